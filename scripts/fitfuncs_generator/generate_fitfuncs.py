@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+"""Generate the fragmented-potential FitFuncs C++ source from a term list.
+
+Usage: generate_fitfuncs.py <terms.json> <output.cpp>
+
+Each polynomial in the input lists its terms as sums of monomials, every
+monomial being a vector of exponents over the polynomial's variables.  The
+generated class evaluates
+
+  * the terms (eval_terms_from_variables) and their derivatives
+    (polynomial_terms_gradient) from a table of shared monomials, where every
+    monomial is built from a previously computed one with a single multiply;
+  * the energy and its gradient with respect to the variables
+    (polynomial_gradient, polynomial_batch) as multivariate Horner schemes
+    over the expanded polynomial, so no power is ever recomputed.
+
+The batched evaluator emits exactly the same expressions as the scalar one,
+inside a "#pragma omp simd" loop over N-mers, once in double and once in
+float precision.
+"""
+
+import json
+import os
+import re
+import sys
+from string import Template
+
+INDENT = " " * 12
+TEMPLATE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "templates")
+
+
+def load_template(name):
+    with open(os.path.join(TEMPLATE_DIR, name)) as f:
+        return Template(f.read())
+
+
+def variable_name(k):
+    return "x%d" % k
+
+
+def monomial_name(exps):
+    """Name of the local holding a monomial, or the literal for degree <= 1."""
+    degree = sum(exps)
+    if degree == 0:
+        return "1"
+    if degree == 1:
+        return variable_name(exps.index(1))
+    return "p_" + "_".join(str(e) for e in exps)
+
+
+def monomial_parent(exps):
+    """Parent in the monomial tree: drop one power of the last variable used."""
+    k = max(i for i, e in enumerate(exps) if e > 0)
+    parent = list(exps)
+    parent[k] -= 1
+    return tuple(parent), k
+
+
+def monomial_table(monomials):
+    """Closes a set of monomials under monomial_parent and returns the
+    statements computing every monomial of degree >= 2, parents first."""
+    needed = set()
+    stack = [tuple(m) for m in monomials]
+    while stack:
+        m = stack.pop()
+        if sum(m) < 2 or m in needed:
+            continue
+        needed.add(m)
+        stack.append(monomial_parent(m)[0])
+
+    statements = []
+    for m in sorted(needed, key=lambda m: (sum(m), m)):
+        parent, k = monomial_parent(m)
+        statements.append("const double %s = %s*%s;"
+                          % (monomial_name(m), monomial_name(parent), variable_name(k)))
+    return statements
+
+
+def scaled(factor, name):
+    if name == "1":
+        return str(factor)
+    if factor == 1:
+        return name
+    return "%d*%s" % (factor, name)
+
+
+def coefficient_sum(items):
+    return " + ".join(scaled(f, "coefficients[%d]" % i) for f, i in items)
+
+
+def horner(items, k, nv):
+    """Multivariate Horner scheme of sum(coef * monomial) in variables k.. nv-1.
+
+    items is a list of (exponent tuple, [(factor, coefficient index), ...]).
+    Returns an expression string whose top level may be a sum.
+    """
+    if k == nv:
+        return coefficient_sum([c for _, coefs in items for c in coefs])
+
+    groups = {}
+    for exps, coefs in items:
+        groups.setdefault(exps[k], []).append((exps, coefs))
+
+    x = variable_name(k)
+    expr = None
+    for d in range(max(groups), -1, -1):
+        if expr is not None:
+            expr = "%s*(%s)" % (x, expr) if "+" in expr else "%s*%s" % (x, expr)
+        if d in groups:
+            q = horner(groups[d], k + 1, nv)
+            expr = q if expr is None else "%s + %s" % (q, expr)
+    return expr
+
+
+def used_variables(expressions, nv):
+    """Variables referenced by the given expressions, in index order."""
+    used = set(int(k) for e in expressions for k in re.findall(r"\bx(\d+)\b", e))
+    return [k for k in range(nv) if k in used]
+
+
+def monomial_variables(monomials, nv):
+    """Variables with a nonzero exponent in any of the monomials."""
+    return [k for k in range(nv) if any(m[k] > 0 for m in monomials)]
+
+
+def switch_constructor(switch):
+    if switch["type"] == "NoSwitchFunction":
+        return "new NoSwitchFunction()"
+    if switch["type"] == "CoarseGrainSwitch":
+        return "new CoarseGrainSwitch(%d, %r, %r)" % (switch["nb"], float(switch["ri"]), float(switch["ro"]))
+    raise ValueError("unknown switch function type '%s'" % switch["type"])
+
+
+def indent(lines, level=INDENT):
+    return "\n".join(level + l if l else "" for l in lines)
+
+
+def generate_polynomial(poly):
+    name = poly["name"]
+    terms = [[tuple(m) for m in term] for term in poly["terms"]]
+    nv = len(poly["variables"])
+    nt = len(terms)
+    for i, term in enumerate(terms):
+        for m in term:
+            if len(m) != nv:
+                raise ValueError("%s: term %d has a monomial over %d variables, expected %d"
+                                 % (name, i, len(m), nv))
+
+    # Energy and gradient as sums of coefficient * monomial.
+    energy = {}
+    gradients = [{} for _ in range(nv)]
+    # d term_i / d v_k as sums of factor * monomial.
+    terms_gradient = [[[] for _ in range(nt)] for _ in range(nv)]
+    for i, term in enumerate(terms):
+        for m in term:
+            energy.setdefault(m, []).append((1, i))
+            for k in range(nv):
+                if m[k] == 0:
+                    continue
+                dm = list(m)
+                dm[k] -= 1
+                dm = tuple(dm)
+                gradients[k].setdefault(dm, []).append((m[k], i))
+                terms_gradient[k][i].append((m[k], dm))
+
+    value_expr = horner(sorted(energy.items()), 0, nv)
+    gradient_exprs = [horner(sorted(g.items()), 0, nv) if g else "0" for g in gradients]
+
+    def variable_loads(variables, source):
+        return ["const double %s = %s;" % (variable_name(k), source % k) for k in variables]
+
+    # Terms and their derivatives are sums over a table of shared monomials.
+    term_monomials = set(m for term in terms for m in term)
+    grad_monomials = set(dm for per_k in terms_gradient for per_i in per_k for _, dm in per_i)
+
+    terms_lines = variable_loads(monomial_variables(term_monomials, nv), "variables[%d]")
+    terms_lines += monomial_table(term_monomials)
+    for i, term in enumerate(terms):
+        terms_lines.append("terms[%d] = %s;" % (i, " + ".join(monomial_name(m) for m in term)))
+
+    tg_lines = variable_loads(monomial_variables(grad_monomials, nv), "variables[%d]")
+    tg_lines += monomial_table(grad_monomials)
+    for k in range(nv):
+        for i in range(nt):
+            if terms_gradient[k][i]:
+                tg_lines.append("grad[%d] = %s;" % (k*nt + i, " + ".join(
+                    scaled(f, monomial_name(dm)) for f, dm in terms_gradient[k][i])))
+
+    gradient_lines = variable_loads(used_variables(gradient_exprs, nv), "variables[%d]")
+    gradient_lines += ["grad[%d] = %s;" % (k, e) for k, e in enumerate(gradient_exprs)]
+
+    def batch_function(real, get_coefficients):
+        """polynomial_batch in the given floating point type."""
+        def typed(lines):
+            return [l.replace("double", real) for l in lines]
+
+        batch_inputs = ["const double* v%d = variables + %d*stride;" % (k, k) for k in range(nv)]
+        batch_outputs = ["double* g%d = grad + %d*stride;" % (k, k) for k in range(nv)]
+        value_lines = variable_loads(used_variables([value_expr], nv), "v%d[j]")
+        value_lines.append("values[j] = %s;" % value_expr)
+        batch_grad_lines = variable_loads(used_variables([value_expr] + gradient_exprs, nv), "v%d[j]")
+        batch_grad_lines.append("values[j] = %s;" % value_expr)
+        batch_grad_lines += ["g%d[j] = %s;" % (k, e) for k, e in enumerate(gradient_exprs)]
+
+        return load_template("PolynomialBatch.in").substitute(
+            real=real,
+            get_coefficients=get_coefficients,
+            batch_inputs=indent(typed(batch_inputs)),
+            batch_value_body=indent(typed(value_lines), INDENT + " " * 8),
+            batch_outputs=indent(typed(batch_outputs)),
+            batch_gradient_body=indent(typed(batch_grad_lines), INDENT + " " * 4))
+
+    return load_template("Polynomial.in").substitute(
+        name=name,
+        num_terms=nt,
+        num_nl_params=poly["num_nl_params"],
+        switch=switch_constructor(poly["switch"]),
+        terms_body=indent(terms_lines),
+        gradient_body=indent(gradient_lines),
+        batch_functions=batch_function("double", "get_coefficients")
+                        + batch_function("float", "get_coefficients_float"),
+        terms_gradient_body=indent(tg_lines),
+        system_ids=indent(["ids.push_back(&%s);" % a for a in poly["atoms"]]),
+        num_atoms=len(poly["atoms"]),
+        nl_param_decls=indent(["int %s = %d;" % (p["name"], p["index"]) for p in poly["nl_params"]]),
+        nl_param_pushes=indent(["indices.push_back(%s);" % v for v in poly["variables"]]))
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("Usage: " + sys.argv[0] + " <terms.json> <output.cpp>")
+        sys.exit(1)
+
+    with open(sys.argv[1]) as f:
+        spec = json.load(f)
+
+    classes = [generate_polynomial(p) for p in spec["polynomials"]]
+    source = load_template("FitFuncs.cpp.in").substitute(
+        input=os.path.basename(sys.argv[1]),
+        atom_ids="\n".join('AtomId %s = AtomId("%s");' % (a, a) for a in spec["atoms"]),
+        classes="\n".join(classes),
+        add_polynomials="\n".join("    polynomials.push_back(new %s());" % p["name"]
+                                  for p in spec["polynomials"]),
+        create_polynomial="\n".join('    if(name == "%s") return new %s();' % (p["name"], p["name"])
+                                     for p in spec["polynomials"]))
+
+    with open(sys.argv[2], "w") as f:
+        f.write(source)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,120 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#include "bblock/cluster_scheduler.h"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @file cluster_scheduler.cpp
+ * @brief Implementation of the load balancing of the cluster search
+ */
+
+namespace bblock {
+
+ClusterScheduler::ClusterScheduler() : bounds_(1, 0) {}
+
+void ClusterScheduler::Plan(const NeighborList &neighbors, size_t n, double cutoff, size_t nthreads,
+                            size_t chunks_per_thread) {
+    const size_t nmon = neighbors.GetNumMonomers();
+    nthreads = std::max(size_t(1), nthreads);
+    const double cutoff2 = cutoff * cutoff;
+
+    // Estimated cost of each root
+    std::vector<double> cost(nmon, 0.0);
+    double total = 0.0;
+    for (size_t i = 0; i < nmon; i++) {
+        const size_t *nb = neighbors.GetNeighbors(i);
+        const double *d2 = neighbors.GetDistances2(i);
+        const size_t nnb = neighbors.GetNumNeighbors(i);
+        size_t d = 0;
+        for (size_t k = std::upper_bound(nb, nb + nnb, i) - nb; k < nnb; k++) {
+            if (d2[k] < cutoff2) d++;
+        }
+        cost[i] = std::pow(1.0 + d, double(n - 1));
+        total += cost[i];
+    }
+
+    // Chunks of roots with similar total cost
+    const size_t nchunks = std::max(size_t(1), std::min(nmon, nthreads * chunks_per_thread));
+    const double target = total / nchunks;
+    bounds_.assign(1, 0);
+    double acc = 0.0;
+    for (size_t i = 0; i < nmon; i++) {
+        acc += cost[i];
+        if (acc >= target && i + 1 < nmon) {
+            bounds_.push_back(i + 1);
+            acc = 0.0;
+        }
+    }
+    if (nmon > 0) bounds_.push_back(nmon);
+
+    // Each thread starts with a contiguous range of chunks
+    const size_t nc = GetNumChunks();
+    next_.resize(nthreads);
+    end_.resize(nthreads);
+    for (size_t t = 0; t < nthreads; t++) {
+        next_[t] = t * nc / nthreads;
+        end_[t] = (t + 1) * nc / nthreads;
+    }
+    locks_.reset(new std::mutex[nthreads]);
+}
+
+bool ClusterScheduler::Next(size_t thread, size_t &chunk) {
+    const size_t nthreads = next_.size();
+
+    // Own queue, from the front
+    {
+        std::lock_guard<std::mutex> guard(locks_[thread]);
+        if (next_[thread] < end_[thread]) {
+            chunk = next_[thread]++;
+            return true;
+        }
+    }
+
+    // Steal from the back of the queues of the other threads
+    for (size_t k = 1; k < nthreads; k++) {
+        const size_t victim = (thread + k) % nthreads;
+        std::lock_guard<std::mutex> guard(locks_[victim]);
+        if (next_[victim] < end_[victim]) {
+            chunk = --end_[victim];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+}  // namespace bblock
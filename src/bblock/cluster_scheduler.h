@@ -0,0 +1,129 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#ifndef BBLOCK_CLUSTER_SCHEDULER_H
+#define BBLOCK_CLUSTER_SCHEDULER_H
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+
+#include "bblock/neighbor_list.h"
+
+/**
+ * @file cluster_scheduler.h
+ * @brief Load balancing of the parallel search of clusters
+ */
+
+namespace bblock {
+
+/**
+ * @brief Splits the root monomers of a cluster search in chunks of
+ * similar cost and hands them to the threads, with work stealing.
+ *
+ * The cost of a root is estimated as (1 + d)^(n-1), where d is the
+ * number of neighbors with larger index within the cutoff, which is the
+ * order of the number of clusters of size n that have to be visited.
+ * Each thread starts with a contiguous range of chunks. Once it has
+ * processed its own chunks, it takes the last chunks of the other threads.
+ */
+class ClusterScheduler {
+   public:
+    /**
+     * Default constructor. Creates a scheduler without chunks.
+     */
+    ClusterScheduler();
+
+    /**
+     * @brief Splits the roots in chunks and assigns them to the threads
+     * @param[in] neighbors Neighbor list of the monomers
+     * @param[in] n Size of the clusters
+     * @param[in] cutoff Cutoff of the clusters
+     * @param[in] nthreads Number of threads
+     * @param[in] chunks_per_thread Number of chunks per thread. More
+     * chunks give a finer balance at the price of more scheduling.
+     */
+    void Plan(const NeighborList &neighbors, size_t n, double cutoff, size_t nthreads, size_t chunks_per_thread = 8);
+
+    /**
+     * @return Number of chunks
+     */
+    size_t GetNumChunks() const { return bounds_.size() - 1; }
+
+    /**
+     * @brief Gets the roots of a chunk
+     * @param[in] chunk Chunk index
+     * @param[out] istart First root of the chunk
+     * @param[out] iend Last root of the chunk (not included)
+     */
+    void GetChunk(size_t chunk, size_t &istart, size_t &iend) const {
+        istart = bounds_[chunk];
+        iend = bounds_[chunk + 1];
+    }
+
+    /**
+     * @brief Gets the next chunk to be processed by a thread.
+     * Can be called concurrently by all the threads.
+     * @param[in] thread Thread number, smaller than the nthreads given to Plan
+     * @param[out] chunk Chunk to process
+     * @return False if there are no chunks left
+     */
+    bool Next(size_t thread, size_t &chunk);
+
+   private:
+    /**
+     * Chunk c contains the roots in [bounds_[c], bounds_[c+1])
+     */
+    std::vector<size_t> bounds_;
+
+    /**
+     * Next chunk of the queue of each thread
+     */
+    std::vector<size_t> next_;
+
+    /**
+     * End of the queue of each thread (not included)
+     */
+    std::vector<size_t> end_;
+
+    /**
+     * Lock of the queue of each thread
+     */
+    std::unique_ptr<std::mutex[]> locks_;
+};
+
+}  // namespace bblock
+
+#endif  // BBLOCK_CLUSTER_SCHEDULER_H
@@ -0,0 +1,90 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#include "bblock/kernel_registry.h"
+
+#include "potential/2b/energy2b.h"
+#include "potential/3b/energy3b.h"
+#include "potential/4b/energy4b.h"
+#include "tools/custom_exceptions.h"
+
+/**
+ * @file kernel_registry.cpp
+ * @brief Implementation of the dispatch table of the N-body kernels
+ */
+
+namespace bblock {
+
+KernelRegistry::KernelRegistry() : kernels_(5) {}
+
+void KernelRegistry::Initialize(const std::vector<std::string> &types) {
+    types_ = types;
+    kernels_.assign(5, std::unordered_map<size_t, NMerKernel>());
+}
+
+const NMerKernel &KernelRegistry::GetKernel(size_t nb, const size_t *types) {
+    if (nb < 2 || nb > 4) {
+        std::string text = "N-mers of " + std::to_string(nb) + " monomers are not supported.";
+        throw CUException(__func__, __FILE__, __LINE__, text);
+    }
+
+    size_t key = 0;
+    for (size_t k = 0; k < nb; k++) key = key * types_.size() + types[k];
+
+    std::unordered_map<size_t, NMerKernel>::iterator it = kernels_[nb].find(key);
+    if (it != kernels_[nb].end()) return it->second;
+
+    // First time this tuple is requested. Resolve it.
+    std::string mon[4];
+    for (size_t k = 0; k < nb; k++) mon[k] = types_[types[k]];
+
+    NMerKernel &entry = kernels_[nb][key];
+    nbody::GetCanonicalOrder(nb, mon, entry.perm);
+    for (size_t k = 0; k < nb; k++) entry.mon[k] = mon[entry.perm[k]];
+
+    if (nb == 2) {
+        entry.kernel = e2b::get_2b_kernel(entry.mon);
+        entry.support = e2b::get_2b_support(entry.mon);
+    } else if (nb == 3) {
+        entry.kernel = e3b::get_3b_kernel(entry.mon);
+        entry.support = e3b::get_3b_support(entry.mon);
+    } else {
+        entry.kernel = e4b::get_4b_kernel(entry.mon);
+        entry.support = e4b::get_4b_support(entry.mon);
+    }
+
+    return entry;
+}
+
+}  // namespace bblock
@@ -0,0 +1,134 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#ifndef BBLOCK_KERNEL_REGISTRY_H
+#define BBLOCK_KERNEL_REGISTRY_H
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <cstddef>
+
+#include "potential/nbody_kernel.h"
+
+/**
+ * @file kernel_registry.h
+ * @brief Integer monomer types and dispatch table of the N-body kernels
+ */
+
+namespace bblock {
+
+/**
+ * @brief How an N-mer of given monomer types is evaluated
+ */
+struct NMerKernel {
+    /**
+     * Kernel of the N-mer, or 0 if there is no polynomial for it
+     */
+    nbody::Kernel kernel;
+
+    /**
+     * perm[k] is the position in the N-mer of the k-th monomer
+     * in the canonical order of the kernel
+     */
+    size_t perm[4];
+
+    /**
+     * Monomer ids in canonical order
+     */
+    std::string mon[4];
+
+    /**
+     * Region of the N-mers where the kernel can be nonzero
+     */
+    nbody::Support support;
+};
+
+/**
+ * @brief Table that interns the monomer ids into integer types and
+ * resolves each tuple of types to its N-body kernel.
+ *
+ * Each tuple of types is resolved only once, the first time it is
+ * requested, so the ids are not compared in the energy evaluation.
+ */
+class KernelRegistry {
+   public:
+    /**
+     * Default constructor. Creates an empty registry.
+     */
+    KernelRegistry();
+
+    /**
+     * @brief Sets the monomer types and clears the resolved kernels
+     * @param[in] types Monomer ids. The type of types[i] is i.
+     */
+    void Initialize(const std::vector<std::string> &types);
+
+    /**
+     * @return Number of monomer types
+     */
+    size_t GetNumTypes() const { return types_.size(); }
+
+    /**
+     * @param[in] type Monomer type
+     * @return Monomer id of the type
+     */
+    const std::string &GetTypeName(size_t type) const { return types_[type]; }
+
+    /**
+     * @brief Gets the kernel of an N-mer.
+     *
+     * Not thread safe. Kernels must be resolved outside parallel regions.
+     * @param[in] nb Number of monomers of the N-mer (2, 3 or 4)
+     * @param[in] types Types of the monomers of the N-mer, in the
+     * order of the N-mer
+     * @return Kernel of the N-mer, with its canonical order
+     */
+    const NMerKernel &GetKernel(size_t nb, const size_t *types);
+
+   private:
+    /**
+     * Monomer ids of each type
+     */
+    std::vector<std::string> types_;
+
+    /**
+     * Resolved kernels of each N-mer size, indexed by the tuple of types
+     */
+    std::vector<std::unordered_map<size_t, NMerKernel>> kernels_;
+};
+
+}  // namespace bblock
+
+#endif  // BBLOCK_KERNEL_REGISTRY_H
@@ -0,0 +1,143 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#include "bblock/monomer_type_table.h"
+
+#include "bblock/sys_tools.h"
+#include "potential/dispersion/disptools.h"
+
+/**
+ * @file monomer_type_table.cpp
+ * @brief Compilation of the per monomer type parameters
+ */
+
+namespace bblock {
+
+MonomerTypeTable::MonomerTypeTable() {}
+
+void MonomerTypeTable::Compile(const std::vector<std::string> &ids, const std::vector<size_t> &nsites,
+                               const nlohmann::json &mon_j) {
+    types_.assign(ids.size(), MonomerType());
+
+    for (size_t t = 0; t < ids.size(); t++) {
+        MonomerType &type = types_[t];
+        type.id = ids[t];
+        type.nsites = nsites[t];
+        type.charge_model = FIXED_CHARGES;
+        type.vsite_model = NO_VSITES;
+
+        excluded_set_type exc12, exc13, exc14;
+        systools::GetExcluded(type.id, mon_j, exc12, exc13, exc14);
+
+        // Excluded pairs may involve virtual sites, which are not there
+        // if the type only has its real atoms
+        type.excluded.assign(type.nsites * type.nsites, 0);
+        const excluded_set_type *exc[3] = {&exc12, &exc13, &exc14};
+        const unsigned char bit[3] = {EXCLUDED_12, EXCLUDED_13, EXCLUDED_14};
+        for (size_t k = 0; k < 3; k++) {
+            for (auto it = exc[k]->begin(); it != exc[k]->end(); it++) {
+                size_t i = it->first;
+                size_t j = it->second;
+                if (i >= type.nsites || j >= type.nsites) continue;
+                type.excluded[i * type.nsites + j] |= bit[k];
+                type.excluded[j * type.nsites + i] |= bit[k];
+            }
+        }
+    }
+}
+
+void MonomerTypeTable::CompileSiteProperties(const nlohmann::json &mon_j) {
+    for (size_t t = 0; t < types_.size(); t++) {
+        MonomerType &type = types_[t];
+        size_t ns = type.nsites;
+
+        // One monomer of the type, starting at site 0
+        type.pol.assign(ns, 0.0);
+        type.polfac.assign(ns, 0.0);
+        type.charges.assign(ns, 0.0);
+        systools::SetPol(type.pol, type.id, 1, ns, 0, mon_j);
+        systools::SetPolfac(type.polfac, type.id, 1, ns, 0, mon_j);
+
+        // Charges in the json take precedence over the dipole moment surface
+        bool json_charges = false;
+        try {
+            std::vector<double> chg = mon_j.at(type.id).at("charges");
+            json_charges = true;
+        } catch (...) {
+        }
+
+        if (type.id == "h2o" && !json_charges) {
+            type.charge_model = WATER_DMS_CHARGES;
+        } else {
+            std::vector<double> xyz(3 * ns, 0.0);
+            std::vector<double> chg_der;
+            systools::SetCharges(xyz, type.charges, type.id, 1, ns, 0, chg_der, mon_j);
+        }
+
+        if (type.id == "h2o") type.vsite_model = WATER_MSITE;
+    }
+}
+
+DispersionTable::DispersionTable() : ntypes_(0) {}
+
+void DispersionTable::Compile(const MonomerTypeTable &types, const std::vector<size_t> &natoms,
+                              const std::vector<std::pair<std::string, std::string>> &ignore_disp,
+                              const nlohmann::json &repdisp_j) {
+    ntypes_ = types.GetNumTypes();
+    has_disp_.assign(ntypes_ * ntypes_, 0);
+    c6_.assign(ntypes_ * ntypes_, std::vector<double>());
+    d6_.assign(ntypes_ * ntypes_, std::vector<double>());
+
+    for (size_t t1 = 0; t1 < ntypes_; t1++) {
+        for (size_t t2 = 0; t2 < ntypes_; t2++) {
+            const std::string &id1 = types.GetType(t1).id;
+            const std::string &id2 = types.GetType(t2).id;
+            size_t k = t1 * ntypes_ + t2;
+
+            double c6, d6;
+            has_disp_[k] = disp::GetC6(id1, id2, 0, 0, c6, d6, ignore_disp, repdisp_j);
+
+            c6_[k].assign(natoms[t1] * natoms[t2], 0.0);
+            d6_[k].assign(natoms[t1] * natoms[t2], 0.0);
+            for (size_t i = 0; i < natoms[t1]; i++) {
+                for (size_t j = 0; j < natoms[t2]; j++) {
+                    disp::GetC6(id1, id2, i, j, c6_[k][i * natoms[t2] + j], d6_[k][i * natoms[t2] + j], ignore_disp,
+                                repdisp_j);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace bblock
@@ -0,0 +1,265 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#ifndef BBLOCK_MONOMER_TYPE_TABLE_H
+#define BBLOCK_MONOMER_TYPE_TABLE_H
+
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstddef>
+
+#include "json/json.h"
+
+/**
+ * @file monomer_type_table.h
+ * @brief Per monomer type parameters, resolved once from the monomer
+ * and dispersion json objects
+ */
+
+namespace bblock {
+
+/**
+ * Bits of the exclusion mask of a pair of sites of the same monomer
+ */
+enum { EXCLUDED_12 = 1, EXCLUDED_13 = 2, EXCLUDED_14 = 4 };
+
+/**
+ * @brief How the charges of the sites of a monomer type are set
+ */
+enum ChargeModel {
+    /**
+     * All monomers of the type have the same charges
+     */
+    FIXED_CHARGES = 0,
+    /**
+     * The charges depend on the geometry, and are given by the
+     * dipole moment surface of water
+     */
+    WATER_DMS_CHARGES
+};
+
+/**
+ * @brief How the virtual sites of a monomer type are placed
+ */
+enum VSiteModel {
+    /**
+     * The monomer type has no virtual sites
+     */
+    NO_VSITES = 0,
+    /**
+     * M-site of water, on the bisector of the HOH angle
+     */
+    WATER_MSITE
+};
+
+/**
+ * @brief Parameters of one monomer type
+ */
+struct MonomerType {
+    /**
+     * Monomer id (h2o, co2...)
+     */
+    std::string id;
+
+    /**
+     * Number of sites of the type
+     */
+    size_t nsites;
+
+    /**
+     * Exclusion mask of each pair of sites, nsites x nsites and symmetric.
+     * excluded[i * nsites + j] is a combination of EXCLUDED_12, EXCLUDED_13
+     * and EXCLUDED_14.
+     */
+    std::vector<unsigned char> excluded;
+
+    /**
+     * Polarizability of each site. Only set by CompileSiteProperties.
+     */
+    std::vector<double> pol;
+
+    /**
+     * Polarizability factor of each site. Only set by CompileSiteProperties.
+     */
+    std::vector<double> polfac;
+
+    /**
+     * Charge of each site, if charge_model is FIXED_CHARGES.
+     * Only set by CompileSiteProperties.
+     */
+    std::vector<double> charges;
+
+    /**
+     * How the charges are set
+     */
+    ChargeModel charge_model;
+
+    /**
+     * How the virtual sites are placed
+     */
+    VSiteModel vsite_model;
+};
+
+/**
+ * @brief Table with the parameters of each monomer type.
+ *
+ * The parameters are looked up by monomer id in the json objects and in
+ * the built-in tables of systools and disp. These lookups compare strings
+ * and copy the json objects, so they are done once, when the table is
+ * compiled, and the energy evaluation only reads arrays indexed by the
+ * integer type of the monomers.
+ *
+ * A System compiles one table and shares it with the terms it runs (see
+ * the SetMonomerTypes of each term). A term used on its own compiles
+ * its own table.
+ */
+class MonomerTypeTable {
+   public:
+    /**
+     * Default constructor. Creates an empty table.
+     */
+    MonomerTypeTable();
+
+    /**
+     * @brief Sets the monomer types and their exclusions.
+     *
+     * Clears the site properties.
+     * @param[in] ids Monomer ids. The type of ids[i] is i.
+     * @param[in] nsites Number of sites of each type. It can be the number
+     * of real atoms for the terms that only use those.
+     * @param[in] mon_j Json object with the user-defined monomer properties
+     */
+    void Compile(const std::vector<std::string> &ids, const std::vector<size_t> &nsites, const nlohmann::json &mon_j);
+
+    /**
+     * @brief Sets the polarizabilities, polarizability factors, charges
+     * and virtual site models of the types.
+     *
+     * The number of sites of each type must include the virtual sites.
+     * @param[in] mon_j Json object with the user-defined monomer properties
+     */
+    void CompileSiteProperties(const nlohmann::json &mon_j);
+
+    /**
+     * @return Number of monomer types
+     */
+    size_t GetNumTypes() const { return types_.size(); }
+
+    /**
+     * @param[in] type Monomer type
+     * @return Parameters of the type
+     */
+    const MonomerType &GetType(size_t type) const { return types_[type]; }
+
+    /**
+     * @param[in] type Monomer type
+     * @param[in] i,j Sites of the monomer
+     * @return Exclusion mask of the pair of sites
+     */
+    unsigned char GetExclusion(size_t type, size_t i, size_t j) const {
+        return types_[type].excluded[i * types_[type].nsites + j];
+    }
+
+   private:
+    /**
+     * Parameters of each type
+     */
+    std::vector<MonomerType> types_;
+};
+
+/**
+ * @brief Dispersion parameters of each pair of monomer types.
+ *
+ * They depend on the pairs of monomers without dispersion, which the
+ * dispersion term can change between calls, so they are kept apart from
+ * the MonomerTypeTable, which may be shared.
+ */
+class DispersionTable {
+   public:
+    /**
+     * Default constructor. Creates an empty table.
+     */
+    DispersionTable();
+
+    /**
+     * @brief Sets the C6 and d6 of each pair of atoms of each pair of types
+     * @param[in] types Monomer types
+     * @param[in] natoms Number of atoms of each type
+     * @param[in] ignore_disp Pairs of monomer ids without dispersion
+     * @param[in] repdisp_j Json object with the user-defined dispersion parameters
+     */
+    void Compile(const MonomerTypeTable &types, const std::vector<size_t> &natoms,
+                 const std::vector<std::pair<std::string, std::string>> &ignore_disp, const nlohmann::json &repdisp_j);
+
+    /**
+     * @param[in] type1,type2 Monomer types
+     * @return False if dispersion between the two types is ignored or
+     * not defined
+     */
+    bool HasDispersion(size_t type1, size_t type2) const { return has_disp_[type1 * ntypes_ + type2]; }
+
+    /**
+     * @param[in] type1,type2 Monomer types
+     * @return C6 of each pair of atoms, natoms1 x natoms2, row major
+     */
+    const double *GetC6(size_t type1, size_t type2) const { return c6_[type1 * ntypes_ + type2].data(); }
+
+    /**
+     * @param[in] type1,type2 Monomer types
+     * @return d6 of each pair of atoms, natoms1 x natoms2, row major
+     */
+    const double *GetD6(size_t type1, size_t type2) const { return d6_[type1 * ntypes_ + type2].data(); }
+
+   private:
+    /**
+     * Number of monomer types
+     */
+    size_t ntypes_;
+
+    /**
+     * Dispersion flag of each pair of types, ntypes x ntypes
+     */
+    std::vector<char> has_disp_;
+
+    /**
+     * C6 and d6 matrices of each pair of types, ntypes x ntypes
+     */
+    std::vector<std::vector<double>> c6_;
+    std::vector<std::vector<double>> d6_;
+};
+
+}  // namespace bblock
+
+#endif  // BBLOCK_MONOMER_TYPE_TABLE_H
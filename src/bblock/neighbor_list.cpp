@@ -0,0 +1,412 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#include "bblock/neighbor_list.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "kdtree/nanoflann.hpp"
+#include "kdtree/kdtree_utils.h"
+
+/**
+ * @file neighbor_list.cpp
+ * @brief Implementation of the monomer neighbor list
+ */
+
+namespace bblock {
+
+NeighborList::NeighborList() : nmon_(0), cutoff_(0.0), skin_(0.0), use_pbc_(false), build_count_(0) {
+    offsets_.push_back(0);
+}
+
+void NeighborList::Clear() {
+    nmon_ = 0;
+    cutoff_ = 0.0;
+    skin_ = 0.0;
+    use_pbc_ = false;
+    box_.clear();
+    ref_xyz_.clear();
+    cur_xyz_.clear();
+    offsets_.assign(1, 0);
+    neighbors_.clear();
+    dist2_.clear();
+    build_dist2_.clear();
+    shifts_.clear();
+}
+
+bool NeighborList::IsValid(const std::vector<double> &xyz, const std::vector<size_t> &first_index, size_t nmon,
+                           double cutoff, double skin, bool use_pbc, const std::vector<double> &box) const {
+    if (nmon != nmon_ || cutoff > cutoff_ || skin != skin_ || use_pbc != use_pbc_) return false;
+    if (use_pbc && box != box_) return false;
+
+    // Maximum displacement allowed since the build
+    const double max_disp2 = 0.25 * skin_ * skin_;
+
+    for (size_t i = 0; i < nmon; i++) {
+        const double *xi = xyz.data() + 3 * first_index[i];
+        const double dx = xi[0] - ref_xyz_[3 * i];
+        const double dy = xi[1] - ref_xyz_[3 * i + 1];
+        const double dz = xi[2] - ref_xyz_[3 * i + 2];
+        if (skin_ == 0.0) {
+            if (dx != 0.0 || dy != 0.0 || dz != 0.0) return false;
+        } else if (dx * dx + dy * dy + dz * dz > max_disp2) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void NeighborList::Refresh(const std::vector<double> &xyz, const std::vector<size_t> &first_index) {
+    // Nothing to do if the monomers did not move since the last refresh
+    bool moved = false;
+    for (size_t i = 0; i < nmon_ && !moved; i++) {
+        const double *xi = xyz.data() + 3 * first_index[i];
+        moved = xi[0] != cur_xyz_[3 * i] || xi[1] != cur_xyz_[3 * i + 1] || xi[2] != cur_xyz_[3 * i + 2];
+    }
+    if (!moved) return;
+
+    for (size_t i = 0; i < nmon_; i++) {
+        for (size_t k = 0; k < 3; k++) cur_xyz_[3 * i + k] = xyz[3 * first_index[i] + k];
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t i = 0; i < nmon_; i++) {
+        const double *xi = cur_xyz_.data() + 3 * i;
+        for (size_t p = offsets_[i]; p < offsets_[i + 1]; p++) {
+            const double *xj = cur_xyz_.data() + 3 * neighbors_[p];
+            const double *t = shifts_.data() + 3 * p;
+            const double dx = xj[0] - xi[0] + t[0];
+            const double dy = xj[1] - xi[1] + t[1];
+            const double dz = xj[2] - xi[2] + t[2];
+            dist2_[p] = dx * dx + dy * dy + dz * dz;
+        }
+    }
+}
+
+void NeighborList::Build(const std::vector<double> &xyz, const std::vector<size_t> &first_index, size_t nmon,
+                         double cutoff, double skin, bool use_pbc, const std::vector<double> &box,
+                         const std::vector<double> &box_inverse) {
+    nmon_ = nmon;
+    cutoff_ = cutoff;
+    skin_ = skin;
+    use_pbc_ = use_pbc;
+    box_ = box;
+    build_count_++;
+
+    // Positions of the first atom of each monomer
+    ref_xyz_.resize(3 * nmon);
+    for (size_t i = 0; i < nmon; i++) {
+        for (size_t k = 0; k < 3; k++) ref_xyz_[3 * i + k] = xyz[3 * first_index[i] + k];
+    }
+    cur_xyz_ = ref_xyz_;
+
+    std::vector<std::vector<Neighbor>> rows(nmon);
+    if (use_pbc) {
+        FindNeighborsCells(cutoff + skin, box, box_inverse, rows);
+    } else {
+        FindNeighborsTree(cutoff + skin, rows);
+    }
+
+    // Sort by index, and keep only the closest image of each neighbor
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (size_t i = 0; i < nmon; i++) {
+        std::vector<Neighbor> &row = rows[i];
+        std::sort(row.begin(), row.end());
+        row.erase(std::unique(row.begin(), row.end(),
+                              [](const Neighbor &a, const Neighbor &b) { return a.index == b.index; }),
+                  row.end());
+    }
+
+    // Compress the rows
+    offsets_.resize(nmon + 1);
+    offsets_[0] = 0;
+    for (size_t i = 0; i < nmon; i++) offsets_[i + 1] = offsets_[i] + rows[i].size();
+
+    neighbors_.resize(offsets_[nmon]);
+    dist2_.resize(offsets_[nmon]);
+    shifts_.resize(3 * offsets_[nmon]);
+    for (size_t i = 0; i < nmon; i++) {
+        for (size_t j = 0; j < rows[i].size(); j++) {
+            size_t p = offsets_[i] + j;
+            neighbors_[p] = rows[i][j].index;
+            dist2_[p] = rows[i][j].dist2;
+            for (size_t k = 0; k < 3; k++) shifts_[3 * p + k] = rows[i][j].shift[k];
+        }
+    }
+    build_dist2_ = dist2_;
+}
+
+double NeighborList::GetDistance2(size_t i, size_t j) const {
+    const size_t *first = GetNeighbors(i);
+    const size_t *last = first + GetNumNeighbors(i);
+    const size_t *it = std::lower_bound(first, last, j);
+    if (it == last || *it != j) return -1.0;
+    return dist2_[offsets_[i] + (it - first)];
+}
+
+void NeighborList::FindNeighborsTree(double cutoff, std::vector<std::vector<Neighbor>> &rows) const {
+    typedef nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Simple_Adaptor<double, kdtutils::PointCloud<double>>,
+                                                kdtutils::PointCloud<double>, 3 /* dim */>
+        my_kd_tree_t;
+
+    // One single tree for the whole system
+    std::vector<double> empty;
+    kdtutils::PointCloud<double> ptc = kdtutils::XyzToCloud(ref_xyz_, false, empty, empty);
+    my_kd_tree_t index(3 /*dim*/, ptc, nanoflann::KDTreeSingleIndexAdaptorParams(10 /* max leaf */));
+    index.buildIndex();
+
+    const double cutoff2 = cutoff * cutoff;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (size_t i = 0; i < nmon_; i++) {
+        double point[3] = {ptc.pts[i].x, ptc.pts[i].y, ptc.pts[i].z};
+        std::vector<std::pair<size_t, double>> ret_matches;
+        nanoflann::SearchParams params;
+        const size_t nMatches = index.radiusSearch(point, cutoff2, ret_matches, params);
+
+        std::vector<Neighbor> &row = rows[i];
+        row.reserve(nMatches);
+        for (size_t j = 0; j < nMatches; j++) {
+            if (ret_matches[j].first == i) continue;
+            Neighbor nb = {ret_matches[j].first, ret_matches[j].second, {0.0, 0.0, 0.0}};
+            row.push_back(nb);
+        }
+    }
+}
+
+void NeighborList::FindNeighborsCells(double cutoff, const std::vector<double> &box,
+                                      const std::vector<double> &box_inverse,
+                                      std::vector<std::vector<Neighbor>> &rows) const {
+    // Fractional coordinates, wrapped into [0,1)
+    std::vector<double> frac(3 * nmon_);
+    for (size_t i = 0; i < nmon_; i++) {
+        const double *r = ref_xyz_.data() + 3 * i;
+        for (size_t k = 0; k < 3; k++) {
+            double s = box_inverse[k] * r[0] + box_inverse[3 + k] * r[1] + box_inverse[6 + k] * r[2];
+            s -= std::floor(s);
+            if (s >= 1.0) s = 0.0;
+            frac[3 * i + k] = s;
+        }
+    }
+
+    // Number of cells along each box vector. The distance between the two
+    // faces of the box perpendicular to the reciprocal vector k is 1/|g_k|,
+    // so if each cell is at least one cutoff wide, the minimum image of any
+    // neighbor is in one of the 27 cells around the cell of the monomer.
+    // This holds for orthorhombic and triclinic boxes.
+    size_t ncell[3];
+    for (size_t k = 0; k < 3; k++) {
+        double g2 = box_inverse[k] * box_inverse[k] + box_inverse[3 + k] * box_inverse[3 + k] +
+                    box_inverse[6 + k] * box_inverse[6 + k];
+        double width = 1.0 / std::sqrt(g2);
+        ncell[k] = std::max(size_t(1), size_t(width / cutoff));
+    }
+
+    // Avoid having many more cells than monomers when the cutoff is small
+    while (ncell[0] * ncell[1] * ncell[2] > 8 * nmon_ + 27) {
+        size_t kmax = 0;
+        for (size_t k = 1; k < 3; k++)
+            if (ncell[k] > ncell[kmax]) kmax = k;
+        ncell[kmax] = std::max(size_t(1), ncell[kmax] / 2);
+    }
+
+    const size_t ntotcells = ncell[0] * ncell[1] * ncell[2];
+
+    // Bin the monomers in the cells (CSR)
+    std::vector<size_t> cell_of(nmon_);
+    std::vector<size_t> cell_start(ntotcells + 1, 0);
+    for (size_t i = 0; i < nmon_; i++) {
+        size_t c[3];
+        for (size_t k = 0; k < 3; k++) c[k] = std::min(ncell[k] - 1, size_t(frac[3 * i + k] * ncell[k]));
+        cell_of[i] = (c[0] * ncell[1] + c[1]) * ncell[2] + c[2];
+        cell_start[cell_of[i] + 1]++;
+    }
+    for (size_t c = 0; c < ntotcells; c++) cell_start[c + 1] += cell_start[c];
+
+    std::vector<size_t> cell_mon(nmon_);
+    std::vector<size_t> fill(cell_start.begin(), cell_start.end() - 1);
+    for (size_t i = 0; i < nmon_; i++) cell_mon[fill[cell_of[i]]++] = i;
+
+    const double cutoff2 = cutoff * cutoff;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (size_t i = 0; i < nmon_; i++) {
+        const double *si = frac.data() + 3 * i;
+        const double *ri = ref_xyz_.data() + 3 * i;
+        const long ci[3] = {long(cell_of[i] / (ncell[1] * ncell[2])), long((cell_of[i] / ncell[2]) % ncell[1]),
+                            long(cell_of[i] % ncell[2])};
+
+        std::vector<Neighbor> &row = rows[i];
+
+        // Loop over the 27 neighboring cells. The image of the cell is
+        // tracked explicitly, so that small boxes (1 or 2 cells along a
+        // direction) visit every image only once.
+        for (long da = -1; da <= 1; da++) {
+            for (long db = -1; db <= 1; db++) {
+                for (long dc = -1; dc <= 1; dc++) {
+                    const long d[3] = {da, db, dc};
+                    long cj[3];
+                    double shift[3];
+                    for (size_t k = 0; k < 3; k++) {
+                        long c = ci[k] + d[k];
+                        long n = long(ncell[k]);
+                        shift[k] = 0.0;
+                        if (c < 0) {
+                            c += n;
+                            shift[k] = -1.0;
+                        } else if (c >= n) {
+                            c -= n;
+                            shift[k] = 1.0;
+                        }
+                        cj[k] = c;
+                    }
+
+                    size_t cell = (cj[0] * ncell[1] + cj[1]) * ncell[2] + cj[2];
+                    for (size_t p = cell_start[cell]; p < cell_start[cell + 1]; p++) {
+                        size_t j = cell_mon[p];
+                        if (j == i) continue;
+
+                        // Displacement in fractional coordinates, then in cartesian
+                        const double *sj = frac.data() + 3 * j;
+                        double ds0 = sj[0] + shift[0] - si[0];
+                        double ds1 = sj[1] + shift[1] - si[1];
+                        double ds2 = sj[2] + shift[2] - si[2];
+                        double dx = box[0] * ds0 + box[3] * ds1 + box[6] * ds2;
+                        double dy = box[1] * ds0 + box[4] * ds1 + box[7] * ds2;
+                        double dz = box[2] * ds0 + box[5] * ds1 + box[8] * ds2;
+                        double d2 = dx * dx + dy * dy + dz * dz;
+
+                        if (d2 < cutoff2) {
+                            // Lattice translation between the (unwrapped) monomers
+                            // and the image found
+                            const double *rj = ref_xyz_.data() + 3 * j;
+                            Neighbor nb = {j, d2, {dx - (rj[0] - ri[0]), dy - (rj[1] - ri[1]), dz - (rj[2] - ri[2])}};
+                            row.push_back(nb);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void NeighborList::GetClusters(size_t n, double cutoff, size_t root, const std::vector<size_t> &is_local,
+                               bool use_ghost, std::vector<size_t> &clusters, bool build_distances) const {
+    SubgraphEnumerator enumerator;
+    GetClusters(n, cutoff, root, is_local, use_ghost, enumerator, clusters, build_distances);
+}
+
+void NeighborList::GetClusters(size_t n, double cutoff, size_t root, const std::vector<size_t> &is_local,
+                               bool use_ghost, SubgraphEnumerator &enumerator, std::vector<size_t> &clusters,
+                               bool build_distances) const {
+    AppendCluster sink(clusters, n);
+    EnumerateClusters(n, cutoff, root, is_local, use_ghost, build_distances, enumerator, sink);
+}
+
+void NeighborList::GetAllClusters(size_t nmax, const double *cutoffs, size_t root, const std::vector<size_t> &is_local,
+                                  bool use_ghost, SubgraphEnumerator &enumerator,
+                                  std::vector<size_t> *clusters) const {
+    AppendClusterBySize sink = {clusters};
+    EnumerateAllClusters(nmax, cutoffs, root, is_local, use_ghost, enumerator, sink);
+}
+
+ClusterList::ClusterList() : n_(0), cutoff_(0.0), use_ghost_(false), build_(0) {}
+
+void ClusterList::Reset(size_t nmon, size_t n, double cutoff, bool use_ghost, size_t build) {
+    n_ = n;
+    cutoff_ = cutoff;
+    use_ghost_ = use_ghost;
+    build_ = build;
+    clusters_.assign(nmon, std::vector<size_t>());
+    enumerated_.assign(nmon, 0);
+}
+
+bool ClusterList::IsValid(size_t n, double cutoff, bool use_ghost, size_t build) const {
+    return build_ != 0 && n == n_ && cutoff == cutoff_ && use_ghost == use_ghost_ && build == build_;
+}
+
+void ClusterList::GetClusters(const NeighborList &neighbors, size_t root, const std::vector<size_t> &is_local,
+                              SubgraphEnumerator &enumerator, std::vector<size_t> &clusters) {
+    // Enumerate once per build, with the distances of the build. Any cluster
+    // connected at the cutoff now was connected at cutoff + skin then, since
+    // no monomer has moved more than skin/2.
+    if (!enumerated_[root]) {
+        neighbors.GetClusters(n_, cutoff_ + neighbors.GetSkin(), root, is_local, use_ghost_, enumerator,
+                              clusters_[root], true);
+        enumerated_[root] = 1;
+    }
+
+    // Keep the clusters that are connected at the exact cutoff
+    const double cutoff2 = cutoff_ * cutoff_;
+    const std::vector<size_t> &cached = clusters_[root];
+    for (size_t c = 0; c < cached.size(); c += n_) {
+        const size_t *mon = cached.data() + c;
+
+        // Adjacency of the cluster as bit masks
+        unsigned int adj[4] = {0, 0, 0, 0};
+        for (size_t a = 0; a < n_; a++) {
+            for (size_t b = a + 1; b < n_; b++) {
+                double d2 = neighbors.GetDistance2(mon[a], mon[b]);
+                if (d2 >= 0.0 && d2 < cutoff2) {
+                    adj[a] |= 1u << b;
+                    adj[b] |= 1u << a;
+                }
+            }
+        }
+
+        // Connected if all the monomers are reachable from the first one
+        unsigned int reached = 1u;
+        unsigned int previous = 0u;
+        while (reached != previous) {
+            previous = reached;
+            for (size_t a = 0; a < n_; a++)
+                if (reached & (1u << a)) reached |= adj[a];
+        }
+
+        if (reached == (1u << n_) - 1) clusters.insert(clusters.end(), mon, mon + n_);
+    }
+}
+
+}  // namespace bblock
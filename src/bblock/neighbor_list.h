@@ -0,0 +1,644 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#ifndef BBLOCK_NEIGHBOR_LIST_H
+#define BBLOCK_NEIGHBOR_LIST_H
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+
+#include "bblock/subgraph_enumerator.h"
+
+/**
+ * @file neighbor_list.h
+ * @brief Monomer neighbor list shared by all the N-body terms
+ */
+
+namespace bblock {
+
+/**
+ * @brief Neighbor list of monomers, in compressed sparse row format.
+ *
+ * Two monomers are neighbors if the distance between their first atoms
+ * (minimum image if PBC are used) is smaller than the cutoff of the list.
+ * The list is built once for a set of coordinates and is then shared,
+ * read-only, by all threads and by all the N-body terms. Each term filters
+ * the stored distances with its own cutoff, which must be smaller or equal
+ * than the cutoff used to build the list.
+ *
+ * The list can be built with a skin (Verlet list). Pairs are then searched
+ * up to cutoff + skin, and the list remains valid until one monomer has
+ * moved more than skin/2 since the build. In the meantime, Refresh updates
+ * the distances of the stored pairs to the current coordinates.
+ */
+class NeighborList {
+   public:
+    /**
+     * Default constructor. Creates an empty list.
+     */
+    NeighborList();
+
+    /**
+     * @brief Builds the neighbor list.
+     *
+     * @param[in] xyz Coordinates of all the sites of the system
+     * @param[in] first_index First index of each monomer in the site list
+     * @param[in] nmon Number of monomers
+     * @param[in] cutoff Cutoff of the list
+     * @param[in] skin Extra distance added to the cutoff in the search
+     * @param[in] use_pbc Boolean that states if we are in PBC or not
+     * @param[in] box Vector of 9 components with the three main vectors
+     * of the box
+     * @param[in] box_inverse Inverse of the box matrix
+     */
+    void Build(const std::vector<double> &xyz, const std::vector<size_t> &first_index, size_t nmon, double cutoff,
+               double skin, bool use_pbc, const std::vector<double> &box, const std::vector<double> &box_inverse);
+
+    /**
+     * @brief Checks if the list built last can be used for these
+     * coordinates and this cutoff.
+     *
+     * Without skin, the coordinates must be the ones of the build. With
+     * skin, no monomer can have moved more than skin/2.
+     * @param[in] xyz Coordinates of all the sites of the system
+     * @param[in] first_index First index of each monomer in the site list
+     * @param[in] nmon Number of monomers
+     * @param[in] cutoff Largest cutoff that will be requested
+     * @param[in] skin Skin that the list must have
+     * @param[in] use_pbc Boolean that states if we are in PBC or not
+     * @param[in] box Vector of 9 components with the three main vectors
+     * of the box
+     * @return True if the list can be used, false otherwise
+     */
+    bool IsValid(const std::vector<double> &xyz, const std::vector<size_t> &first_index, size_t nmon, double cutoff,
+                 double skin, bool use_pbc, const std::vector<double> &box) const;
+
+    /**
+     * @brief Updates the distances of the stored pairs to the current
+     * coordinates. The list must be valid for these coordinates.
+     * @param[in] xyz Coordinates of all the sites of the system
+     * @param[in] first_index First index of each monomer in the site list
+     */
+    void Refresh(const std::vector<double> &xyz, const std::vector<size_t> &first_index);
+
+    /**
+     * Empties the list. The next call to IsValid will return false.
+     */
+    void Clear();
+
+    /**
+     * @return Number of monomers in the list
+     */
+    size_t GetNumMonomers() const { return nmon_; }
+
+    /**
+     * @return Cutoff used to build the list (without skin)
+     */
+    double GetCutoff() const { return cutoff_; }
+
+    /**
+     * @return Skin used to build the list
+     */
+    double GetSkin() const { return skin_; }
+
+    /**
+     * @return Number of times the list has been built. Allows to know
+     * if data derived from the list is outdated.
+     */
+    size_t GetBuildCount() const { return build_count_; }
+
+    /**
+     * @param[in] i Monomer index
+     * @return Number of neighbors of monomer i
+     */
+    size_t GetNumNeighbors(size_t i) const { return offsets_[i + 1] - offsets_[i]; }
+
+    /**
+     * @param[in] i Monomer index
+     * @return Pointer to the (sorted) indexes of the neighbors of monomer i
+     */
+    const size_t *GetNeighbors(size_t i) const { return neighbors_.data() + offsets_[i]; }
+
+    /**
+     * @param[in] i Monomer index
+     * @return Pointer to the current squared distances to the neighbors
+     * of monomer i
+     */
+    const double *GetDistances2(size_t i) const { return dist2_.data() + offsets_[i]; }
+
+    /**
+     * @param[in] i Monomer index
+     * @param[in] j Monomer index
+     * @return Current squared distance between i and j, or -1 if j is
+     * not in the list of i
+     */
+    double GetDistance2(size_t i, size_t j) const;
+
+    /**
+     * @brief Passes to a sink all the clusters of n monomers in which
+     * root is the monomer with the lowest index.
+     *
+     * A cluster is a set of monomers connected by pairs closer than
+     * cutoff. The clusters are enumerated directly from the list, without
+     * storing them, and each one is passed to the sink as n sorted indexes.
+     * @param[in] n Size of the clusters (2, 3 or 4)
+     * @param[in] cutoff Cutoff of the clusters. Must not be larger
+     * than the cutoff of the list (plus the skin if build_distances).
+     * @param[in] root Monomer with the lowest index in the clusters
+     * @param[in] is_local local/ghost descriptor of the monomers
+     * @param[in] use_ghost If true, only clusters with local and ghost
+     * monomers are passed. If false, only clusters of local monomers.
+     * @param[in] build_distances If true, the distances at the time of the
+     * build are used instead of the current ones
+     * @param[in,out] enumerator Enumerator used in the search. Its buffer
+     * is reused between calls.
+     * @param[in,out] sink Functor called with a pointer to each cluster
+     */
+    template <class Sink>
+    void EnumerateClusters(size_t n, double cutoff, size_t root, const std::vector<size_t> &is_local, bool use_ghost,
+                           bool build_distances, SubgraphEnumerator &enumerator, Sink &sink) const;
+
+    /**
+     * @brief Passes to a sink all the clusters of 2 to nmax monomers in
+     * which root is the monomer with the lowest index, in one traversal.
+     *
+     * A cluster of n monomers must be connected by pairs closer than
+     * cutoffs[n - 2]. Dimers are taken from the neighbors of the root.
+     * Trimers are enumerated at the largest of the trimer and tetramer
+     * cutoffs, and each trimer connected at the tetramer cutoff is extended
+     * with its neighbors. A tetramer is only passed when it is extended from
+     * the trimer left after removing its largest monomer that does not
+     * disconnect it, so it is found once.
+     * @param[in] nmax Largest size of the clusters (2, 3 or 4)
+     * @param[in] cutoffs Cutoff of the clusters of each size, from 2 to
+     * nmax. Must not be larger than the cutoff of the list.
+     * @param[in] root Monomer with the lowest index in the clusters
+     * @param[in] is_local local/ghost descriptor of the monomers
+     * @param[in] use_ghost If true, only clusters with local and ghost
+     * monomers are passed. If false, only clusters of local monomers.
+     * @param[in,out] enumerator Enumerator used in the search. Its buffer
+     * is reused between calls.
+     * @param[in,out] sink Functor called with a pointer to each cluster
+     * (sorted indexes) and its size
+     */
+    template <class Sink>
+    void EnumerateAllClusters(size_t nmax, const double *cutoffs, size_t root, const std::vector<size_t> &is_local,
+                              bool use_ghost, SubgraphEnumerator &enumerator, Sink &sink) const;
+
+    /**
+     * @brief Appends all the clusters of 2 to nmax monomers in which root
+     * is the monomer with the lowest index.
+     *
+     * Same as EnumerateAllClusters, with a sink that appends the clusters
+     * of n monomers to clusters[n - 2].
+     * @param[in] nmax Largest size of the clusters (2, 3 or 4)
+     * @param[in] cutoffs Cutoff of the clusters of each size, from 2 to nmax
+     * @param[in] root Monomer with the lowest index in the clusters
+     * @param[in] is_local local/ghost descriptor of the monomers
+     * @param[in] use_ghost Local/ghost selection, as in EnumerateAllClusters
+     * @param[in,out] enumerator Enumerator used in the search
+     * @param[in,out] clusters Array of nmax - 1 vectors where the clusters
+     * are appended
+     */
+    void GetAllClusters(size_t nmax, const double *cutoffs, size_t root, const std::vector<size_t> &is_local,
+                        bool use_ghost, SubgraphEnumerator &enumerator, std::vector<size_t> *clusters) const;
+
+    /**
+     * @brief Appends all the clusters of n monomers in which root is the
+     * monomer with the lowest index.
+     *
+     * Same as EnumerateClusters, with a sink that appends each cluster
+     * to a vector.
+     * @param[in] n Size of the clusters (2, 3 or 4)
+     * @param[in] cutoff Cutoff of the clusters. Must not be larger
+     * than the cutoff of the list (plus the skin if build_distances).
+     * @param[in] root Monomer with the lowest index in the clusters
+     * @param[in] is_local local/ghost descriptor of the monomers
+     * @param[in] use_ghost If true, only clusters with local and ghost
+     * monomers are appended. If false, only clusters of local monomers.
+     * @param[in,out] clusters Vector where the clusters are appended
+     * @param[in] build_distances If true, the distances at the time of the
+     * build are used instead of the current ones
+     */
+    void GetClusters(size_t n, double cutoff, size_t root, const std::vector<size_t> &is_local, bool use_ghost,
+                     std::vector<size_t> &clusters, bool build_distances = false) const;
+
+    /**
+     * @brief Same as the previous one, reusing the buffer of an enumerator
+     */
+    void GetClusters(size_t n, double cutoff, size_t root, const std::vector<size_t> &is_local, bool use_ghost,
+                     SubgraphEnumerator &enumerator, std::vector<size_t> &clusters,
+                     bool build_distances = false) const;
+
+   private:
+    /**
+     * @brief Pair found in the search
+     */
+    struct Neighbor {
+        size_t index;
+        double dist2;
+        double shift[3];
+        bool operator<(const Neighbor &other) const {
+            return index < other.index || (index == other.index && dist2 < other.dist2);
+        }
+    };
+
+    /**
+     * @brief Finds the neighbors of all monomers with a k-d tree.
+     * Used in gas phase.
+     * @param[in] cutoff Cutoff of the search
+     * @param[out] rows Neighbors of each monomer
+     */
+    void FindNeighborsTree(double cutoff, std::vector<std::vector<Neighbor>> &rows) const;
+
+    /**
+     * @brief Finds the neighbors of all monomers with a cell grid built
+     * in fractional coordinates. Used with PBC, for both orthorhombic and
+     * triclinic boxes, without replicating the monomers.
+     * @param[in] cutoff Cutoff of the search
+     * @param[in] box Vector of 9 components with the three main vectors
+     * of the box
+     * @param[in] box_inverse Inverse of the box matrix
+     * @param[out] rows Neighbors of each monomer
+     */
+    void FindNeighborsCells(double cutoff, const std::vector<double> &box, const std::vector<double> &box_inverse,
+                            std::vector<std::vector<Neighbor>> &rows) const;
+
+    /**
+     * @brief Tells which monomers can be in a cluster with the root
+     */
+    struct AcceptMonomer {
+        const std::vector<size_t> &is_local;
+        size_t n;
+        size_t root;
+        bool use_ghost;
+        bool operator()(size_t j) const {
+            if (!use_ghost) return is_local[j];
+            if (n == 2) return is_local[j] != is_local[root];
+            return true;
+        }
+    };
+
+    /**
+     * @brief Sink that keeps the clusters with the right local/ghost
+     * composition and passes them to another sink
+     */
+    template <class Sink>
+    struct FilterComposition {
+        const std::vector<size_t> &is_local;
+        size_t n;
+        bool use_ghost;
+        Sink &sink;
+        void operator()(const size_t *cluster) {
+            if (HasComposition(is_local, cluster, n, use_ghost)) sink(cluster);
+        }
+    };
+
+    /**
+     * @return True if the cluster has the local/ghost composition
+     * requested by use_ghost
+     */
+    static bool HasComposition(const std::vector<size_t> &is_local, const size_t *cluster, size_t n, bool use_ghost) {
+        size_t islsum = 0;
+        for (size_t j = 0; j < n; j++) islsum += is_local[cluster[j]];
+        return (!use_ghost && islsum == n) || (use_ghost && islsum > 0 && islsum < n);
+    }
+
+    /**
+     * @brief Tells if the monomers in mask are connected
+     * @param[in] adj Adjacency of the monomers of a cluster as bit masks
+     * @param[in] mask Bit mask of the monomers to check
+     */
+    static bool IsConnected(const unsigned int *adj, unsigned int mask) {
+        unsigned int reached = mask & (~mask + 1u);
+        unsigned int previous = 0u;
+        while (reached != previous) {
+            previous = reached;
+            for (size_t a = 0; a < SubgraphEnumerator::kMaxSize; a++)
+                if (reached & (1u << a)) reached |= adj[a] & mask;
+        }
+        return reached == mask;
+    }
+
+    /**
+     * @brief Sink of the trimers of EnumerateAllClusters. Passes the
+     * trimers connected at the trimer cutoff and extends the ones connected
+     * at the tetramer cutoff to tetramers.
+     */
+    template <class Sink>
+    struct ExtendTrimer {
+        const NeighborList &list;
+        const AcceptMonomer &accept;
+        const std::vector<size_t> &is_local;
+        size_t nmax;
+        double cutoff3_2;
+        double cutoff4_2;
+        bool use_ghost;
+        Sink &sink;
+        void operator()(const size_t *trimer) {
+            double d2[3] = {list.GetDistance2(trimer[0], trimer[1]), list.GetDistance2(trimer[0], trimer[2]),
+                            list.GetDistance2(trimer[1], trimer[2])};
+
+            size_t npairs = 0;
+            for (size_t j = 0; j < 3; j++) npairs += d2[j] >= 0.0 && d2[j] < cutoff3_2;
+            if (npairs >= 2 && HasComposition(is_local, trimer, 3, use_ghost)) sink(trimer, 3);
+
+            if (nmax < 4) return;
+            npairs = 0;
+            for (size_t j = 0; j < 3; j++) npairs += d2[j] >= 0.0 && d2[j] < cutoff4_2;
+            if (npairs < 2) return;
+
+            for (size_t i = 0; i < 3; i++) {
+                const size_t *row = list.GetNeighbors(trimer[i]);
+                const double *row_d2 = list.GetDistances2(trimer[i]);
+                for (size_t p = 0; p < list.GetNumNeighbors(trimer[i]); p++) {
+                    const size_t v = row[p];
+                    if (v <= trimer[0] || row_d2[p] >= cutoff4_2 || v == trimer[1] || v == trimer[2] || !accept(v))
+                        continue;
+
+                    // Each new monomer is only added from its first neighbor in the trimer
+                    bool first = true;
+                    for (size_t j = 0; j < i && first; j++) {
+                        double dj = list.GetDistance2(trimer[j], v);
+                        first = dj < 0.0 || dj >= cutoff4_2;
+                    }
+                    if (!first) continue;
+
+                    size_t tetramer[4];
+                    size_t nv = 0;
+                    for (size_t j = 0; j < 3; j++) {
+                        if (nv == j && v < trimer[j]) tetramer[nv++] = v;
+                        tetramer[nv++] = trimer[j];
+                    }
+                    if (nv == 3) tetramer[nv++] = v;
+
+                    unsigned int adj[4] = {0, 0, 0, 0};
+                    for (size_t a = 0; a < 4; a++) {
+                        for (size_t b = a + 1; b < 4; b++) {
+                            double dab = list.GetDistance2(tetramer[a], tetramer[b]);
+                            if (dab >= 0.0 && dab < cutoff4_2) {
+                                adj[a] |= 1u << b;
+                                adj[b] |= 1u << a;
+                            }
+                        }
+                    }
+
+                    // v must be the largest monomer that can be removed
+                    // without disconnecting the tetramer
+                    size_t u = 3;
+                    while (!IsConnected(adj, 0xfu & ~(1u << u))) u--;
+                    if (tetramer[u] == v && HasComposition(is_local, tetramer, 4, use_ghost)) sink(tetramer, 4);
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Sink that appends the clusters to a vector
+     */
+    struct AppendCluster {
+        AppendCluster(std::vector<size_t> &c, size_t size) : clusters(c), n(size) {}
+        std::vector<size_t> &clusters;
+        size_t n;
+        void operator()(const size_t *cluster) { clusters.insert(clusters.end(), cluster, cluster + n); }
+    };
+
+    /**
+     * @brief Sink that appends the clusters of each size to its own vector
+     */
+    struct AppendClusterBySize {
+        std::vector<size_t> *clusters;
+        void operator()(const size_t *cluster, size_t n) {
+            clusters[n - 2].insert(clusters[n - 2].end(), cluster, cluster + n);
+        }
+    };
+
+    /**
+     * Number of monomers in the list
+     */
+    size_t nmon_;
+
+    /**
+     * Cutoff of the list
+     */
+    double cutoff_;
+
+    /**
+     * Skin of the list
+     */
+    double skin_;
+
+    /**
+     * PBC flag used in the last build
+     */
+    bool use_pbc_;
+
+    /**
+     * Number of builds performed
+     */
+    size_t build_count_;
+
+    /**
+     * Box used in the last build
+     */
+    std::vector<double> box_;
+
+    /**
+     * Positions of the first atom of each monomer in the last build
+     */
+    std::vector<double> ref_xyz_;
+
+    /**
+     * Positions of the first atom of each monomer in the last refresh
+     */
+    std::vector<double> cur_xyz_;
+
+    /**
+     * offsets_[i] is the position in neighbors_ of the first
+     * neighbor of monomer i. It has nmon_ + 1 elements.
+     */
+    std::vector<size_t> offsets_;
+
+    /**
+     * Neighbors of all the monomers, one row after the other
+     */
+    std::vector<size_t> neighbors_;
+
+    /**
+     * Current squared distances to the neighbors in neighbors_
+     */
+    std::vector<double> dist2_;
+
+    /**
+     * Squared distances to the neighbors in neighbors_ at the time
+     * of the build
+     */
+    std::vector<double> build_dist2_;
+
+    /**
+     * Lattice translation (3 components per pair) that brings the
+     * neighbor to the image found in the build
+     */
+    std::vector<double> shifts_;
+};
+
+/**
+ * @brief Clusters of a given size enumerated with cutoff + skin and
+ * cached until the neighbor list is rebuilt.
+ *
+ * The clusters of each root are enumerated the first time they are
+ * requested, using the distances of the build of the neighbor list. Every
+ * request then returns the cached clusters that are still connected at the
+ * exact cutoff with the current distances. Different roots can be
+ * requested from different threads at the same time.
+ */
+class ClusterList {
+   public:
+    /**
+     * Default constructor. Creates an empty (invalid) cache.
+     */
+    ClusterList();
+
+    /**
+     * @brief Empties the cache and sets its parameters
+     * @param[in] nmon Number of monomers
+     * @param[in] n Size of the clusters
+     * @param[in] cutoff Exact cutoff of the clusters
+     * @param[in] use_ghost Local/ghost selection of the clusters
+     * @param[in] build Build count of the neighbor list
+     */
+    void Reset(size_t nmon, size_t n, double cutoff, bool use_ghost, size_t build);
+
+    /**
+     * @return True if the cache was set with these parameters
+     */
+    bool IsValid(size_t n, double cutoff, bool use_ghost, size_t build) const;
+
+    /**
+     * @brief Appends the clusters with the given root that are connected
+     * at the exact cutoff for the current coordinates.
+     * @param[in] neighbors Neighbor list (refreshed) used to build the cache
+     * @param[in] root Monomer with the lowest index in the clusters
+     * @param[in] is_local local/ghost descriptor of the monomers
+     * @param[in,out] enumerator Enumerator used if the clusters of the
+     * root have not been enumerated yet
+     * @param[in,out] clusters Vector where the clusters are appended
+     */
+    void GetClusters(const NeighborList &neighbors, size_t root, const std::vector<size_t> &is_local,
+                     SubgraphEnumerator &enumerator, std::vector<size_t> &clusters);
+
+   private:
+    /**
+     * Size of the clusters
+     */
+    size_t n_;
+
+    /**
+     * Exact cutoff
+     */
+    double cutoff_;
+
+    /**
+     * Local/ghost selection
+     */
+    bool use_ghost_;
+
+    /**
+     * Build count of the neighbor list used
+     */
+    size_t build_;
+
+    /**
+     * Cached clusters of each root, enumerated with cutoff + skin
+     */
+    std::vector<std::vector<size_t>> clusters_;
+
+    /**
+     * Tells if the clusters of a root have already been enumerated.
+     * Each element is only written by the thread handling that root.
+     */
+    std::vector<char> enumerated_;
+};
+
+template <class Sink>
+void NeighborList::EnumerateClusters(size_t n, double cutoff, size_t root, const std::vector<size_t> &is_local,
+                                     bool use_ghost, bool build_distances, SubgraphEnumerator &enumerator,
+                                     Sink &sink) const {
+    if (n < 2 || root >= nmon_) return;
+
+    // If root is ghost and we're not computing local-ghost interactions, then skip
+    if (!use_ghost && !is_local[root]) return;
+
+    const std::vector<double> &dist2 = build_distances ? build_dist2_ : dist2_;
+    AcceptMonomer accept = {is_local, n, root, use_ghost};
+    FilterComposition<Sink> filter = {is_local, n, use_ghost, sink};
+    enumerator.Enumerate(offsets_.data(), neighbors_.data(), dist2.data(), cutoff * cutoff, root, n, accept,
+                         filter);
+}
+
+template <class Sink>
+void NeighborList::EnumerateAllClusters(size_t nmax, const double *cutoffs, size_t root,
+                                        const std::vector<size_t> &is_local, bool use_ghost,
+                                        SubgraphEnumerator &enumerator, Sink &sink) const {
+    if (nmax < 2 || root >= nmon_) return;
+
+    // If root is ghost and we're not computing local-ghost interactions, then skip
+    if (!use_ghost && !is_local[root]) return;
+
+    // The composition of each cluster is checked when it is complete
+    AcceptMonomer accept = {is_local, 0, root, use_ghost};
+
+    // Dimers
+    const double cutoff2_2 = cutoffs[0] * cutoffs[0];
+    size_t dimer[2] = {root, 0};
+    for (size_t p = offsets_[root]; p < offsets_[root + 1]; p++) {
+        dimer[1] = neighbors_[p];
+        if (dimer[1] > root && dist2_[p] < cutoff2_2 && HasComposition(is_local, dimer, 2, use_ghost)) sink(dimer, 2);
+    }
+    if (nmax < 3) return;
+
+    // Trimers and tetramers
+    double cutoff34 = cutoffs[1];
+    if (nmax > 3) cutoff34 = std::max(cutoff34, cutoffs[2]);
+    double cutoff4_2 = nmax > 3 ? cutoffs[2] * cutoffs[2] : 0.0;
+    ExtendTrimer<Sink> extend = {*this, accept, is_local, nmax, cutoffs[1] * cutoffs[1], cutoff4_2, use_ghost, sink};
+    enumerator.Enumerate(offsets_.data(), neighbors_.data(), dist2_.data(), cutoff34 * cutoff34, root, 3, accept,
+                         extend);
+}
+
+}  // namespace bblock
+
+#endif  // BBLOCK_NEIGHBOR_LIST_H
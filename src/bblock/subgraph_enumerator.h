@@ -0,0 +1,176 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#ifndef BBLOCK_SUBGRAPH_ENUMERATOR_H
+#define BBLOCK_SUBGRAPH_ENUMERATOR_H
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+/**
+ * @file subgraph_enumerator.h
+ * @brief Enumeration of the connected subgraphs of a graph stored in
+ * compressed sparse row format
+ */
+
+namespace bblock {
+
+/**
+ * @brief Enumerates the connected subgraphs of k vertices of a graph.
+ *
+ * Implements the ESU algorithm (Wernicke, 2006) iteratively, with a stack
+ * of fixed depth. Each subgraph is found exactly once, and is passed to a
+ * sink as soon as it is found, so no list of subgraphs is ever stored.
+ * The graph is read directly from a compressed sparse row adjacency with
+ * sorted rows and an edge weight (squared distance): two vertices are
+ * connected if their weight is below the squared cutoff.
+ *
+ * The only memory used is a buffer for the extension sets, which is kept
+ * between calls. One enumerator must be used per thread.
+ */
+class SubgraphEnumerator {
+   public:
+    /**
+     * Maximum number of vertices of the subgraphs
+     */
+    static const size_t kMaxSize = 4;
+
+    /**
+     * @brief Enumerates the connected subgraphs of k vertices in which
+     * root is the vertex with the lowest index.
+     *
+     * @param[in] offsets offsets[i] is the position in neighbors of the
+     * first neighbor of vertex i
+     * @param[in] neighbors Sorted neighbors of each vertex, one row after the other
+     * @param[in] dist2 Squared distance of each pair in neighbors
+     * @param[in] cutoff2 Squared cutoff. Pairs closer than this are connected.
+     * @param[in] root First vertex of the subgraphs
+     * @param[in] k Number of vertices of the subgraphs (2 to kMaxSize)
+     * @param[in] accept Functor that, given a vertex, tells if it can be
+     * part of the subgraphs. Only called for vertices larger than root.
+     * @param[in] sink Functor called with a pointer to the k vertices
+     * (sorted) of each subgraph
+     */
+    template <class Accept, class Sink>
+    void Enumerate(const size_t *offsets, const size_t *neighbors, const double *dist2, double cutoff2, size_t root,
+                   size_t k, const Accept &accept, Sink &sink) {
+        if (k < 2 || k > kMaxSize) return;
+
+        // Vertices of the current subgraph
+        size_t sub[kMaxSize];
+        // Extension set of each level, in ext_[start[l], end[l])
+        size_t start[kMaxSize];
+        size_t end[kMaxSize];
+
+        // The extension of the root are its neighbors
+        sub[0] = root;
+        start[1] = 0;
+        end[1] = 0;
+        Reserve(offsets[root + 1] - offsets[root]);
+        for (size_t p = offsets[root]; p < offsets[root + 1]; p++) {
+            const size_t u = neighbors[p];
+            if (u > root && dist2[p] < cutoff2 && accept(u)) ext_[end[1]++] = u;
+        }
+
+        size_t level = 1;
+        while (level > 0) {
+            if (end[level] == start[level]) {
+                level--;
+                continue;
+            }
+
+            // Move one vertex from the extension to the subgraph
+            const size_t w = ext_[--end[level]];
+            sub[level] = w;
+
+            if (level + 1 == k) {
+                size_t found[kMaxSize];
+                std::copy(sub, sub + k, found);
+                std::sort(found, found + k);
+                sink(found);
+                continue;
+            }
+
+            // The extension of the next level is the rest of this one, plus
+            // the neighbors of w that are not in or next to the subgraph
+            const size_t nleft = end[level] - start[level];
+            start[level + 1] = end[level];
+            end[level + 1] = end[level] + nleft;
+            Reserve(end[level + 1] + offsets[w + 1] - offsets[w]);
+            std::copy(ext_.begin() + start[level], ext_.begin() + end[level], ext_.begin() + start[level + 1]);
+
+            for (size_t p = offsets[w]; p < offsets[w + 1]; p++) {
+                const size_t u = neighbors[p];
+                if (u <= root || dist2[p] >= cutoff2 || !accept(u)) continue;
+
+                bool exclusive = true;
+                for (size_t s = 0; s < level && exclusive; s++) {
+                    exclusive = u != sub[s] && !Connected(offsets, neighbors, dist2, cutoff2, sub[s], u);
+                }
+                if (exclusive) ext_[end[level + 1]++] = u;
+            }
+
+            level++;
+        }
+    }
+
+   private:
+    /**
+     * @brief Makes sure the extension buffer can hold n vertices
+     */
+    void Reserve(size_t n) {
+        if (ext_.size() < n) ext_.resize(std::max(n, 2 * ext_.size()));
+    }
+
+    /**
+     * @return True if vertices a and b are connected
+     */
+    static bool Connected(const size_t *offsets, const size_t *neighbors, const double *dist2, double cutoff2,
+                          size_t a, size_t b) {
+        const size_t *first = neighbors + offsets[a];
+        const size_t *last = neighbors + offsets[a + 1];
+        const size_t *it = std::lower_bound(first, last, b);
+        return it != last && *it == b && dist2[it - neighbors] < cutoff2;
+    }
+
+    /**
+     * Extension sets of all the levels, one after the other
+     */
+    std::vector<size_t> ext_;
+};
+
+}  // namespace bblock
+
+#endif  // BBLOCK_SUBGRAPH_ENUMERATOR_H
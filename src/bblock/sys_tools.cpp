@@ -287,8 +287,8 @@ void FixMonomerCoordinates(std::vector<double> &xyz, std::vector<double> box, st
     }
 }
 
-void GetCloseDimerImage(std::vector<double> box, std::vector<double> box_inv, size_t nat1, size_t nat2, size_t nd,
-                        double *xyz1, double *xyz2) {
+void GetCloseDimerImage(const std::vector<double> &box, const std::vector<double> &box_inv, size_t nat1, size_t nat2,
+                        size_t nd, double *xyz1, double *xyz2) {
     size_t shift1 = 0;
     size_t shift2 = 0;
     size_t coords1 = 3 * nat1;
@@ -435,255 +435,24 @@ void GetCloseTrimerImage(std::vector<double> box, std::vector<double> box_inv, s
     // use_ghost controls whether or not to include ghost monomers in clusters; default is no.
     // dimers and trimers will be filled with the dimers and trimers found
 
-    // if use_ghost == true,
-    //       include local+ghost monomers in xyz, but only include local-ghost interactions
-    // if use_ghost == false,
-    //       include only local monomers in xyz and do nothing special
-
-    // Perform a radial search within the cutoff
+    // This is a standalone version that builds its own neighbor list.
+    // The system class builds the list once and reuses it for all the
+    // N-body terms and all the threads.
     dimers.clear();
     if (n_max > 2) trimers.clear();
 
     if (n_max > 3) tetramers.clear();
 
+    bblock::NeighborList neighbors;
+    neighbors.Build(xyz_orig, first_index, nmon, cutoff, 0.0, use_pbc, box, box_inverse);
 
-    // if first monomer is ghost and we're not computing local-ghost interactions, then skip
-
-    if (!use_ghost && !is_local[istart]) return;
-
-
-     
-
-    
-
-
-    
-    // Obtain xyz vector with the positions of first atom of each monomer
-    std::vector<double> xyz;
-    size_t nmon2 = 0;
-
-    std::vector<size_t> mon_index;
-    for (size_t i = istart; i < nmon; i++) {
-      size_t islsum = is_local[istart] + is_local[i];
-
-      bool include_monomer = false;
-      if (n_max == 2) {
-  	if (i == istart) {
-  	  if (use_ghost)
-  	    include_monomer = true;
-  	  else if (!use_ghost && islsum == 2)
-  	    include_monomer = true;
-  	} else {
-  	  if (use_ghost && islsum == 1)
-  	    include_monomer = true;
-  	  else if (!use_ghost && islsum == 2)
-  	    include_monomer = true;
-  	}
-      } else {  // trimer
-  	if (i == istart) {
-  	  if (use_ghost)
-  	    include_monomer = true;
-  	  else if (!use_ghost && islsum == 2)
-  	    include_monomer = true;
-  	} else {
-  	  if (use_ghost)
-  	    include_monomer = true;
-  	  else if (!use_ghost && islsum == 2)
-  	    include_monomer = true;
-  	}
-      }
-
-      if (include_monomer) {
-  	xyz.push_back(xyz_orig[3 * first_index[i]]);
-  	xyz.push_back(xyz_orig[3 * first_index[i] + 1]);
-  	xyz.push_back(xyz_orig[3 * first_index[i] + 2]);
-  	mon_index.push_back(i); //First index of atom in monomer
-  	nmon2++; //Number of monomers included
-      }
-    }
-
-    if (nmon2 < 2) return;
-    if (n_max > 2 && nmon2 < 3) return;
-    if (n_max > 3 && nmon2 < 4) return;
-
-    typedef nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Simple_Adaptor<double, kdtutils::PointCloud<double>>,
-                                                kdtutils::PointCloud<double>, 3 /* dim */>
-      my_kd_tree_t;
-
-    
-    // Remove positions outside maximum nmer distance (linear)
-    kdtutils::PointCloud<double> ptc = kdtutils::XyzToCloud(xyz, use_pbc, box, box_inverse);
-
-  
-    my_kd_tree_t index2(3 /*dim*/, ptc, nanoflann::KDTreeSingleIndexAdaptorParams(10 /* max leaf */));
-    index2.buildIndex();
-
-    set<int, less<int> > s1;
-    for (size_t i = 0; i < iend-istart; i++) {
-      double point[3];
-      point[0] = ptc.pts[i].x;
-      point[1] = ptc.pts[i].y;
-      point[2] = ptc.pts[i].z;
-      std::vector<std::pair<size_t, double>> ret_matches;
-      nanoflann::SearchParams params;
-      size_t  nMatches;
-      if(n_max==4){
-	nMatches = index2.radiusSearch(point, (n_max-1)*(n_max-1)*cutoff*cutoff, ret_matches, params);
-      }else{
-	nMatches = index2.radiusSearch(point, (n_max-1)*(n_max-1)*cutoff*cutoff, ret_matches, params);
-      }
-      for (size_t j = 0; j < nMatches; j++) {
-    	size_t pos = ret_matches[j].first / nmon2;
-    	ret_matches[j].first -= nmon2 * pos;
-    	s1.insert(ret_matches[j].first);
-      }
-    }
-    
-    nmon2=s1.size();
-    if (nmon2 < 2) return;
-    if (n_max > 2 && nmon2 < 3) return;
-    if (n_max > 3 && nmon2 < 4) return;
-    
-    std::vector<size_t> mon_index2;
-    mon_index2.reserve(nmon2);
-    std::vector<double> xyz2;
-    xyz2.reserve(nmon2*3);
-   
-    for (int i : s1)
-      {
-	xyz2.push_back(xyz[i*3]);
-    	xyz2.push_back(xyz[i*3+1]);
-    	xyz2.push_back(xyz[i*3+2]);
-    	mon_index2.push_back(mon_index[i]);
-      }
-    xyz.clear();
-    mon_index.clear();
-    xyz=xyz2;
-    mon_index=mon_index2;  
-
-   
-    
-
-    
-    // Obtain the data in the structure needed by the kd-tree
-    ptc = kdtutils::XyzToCloud(xyz, use_pbc, box, box_inverse);
-
-    // Build the tree
-    // typedef nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Simple_Adaptor<double, kdtutils::PointCloud<double>>,
-    //                                             kdtutils::PointCloud<double>, 3 /* dim */>
-    //   my_kd_tree_t;
-    my_kd_tree_t index(3 /*dim*/, ptc, nanoflann::KDTreeSingleIndexAdaptorParams(10 /* max leaf */));
-    index.buildIndex();
-
-    int** neighborList;
-    neighborList = new int*[nmon2];
-
-    //for(int i = 0; i < iend - istart; i++){
-    for(int i = 0; i < nmon2; i++){ 
-      double point[3];
-      point[0] = ptc.pts[i].x;
-      point[1] = ptc.pts[i].y;
-      point[2] = ptc.pts[i].z;
-	 
-      // Perform the search
-      std::vector<std::pair<size_t, double>> ret_matches;
-      nanoflann::SearchParams params;
-      const size_t nMatches = index.radiusSearch(point, cutoff * cutoff, ret_matches, params);
-      for (size_t j = 0; j < nMatches; j++) {
-	size_t pos = ret_matches[j].first / nmon2;
-	ret_matches[j].first -= nmon2 * pos;
-      }
-
-      //Has to be reverse order for subgraph construction
-      std::sort(ret_matches.rbegin(), ret_matches.rend(), ComparePair);
-       
-      neighborList[i] = new int[nMatches];
-      neighborList[i][0]=nMatches-1;
-
-      size_t l=0;
-      for (size_t j = 0; j < nMatches; j++) {
-	if (ret_matches[j].first != i){
-	  neighborList[i][l+1]   =  ret_matches[j].first+1;
-	  l++;
-	}
-      }
+    std::vector<size_t> &nmers = n_max == 2 ? dimers : (n_max == 3 ? trimers : tetramers);
+    bblock::SubgraphEnumerator enumerator;
+    for (size_t i = istart; i < iend; i++) {
+        neighbors.GetClusters(n_max, cutoff, i, is_local, use_ghost, enumerator, nmers);
     }
-  
-
-
-    
-#ifdef Debug
-    std::cout<<iend-istart<<" "<<nmon<<" "<<nmon2<<std::endl;
-    for(int i = 0; i < nmon2; i++) 
-      {
-	std::cout<<i+1<<", has "<<neighborList[i][0]<<" neighbors: ";
-	for (size_t j = 0; j < neighborList[i][0]; j++) 
-	  std::cout<<neighborList[i][j+1]<<' ';
-	std::cout<<std::endl;
-      }
-#endif
- 
-
-    int n_max_i=n_max;
-    //for (int n_max_i = 2; n_max_i <  n_max+1; n_max_i++){
-    // std::cout << n_max_i << "-body, number of vert "<< nmon2 <<endl;
-    SubGraphs B(nmon2, n_max_i, neighborList, iend-istart);
-    B.Enumerate();
-    std::vector<std::vector<int>> subgraphs = B.GetSubgraphs();
-    
+  }
 
-#ifdef Debug
-      std::cout<<"Number of subgraphs with size "<< n_max_i<<": "<<subgraphs.size()<<endl;
-      for(int i = 0; i <  subgraphs.size(); i++){
-	for(int j = 0; j <  n_max_i; j++)
-	  std::cout<<mon_index[subgraphs[i][j]-1]<<" ";
-	std::cout<<endl;
-      }
-#endif
-      
-      for(int i = 0; i <  subgraphs.size(); i++){
-	size_t islsum=0;
-	for(int j = 0; j <  n_max_i; j++)
-	  islsum += is_local[mon_index[subgraphs[i][j]-1]];
-	
-	if ((!use_ghost && islsum == n_max_i)||(use_ghost && islsum > 0 && islsum < n_max_i) )
-	  {
-
-	    std::sort(std::begin(subgraphs[i]), std::end(subgraphs[i]));
-	    if(n_max_i==2)
-	      {
-		dimers.push_back(mon_index[subgraphs[i][0]-1]);
-		dimers.push_back(mon_index[subgraphs[i][1]-1]);
-	      }
-	    else if(n_max_i==3)
-	      {
-		trimers.push_back(mon_index[subgraphs[i][0]-1]);
-		trimers.push_back(mon_index[subgraphs[i][1]-1]);
-		trimers.push_back(mon_index[subgraphs[i][2]-1]);
-		
-	      }
-	    else if(n_max_i==4)
-	      {
-		tetramers.push_back(mon_index[subgraphs[i][0]-1]);
-		tetramers.push_back(mon_index[subgraphs[i][1]-1]);
-		tetramers.push_back(mon_index[subgraphs[i][2]-1]);
-		tetramers.push_back(mon_index[subgraphs[i][3]-1]); 
-	      }
-	  }
-      }
-
-      	
-      
-      // Deallocate arrays and vectors
-      for(int i = 0; i < nmon2; i++){ 
-	delete[] neighborList[i];
-      }
-      delete[] neighborList;
-
-
-  } // 
- 
- 
 void GetExcluded(std::string mon, nlohmann::json mon_j, excluded_set_type &exc12, excluded_set_type &exc13,
                  excluded_set_type &exc14) {
     // Clearing excluded pairs just in case
@@ -44,8 +44,7 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 
 #include "kdtree/nanoflann.hpp"
 #include "kdtree/kdtree_utils.h"
-//#include "subgraphs/subgraphs.h"
-#include "bblock/subgraphs.h"
+#include "bblock/neighbor_list.h"
 
 #include "tools/definitions.h"
 #include "potential/lj/ljtools.h"
@@ -206,8 +205,8 @@ void FixMonomerCoordinates(std::vector<double> &xyz, std::vector<double> box, st
  * the other one. At output, it will be modified so the coordinates
  * of monomer 2 are the closer image to monomer 1.
  */
-void GetCloseDimerImage(std::vector<double> box, std::vector<double> box_inv, size_t nat1, size_t nat2, size_t nd,
-                        double *xyz1, double *xyz2);
+void GetCloseDimerImage(const std::vector<double> &box, const std::vector<double> &box_inv, size_t nat1, size_t nat2,
+                        size_t nd, double *xyz1, double *xyz2);
 
 /**
  * @brief This function finds the monomers 2 and 3 mirror image that is
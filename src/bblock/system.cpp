@@ -33,6 +33,9 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 ******************************************************************************/
 
 #include "system.h"
+#include "potential/fragmented/ParamRegistry.h"
+
+#include <array>
 
 //#define DEBUG
 //#define TIMING
@@ -79,6 +82,17 @@ System::System() {
 
     cutoff4b_ = 5.0;
 
+    // Skin added to the cutoffs when the clusters are searched.
+    // With 0, clusters are searched again in every call
+    cluster_skin_ = 0.0;
+
+    // N-mers dropped by the support of their kernels in the last call
+    nmers_skipped_ = std::vector<size_t>(3, 0);
+
+    // All the N-body polynomials in double precision, not compared
+    check_nbody_precision_ = false;
+    nbody_precision_checked_ = false;
+
     
     ////////////////////////
     // Evaluation batches //
@@ -102,6 +116,8 @@ System::System() {
     maxItDip_ = 100;
     // Sets the default method to calculate induced dipoles to ASPC
     dipole_method_ = "cg";
+    // Dipole-dipole tensors are recomputed in each iteration by default
+    dipole_tensor_cache_mb_ = 0.0;
 
     // Define the virial vector
     virial_ = std::vector<double>(9, 0.0);
@@ -144,6 +160,7 @@ std::vector<size_t> System::GetPairList(size_t nmax, double cutoff, size_t istar
     }
 
     // Call the add clusters function to get all the pairs
+    UpdateNeighborList(cutoff);
     AddClusters(nmax, cutoff, 0, monomers_.size());
 
     // Change the monomer indexes of dimers_ or trimers_
@@ -496,6 +513,8 @@ void System::SetDipoleTol(double tol) { diptol_ = tol; }
 void System::SetDipoleMaxIt(size_t maxit) { maxItDip_ = maxit; }
 void System::SetDipoleMethod(std::string method) { dipole_method_ = method; }
 
+void System::SetDipoleTensorCache(double max_mb) { dipole_tensor_cache_mb_ = max_mb; }
+
 void System::SetPBC(std::vector<double> box) {
     // Check that the box has 0 or 9 components
     if (box.size() != 9 && box.size() != 0) {
@@ -767,6 +786,30 @@ void System::Initialize() {
     nummol = molecules_.size();
     nummon_ = monomers_.size();
 
+    // Interning of the monomer ids. Monomers are ordered by type, so the
+    // type of each monomer is the position of its id in mon_type_count_.
+    std::vector<std::string> mon_types;
+    std::vector<size_t> mon_type_sites;
+    mon_type_id_.clear();
+    for (size_t k = 0; k < mon_type_count_.size(); k++) {
+        mon_types.push_back(mon_type_count_[k].first);
+        mon_type_sites.push_back(sites_[mon_type_id_.size()]);
+        mon_type_id_.insert(mon_type_id_.end(), mon_type_count_[k].second, k);
+    }
+    kernels_.Initialize(mon_types);
+
+    // Resolve the parameters of each type once, so the charges, pols,
+    // polfacs and virtual sites are set without looking at the json.
+    // The terms use the exclusions of this table instead of their own.
+    std::shared_ptr<MonomerTypeTable> mon_type_table(new MonomerTypeTable());
+    mon_type_table->Compile(mon_types, mon_type_sites, monomers_j_);
+    mon_type_table->CompileSiteProperties(monomers_j_);
+    mon_types_ = mon_type_table;
+    electrostaticE_.SetMonomerTypes(mon_types_);
+    dispersionE_.SetMonomerTypes(mon_types_);
+    lennardJonesE_.SetMonomerTypes(mon_types_);
+    buckinghamE_.SetMonomerTypes(mon_types_);
+
     // Setting PBC to false by default
     SetPBC(box_);
 
@@ -1012,6 +1055,82 @@ void System::SetUpFromJson(nlohmann::json j) {
     }
     cutoff4b_ = cutoff_4b;
     mbx_j_["MBX"]["fourbody_cutoff"] = cutoff_4b;
+
+    // Try to get the skin of the cluster lists
+    // Default: 0 Angstrom (clusters are searched in every call)
+    double cluster_skin;
+    try {
+        cluster_skin = j["MBX"]["cluster_skin"];
+    } catch (...) {
+        cluster_skin = 0.0;
+    }
+    if (cluster_skin < 0.0) {
+        std::string text = "\"cluster_skin\" cannot be negative (" + std::to_string(cluster_skin) + ").";
+        throw CUException(__func__, __FILE__, __LINE__, text);
+    }
+    cluster_skin_ = cluster_skin;
+    mbx_j_["MBX"]["cluster_skin"] = cluster_skin;
+
+    // Try to get the directories where the parameters of the polynomials
+    // are searched, before MBX_PARAMS_PATH and the current directory
+    // Default: none
+    std::vector<std::string> params_path;
+    try {
+        if (j["MBX"]["params_path"].is_string()) {
+            params_path.push_back(j["MBX"]["params_path"]);
+        } else {
+            std::vector<std::string> params_path2 = j["MBX"]["params_path"];
+            params_path = params_path2;
+        }
+    } catch (...) {
+        params_path.clear();
+    }
+    ParamRegistry::set_search_path(params_path);
+    mbx_j_["MBX"]["params_path"] = params_path;
+    // The parameters are read once per process
+    std::map<std::string, std::string> stale_polynomials = ParamRegistry::get_stale_polynomials();
+    for (auto it = stale_polynomials.begin(); it != stale_polynomials.end(); it++) {
+        std::cerr << "**WARNING** The parameters of " << it->first << " were already read from \"" << it->second
+                  << "\". They are kept, \"params_path\" only applies to polynomials not used yet.\n";
+    }
+
+    // Try to get the precision of the batched N-body polynomials, by
+    // polynomial name: "double" or "float"
+    // Default: all in double precision
+    std::map<std::string, std::string> fragmented_precision;
+    try {
+        std::map<std::string, std::string> fragmented_precision2 = j["MBX"]["fragmented_precision"];
+        fragmented_precision = fragmented_precision2;
+    } catch (...) {
+        fragmented_precision.clear();
+    }
+    fragmented_precision_.clear();
+    nbody_precision_checked_ = false;
+    for (auto it = fragmented_precision.begin(); it != fragmented_precision.end(); it++) {
+        if (it->second == "float") {
+            fragmented_precision_[it->first] = Polynomial::single_precision;
+        } else if (it->second == "double") {
+            fragmented_precision_[it->first] = Polynomial::double_precision;
+        } else {
+            std::string text = "Precision \"" + it->second + "\" of polynomial " + it->first +
+                               " is not valid. It must be \"double\" or \"float\".";
+            throw CUException(__func__, __FILE__, __LINE__, text);
+        }
+    }
+    mbx_j_["MBX"]["fragmented_precision"] = fragmented_precision;
+
+    // Try to get if the polynomials in single precision are compared with
+    // double precision in the first energy call
+    // Default: false (each comparison costs two evaluations of the N-body term)
+    bool check_fragmented_precision = false;
+    try {
+        bool check_fragmented_precision2 = j["MBX"]["check_fragmented_precision"];
+        check_fragmented_precision = check_fragmented_precision2;
+    } catch (...) {
+        check_fragmented_precision = false;
+    }
+    check_nbody_precision_ = check_fragmented_precision;
+    mbx_j_["MBX"]["check_fragmented_precision"] = check_fragmented_precision;
  
     
     // Try to get maximum number of evaluations for 1b
@@ -1099,6 +1218,17 @@ void System::SetUpFromJson(nlohmann::json j) {
     maxItDip_ = dipole_max_it;
     mbx_j_["MBX"]["dipole_max_it"] = dipole_max_it;
 
+    // Try to get the memory available to cache the dipole-dipole tensors
+    // Default: 0 (no cache)
+    double dipole_tensor_cache_mb;
+    try {
+        dipole_tensor_cache_mb = j["MBX"]["dipole_tensor_cache_mb"];
+    } catch (...) {
+        dipole_tensor_cache_mb = 0.0;
+    }
+    dipole_tensor_cache_mb_ = dipole_tensor_cache_mb;
+    mbx_j_["MBX"]["dipole_tensor_cache_mb"] = dipole_tensor_cache_mb;
+
     // Try to get dispersion PME alpha
     // Default: 0.6
     double alpha_disp;
@@ -1456,12 +1586,14 @@ std::string System::GetCurrentSystemConfig() {
 
     ss << std::left << std::setw(25) << "2B cutoff:" << cutoff2b_ << std::endl;
     ss << std::left << std::setw(25) << "3B cutoff:" << cutoff3b_ << std::endl;
+    ss << std::left << std::setw(25) << "Cluster skin:" << cluster_skin_ << std::endl;
     ss << std::left << std::setw(25) << "Max Eval Mon:" << maxNMonEval_ << std::endl;
     ss << std::left << std::setw(25) << "Max Eval Dim:" << maxNDimEval_ << std::endl;
     ss << std::left << std::setw(25) << "Max Eval Trim:" << maxNTriEval_ << std::endl;
     ss << std::left << std::setw(25) << "Dipole Tol:" << diptol_ << std::endl;
     ss << std::left << std::setw(25) << "Dipole Max Iter:" << maxItDip_ << std::endl;
     ss << std::left << std::setw(25) << "Dipole Method:" << dipole_method_ << std::endl;
+    ss << std::left << std::setw(25) << "Dipole Tensor Cache MB:" << dipole_tensor_cache_mb_ << std::endl;
     ss << std::left << std::setw(25) << "Ewald Alpha Elec:" << elec_alpha_ << std::endl;
     ss << std::left << std::setw(25) << "Grid Dens Elec:" << elec_grid_density_ << std::endl;
     ss << std::left << std::setw(25) << "Spline Order Elec:" << elec_spline_order_ << std::endl;
@@ -1697,6 +1829,54 @@ void System::AddMonomerInfo() {
 #endif
 }
 
+void System::UpdateNeighborList(double cutoff) {
+    // The list is built with the largest of the N-body cutoffs, so it
+    // can be shared by all the N-body terms for the same coordinates
+    double list_cutoff = std::max(cutoff, std::max(cutoff2b_, std::max(cutoff3b_, cutoff4b_)));
+    size_t nmon = monomers_.size();
+
+    if (neighbor_list_.IsValid(xyz_, first_index_, nmon, cutoff, cluster_skin_, use_pbc_, box_)) {
+        // Within the skin, only the distances need to be updated
+        neighbor_list_.Refresh(xyz_, first_index_);
+    } else {
+        neighbor_list_.Build(xyz_, first_index_, nmon, list_cutoff, cluster_skin_, use_pbc_, box_, box_inverse_);
+    }
+}
+
+void System::UpdateClusterList(size_t nmax, double cutoff, bool use_ghost) {
+    // Without skin the clusters are searched directly every time
+    if (cluster_skin_ == 0.0) return;
+
+    // One cache for each cluster size (2, 3, 4) and local/ghost selection
+    if (cluster_lists_.size() != 6) cluster_lists_.resize(6);
+
+    ClusterList &clusters = cluster_lists_[2 * (nmax - 2) + (use_ghost ? 1 : 0)];
+    if (!clusters.IsValid(nmax, cutoff, use_ghost, neighbor_list_.GetBuildCount())) {
+        clusters.Reset(monomers_.size(), nmax, cutoff, use_ghost, neighbor_list_.GetBuildCount());
+    }
+}
+
+void System::FindClusters(size_t nmax, double cutoff, size_t istart, size_t iend, bool use_ghost,
+                          std::vector<size_t> &nmers) {
+    // The neighbor list (and the cluster list if there is a skin) must be
+    // up to date. See UpdateNeighborList and UpdateClusterList.
+    // The same enumerator is used for all the roots.
+    SubgraphEnumerator enumerator;
+    if (cluster_skin_ > 0.0 && nmax >= 2 && nmax <= 4) {
+        ClusterList &clusters = cluster_lists_[2 * (nmax - 2) + (use_ghost ? 1 : 0)];
+        if (clusters.IsValid(nmax, cutoff, use_ghost, neighbor_list_.GetBuildCount())) {
+            for (size_t i = istart; i < iend; i++) {
+                clusters.GetClusters(neighbor_list_, i, islocal_, enumerator, nmers);
+            }
+            return;
+        }
+    }
+
+    for (size_t i = istart; i < iend; i++) {
+        neighbor_list_.GetClusters(nmax, cutoff, i, islocal_, use_ghost, enumerator, nmers);
+    }
+}
+
 void System::AddClusters(size_t nmax, double cutoff, size_t istart, size_t iend, bool use_ghost_) {
     // istart is the monomer position for which we will look all dimers and
     // trimers that contain it. iend is the last monomer position.
@@ -1712,8 +1892,12 @@ void System::AddClusters(size_t nmax, double cutoff, size_t istart, size_t iend,
     //    or 3."; throw CUException(__func__, __FILE__, __LINE__, text);
     //}
 
-    size_t nmon = monomers_.size();
-    systools::AddClusters(nmax, cutoff, istart, iend, nmon, use_pbc_, box_, box_inverse_, xyz_, first_index_, islocal_, dimers_, trimers_, tetramers_, use_ghost_);
+    dimers_.clear();
+    if (nmax > 2) trimers_.clear();
+    if (nmax > 3) tetramers_.clear();
+
+    std::vector<size_t> &nmers = nmax == 2 ? dimers_ : (nmax == 3 ? trimers_ : tetramers_);
+    FindClusters(nmax, cutoff, istart, iend, use_ghost_, nmers);
 }
 
 std::vector<size_t> System::AddClustersParallel(size_t nmax, double cutoff, size_t istart, size_t iend,
@@ -1730,12 +1914,11 @@ std::vector<size_t> System::AddClustersParallel(size_t nmax, double cutoff, size
     //    or 3."; throw CUException(__func__, __FILE__, __LINE__, text);
     //}
 
-    size_t nmon = monomers_.size();
-    std::vector<size_t> dimers, trimers, tetramers;
-    systools::AddClusters(nmax, cutoff, istart, iend, nmon, use_pbc_, box_, box_inverse_, xyz_, first_index_, islocal_, dimers, trimers, tetramers, use_ghost_);
-    if (nmax == 2) return dimers;
-    if (nmax == 3) return trimers;
-    if (nmax == 4) return tetramers;
+    // The neighbor and cluster lists are shared. Each thread only
+    // touches the roots it has been given.
+    std::vector<size_t> nmers;
+    FindClusters(nmax, cutoff, istart, iend, use_ghost_, nmers);
+    return nmers;
 }
 
 void System::SetConnectivity(std::unordered_map<std::string, eff::Conn> connectivity_map) {
@@ -1756,6 +1939,12 @@ double System::Energy(bool do_grads) {
         throw CUException(__func__, __FILE__, __LINE__, text);
     }
 
+    // Report the error of the polynomials in single precision, once, if requested
+    if (check_nbody_precision_ && !nbody_precision_checked_) {
+        nbody_precision_checked_ = true;
+        LogNBodyPrecision();
+    }
+
     // Reset energy and grads in system to 0
     energy_ = 0.0;
     std::fill(grad_.begin(), grad_.end(), 0.0);
@@ -1785,8 +1974,10 @@ double System::Energy(bool do_grads) {
 #ifdef TIMING
     auto t2 = std::chrono::high_resolution_clock::now();
 #endif
-    // double e2b = 0.0;
-    double e2b = Get2B(do_grads);
+    // The dimers, trimers and tetramers are found in a single search
+    double enb[3] = {0.0, 0.0, 0.0};
+    GetFusedNB(do_grads, enb);
+    double e2b = enb[0];
 
 #ifdef TIMING
     auto t2a = std::chrono::high_resolution_clock::now();
@@ -1812,13 +2003,7 @@ double System::Energy(bool do_grads) {
     auto t31 = std::chrono::high_resolution_clock::now();
 #endif
 
-    // double e3b = 0.0;
-   
-    double e3b =   Get3B(do_grads);
-
-#ifdef TIMING
-    auto t4 = std::chrono::high_resolution_clock::now();
-#endif
+    double e3b = enb[1];
 
     // Electrostatic energy
     double Eelec = 0.0;
@@ -1830,12 +2015,7 @@ double System::Energy(bool do_grads) {
     auto t5 = std::chrono::high_resolution_clock::now();
 #endif
 
-    double e4b =0;
-    e4b = GetNB(do_grads, 4);
-
-#ifdef TIMING
-    auto t6 = std::chrono::high_resolution_clock::now();
-#endif
+    double e4b = enb[2];
 
     // Set up energy with the new value
     energy_ = eff + e1b + e2b + e3b + e4b + edisp + ebuck + elj + Eelec;
@@ -1856,7 +2036,7 @@ double System::Energy(bool do_grads) {
 #ifdef TIMING
     std::cerr << "System::1b(grad=" << do_grads << ") "
               << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count() << " milliseconds\n";
-    std::cerr << "System::2b(grad=" << do_grads << ") "
+    std::cerr << "System::2b+3b+4b(grad=" << do_grads << ") "
               << std::chrono::duration_cast<std::chrono::milliseconds>(t2a - t2).count() << " milliseconds\n";
     std::cerr << "System::disp(grad=" << do_grads << ") "
               << std::chrono::duration_cast<std::chrono::milliseconds>(t2b - t2a).count() << " milliseconds\n";
@@ -1864,14 +2044,10 @@ double System::Energy(bool do_grads) {
               << std::chrono::duration_cast<std::chrono::milliseconds>(t3 - t2b).count() << " milliseconds\n";
     std::cerr << "System::LJ(grad=" << do_grads << ") "
               << std::chrono::duration_cast<std::chrono::milliseconds>(t31 - t3).count() << " milliseconds\n";
-    std::cerr << "System::3b(grad=" << do_grads << ") "
-              << std::chrono::duration_cast<std::chrono::milliseconds>(t4 - t31).count() << " milliseconds\n";
     std::cerr << "System::electrostatics(grad=" << do_grads << ") "
-              << std::chrono::duration_cast<std::chrono::milliseconds>(t5 - t4).count() << " milliseconds\n";
-     std::cerr << "System::4b(grad=" << do_grads << ") "
-              << std::chrono::duration_cast<std::chrono::milliseconds>(t6 - t5).count() << " milliseconds\n";
+              << std::chrono::duration_cast<std::chrono::milliseconds>(t5 - t31).count() << " milliseconds\n";
     std::cerr << "TotalEnergy(grad=" << do_grads << ") "
-	      << std::chrono::duration_cast<std::chrono::milliseconds>(t6 - t1).count() << " milliseconds\n";
+	      << std::chrono::duration_cast<std::chrono::milliseconds>(t5 - t1).count() << " milliseconds\n";
 #endif
 
     return energy_;
@@ -2116,281 +2292,186 @@ double System::TwoBodyEnergy(bool do_grads, bool use_ghost) {
 }
 
 double System::Get2B(bool do_grads, bool use_ghost) {
-    // No dimers makes the function return 0.
-
-    // 2B ENERGY
-    double e2b_t = 0.0;
-    double edisp_t = 0.0;
-
-    // Variables needed for OMP
-    size_t step = 1;
-    int num_threads = 1;
+    // Dimers are collected, sorted by type and evaluated in full batches
+    // by the generic N-body driver. With ghost monomers only mixed dimers
+    // are included, so their energy and virial are scaled by 1/2 there.
+    return GetNB<2>(do_grads, use_ghost);
+}
 
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-        // Get the number of threads
-        if (omp_get_thread_num() == 0) num_threads = omp_get_num_threads();
+double System::ThreeBodyEnergy(bool do_grads, bool use_ghost) {
+    // Check if system has been initialized
+    // If not, throw exception
+    if (!initialized_) {
+        std::string text =
+            std::string("System has not been initialized. ") + std::string("3B Energy calculation not possible.");
+        throw CUException(__func__, __FILE__, __LINE__, text);
     }
-    // Define variables to be used later in the condensation of data
-    int grad_step = 3 * numsites_ / num_threads;
-    step = std::max(size_t(1), std::min(nummon_ / num_threads, step));
-#endif  // _OPENMP
 
-    // Variables to be used for both serial and parallel implementation
-    size_t first_grad = 0;
-    size_t last_grad = 3 * numsites_;
-    int rank = 0;
+    energy_ = 0.0;
+    std::fill(grad_.begin(), grad_.end(), 0.0);
+    std::fill(virial_.begin(), virial_.end(), 0.0);
 
-    // Vector pools that allow compatibility between
-    // serial and parallel implementation
-    std::vector<double> e2b_pool(num_threads, 0.0);
-    std::vector<std::vector<double>> grad_pool(num_threads, std::vector<double>(3 * numsites_, 0.0));
-    std::vector<std::vector<double>> virial_pool(num_threads, std::vector<double>(9, 0.0));  // declare virial pool
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic) private(rank)
-#endif  // _OPENMP
-    for (size_t istart = 0; istart < nummon_; istart += step) {
-#ifdef _OPENMP
-        rank = omp_get_thread_num();
-#endif  // _OPENMP
+    SetPBC(box_);
 
-        // We loop over all the monomers, and we get all the dimers
-        // in which this monomer is involved
+    energy_ = Get3B(do_grads, use_ghost);
 
-        // In this function, istart and iend refer to the first
-        // monomer of the dimer. The second one will be found from istart+1
-        // to the total number of monomers
+    return energy_;
+}
 
-        // This iend definition is making sure that we don't go passed
-        // the number of monomers
-        size_t iend = std::min(istart + step, nummon_);
+double System::Get3B(bool do_grads, bool use_ghost) {
+    // Trimers are collected, sorted by type and evaluated in full batches
+    // by the generic N-body driver
+    return GetNB<3>(do_grads, use_ghost);
+}
 
-// Adding corresponding clusters depending on if we are within
-// OPENMP or not
+  ////////
 
-// This call will get the dimers that have as first index a monomer
-// with index between istart and iend (iend not included)
-#ifdef _OPENMP
-        std::vector<size_t> dimers = AddClustersParallel(2, cutoff2b_, istart, iend, use_ghost);
-#else
-        AddClusters(2, cutoff2b_, istart, iend, use_ghost);
-        std::vector<size_t> dimers = dimers_;
-#endif
+  double System::NBodyEnergy(bool do_grads, int N, bool use_ghost) {
+    // Check if system has been initialized
+    // If not, throw exception
+    if (!initialized_) {
+        std::string text =
+	  std::string("System has not been initialized. ") +std::to_string(N)+ std::string("B Energy calculation not possible.");
+        throw CUException(__func__, __FILE__, __LINE__, text);
+    }
 
-        // In order to continue, we need at least one dimer
-        // If the size of the dimer vector is not at least 2, means
-        // that we don't have any dimer
-        if (dimers.size() < 2) {
-            continue;
-        }
+    energy_ = 0.0;
+    std::fill(grad_.begin(), grad_.end(), 0.0);
+    std::fill(virial_.begin(), virial_.end(), 0.0);
 
-        // The way the XYZ are set, they include the virtual site,
-        // but we don't need the electrostatic virtual site for teh 2B
-        // polynomials. Thus, we need to create a pair of vectors with the right
-        // coordinates to pass to polynomials and dispersion
-        std::vector<double> xyz1;
-        std::vector<double> xyz2;
-        std::vector<double> grad1;
-        std::vector<double> grad2;
-        std::vector<double> virial(9, 0.0);  // declare virial tensor
-
-        // Define the two monomer ids that we are currently looking at
-        std::string m1 = monomers_[dimers[0]];
-        std::string m2 = monomers_[dimers[1]];
-
-        // Initialize the iteration variables
-        size_t i = 0;
-        size_t nd = 0;
-        size_t nd_tot = 0;
-        size_t nd_bad = 0;
-	
+    SetPBC(box_);
+    if (N==4)
+      energy_ = GetNB<4>(do_grads, use_ghost);
+    if (N==3)
+      energy_ = Get3B(do_grads, use_ghost);
+    if (N==2)
+      energy_ = Get2B(do_grads, use_ghost);
 
-        // Loop over all the dimers
-        while (2 * nd_tot < dimers.size()) {
-            i = (nd_tot + nd_bad + nd) * 2;
-            if (i >= dimers.size()) break;
-            bool m1_is_good = true;
-            bool m2_is_good = true;
-            // Check if we are still in the same type of pair
-            // We will pas the entire batch in the 2b calculator, but they need
-            // to be the same pair (e.g., h2o-h2o, h2o-i, cl-na...)
-            if (std::find(enforce_ttm_for_idx_.begin(), enforce_ttm_for_idx_.end(), dimers[i]) !=
-                enforce_ttm_for_idx_.end())
-                m1_is_good = false;
-            if (std::find(enforce_ttm_for_idx_.begin(), enforce_ttm_for_idx_.end(), dimers[i + 1]) !=
-                enforce_ttm_for_idx_.end())
-                m2_is_good = false;
-            if (monomers_[dimers[i]] == m1 && monomers_[dimers[i + 1]] == m2 && m1_is_good && m2_is_good) {
-                // Push the coordinates
-                for (size_t j = 0; j < 3 * nat_[dimers[i]]; j++) {
-                    xyz1.push_back(xyz_[3 * first_index_[dimers[i]] + j]);
-                    grad1.push_back(0.0);
-                }
-                for (size_t j = 0; j < 3 * nat_[dimers[i + 1]]; j++) {
-                    xyz2.push_back(xyz_[3 * first_index_[dimers[i + 1]] + j]);
-                    grad2.push_back(0.0);
-                }
-                nd++;
-            }
-            if (!m1_is_good || !m2_is_good) nd_bad++;
-
-            // If one of the monomers is different as the previous one
-            // since dimers are also ordered, means that no more dimers of that
-            // type exist. Thus, do calculation, update m? and clear xyz
-            if (monomers_[dimers[i]] != m1 || monomers_[dimers[i + 1]] != m2 || i == dimers.size() - 2 ||
-                nd == maxNDimEval_ || !m1_is_good || !m2_is_good) {
-                if (nd == 0) {
-                    xyz1.clear();
-                    xyz2.clear();
-                    grad1.clear();
-                    grad2.clear();
-                    std::fill(virial.begin(), virial.end(), 0.0);
-                    m1 = monomers_[dimers[i]];
-                    m2 = monomers_[dimers[i + 1]];
-                    continue;
-                }
+    return energy_;
+}
+ 
+std::vector<double> System::CheckNBodyPrecision(int N, bool use_ghost) {
+    // With the selected precisions
+    const double energy_selected = NBodyEnergy(true, N, use_ghost);
+    const std::vector<double> grad_selected = grad_;
+    const std::vector<double> virial_selected = virial_;
 
-                // Fix dimer positions if pbc
-                if (use_pbc_) {
-                    systools::GetCloseDimerImage(box_, box_inverse_, nat_[dimers[nd_tot * 2]],
-                                                 nat_[dimers[nd_tot * 2 + 1]], nd, xyz1.data(), xyz2.data());
-                }
+    // With all the polynomials in double precision
+    ParamRegistry::PrecisionTable precisions;
+    precisions.swap(fragmented_precision_);
 
-                // Check if this pair needs to use MB-nrg
-                bool use_poly = true;
-                for (size_t i2b = 0; i2b < ignore_2b_poly_.size(); i2b++) {
-                    std::vector<std::string> v1 = ignore_2b_poly_[i2b];
-                    std::vector<std::string> v2 = {m1, m2};
-                    std::sort(v1.begin(), v1.end());
-                    std::sort(v2.begin(), v2.end());
-
-                    if (v1 == v2) {
-                        use_poly = false;
-                        break;
-                    }
-                }
+    double energy_double = 0.0;
+    try {
+        energy_double = NBodyEnergy(true, N, use_ghost);
+    } catch (...) {
+        precisions.swap(fragmented_precision_);
+        throw;
+    }
+    precisions.swap(fragmented_precision_);
 
-                if (use_poly) {
-                    if (do_grads) {
-                        // POLYNOMIALS
-                        e2b_pool[rank] += e2b::get_2b_energy(m1, m2, nd, xyz1, xyz2, grad1, grad2, &virial);
+    double max_grad_diff = 0.0;
+    double max_grad = 0.0;
+    for (size_t i = 0; i < grad_.size(); i++) {
+        max_grad_diff = std::max(max_grad_diff, std::fabs(grad_selected[i] - grad_[i]));
+        max_grad = std::max(max_grad, std::fabs(grad_[i]));
+    }
 
-                        for (size_t k = 0; k < 9; k++) {  // accumulate virial tensor from pool
+    energy_ = energy_selected;
+    grad_ = grad_selected;
+    virial_ = virial_selected;
 
-                            virial_pool[rank][k] += virial[k];
-                        }
-                        // Update gradients in system
-                        size_t i0 = nd_tot * 2;
-                        for (size_t k = 0; k < nd; k++) {
-                            // Monomer 1
-                            for (size_t j = 0; j < 3 * nat_[dimers[i0 + 2 * k]]; j++) {
-                                grad_pool[rank][3 * first_index_[dimers[i0 + 2 * k]] + j] +=
-                                    grad1[k * 3 * nat_[dimers[i0 + 2 * k]] + j];
-                            }
-                            // Monomer 2
-                            for (size_t j = 0; j < 3 * nat_[dimers[i0 + 2 * k + 1]]; j++) {
-                                grad_pool[rank][3 * first_index_[dimers[i0 + 2 * k + 1]] + j] +=
-                                    grad2[k * 3 * nat_[dimers[i0 + 2 * k + 1]] + j];
-                            }
-                        }
-                    } else {
-                        e2b_pool[rank] += e2b::get_2b_energy(m1, m2, nd, xyz1, xyz2);
-                    }
-                }
+    return {std::fabs(energy_selected - energy_double), max_grad_diff, max_grad};
+}
 
-                // Update loop variables and clear other temporary variable
-                nd_tot += nd + nd_bad;
-                nd = 0;
-                nd_bad = 0;
-                xyz1.clear();
-                xyz2.clear();
-                grad1.clear();
-                grad2.clear();
-                std::fill(virial.begin(), virial.end(), 0.0);  // clear virial tensor
-                m1 = monomers_[dimers[i]];
-                m2 = monomers_[dimers[i + 1]];
-            }
-        }
+void System::LogNBodyPrecision() {
+    // Orders with some polynomial in single precision. The polynomials are
+    // named after their monomers, joined by '_' (e.g. OW_OW_OW).
+    std::vector<bool> use_float(5, false);
+    for (auto it = fragmented_precision_.begin(); it != fragmented_precision_.end(); it++) {
+        size_t n = std::count(it->first.begin(), it->first.end(), '_') + 1;
+        if (it->second == Polynomial::single_precision && n < use_float.size()) use_float[n] = true;
+    }
+
+    for (int n = 2; n <= 4; n++) {
+        if (!use_float[n]) continue;
+        std::vector<double> diff = CheckNBodyPrecision(n);
+        std::cerr << "**PRECISION** " << n << "B polynomials in single precision: |dE| = " << diff[0]
+                  << " kcal/mol, largest |dgrad| = " << diff[1] << " kcal/mol/A (largest |grad| = " << diff[2]
+                  << ")\n";
     }
+}
+
+template <size_t NB>
+double System::GetNB(bool do_grads, bool use_ghost) {
+    const size_t nb = NB;
+    const double cutoffNb = nb == 2 ? cutoff2b_ : (nb == 3 ? cutoff3b_ : cutoff4b_);
+
+    // Variables needed for OMP
+    int num_threads = 1;
 
 #ifdef _OPENMP
-#pragma omp parallel private(first_grad, last_grad, rank)
+#pragma omp parallel
     {
-        rank = omp_get_thread_num();
-
-        first_grad = 0 + rank * grad_step;
+        // Get the number of threads
+        if (omp_get_thread_num() == 0) num_threads = omp_get_num_threads();
+    }
+#endif  // _OPENMP
 
-        last_grad = (rank + 1) * grad_step;
+    // Variables to be used for both serial and parallel implementation
+    int rank = 0;
 
-        if (rank == num_threads - 1) {
-            last_grad = 3 * numsites_;
-        }
-#pragma omp barrier
-#endif
+    // Build (or reuse) the neighbor list shared by all threads
+    UpdateNeighborList(cutoffNb);
+    UpdateClusterList(nb, cutoffNb, use_ghost);
+
+    // PHASE 1: Collect all the N-mers of the system.
+    // The roots are split in chunks of similar estimated cost. Threads
+    // process their own chunks first and then steal chunks from the
+    // others. Each thread stores the N-mers in its own buffer, and
+    // remembers where the N-mers of each chunk are.
+    ClusterScheduler scheduler;
+    scheduler.Plan(neighbor_list_, nb, cutoffNb, num_threads);
+    const size_t nchunks = scheduler.GetNumChunks();
+    std::vector<std::vector<size_t>> thread_nmers(num_threads);
+    std::vector<const std::vector<size_t> *> chunk_nmers(nchunks, 0);
+    std::vector<std::pair<size_t, size_t>> chunk_range(nchunks);
 
-        // Condensate gradients
-        //	const double scale = use_ghost ? 0.5 : 1.0;
-        const double scale = 1.0;  // only accumulate force on local particles in LAMMPS
-        for (int i = 0; i < num_threads; i++) {
-            for (size_t j = first_grad; j < last_grad; j++) {
-                grad_[j] += scale * grad_pool[i][j];
-            }
+#ifdef _OPENMP
+#pragma omp parallel private(rank)
+    {
+        rank = omp_get_thread_num();
+#endif  // _OPENMP
+        size_t chunk, istart, iend;
+        while (scheduler.Next(rank, chunk)) {
+            scheduler.GetChunk(chunk, istart, iend);
+            chunk_nmers[chunk] = &thread_nmers[rank];
+            chunk_range[chunk].first = thread_nmers[rank].size();
+            FindClusters(nb, cutoffNb, istart, iend, use_ghost, thread_nmers[rank]);
+            chunk_range[chunk].second = thread_nmers[rank].size();
         }
-
 #ifdef _OPENMP
     }  // parallel
-#endif
-
-    // Condensate energy
-    for (int i = 0; i < num_threads; i++) {
-        e2b_t += e2b_pool[i];
-    }
+#endif  // _OPENMP
 
-    if (use_ghost) e2b_t *= 0.5;
-    // Condensate virial
-    const double scalev = use_ghost ? 0.5 : 1.0;
-    for (int i = 0; i < num_threads; i++) {
-        for (size_t j = 0; j < 9; j++) {
-            virial_[j] += scalev * virial_pool[i][j];
-        }
-    }
+    NMerBatches batches;
+    BatchNMers(nb, use_ghost, chunk_nmers, chunk_range, batches);
+    std::vector<std::vector<size_t>>().swap(thread_nmers);
 
-#ifdef DEBUG
-    std::cerr << "disp = " << edisp_t << "    2b = " << e2b_t << std::endl;
-#endif
-
-    return e2b_t + edisp_t;
+    return EvaluateNMers<NB>(do_grads, use_ghost, batches);
 }
 
-double System::ThreeBodyEnergy(bool do_grads, bool use_ghost) {
-    // Check if system has been initialized
-    // If not, throw exception
-    if (!initialized_) {
-        std::string text =
-            std::string("System has not been initialized. ") + std::string("3B Energy calculation not possible.");
-        throw CUException(__func__, __FILE__, __LINE__, text);
+void System::GetFusedNB(bool do_grads, double *enb, bool use_ghost) {
+    // With a skin, the clusters of each size are cached separately
+    if (cluster_skin_ > 0.0) {
+        enb[0] = GetNB<2>(do_grads, use_ghost);
+        enb[1] = GetNB<3>(do_grads, use_ghost);
+        enb[2] = GetNB<4>(do_grads, use_ghost);
+        return;
     }
 
-    energy_ = 0.0;
-    std::fill(grad_.begin(), grad_.end(), 0.0);
-    std::fill(virial_.begin(), virial_.end(), 0.0);
-
-    SetPBC(box_);
-
-    energy_ = Get3B(do_grads, use_ghost);
-
-    return energy_;
-}
-
-double System::Get3B(bool do_grads, bool use_ghost) {
-    // 3B ENERGY
-    double e3b_t = 0.0;
-
-    const double one_third = 1.0 / 3.0;
+    const double cutoffs[3] = {cutoff2b_, cutoff3b_, cutoff4b_};
 
     // Variables needed for OMP
-    size_t step = 1;
     int num_threads = 1;
 
 #ifdef _OPENMP
@@ -2399,652 +2480,422 @@ double System::Get3B(bool do_grads, bool use_ghost) {
         // Get the number of threads
         if (omp_get_thread_num() == 0) num_threads = omp_get_num_threads();
     }
-    // Define variables to be used later in the condensation of data
-    int grad_step = 3 * numsites_ / num_threads;
-    step = std::max(size_t(1), std::min(nummon_ / num_threads, step));
 #endif  // _OPENMP
 
     // Variables to be used for both serial and parallel implementation
-    size_t first_grad = 0;
-    size_t last_grad = 3 * numsites_;
     int rank = 0;
 
-    // Vector pools that allow compatibility between
-    // serial and parallel implementation
-    std::vector<double> e3b_pool(num_threads, 0.0);
-    std::vector<std::vector<double>> grad_pool(num_threads, std::vector<double>(3 * numsites_, 0.0));
-    std::vector<std::vector<double>> virial_pool(num_threads, std::vector<double>(9, 0.0));  // declare virial pool
+    // Build (or reuse) the neighbor list shared by all threads
+    UpdateNeighborList(std::max(cutoff2b_, std::max(cutoff3b_, cutoff4b_)));
+
+    // PHASE 1: Collect all the dimers, trimers and tetramers of the system
+    // in a single search. Same as in GetNB, with one buffer per size in
+    // each thread. The cost of a root is dominated by its tetramers, which
+    // are searched from the trimers.
+    ClusterScheduler scheduler;
+    scheduler.Plan(neighbor_list_, 4, std::max(cutoff3b_, cutoff4b_), num_threads);
+    const size_t nchunks = scheduler.GetNumChunks();
+    std::vector<std::vector<std::vector<size_t>>> thread_nmers(num_threads, std::vector<std::vector<size_t>>(3));
+    std::vector<const std::vector<size_t> *> chunk_nmers(3 * nchunks, 0);
+    std::vector<std::pair<size_t, size_t>> chunk_range(3 * nchunks);
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic) private(rank)
-#endif  // _OPENMP
-    for (size_t istart = 0; istart < nummon_; istart += step) {
-#ifdef _OPENMP
+#pragma omp parallel private(rank)
+    {
         rank = omp_get_thread_num();
-#endif
-
-        // We loop over all the monomers, and we get all the trimers
-        // in which this monomer is involved
-
-        // In this function, istart and iend refer to the first
-        // monomer of the trimer. The second and third ones will
-        // be found from istart+1 to the total number of monomers
-
-        // This iend definition is making sure that we don't go passed
-        // the number of monomers
-
-        size_t iend = std::min(istart + step, nummon_);
-
+#endif  // _OPENMP
+        SubgraphEnumerator enumerator;
+        std::vector<size_t> *buffers = thread_nmers[rank].data();
+        size_t chunk, istart, iend;
+        while (scheduler.Next(rank, chunk)) {
+            scheduler.GetChunk(chunk, istart, iend);
+            for (size_t s = 0; s < 3; s++) {
+                chunk_nmers[s * nchunks + chunk] = &buffers[s];
+                chunk_range[s * nchunks + chunk].first = buffers[s].size();
+            }
+            for (size_t i = istart; i < iend; i++) {
+                neighbor_list_.GetAllClusters(4, cutoffs, i, islocal_, use_ghost, enumerator, buffers);
+            }
+            for (size_t s = 0; s < 3; s++) chunk_range[s * nchunks + chunk].second = buffers[s].size();
+        }
 #ifdef _OPENMP
-        std::vector<size_t> trimers = AddClustersParallel(3, cutoff3b_, istart, iend, use_ghost);
-#else
-        AddClusters(3, cutoff3b_, istart, iend, use_ghost);
-        std::vector<size_t> trimers = trimers_;
-#endif
+    }  // parallel
+#endif  // _OPENMP
 
-        // In order to continue, we need at least one dimer
-        // If the size of the dimer vector is not at least 2, means
-        // that we don't have any dimer
-        if (trimers.size() < 3) {
-            continue;
+    // Each size is bucketed and evaluated as in GetNB
+    for (size_t nb = 2; nb <= 4; nb++) {
+        const size_t s = nb - 2;
+        std::vector<const std::vector<size_t> *> size_nmers(chunk_nmers.begin() + s * nchunks,
+                                                            chunk_nmers.begin() + (s + 1) * nchunks);
+        std::vector<std::pair<size_t, size_t>> size_range(chunk_range.begin() + s * nchunks,
+                                                          chunk_range.begin() + (s + 1) * nchunks);
+        NMerBatches batches;
+        BatchNMers(nb, use_ghost, size_nmers, size_range, batches);
+        for (int t = 0; t < num_threads; t++) std::vector<size_t>().swap(thread_nmers[t][s]);
+
+        if (nb == 2) {
+            enb[s] = EvaluateNMers<2>(do_grads, use_ghost, batches);
+        } else if (nb == 3) {
+            enb[s] = EvaluateNMers<3>(do_grads, use_ghost, batches);
+        } else {
+            enb[s] = EvaluateNMers<4>(do_grads, use_ghost, batches);
         }
+    }
+}
 
-        // The way the XYZ are set, they include the virtual site,
-        // but we don't need the electrostatic virtual site for teh 2B
-        // polynomials. Thus, we need to create a pair of vectors with the right
-        // coordinates to pass to polynomials and dispersion
-        std::vector<double> coord1;
-        std::vector<double> coord2;
-        std::vector<double> coord3;
-        std::string m1 = monomers_[trimers[0]];
-        std::string m2 = monomers_[trimers[1]];
-        std::string m3 = monomers_[trimers[2]];
-
-        // Initialize the iteration variables
-        size_t i = 0;
-        size_t nt = 0;
-        size_t nt_tot = 0;
-
-        // if ghost monomers included, then force maxNTriEval == 1 to properly tally energy+virial
-        // should we just overwrite maxNTriEval_?
-        size_t _maxNTriEval = (use_ghost) ? 1 : maxNTriEval_;
-
-        // Loop over all the trimers
-        while (3 * nt_tot < trimers.size()) {
-            i = (nt_tot + nt) * 3;
-
-            // Check if we are still in the same type of trimer
-            if (monomers_[trimers[i]] == m1 && monomers_[trimers[i + 1]] == m2 && monomers_[trimers[i + 2]] == m3) {
-                // Push the coordinates
-                for (size_t j = 0; j < 3 * nat_[trimers[i]]; j++) {
-                    coord1.push_back(xyz_[3 * first_index_[trimers[i]] + j]);
-                }
-                for (size_t j = 0; j < 3 * nat_[trimers[i + 1]]; j++) {
-                    coord2.push_back(xyz_[3 * first_index_[trimers[i + 1]] + j]);
-                }
-                for (size_t j = 0; j < 3 * nat_[trimers[i + 2]]; j++) {
-                    coord3.push_back(xyz_[3 * first_index_[trimers[i + 2]] + j]);
-                }
-                nt++;
+void System::BatchNMers(size_t nb, bool use_ghost, const std::vector<const std::vector<size_t> *> &chunk_nmers,
+                        const std::vector<std::pair<size_t, size_t>> &chunk_range, NMerBatches &nmer_batches) {
+    const size_t nchunks = chunk_nmers.size();
+    const size_t maxNEval = nb == 2 ? maxNDimEval_ : (nb == 3 ? maxNTriEval_ : maxNTetEval_);
+    const std::vector<std::vector<std::string>> &ignore_poly =
+        nb == 2 ? ignore_2b_poly_ : (nb == 3 ? ignore_3b_poly_ : ignore_4b_poly_);
+
+    const size_t ntypes = kernels_.GetNumTypes();
+
+    // Dimers with monomers that have to use TTM are not evaluated
+    std::vector<char> skip_mon(nummon_, 0);
+    if (nb == 2) {
+        for (size_t i = 0; i < enforce_ttm_for_idx_.size(); i++) skip_mon[enforce_ttm_for_idx_[i]] = 1;
+    }
+
+    // Merge the buffers of the threads in the order of the chunks, so the
+    // final list does not depend on the number of threads, and bucket the
+    // N-mers by their tuple of monomer types. If ghost monomers are
+    // included, the number of local monomers is part of the key too,
+    // so all the N-mers of a batch have the same energy scaling.
+    std::vector<size_t> &nmers = nmer_batches.nmers;
+    std::vector<std::pair<size_t, size_t>> &order = nmer_batches.order;
+    nmers.clear();
+    order.clear();
+    for (size_t c = 0; c < nchunks; c++) {
+        const std::vector<size_t> &bn = *chunk_nmers[c];
+        for (size_t i = chunk_range[c].first; i < chunk_range[c].second; i += nb) {
+            size_t key = 0;
+            bool skip = false;
+            for (size_t k = 0; k < nb; k++) {
+                skip = skip || skip_mon[bn[i + k]];
+                key += use_ghost ? islocal_[bn[i + k]] : 0;
             }
+            if (skip) continue;
+            for (size_t k = 0; k < nb; k++) key = key * ntypes + mon_type_id_[bn[i + k]];
 
-            // If one of the monomers is different as the previous one
-            // since trimers are also ordered, means that no more trimers of that
-            // type exist. Thus, do calculation, update m? and clear xyz
-            if (monomers_[trimers[i]] != m1 || monomers_[trimers[i + 1]] != m2 || monomers_[trimers[i + 2]] != m3 ||
-                i == trimers.size() - 3 || nt == _maxNTriEval) {
-                if (nt == 0) {
-                    coord1.clear();
-                    coord2.clear();
-                    coord3.clear();
-                    m1 = monomers_[trimers[i]];
-                    m2 = monomers_[trimers[i + 1]];
-                    m3 = monomers_[trimers[i + 2]];
-                    continue;
-                }
+            order.push_back(std::make_pair(key, nmers.size() / nb));
+            nmers.insert(nmers.end(), bn.begin() + i, bn.begin() + i + nb);
+        }
+    }
+    std::sort(order.begin(), order.end());
+
+    // The kernel of each bucket is resolved here, once. Buckets without
+    // polynomial, or whose polynomials are ignored, are dropped.
+    std::vector<std::pair<size_t, size_t>> runs;
+    std::vector<const NMerKernel *> run_kernels;
+    for (size_t run_start = 0; run_start < order.size();) {
+        size_t run_end = run_start + 1;
+        while (run_end < order.size() && order[run_end].first == order[run_start].first) run_end++;
+
+        const size_t *first = nmers.data() + nb * order[run_start].second;
+        size_t types[4];
+        for (size_t k = 0; k < nb; k++) types[k] = mon_type_id_[first[k]];
+        const NMerKernel &kernel = kernels_.GetKernel(nb, types);
+
+        // Check if this N-mer needs to use MB-nrg
+        bool use_poly = kernel.kernel != 0;
+        std::vector<std::string> v2(kernel.mon, kernel.mon + nb);
+        for (size_t ip = 0; ip < ignore_poly.size() && use_poly; ip++) {
+            std::vector<std::string> v1 = ignore_poly[ip];
+            std::sort(v1.begin(), v1.end());
+            if (v1 == v2) use_poly = false;
+        }
 
-                // Fix trimer positions if pbc
-                if (use_pbc_) {
-                    systools::GetCloseTrimerImage(box_, box_inverse_, nat_[trimers[nt_tot * 3]],
-                                                  nat_[trimers[nt_tot * 3 + 1]], nat_[trimers[nt_tot * 3 + 2]], nt,
-                                                  coord1, coord2, coord3);
-                }
+        if (use_poly) {
+            runs.push_back(std::make_pair(run_start, run_end));
+            run_kernels.push_back(&kernel);
+        }
 
-                // Check if this pair needs to use MB-nrg
-                bool use_poly = true;
-                for (size_t i3b = 0; i3b < ignore_3b_poly_.size(); i3b++) {
-                    std::vector<std::string> v1 = ignore_3b_poly_[i3b];
-                    std::vector<std::string> v2 = {m1, m2, m3};
-                    std::sort(v1.begin(), v1.end());
-                    std::sort(v2.begin(), v2.end());
-
-                    if (v1 == v2) {
-                        use_poly = false;
-                        break;
-                    }
-                }
+        run_start = run_end;
+    }
 
-                if (use_poly) {
-		  std::vector<double> xyz1(coord1.size(), 0.0);
-		  std::vector<double> xyz2(coord2.size(), 0.0);
-		  std::vector<double> xyz3(coord3.size(), 0.0);
-		  std::copy(coord1.begin(), coord1.end(), xyz1.begin());
-		  std::copy(coord2.begin(), coord2.end(), xyz2.begin());
-		  std::copy(coord3.begin(), coord3.end(), xyz3.begin());
-
-		  if (do_grads) {
-		    // POLYNOMIALS
-		    std::vector<double> grad1(coord1.size(), 0.0);
-		    std::vector<double> grad2(coord2.size(), 0.0);
-		    std::vector<double> grad3(coord3.size(), 0.0);
-		    std::vector<double> virial(9, 0.0);  // declare virial tensor
-		    // POLYNOMIALS
-		    double e = e3b::get_3b_energy(m1, m2, m3, nt, xyz1, xyz2, xyz3, grad1, grad2, grad3, &virial);
-
-		    double escale = 1.0;
-		    if (use_ghost)
-		      escale = (islocal_[trimers[i]] + islocal_[trimers[i + 1]] + islocal_[trimers[i + 2]]) *
-			one_third;
-		    e3b_pool[rank] += escale * e;
-
-		    // Update gradients
-		    size_t i0 = nt_tot * 3;
-		    for (size_t k = 0; k < nt; k++) {
-		      // Monomer 1
-		      for (size_t j = 0; j < 3 * nat_[trimers[i0 + 3 * k]]; j++) {
-			grad_pool[rank][3 * first_index_[trimers[i0 + 3 * k]] + j] +=
-			  grad1[k * 3 * nat_[trimers[i0 + 3 * k]] + j];
-		      }
-		      // Monomer 2
-		      for (size_t j = 0; j < 3 * nat_[trimers[i0 + 3 * k + 1]]; j++) {
-			grad_pool[rank][3 * first_index_[trimers[i0 + 3 * k + 1]] + j] +=
-			  grad2[k * 3 * nat_[trimers[i0 + 3 * k + 1]] + j];
-		      }
-		      // Monomer 3
-		      for (size_t j = 0; j < 3 * nat_[trimers[i0 + 3 * k + 2]]; j++) {
-			grad_pool[rank][3 * first_index_[trimers[i0 + 3 * k + 2]] + j] +=
-			  grad3[k * 3 * nat_[trimers[i0 + 3 * k + 2]] + j];
-		      }
-		    
-		    }
-		    // Virial Tensor
-                        for (size_t j = 0; j < 9; j++) {
-                            virial_pool[rank][j] += escale * virial[j];
-                        }
+    // N-mers outside the support of their kernel have zero energy, and are
+    // dropped before their coordinates are gathered. The distances are
+    // the minimum image ones of the neighbor list, which are never longer
+    // than the ones the kernel sees. Pairs not in the list are farther
+    // than its cutoff.
+    std::vector<char> keep(order.size(), 1);
+    const double list_cutoff = neighbor_list_.GetCutoff();
+    for (size_t r = 0; r < runs.size(); r++) {
+        const nbody::Support &support = run_kernels[r]->support;
+        if (support.min_pairs == 0) continue;
+        const double ro2 = support.ro * support.ro;
+        const bool far_inside = support.ro > list_cutoff;
 
-		  } else {
-                        // POLYNOMIALS
-                        double e = e3b::get_3b_energy(m1, m2, m3, nt, xyz1, xyz2, xyz3);
-                        double escale = 1.0;
-                        if (use_ghost)
-                            escale = (islocal_[trimers[i]] + islocal_[trimers[i + 1]] + islocal_[trimers[i + 2]]) *
-                                     one_third;
-                        e3b_pool[rank] += escale * e;
-		  }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif  // _OPENMP
+        for (size_t i = runs[r].first; i < runs[r].second; i++) {
+            const size_t *nmer = nmers.data() + nb * order[i].second;
+            size_t npairs = 0;
+            for (size_t a = 0; a < nb; a++) {
+                for (size_t b = a + 1; b < nb; b++) {
+                    const double d2 = neighbor_list_.GetDistance2(nmer[a], nmer[b]);
+                    npairs += d2 < 0.0 ? far_inside : d2 < ro2;
                 }
-
-                // Update iteration variables
-                nt_tot += nt;
-                nt = 0;
-                coord1.clear();
-                coord2.clear();
-                coord3.clear();
-                m1 = monomers_[trimers[i]];
-                m2 = monomers_[trimers[i + 1]];
-                m3 = monomers_[trimers[i + 2]];
             }
+            keep[i] = npairs >= support.min_pairs;
         }
     }
 
-#ifdef _OPENMP
-#pragma omp parallel private(first_grad, last_grad, rank)
-    {
-        rank = omp_get_thread_num();
-
-        first_grad = 0 + rank * grad_step;
-
-        last_grad = (rank + 1) * grad_step;
-        if (rank == num_threads - 1) {
-            last_grad = 3 * numsites_;
-        }
-#pragma omp barrier
-#endif
-
-        // Condensate gradients
-        for (int i = 0; i < num_threads; i++) {
-            for (size_t j = first_grad; j < last_grad; j++) {
-                grad_[j] += grad_pool[i][j];
+    // Cut each bucket in batches of at most maxNEval of the N-mers kept
+    std::vector<std::pair<size_t, size_t>> &batches = nmer_batches.batches;
+    std::vector<const NMerKernel *> &batch_kernels = nmer_batches.kernels;
+    batches.clear();
+    batch_kernels.clear();
+    size_t nkept = 0;
+    size_t nskipped = 0;
+    for (size_t r = 0; r < runs.size(); r++) {
+        const size_t kept_start = nkept;
+        for (size_t i = runs[r].first; i < runs[r].second; i++) {
+            if (keep[i]) {
+                order[nkept++] = order[i];
+            } else {
+                nskipped++;
             }
         }
-
-#ifdef _OPENMP
-    }  // parallel
-#endif
-
-    // Condensate energy
-    for (int i = 0; i < num_threads; i++) {
-        e3b_t += e3b_pool[i];
-    }
-    // Condensate virial
-    for (int i = 0; i < num_threads; i++) {
-        for (size_t j = 0; j < 9; j++) {
-            virial_[j] += virial_pool[i][j];
+        for (size_t i = kept_start; i < nkept; i += maxNEval) {
+            batches.push_back(std::make_pair(i, std::min(i + maxNEval, nkept)));
+            batch_kernels.push_back(run_kernels[r]);
         }
     }
-
-    return e3b_t;
+    order.resize(nkept);
+    nmers_skipped_[nb - 2] = nskipped;
 }
 
-  ////////
-
-  double System::NBodyEnergy(bool do_grads, int N, bool use_ghost) {
-    // Check if system has been initialized
-    // If not, throw exception
-    if (!initialized_) {
-        std::string text =
-	  std::string("System has not been initialized. ") +std::to_string(N)+ std::string("B Energy calculation not possible.");
-        throw CUException(__func__, __FILE__, __LINE__, text);
-    }
-
-    energy_ = 0.0;
-    std::fill(grad_.begin(), grad_.end(), 0.0);
-    std::fill(virial_.begin(), virial_.end(), 0.0);
+template <size_t NB>
+double System::EvaluateNMers(bool do_grads, bool use_ghost, const NMerBatches &nmer_batches) {
+    const size_t nb = NB;
 
-    SetPBC(box_);
-    if (N==4)
-      energy_ = GetNB(do_grads, N, use_ghost);
-    if (N==3)
-      energy_ = Get3B(do_grads, use_ghost);
-    if (N==2)
-      energy_ = Get2B(do_grads, use_ghost);
-
-    return energy_;
-}
- 
-  double System::GetNB(bool do_grads, int N, bool use_ghost) {
-    // 4B ENERGY
+    // N-BODY ENERGY
     double enb_t = 0.0;
-    const double one_N = 1.0 / N;
+    const double one_N = 1.0 / nb;
+    const std::vector<size_t> &nmers = nmer_batches.nmers;
+    const std::vector<std::pair<size_t, size_t>> &order = nmer_batches.order;
+    const std::vector<std::pair<size_t, size_t>> &batches = nmer_batches.batches;
+    const std::vector<const NMerKernel *> &batch_kernels = nmer_batches.kernels;
 
     // Variables needed for OMP
-    size_t step = 1;
-    
     int num_threads = 1;
 
 #ifdef _OPENMP
 #pragma omp parallel
     {
-      // Get the number of threads
-      if (omp_get_thread_num() == 0) num_threads = omp_get_num_threads();
+        // Get the number of threads
+        if (omp_get_thread_num() == 0) num_threads = omp_get_num_threads();
     }
-    // Define variables to be used later in the condensation of data
-    int grad_step = 3 * numsites_ / num_threads;
-    step = std::max(size_t(1), std::min(nummon_ / num_threads, step));
 #endif  // _OPENMP
 
     // Variables to be used for both serial and parallel implementation
-    size_t first_grad = 0;
-    size_t last_grad = 3 * numsites_;
     int rank = 0;
 
     // Vector pools that allow compatibility between
     // serial and parallel implementation
     std::vector<double> enb_pool(num_threads, 0.0);
-    std::vector<std::vector<double>> grad_pool(num_threads, std::vector<double>(3 * numsites_, 0.0));
     std::vector<std::vector<double>> virial_pool(num_threads, std::vector<double>(9, 0.0));  // declare virial pool
+    std::vector<std::vector<double>> batch_virial_pool(num_threads, std::vector<double>(9, 0.0));
+
+    // The coordinates of each batch are gathered in the arena of its
+    // thread, which only grows, so batches do not allocate memory
+    if (nmer_xyz_arena_.size() < size_t(num_threads)) nmer_xyz_arena_.resize(num_threads);
+
+    // PHASE 2: Evaluate the batches.
+    // The gradients of each batch are written in their own slice of
+    // nmer_grad_. They are then added to grad_ monomer by monomer, so
+    // each monomer is updated by a single thread, always in the same
+    // order. Batches are evaluated in waves to bound the size of
+    // nmer_grad_, which is kept between calls.
+    const size_t max_grad_size = std::max(size_t(1) << 22, 3 * numsites_);
+    std::vector<size_t> batch_grad(batches.size(), 0);
+    for (size_t wave_start = 0; wave_start < batches.size();) {
+        size_t wave_end = batches.size();
+        if (do_grads) {
+            // Slices of the gradients of the batches of this wave
+            size_t grad_size = 0;
+            for (wave_end = wave_start; wave_end < batches.size(); wave_end++) {
+                const size_t *first = nmers.data() + nb * order[batches[wave_end].first].second;
+                size_t size = 0;
+                for (size_t k = 0; k < nb; k++) size += 3 * nat_[first[k]];
+                size *= batches[wave_end].second - batches[wave_end].first;
+                if (wave_end > wave_start && grad_size + size > max_grad_size) break;
+                batch_grad[wave_end] = grad_size;
+                grad_size += size;
+            }
+            nmer_grad_.assign(grad_size, 0.0);
+        }
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic) private(rank)
 #endif  // _OPENMP
-    for (size_t istart = 0; istart < nummon_; istart += step) {
+        for (size_t ib = wave_start; ib < wave_end; ib++) {
 #ifdef _OPENMP
-      rank = omp_get_thread_num();
-#endif
-      
-      // We loop over all the monomers, and we get all the trimers
-      // in which this monomer is involved
+            rank = omp_get_thread_num();
+#endif  // _OPENMP
 
-      // In this function, istart and iend refer to the first
-      // monomer of the trimer. The second and third ones will
-      // be found from istart+1 to the total number of monomers
+            const size_t bstart = batches[ib].first;
+            const size_t nt = batches[ib].second - bstart;
+
+            // The polynomials are evaluated in the precisions of this system
+            ParamRegistry::PrecisionScope precision_scope(fragmented_precision_);
+
+            // All N-mers of the batch have the same monomer types
+            const NMerKernel &kernel = *batch_kernels[ib];
+            const size_t *first = nmers.data() + nb * order[bstart].second;
+            std::array<size_t, NB> nat_vec;
+            size_t ncoords = 0;
+            double escale = 1.0;
+            if (use_ghost) escale = 0.0;
+            for (size_t k = 0; k < nb; k++) {
+                nat_vec[k] = nat_[first[k]];
+                ncoords += 3 * nat_vec[k] * nt;
+                if (use_ghost) escale += islocal_[first[k]];
+            }
+            if (use_ghost) escale *= one_N;
+
+            // Coordinates of monomer k of the N-mers of the batch
+            std::vector<double> &arena = nmer_xyz_arena_[rank];
+            if (arena.size() < ncoords) arena.resize(ncoords);
+            std::array<double *, NB> coord_vec;
+            coord_vec[0] = arena.data();
+            for (size_t k = 1; k < nb; k++) coord_vec[k] = coord_vec[k - 1] + 3 * nat_vec[k - 1] * nt;
+
+            // Gather the coordinates of the batch
+            for (size_t t = 0; t < nt; t++) {
+                const size_t *nmer = nmers.data() + nb * order[bstart + t].second;
+                for (size_t k = 0; k < nb; k++) {
+                    std::copy(xyz_.begin() + 3 * first_index_[nmer[k]],
+                              xyz_.begin() + 3 * first_index_[nmer[k]] + 3 * nat_vec[k],
+                              coord_vec[k] + 3 * nat_vec[k] * t);
+                }
+            }
 
-      // This iend definition is making sure that we don't go passed
-      // the number of monomers
-      
-      size_t iend = std::min(istart + step, nummon_);
+            // Fix N-mer positions if pbc. Every monomer is moved to its
+            // image closest to the first one.
+            if (use_pbc_) {
+                for (size_t k = 1; k < nb; k++) {
+                    systools::GetCloseDimerImage(box_, box_inverse_, nat_vec[0], nat_vec[k], nt, coord_vec[0],
+                                                 coord_vec[k]);
+                }
+            }
 
-      //std::vector<size_t> nmers;
-      std::vector<size_t> nmers;
+            // The kernel takes the monomers in its canonical order
+            const double *xyz_ptr[NB];
+            for (size_t k = 0; k < nb; k++) xyz_ptr[k] = coord_vec[kernel.perm[k]];
 
-#ifdef Debug
-      std::cout<<"Computing N-mers:"<<std::endl;
-#endif
-      
-#ifdef _OPENMP
-      if(N==2)
-	nmers = AddClustersParallel(2, cutoff2b_, istart, iend, use_ghost);
-      if(N==3)
-	nmers = AddClustersParallel(3, cutoff3b_, istart, iend, use_ghost);
-      if(N==4)
-      	nmers = AddClustersParallel(4, cutoff4b_, istart, iend, use_ghost);
-#else
-      if(N==2){
-	AddClusters(2, cutoff2b_, istart, iend, use_ghost);
-	nmers = dimers_;
-      }
-      if(N==3){
-	AddClusters(3, cutoff3b_, istart, iend, use_ghost);
-	nmers = trimers_;
-      }
-      if(N==4){
-      	AddClusters(4, cutoff4b_, istart, iend, use_ghost);
-      	nmers = tetramers_;
-      }
-#endif
-
-      // In order to continue, we need at least one dimer
-      // If the size of the dimer vector is not at least 2, means
-      // that we don't have any dimer
-	
-      if (nmers.size() < N) {
-	continue;
-      }
-	
-      // The way the XYZ are set, they include the virtual site,
-      // but we don't need the electrostatic virtual site for teh 2B
-      // polynomials. Thus, we need to create a pair of vectors with the right
-      // coordinates to pass to polynomials and dispersion
+            if (do_grads) {
+                // Gradients of monomer k of the N-mers of the batch
+                double *grad_vec[NB];
+                grad_vec[0] = nmer_grad_.data() + batch_grad[ib];
+                for (size_t k = 1; k < nb; k++) grad_vec[k] = grad_vec[k - 1] + 3 * nat_vec[k - 1] * nt;
+                double *grad_ptr[NB];
+                for (size_t k = 0; k < nb; k++) grad_ptr[k] = grad_vec[kernel.perm[k]];
+                std::vector<double> &virial = batch_virial_pool[rank];  // virial tensor of the batch
+                std::fill(virial.begin(), virial.end(), 0.0);
+
+                // POLYNOMIALS
+                double e = kernel.kernel(kernel.mon, nt, xyz_ptr, grad_ptr, &virial);
+
+                enb_pool[rank] += escale * e;
+
+                // Virial Tensor
+                for (size_t j = 0; j < 9; j++) {
+                    virial_pool[rank][j] += escale * virial[j];
+                }
+            } else {
+                // POLYNOMIALS
+                double e = kernel.kernel(kernel.mon, nt, xyz_ptr, 0, 0);
 
+                enb_pool[rank] += escale * e;
+            }
+        }
 
+        if (do_grads) {
+            // List, for each monomer, of the positions of its gradients
+            // in nmer_grad_, in compressed sparse row format
+            nmer_grad_offsets_.assign(nummon_ + 1, 0);
+            for (size_t ib = wave_start; ib < wave_end; ib++) {
+                for (size_t i = batches[ib].first; i < batches[ib].second; i++) {
+                    const size_t *nmer = nmers.data() + nb * order[i].second;
+                    for (size_t k = 0; k < nb; k++) nmer_grad_offsets_[nmer[k]]++;
+                }
+            }
+            for (size_t m = 1; m < nummon_; m++) nmer_grad_offsets_[m] += nmer_grad_offsets_[m - 1];
+            if (nummon_ > 0) nmer_grad_offsets_[nummon_] = nmer_grad_offsets_[nummon_ - 1];
+            nmer_grad_index_.resize(nmer_grad_offsets_[nummon_]);
+
+            // Filled backwards, so the offsets end up pointing to the
+            // first position of each monomer
+            for (size_t ib = wave_end; ib-- > wave_start;) {
+                const size_t nt = batches[ib].second - batches[ib].first;
+                const size_t *first = nmers.data() + nb * order[batches[ib].first].second;
+                for (size_t t = nt; t-- > 0;) {
+                    const size_t *nmer = nmers.data() + nb * order[batches[ib].first + t].second;
+                    size_t pos = batch_grad[ib];
+                    for (size_t k = 0; k < nb; k++) {
+                        const size_t pos_k = pos + 3 * nat_[first[k]] * t;
+                        pos += 3 * nat_[first[k]] * nt;
+                        nmer_grad_index_[--nmer_grad_offsets_[nmer[k]]] = pos_k;
+                    }
+                }
+            }
 
-#ifdef Debug
-      std::cout<<"Writing N-mers:"<<std::endl;
-      for (int i = 0; i < nmers.size(); i++){
-	std::cout << nmers[i] << " ";
-	if((i+1)%N==0){
-	  std::cout<<std::endl;
-	}
-      }
-#endif
-      
-      
-      std::vector<std::string> m_vec(N);
-      std::vector<std::vector<double>> coord_vec(N);// , vector<double> (3,0)); 
-      
-      for (int i = 0; i < N; i++)
-	m_vec[i]=monomers_[nmers[i]];
-    
-      size_t _maxNEval;
-      if(N==2){
-	_maxNEval = (use_ghost) ? 1 : maxNDimEval_;
-      }
-      else if(N==3){
-	_maxNEval = (use_ghost) ? 1 : maxNTriEval_;
-      }
-      else if(N==4){
-      	_maxNEval = (use_ghost) ? 1 : maxNTetEval_;
-      }
-
-      // Initialize the iteration variables
-      size_t i = 0;
-      size_t nt = 0;
-      size_t nt_tot = 0;
-
-      // if ghost monomers included, then force maxNTriEval == 1 to properly tally energy+virial
-      // should we just overwrite maxNTriEval_?
-        
-
-      // Loop over all the trimers
-      while (N * nt_tot < nmers.size()) {
-	i = (nt_tot + nt) * N;
-// #ifdef Debug
-// 	std::cout << "i: "<<i<< ", nt: "<<nt<<", nt_tot: "<<nt_tot<<std::endl;
-// #endif
-	
-	bool sameNmer = true;
-	for (int k = 0; k < N; k++)
-	  sameNmer = sameNmer and (m_vec[k] == monomers_[nmers[i+k]]);
-	    
-	// Check if we are still in the same type of trimer
-	if (sameNmer) {
-	  for (int k = 0; k < N; k++){
-	    for (size_t j = 0; j < 3 * nat_[nmers[i+k]]; j++) 
-	      coord_vec[k].push_back(xyz_[3 * first_index_[nmers[i+k]] + j]);
-	  }
-	  nt++;
-	} 
-
-	bool diffMonomer = false;
-	for (int k = 0; k < N; k++)
-	  diffMonomer = diffMonomer || (monomers_[nmers[i+k]]!=m_vec[k]);
-	diffMonomer = diffMonomer ||(nt == _maxNEval)||(i == nmers.size() - N);
-
-
-// #ifdef Debug
-// 	std::cout << "sameNmer: " << sameNmer << ", diffNmer: " << diffMonomer <<std::endl;
-// #endif
-
-	// If one of the monomers is different as the previous one
-	// since trimers are also ordered, means that no more trimers of that
-	// type exist. Thus, do calculation, update m? and clear xyz
-	if (diffMonomer) {
-	  if (nt == 0) {
-	    for (int k = 0; k < N; k++)
-	      {
-		coord_vec[k].clear();
-		m_vec[k]=monomers_[nmers[i+k]];
-	      }
-	    continue;
-	  }
- 
-	  // Fix trimer positions if pbc
- 		 
-	  if (use_pbc_) {
-	    if(N==2){
-	      systools::GetCloseDimerImage(box_, box_inverse_, nat_[nmers[nt_tot * N]],
-					   nat_[nmers[nt_tot * N + 1]], nt,
-					   coord_vec[0].data(), coord_vec[1].data());
-	    }
-	    else if(N==3){
-	      systools::GetCloseTrimerImage(box_, box_inverse_, nat_[nmers[nt_tot * N]],
-					    nat_[nmers[nt_tot * N + 1]],nat_[nmers[nt_tot * N + 2]], nt,
-					    coord_vec[0], coord_vec[1], coord_vec[2]);
-	    }  
-	    else{
-	      for (int k = 0; k < N; k++){
-		systools::GetCloseDimerImage(box_, box_inverse_, nat_[nmers[nt_tot * N]],
-					     nat_[nmers[nt_tot * N + k]], nt,
-					     coord_vec[0].data(), coord_vec[k].data());
-	      }
-	    }
-	  }
-	    
-	  // Check if this pair needs to use MB-nrg
-	  bool use_poly = true;
-	  std::vector<std::string> v1;
-	  std::vector<std::string> v2;
-	  if(N==2){
-	    for (size_t i2b = 0; i2b < ignore_2b_poly_.size(); i2b++) {
-	      v1 = ignore_2b_poly_[i2b];
-	      v2 = {m_vec[0], m_vec[1]};
-	      std::sort(v1.begin(), v1.end());
-	      std::sort(v2.begin(), v2.end());
-
-	      if (v1 == v2) {
-		use_poly = false;
-		break;
-	      }
-	    }
-	  }
-	  else if(N==3){
-	    for (size_t i3b = 0; i3b < ignore_3b_poly_.size(); i3b++) {
-	      v1 = ignore_3b_poly_[i3b];
-	      v2 = {m_vec[0], m_vec[1], m_vec[2]};
-	      std::sort(v1.begin(), v1.end());
-	      std::sort(v2.begin(), v2.end());
-
-	      if (v1 == v2) {
-		use_poly = false;
-		break;
-	      }
-	    }
-	  }
-	  else if(N==4){
-	    for (size_t i4b = 0; i4b < ignore_4b_poly_.size(); i4b++) {
-	      v1 = ignore_4b_poly_[i4b];
-	      v2 = {m_vec[0], m_vec[1], m_vec[2], m_vec[3]};
-	      std::sort(v1.begin(), v1.end());
-	      std::sort(v2.begin(), v2.end());
-
-	      if (v1 == v2) {
-		use_poly = false;
-		break;
-	      }
-	    }
-
-	  }
-
-
-
-	  double escale = 1.0;
-	  if (use_ghost)
-	    {
-	      escale = 0.0;
-	      for (int k = 0; k < N; k++)
-		escale += islocal_[nmers[i+k]];
-	      escale=escale*one_N;
-	    }
- 		   
-	  if (use_poly) {
-	    ////CONTINUE
-	    std::vector<std::vector<double>> xyz_vec;
-	    for (int k = 0; k < N; k++)
-	      xyz_vec.push_back(coord_vec[k]);
-	    
-		//	      std::copy(coord_vec[k].begin(), coord_vec[k].end(), xyz_vec[k].begin());
-
-	    if (do_grads) {
-	      
-	      // POLYNOMIALS
-	      std::vector<std::vector<double>> grad_vec(N);
-	      for (int k = 0; k < N; k++)
-		grad_vec[k] = std::vector<double>(coord_vec[k].size(),0);
-	      
-		  //grad_vec.push_back(std::vector<double>(coord_vec[k].size(), 0.0));
-			  
-	      std::vector<double> virial(9, 0.0);  // declare virial tensor
-	      // POLYNOMIALS
-	      double e;
-	      if(N==2)
-		e = e2b::get_2b_energy(m_vec[0], m_vec[1], nt, xyz_vec[0], xyz_vec[1],  grad_vec[0], grad_vec[1], &virial);
-	      if(N==3)
-		e = e3b::get_3b_energy(m_vec[0], m_vec[1], m_vec[2], nt, xyz_vec[0], xyz_vec[1], xyz_vec[2], grad_vec[0], grad_vec[1],grad_vec[2], &virial);
-	      if(N==4)
-		e = e4b::get_4b_energy(m_vec[0], m_vec[1], m_vec[2], m_vec[3], nt, xyz_vec[0], xyz_vec[1], xyz_vec[2],xyz_vec[3], grad_vec[0], grad_vec[1],grad_vec[2],grad_vec[3], &virial);
-
-	      enb_pool[rank] += escale * e;
-		
-	      // Update gradients
-	      size_t i0 = nt_tot * N;
-	      for (size_t k = 0; k < nt; k++) {
-		
-		// For each monomer
-		for (int l = 0; l < N; l++){
-		  for (size_t j = 0; j < 3 * nat_[nmers[i0 + N * k + l]]; j++) {
-		    grad_pool[rank][3 * first_index_[nmers[i0 + N * k + l]] + j] +=
-		      grad_vec[l][k * 3 * nat_[nmers[i0 + N * k + l]] + j]; 
-		  }
-		}
-		
-	      }
-	      // Virial Tensor
-	      for (size_t j = 0; j < 9; j++) {
-		virial_pool[rank][j] += escale * virial[j];
-	      }
- 
-	    } else {
-	      // POLYNOMIALS
-	      double e;
-	      if(N==2)
-		e = e2b::get_2b_energy(m_vec[0], m_vec[1], nt, xyz_vec[0], xyz_vec[1]);
-	      if(N==3)
-		e = e3b::get_3b_energy(m_vec[0], m_vec[1], m_vec[2], nt, xyz_vec[0], xyz_vec[1], xyz_vec[2]);
-	      if(N==4)
-		e = e4b::get_4b_energy(m_vec[0], m_vec[1], m_vec[2], m_vec[3], nt, xyz_vec[0], xyz_vec[1], xyz_vec[2],xyz_vec[3]);
-
-	      enb_pool[rank] += escale * e;
-	    }
-	  }
-	  
-	  // Update iteration variables
-	  nt_tot += nt;
-	  nt = 0;
-	  for (int l = 0; l < N; l++)
-	    {
-	    coord_vec[l].clear();
-	    m_vec[l]=monomers_[nmers[i+l]];    
-	    }
-	}
-      }
-    }
-  
+            // Each monomer is updated by one thread
 #ifdef _OPENMP
-#pragma omp parallel private(first_grad, last_grad, rank)
-    {
-      rank = omp_get_thread_num();
-
-      first_grad = 0 + rank * grad_step;
-
-      last_grad = (rank + 1) * grad_step;
-      if (rank == num_threads - 1) {
-	last_grad = 3 * numsites_;
-      }
-#pragma omp barrier
-#endif
-
-      // Condensate gradients
-      for (int i = 0; i < num_threads; i++) {
-	for (size_t j = first_grad; j < last_grad; j++) {
-	  grad_[j] += grad_pool[i][j];
-	}
-      }
+#pragma omp parallel for schedule(static)
+#endif  // _OPENMP
+            for (size_t m = 0; m < nummon_; m++) {
+                double *g = grad_.data() + 3 * first_index_[m];
+                for (size_t c = nmer_grad_offsets_[m]; c < nmer_grad_offsets_[m + 1]; c++) {
+                    const double *gn = nmer_grad_.data() + nmer_grad_index_[c];
+                    for (size_t j = 0; j < 3 * nat_[m]; j++) g[j] += gn[j];
+                }
+            }
+        }
 
-#ifdef _OPENMP
-    }  // parallel
-#endif
+        wave_start = wave_end;
+    }
 
     // Condensate energy
-    for (int i = 0; i < num_threads; i++) 
-      enb_t += enb_pool[i];
-	  
-    // Condensate virial
     for (int i = 0; i < num_threads; i++) {
-      for (size_t j = 0; j < 9; j++) {
-	virial_[j] += virial_pool[i][j];
-      }
+        enb_t += enb_pool[i];
     }
-      
-    return enb_t;
-      
-  }
-
-
 
+    // Condensate virial
+    for (int i = 0; i < num_threads; i++) {
+        for (size_t j = 0; j < 9; j++) {
+            virial_[j] += virial_pool[i][j];
+        }
+    }
 
-  
+    return enb_t;
+}
 
 
-  
 ////////////////////////////////////////////////////////////////////////////////
 
 void System::SetCharges() {
     // Set charges for each monomer type
     size_t fi_mon = 0;
     for (size_t k = 0; k < mon_type_count_.size(); k++) {
-        std::string mon = mon_type_count_[k].first;
+        const MonomerType &type = mon_types_->GetType(k);
         size_t nmon = mon_type_count_[k].second;
-        size_t nsites = sites_[fi_mon];
-
-        systools::SetCharges(xyz_, chg_, mon, nmon, nsites, first_index_[fi_mon], chggrad_, monomers_j_);
+        size_t nsites = type.nsites;
+
+        if (type.charge_model == WATER_DMS_CHARGES) {
+            // Charges depend on the geometry of each monomer
+            systools::SetCharges(xyz_, chg_, type.id, nmon, nsites, first_index_[fi_mon], chggrad_, monomers_j_);
+        } else {
+            double *chg = chg_.data() + first_index_[fi_mon];
+            for (size_t nv = 0; nv < nmon; nv++) {
+                std::copy(type.charges.begin(), type.charges.end(), chg + nv * nsites);
+            }
+        }
         fi_mon += nmon;
     }
 
@@ -3075,11 +2926,14 @@ void System::SetPols() {
     // Set polarizabilities for each monomer type
     size_t fi_mon = 0;
     for (size_t k = 0; k < mon_type_count_.size(); k++) {
-        std::string mon = mon_type_count_[k].first;
+        const MonomerType &type = mon_types_->GetType(k);
         size_t nmon = mon_type_count_[k].second;
-        size_t nsites = sites_[fi_mon];
+        size_t nsites = type.nsites;
 
-        systools::SetPol(pol_, mon, nmon, nsites, first_index_[fi_mon], monomers_j_);
+        double *pol = pol_.data() + first_index_[fi_mon];
+        for (size_t nv = 0; nv < nmon; nv++) {
+            std::copy(type.pol.begin(), type.pol.end(), pol + nv * nsites);
+        }
         fi_mon += nmon;
     }
 
@@ -3107,11 +2961,14 @@ void System::SetPolfacs() {
     // Set polarizability factors for each monomer type
     size_t fi_mon = 0;
     for (size_t k = 0; k < mon_type_count_.size(); k++) {
-        std::string mon = mon_type_count_[k].first;
+        const MonomerType &type = mon_types_->GetType(k);
         size_t nmon = mon_type_count_[k].second;
-        size_t nsites = sites_[fi_mon];
+        size_t nsites = type.nsites;
 
-        systools::SetPolfac(polfac_, mon, nmon, nsites, first_index_[fi_mon], monomers_j_);
+        double *polfac = polfac_.data() + first_index_[fi_mon];
+        for (size_t nv = 0; nv < nmon; nv++) {
+            std::copy(type.polfac.begin(), type.polfac.end(), polfac + nv * nsites);
+        }
         fi_mon += nmon;
     }
 
@@ -3189,11 +3046,12 @@ void System::SetVSites() {
     // Set virtual sites for each monomer type
     size_t fi_mon = 0;
     for (size_t k = 0; k < mon_type_count_.size(); k++) {
-        std::string mon = mon_type_count_[k].first;
+        const MonomerType &type = mon_types_->GetType(k);
         size_t nmon = mon_type_count_[k].second;
-        size_t nsites = sites_[fi_mon];
 
-        systools::SetVSites(xyz_, mon, nmon, nsites, first_index_[fi_mon]);
+        if (type.vsite_model != NO_VSITES) {
+            systools::SetVSites(xyz_, type.id, nmon, type.nsites, first_index_[fi_mon]);
+        }
         fi_mon += nmon;
     }
 
@@ -3474,6 +3332,7 @@ double System::GetElectrostatics(bool do_grads, bool use_ghost) {
     electrostaticE_.SetNewParameters(xyz_, chg_, chggrad_, pol_, polfac_, dipole_method_, do_grads, box_, cutoff2b_);
     electrostaticE_.SetDipoleTolerance(diptol_);
     electrostaticE_.SetDipoleMaxIt(maxItDip_);
+    electrostaticE_.SetDipoleTensorCache(dipole_tensor_cache_mb_);
     electrostaticE_.SetEwaldAlpha(elec_alpha_);
     electrostaticE_.SetEwaldGridDensity(elec_grid_density_);
     electrostaticE_.SetEwaldSplineOrder(elec_spline_order_);
@@ -3716,6 +3575,8 @@ double System::GetBuckingham(bool do_grads, bool use_ghost) {
 
 void System::ResetDipoleHistory() { electrostaticE_.ResetAspcHistory(); }
 
+std::vector<size_t> System::GetInfoSkippedNMers() { return nmers_skipped_; }
+
 std::vector<size_t> System::GetInfoElectrostaticsCounts() { return electrostaticE_.GetInfoCounts(); }
 std::vector<double> System::GetInfoElectrostaticsTimings() { return electrostaticE_.GetInfoTimings(); }
 
@@ -49,6 +49,9 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #include "kdtree/kdtree_utils.h"
 #include "json/json.h"
 #include "bblock/sys_tools.h"
+#include "bblock/kernel_registry.h"
+#include "bblock/monomer_type_table.h"
+#include "bblock/cluster_scheduler.h"
 #include "tools/definitions.h"
 #include "tools/custom_exceptions.h"
 #include "tools/math_tools.h"
@@ -74,6 +77,8 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #include "potential/buckingham/buckingham.h"
 // ELECTROSTATICS
 #include "potential/electrostatics/electrostatics.h"
+// N-BODY POLYNOMIAL PARAMETERS
+#include "potential/fragmented/ParamRegistry.h"
 
 /**
  * @file system.h
@@ -784,10 +789,17 @@ class System {
 
     /**
      * Sets the iterative dipole method. See documentation for available methods
-     * @param[in] method String with the method abbreviation (iter, cg or aspc)
+     * @param[in] method String with the method abbreviation (iter, cg, pcg or aspc)
      */
     void SetDipoleMethod(std::string method);
 
+    /**
+     * Sets the memory available to keep the real space dipole-dipole tensors
+     * between the induced dipole iterations, instead of recomputing them
+     * @param[in] max_mb Maximum memory in MB. 0 to always recompute them
+     */
+    void SetDipoleTensorCache(double max_mb);
+
     /**
      * Resets the dipole history when using ASPC. If other method is used,
      * this function does nothing.
@@ -974,6 +986,24 @@ class System {
      */
     double NBodyEnergy(bool do_grads, int N, bool use_ghost = 0);
 
+    /**
+     * Checks the N-body polynomials evaluated in single precision
+     * ("fragmented_precision" in the json file). It is done, and logged,
+     * in the first energy call of a system that uses single precision.
+     *
+     * Computes the N-body energy and gradients of the current configuration
+     * with the selected precisions and with all the polynomials in double
+     * precision, and compares them. The energy, gradients and virial of the
+     * selected precisions are kept.
+     * @param[in] N Number of monomers of the N-body term (2, 3 or 4)
+     * @param[in] use_ghost If true, include ghost monomers in calculation. Otherwise,
+     * only local monomers included (default)
+     * @return Vector with the absolute difference of the energies, the largest
+     * absolute difference of a gradient component, and the largest absolute
+     * gradient component in double precision
+     */
+    std::vector<double> CheckNBodyPrecision(int N, bool use_ghost = 0);
+
     /**
      * Obtains the electrostatic energy. This is the sum of the permanent
      * and induced electrostatics
@@ -1027,10 +1057,58 @@ class System {
      */
     double Buckingham(bool do_grads, bool use_ghost = 0);
 
+    /**
+     * Gets the number of dimers, trimers and tetramers that were skipped in
+     * the last N-body evaluation of each size because they were outside the
+     * support of the switch of their polynomials (see nbody::Support).
+     * @return Vector with the number of skipped dimers, trimers and tetramers
+     */
+    std::vector<size_t> GetInfoSkippedNMers();
+
     std::vector<size_t> GetInfoElectrostaticsCounts();
     std::vector<double> GetInfoElectrostaticsTimings();
 
    private:
+    /**
+     * Compares the energies and gradients of the current configuration
+     * with double precision (see CheckNBodyPrecision), for each of the 2b,
+     * 3b and 4b terms with some polynomial in single precision, and writes
+     * the differences to the standard error.
+     */
+    void LogNBodyPrecision();
+
+    /**
+     * Builds the monomer neighbor list shared by all the N-body terms, if
+     * the one stored is not valid for the current coordinates. The list
+     * is built with the largest of the N-body cutoffs.
+     * @param[in] cutoff Largest cutoff that will be requested to the list
+     */
+    void UpdateNeighborList(double cutoff);
+
+    /**
+     * Prepares the cache of clusters of size nmax if a cluster skin is
+     * used. The cache is emptied when the neighbor list is rebuilt, and
+     * filled as the clusters are requested.
+     * @param[in] nmax Size of the clusters (2, 3 or 4)
+     * @param[in] cutoff Cutoff of the clusters
+     * @param[in] use_ghost Local/ghost selection of the clusters
+     */
+    void UpdateClusterList(size_t nmax, double cutoff, bool use_ghost);
+
+    /**
+     * Appends to nmers the clusters of nmax monomers whose lowest index
+     * is between istart and iend (not included). Uses the cluster cache
+     * if there is one, and the neighbor list otherwise.
+     * @param[in] nmax Size of the clusters (2, 3 or 4)
+     * @param[in] cutoff Cutoff of the clusters
+     * @param[in] istart Minimum index of i
+     * @param[in] iend Maximum index (iend not included) of index i
+     * @param[in] use_ghost Local/ghost selection of the clusters
+     * @param[in,out] nmers Vector where the clusters are appended
+     */
+    void FindClusters(size_t nmax, double cutoff, size_t istart, size_t iend, bool use_ghost,
+                      std::vector<size_t> &nmers);
+
     /**
      * Fills the dimers_(i,j) and/or trimers_(i,j,k) vectors, with
      * i < j < k. These i,j,k are the index of the corresponding monomer
@@ -1139,15 +1217,88 @@ class System {
     /**
      * Private function to internally get the Nb energy.
      * Gradients of the system will be updated.
+     * All the N-mers of the system are collected first in a single list,
+     * which is sorted by the types of the monomers. The search is split
+     * in chunks of roots of similar estimated cost (see ClusterScheduler). Each group of N-mers
+     * of the same type is then cut in batches of up to maxN{Dim,Tri,Tet}Eval_
+     * N-mers, and the batches are evaluated in parallel.
      * @param[in] do_grads Boolean. If true, gradients will be computed.
      * If false, gradients won't be computed.
+     * @tparam NB Number of bodies (2, 3 or 4).
      * @param[in] use_ghost Boolean. If true, include ghost monomers in calculation. Otherwise,
      * only local monomers included (default)
-     * @param[in] N int. Number of bodies body.
-     * @param[in] nmers vector of int. Vector containing N-mers.
      * @return  N-body energy of the system
      */
-    double GetNB(bool do_grads, int N, bool use_ghost=0);
+    template <size_t NB>
+    double GetNB(bool do_grads, bool use_ghost = 0);
+
+    /**
+     * Private function to internally get the 2b, 3b and 4b energies at
+     * once. All the dimers, trimers and tetramers are collected in a single
+     * search of the neighbor list (see NeighborList::EnumerateAllClusters),
+     * each one with its own cutoff, and are then evaluated as in GetNB.
+     * If the cluster lists have a skin, GetNB is called for each size instead.
+     * Gradients of the system will be updated.
+     * @param[in] do_grads Boolean. If true, gradients will be computed.
+     * If false, gradients won't be computed.
+     * @param[out] enb Array with the 2b, 3b and 4b energies
+     * @param[in] use_ghost Boolean. If true, include ghost monomers in calculation. Otherwise,
+     * only local monomers included (default)
+     */
+    void GetFusedNB(bool do_grads, double *enb, bool use_ghost = 0);
+
+    /**
+     * @brief N-mers of one size, bucketed by the types of their monomers
+     * and cut in batches
+     */
+    struct NMerBatches {
+        /**
+         * Monomer indexes of the N-mers, one N-mer after the other
+         */
+        std::vector<size_t> nmers;
+        /**
+         * Bucket key and position in nmers of each N-mer, sorted by key
+         */
+        std::vector<std::pair<size_t, size_t>> order;
+        /**
+         * Range of each batch in order
+         */
+        std::vector<std::pair<size_t, size_t>> batches;
+        /**
+         * Kernel of each batch
+         */
+        std::vector<const NMerKernel *> kernels;
+    };
+
+    /**
+     * Merges the N-mers found by the threads in the order of the chunks
+     * of the search, buckets them by monomer types and cuts the buckets
+     * in batches of up to maxN{Dim,Tri,Tet}Eval_ N-mers. The buckets
+     * without polynomials are dropped, and so are the N-mers outside the
+     * support of their kernel, whose energy is zero. The number of the
+     * latter is stored in nmers_skipped_.
+     * @param[in] nb Number of monomers of the N-mers
+     * @param[in] use_ghost Local/ghost selection of the N-mers
+     * @param[in] chunk_nmers Buffer where the N-mers of each chunk are
+     * @param[in] chunk_range Range of the N-mers of each chunk in its buffer
+     * @param[out] nmer_batches N-mers in batches
+     */
+    void BatchNMers(size_t nb, bool use_ghost, const std::vector<const std::vector<size_t> *> &chunk_nmers,
+                    const std::vector<std::pair<size_t, size_t>> &chunk_range, NMerBatches &nmer_batches);
+
+    /**
+     * Evaluates the polynomials of the batches in parallel. Gradients of
+     * the system and the virial will be updated. The coordinates of each
+     * batch are gathered in nmer_xyz_arena_, so no memory is allocated
+     * per batch.
+     * @tparam NB Number of monomers of the N-mers
+     * @param[in] do_grads Boolean. If true, gradients will be computed.
+     * @param[in] use_ghost Local/ghost selection of the N-mers
+     * @param[in] nmer_batches N-mers in batches, from BatchNMers
+     * @return N-body energy of the N-mers
+     */
+    template <size_t NB>
+    double EvaluateNMers(bool do_grads, bool use_ghost, const NMerBatches &nmer_batches);
 
     /**
      * Private function to internally get the electrostatic energy.
@@ -1271,6 +1422,12 @@ class System {
      */
     double diptol_;
 
+    /**
+     * Memory in MB available to cache the dipole-dipole tensors in the
+     * induced dipole calculation. 0 to not cache them
+     */
+    double dipole_tensor_cache_mb_;
+
     /**
      * Ewald alpha for electrostatics
      */
@@ -1415,6 +1572,43 @@ class System {
      */
     std::vector<size_t> first_index_;
 
+    /**
+     * Neighbor list of the monomers. It is built once per set of
+     * coordinates and shared by all the N-body terms and threads.
+     */
+    NeighborList neighbor_list_;
+
+    /**
+     * Skin added to the cutoffs in the neighbor list. The clusters found
+     * with cutoff + skin are reused until a monomer moves more than
+     * skin/2. A skin of 0 disables the reuse.
+     */
+    double cluster_skin_;
+
+    /**
+     * Cached clusters for each size (2, 3, 4) and local/ghost selection,
+     * used when cluster_skin_ is larger than 0
+     */
+    std::vector<ClusterList> cluster_lists_;
+
+    /**
+     * Precision of the batched N-body polynomials of this system, by
+     * polynomial name ("fragmented_precision" in the json file)
+     */
+    ParamRegistry::PrecisionTable fragmented_precision_;
+
+    /**
+     * If true, the polynomials in single precision are compared with double
+     * precision, and the result logged, in the first energy call
+     */
+    bool check_nbody_precision_;
+
+    /**
+     * True once the polynomials in single precision have been compared with
+     * double precision, and the result logged, in the first energy call
+     */
+    bool nbody_precision_checked_;
+
     /**
      * Vector that stores the dimers computed by the AddClusters functions.
      * The vector stores the two indeces of a dimer, one after the other one,
@@ -1542,6 +1736,55 @@ class System {
      */
     std::vector<std::pair<std::string, size_t> > mon_type_count_;
 
+    /**
+     * Integer type of each monomer, which is the position of its monomer id
+     * in mon_type_count_. Set in Initialize.
+     */
+    std::vector<size_t> mon_type_id_;
+
+    /**
+     * Dispatch table from tuples of monomer types to N-body kernels
+     */
+    KernelRegistry kernels_;
+
+    /**
+     * Parameters of each monomer type, with the sites of the types
+     * including the virtual sites. Compiled in Initialize and shared
+     * with the electrostatics, dispersion, Lennard-Jones and buckingham
+     * terms. It is not modified once compiled, so copies of the System
+     * can share it.
+     */
+    std::shared_ptr<const MonomerTypeTable> mon_types_;
+
+    /**
+     * Gradients of the N-mers evaluated in GetNB, before they are added
+     * to grad_. Kept between calls to avoid reallocations.
+     */
+    std::vector<double> nmer_grad_;
+
+    /**
+     * Coordinates of the N-mers of the batch evaluated by each thread in
+     * GetNB. Kept between calls to avoid reallocations.
+     */
+    std::vector<std::vector<double>> nmer_xyz_arena_;
+
+    /**
+     * nmer_grad_offsets_[m] is the position in nmer_grad_index_ of the
+     * first gradient of monomer m in nmer_grad_
+     */
+    std::vector<size_t> nmer_grad_offsets_;
+
+    /**
+     * Positions in nmer_grad_ of the gradients of each monomer
+     */
+    std::vector<size_t> nmer_grad_index_;
+
+    /**
+     * Number of dimers, trimers and tetramers skipped in the last call to
+     * BatchNMers of each size, because their energy was zero by construction
+     */
+    std::vector<size_t> nmers_skipped_;
+
     /**
      * This vector contains the pairs that will use TTM-nrg instead of MB-nrg for 1b
      */
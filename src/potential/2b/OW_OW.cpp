@@ -29,7 +29,8 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 ******************************************************************************/
 
 #include "potential/2b/OW_OW.h"
-#include "potential/fragmented/FitFuncs.h"
+#include "potential/fragmented/ParamRegistry.h"
+#include "tools/custom_exceptions.h"
  
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -38,53 +39,96 @@ namespace OW_OW_namespace {
 //----------------------------------------------------------------------------//
 
 OW_OW::OW_OW(const std::string mon0, const std::string mon1) {
-    int fitfuncs_index = 0;
-    std::vector<Polynomial*> polynomials;
-
-    FitFuncs::add_polynomials(polynomials);
-
-    for(int i = 0; i < polynomials.size(); i++) {
-        if(i == fitfuncs_index) {
-            this->poly = polynomials[i];
-        } else {
-            delete polynomials[i];
-        }
+    // Shared by all the instances. Its parameters are read on the first request.
+    poly = &ParamRegistry::get_polynomial("OW_OW");
+
+    // Tabulate the dimer energy up to the outer cutoff of the switch
+    const double ro = poly->get_ro();
+    const size_t nintervals = static_cast<size_t>(std::ceil((ro - table_rmin) / table_spacing));
+    table.Build([this](double r, double& dedr) { return this->eval_polynomial(r, dedr); }, table_rmin, ro,
+                nintervals);
+
+    // A table that does not reproduce the polynomial would silently change
+    // the energies, so it is rejected
+    const tools::RadialTableError error = check_table();
+    if (error.value > table_tolerance * error.max_value || error.derivative > table_tolerance * error.max_derivative) {
+        std::ostringstream text;
+        text << "The table of the OW_OW polynomial does not reproduce it: the largest error of the energy is "
+             << error.value << " (at r = " << error.r_value << ") and of its derivative " << error.derivative
+             << " (at r = " << error.r_derivative << "), for a largest energy of " << error.max_value
+             << " and derivative of " << error.max_derivative << ". The spacing of the table is too large for "
+             << "these parameters.";
+        throw CUException(__func__, __FILE__, __LINE__, text.str());
     }
+}
 
-    std::string param_file = "OW_OW.params";
-
-    // parse nl params and coefficients
+//----------------------------------------------------------------------------//
 
-    std::ifstream poly_file(param_file.c_str());
-    std::string tmp;
-    std::string line1, line2;
-    getline(poly_file, line1);
-    getline(poly_file, line2);
+double OW_OW::eval_polynomial(double r, double& dedr) const {
+    // Kept between calls, so the short dimers do not allocate
+    static thread_local std::vector<double> scratch;
+    if (scratch.size() < poly->get_scratch_size()) scratch.resize(poly->get_scratch_size());
 
-    std::stringstream stream(line1 + " " + line2);
-    std::vector<double> nl_params;
-    std::vector<double> coefficients;
+    const double xyz[6] = {0.0, 0.0, 0.0, r, 0.0, 0.0};
+    double grad[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    const double energy = poly->eval_gradient(xyz, grad, 0, scratch.data());
+    dedr = grad[3];
+    return energy;
+}
 
-    stream >> tmp;
-    stream >> tmp;
+//----------------------------------------------------------------------------//
 
-    for(int i = 0; i < poly->get_num_nl_params(); i++) {
-        stream >> tmp;
-        nl_params.push_back(std::stod(tmp));
-    }
+tools::RadialTableError OW_OW::check_table(size_t nsamples) const {
+    return table.CheckError([this](double r, double& dedr) { return this->eval_polynomial(r, dedr); }, nsamples);
+}
 
-    stream >> tmp;
-    for(int i = 0; i < poly->get_num_coefficients(); i++) {
-        stream >> tmp;
-        coefficients.push_back(std::stod(tmp));
-    }
+//----------------------------------------------------------------------------//
 
-    poly_file.close();
-    poly->set_nl_params(nl_params);
-    poly->set_coefficients(coefficients);
+double OW_OW::eval_table(const double* xyz0, const double* xyz1, double* grad0, double* grad1, const size_t ndim,
+                         double* virial) const {
+    const double rmin = table.GetRmin();
+    const double rmax2 = table.GetRmax() * table.GetRmax();
 
-        
+    double energy = 0.0;
+    for (size_t i = 0; i < ndim; i++) {
+        const double dx = xyz0[3 * i] - xyz1[3 * i];
+        const double dy = xyz0[3 * i + 1] - xyz1[3 * i + 1];
+        const double dz = xyz0[3 * i + 2] - xyz1[3 * i + 2];
+        const double r2 = dx * dx + dy * dy + dz * dz;
+
+        // The switch is zero beyond ro
+        if (r2 >= rmax2) continue;
+
+        const double r = std::sqrt(r2);
+        double dedr;
+        energy += r >= rmin ? table.Eval(r, dedr) : eval_polynomial(r, dedr);
+
+        // Two monomers on top of each other have no direction, and the
+        // gradient is zero by symmetry
+        if (grad0 == 0 || r == 0.0) continue;
+
+        const double f = dedr / r;
+        grad0[3 * i] += f * dx;
+        grad0[3 * i + 1] += f * dy;
+        grad0[3 * i + 2] += f * dz;
+        grad1[3 * i] -= f * dx;
+        grad1[3 * i + 1] -= f * dy;
+        grad1[3 * i + 2] -= f * dz;
+
+        if (virial != 0) {
+            virial[0] -= f * dx * dx;
+            virial[1] -= f * dx * dy;
+            virial[2] -= f * dx * dz;
+            virial[3] -= f * dx * dy;
+            virial[4] -= f * dy * dy;
+            virial[5] -= f * dy * dz;
+            virial[6] -= f * dx * dz;
+            virial[7] -= f * dy * dz;
+            virial[8] -= f * dz * dz;
+        }
+    }
 
+    return energy;
 }
 
 //----------------------------------------------------------------------------//
@@ -103,44 +147,7 @@ double OW_OW::eval(const double* xyz0, const double* xyz1, const size_t ndim) co
     std::cerr << "\nEntering " << __func__ << " in " << __FILE__ << std::endl;
 #endif
 
-    std::vector<double> energies;
-
-
-    for(size_t j = 0; j < ndim; j++) {
-        std::vector<double> coords;
-
-
-        for(size_t i = 0; i < 1*3; i++)
-            coords.push_back(xyz0[j*3*1 + i]);
-
-        for(size_t i = 0; i < 1*3; i++)
-            coords.push_back(xyz1[j*3*1 + i]);
-
-
-        std::vector<double> distances;
-
-        for(int atom_index1 = 0; atom_index1 < coords.size() / 3; atom_index1++) {
-            for(int atom_index2 = atom_index1 + 1; atom_index2 < coords.size() / 3; atom_index2++) {
-                double x1, y1, z1, x2, y2, z2;
-                x1 = coords[3*atom_index1];
-                y1 = coords[3*atom_index1 + 1];
-                z1 = coords[3*atom_index1 + 2];
-                x2 = coords[3*atom_index2];
-                y2 = coords[3*atom_index2 + 1];
-                z2 = coords[3*atom_index2 + 2];
-                distances.push_back(std::sqrt(((x1 - x2) * (x1 - x2)) + ((y1 - y2) * (y1 - y2)) + ((z1 - z2) * (z1 - z2))));
-            }
-        }
-  
-
-        energies.push_back(poly->eval(distances) * poly->eval_switch(distances));
-
-    }
-
-    double energy = 0.0;
-    for (size_t i = 0; i < ndim; i++) {
-        energy += energies[i];
-    }
+    double energy = eval_table(xyz0, xyz1, 0, 0, ndim, 0);
 
 #ifdef DEBUG
     std::cerr << std::scientific << std::setprecision(10);
@@ -215,36 +222,9 @@ double OW_OW::eval(const double* xyz0, const double* xyz1, double* grad0, double
     std::cerr << std::endl;
 #endif
 
-    for (size_t j = 0; j < ndim; j++) {
-
-        std::vector<double> coords;
-
-
-
-        for(size_t i = 0; i < 1*3; i++)
-            coords.push_back(xyz0[j*3*1 + i]);
-
-        for(size_t i = 0; i < 1*3; i++)
-            coords.push_back(xyz1[j*3*1 + i]);
-
-
-        std::vector<double> grads = poly->gradient(coords, *virial);
-
-
-        for(size_t i = 0; i < 1*3; i++) {
-            grad0[j*3*1 + i] = grads[0];
-            grads.erase(grads.begin());
-        }
-
-        for(size_t i = 0; i < 1*3; i++) {
-            grad1[j*3*1 + i] = grads[0];
-            grads.erase(grads.begin());
-        }
-
-
-    }
+    double* virial_ptr = virial == 0 ? 0 : virial->data();
 
-    double energy = eval(xyz0, xyz1, ndim);
+    double energy = eval_table(xyz0, xyz1, grad0, grad1, ndim, virial_ptr);
 
 #ifdef DEBUG
     std::cerr << std::scientific << std::setprecision(10);
@@ -32,6 +32,7 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #define OW_OWHEADER
 
 #include "potential/fragmented/Polynomial.h"
+#include "tools/radial_table.h"
 
 #include <iostream>
 #include <sstream>
@@ -61,6 +62,9 @@ class OW_OW {
 
     /**
      * @brief Creates a class and initializes the parameters corresponding to mon1 and mon2
+     *
+     * Tabulates the polynomial and compares the table with it. Throws
+     * CUException if the table is not accurate enough.
      * @param[in] mon1 Monomer id of the first monomer of interest
      * @param[in] mon2 Monomer id of the second monomer of interest
      */
@@ -97,6 +101,23 @@ class OW_OW {
     double eval(const double* xyz0, const double* xyz1, double* grad0, double* grad1, const size_t ndim,
                 std::vector<double>* virial = 0) const;
 
+    /**
+     * @brief Compares the table of the dimer energy with the polynomial
+     * @param[in] nsamples Number of distances checked inside each interval of the table
+     * @return Largest errors of the energy and of its derivative with respect to the distance
+     */
+    tools::RadialTableError check_table(size_t nsamples = 4) const;
+
+    /**
+     * @return Number of monomers of the switch of the polynomial
+     */
+    int get_nb() const { return poly->get_nb(); }
+
+    /**
+     * @return Outer cutoff of the switch of the polynomial
+     */
+    double get_ro() const { return poly->get_ro(); }
+
    private:
    
     // Inner cutoff
@@ -109,7 +130,27 @@ class OW_OW {
     double f_switch(const double&, double&) const;
 
     // The polynomial
-    Polynomial* poly;
+    const Polynomial* poly;
+
+    // The switched polynomial only depends on the distance between the
+    // two monomers, and is evaluated from this table in [table_rmin, ro].
+    // Shorter dimers use the polynomial.
+    tools::RadialTable table;
+
+    // Smallest distance and width of the intervals of the table
+    static constexpr double table_rmin = 1.0;
+    static constexpr double table_spacing = 0.002;
+
+    // Largest error of the table, relative to the largest energy (or
+    // derivative) of the polynomial, checked when it is built
+    static constexpr double table_tolerance = 1e-6;
+
+    // Energy of the dimer at distance r, and its derivative, from the polynomial
+    double eval_polynomial(double r, double& dedr) const;
+
+    // Sum of the energies and gradients of the dimers, from the table
+    double eval_table(const double* xyz0, const double* xyz1, double* grad0, double* grad1, const size_t ndim,
+                      double* virial) const;
 
 };
 
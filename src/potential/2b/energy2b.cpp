@@ -41,6 +41,108 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 
 namespace e2b {
 
+namespace {
+
+// The kernels receive the monomers in canonical order (mon[0] <= mon[1])
+
+double kernel_h2o_h2o(const std::string *, size_t nm, const double *const *xyz, double *const *grad,
+                      std::vector<double> *virial) {
+    if (grad == 0) return x2o::x2b_v9x::eval(xyz[0], xyz[1], nm);
+    return x2o::x2b_v9x::eval(xyz[0], xyz[1], grad[0], grad[1], nm, virial);
+}
+
+double kernel_ion_h2o(const std::string *mon, size_t nm, const double *const *xyz, double *const *grad,
+                      std::vector<double> *virial) {
+    // The order is bc the poly were generated this way
+    // First water and then ion
+    h2o_ion::x2b_h2o_ion_v2x pot(mon[1], mon[0]);
+    if (grad == 0) return pot.eval(xyz[1], xyz[0], nm);
+    return pot.eval(xyz[1], xyz[0], grad[1], grad[0], nm, virial);
+}
+
+double kernel_h2o_ion(const std::string *mon, size_t nm, const double *const *xyz, double *const *grad,
+                      std::vector<double> *virial) {
+    h2o_ion::x2b_h2o_ion_v2x pot(mon[0], mon[1]);
+    if (grad == 0) return pot.eval(xyz[0], xyz[1], nm);
+    return pot.eval(xyz[0], xyz[1], grad[0], grad[1], nm, virial);
+}
+
+// Generated kernels go in 2B_KERNELS and their table entries in 2B_REGISTRATION.
+// These sections replace 2B_NO_GRADIENT and 2B_GRADIENT; see "Adding N-body polynomials" in README.md.
+// =====>> BEGIN SECTION 2B_KERNELS <<=====
+// =====>> PASTE YOUR CODE BELOW <<=====
+double kernel_ch4_ch4(const std::string *mon, size_t nm, const double *const *xyz, double *const *grad,
+                      std::vector<double> *virial) {
+    x2b_A1B4_A1B4_deg4_exp0::x2b_A1B4_A1B4_v1x pot(mon[0], mon[1]);
+    if (grad == 0) return pot.eval(xyz[0], xyz[1], nm);
+    return pot.eval(xyz[0], xyz[1], grad[0], grad[1], nm, virial);
+}
+
+double kernel_co2_co2(const std::string *mon, size_t nm, const double *const *xyz, double *const *grad,
+                      std::vector<double> *virial) {
+    x2b_A1B2_A1B2_deg5::x2b_A1B2_A1B2_v1x pot(mon[0], mon[1]);
+    if (grad == 0) return pot.eval(xyz[0], xyz[1], nm);
+    return pot.eval(xyz[0], xyz[1], grad[0], grad[1], nm, virial);
+}
+
+double kernel_co2_h2o(const std::string *mon, size_t nm, const double *const *xyz, double *const *grad,
+                      std::vector<double> *virial) {
+    x2b_A1B2Z2_C1D2_deg4::x2b_A1B2Z2_C1D2_v1x pot(mon[1], mon[0]);
+    if (grad == 0) return pot.eval(xyz[1], xyz[0], nm);
+    return pot.eval(xyz[1], xyz[0], grad[1], grad[0], nm, virial);
+}
+
+double kernel_ch4_h2o(const std::string *mon, size_t nm, const double *const *xyz, double *const *grad,
+                      std::vector<double> *virial) {
+    x2b_A1B2Z2_C1D4_deg3_exp0::x2b_A1B2Z2_C1D4_v1x pot(mon[1], mon[0]);
+    if (grad == 0) return pot.eval(xyz[1], xyz[0], nm);
+    return pot.eval(xyz[1], xyz[0], grad[1], grad[0], nm, virial);
+}
+// =====>> END SECTION 2B_KERNELS <<=====
+
+double kernel_ow_ow(const std::string *, size_t nm, const double *const *xyz, double *const *grad,
+                    std::vector<double> *virial) {
+    if (grad == 0) return get_pot_ow_ow().eval(xyz[0], xyz[1], nm);
+    return get_pot_ow_ow().eval(xyz[0], xyz[1], grad[0], grad[1], nm, virial);
+}
+
+// Table of the 2b kernels. Monomer ids are in canonical order.
+const nbody::Registration kernels[] = {
+    {{"h2o", "h2o"}, &kernel_h2o_h2o, 0},
+    {{"br", "h2o"}, &kernel_ion_h2o, 0},
+    {{"cl", "h2o"}, &kernel_ion_h2o, 0},
+    {{"cs", "h2o"}, &kernel_ion_h2o, 0},
+    {{"f", "h2o"}, &kernel_ion_h2o, 0},
+    {{"h2o", "i"}, &kernel_h2o_ion, 0},
+    {{"h2o", "k"}, &kernel_h2o_ion, 0},
+    {{"h2o", "li"}, &kernel_h2o_ion, 0},
+    {{"h2o", "na"}, &kernel_h2o_ion, 0},
+    {{"h2o", "rb"}, &kernel_h2o_ion, 0},
+    // =====>> BEGIN SECTION 2B_REGISTRATION <<=====
+    // =====>> PASTE YOUR CODE BELOW <<=====
+    {{"ch4", "ch4"}, &kernel_ch4_ch4, 0},
+    {{"co2", "co2"}, &kernel_co2_co2, 0},
+    {{"co2", "h2o"}, &kernel_co2_h2o, 0},
+    {{"ch4", "h2o"}, &kernel_ch4_h2o, 0},
+    // =====>> END SECTION 2B_REGISTRATION <<=====
+    {{"ow", "ow"}, &kernel_ow_ow, &nbody::SwitchedSupport<OW_OW_namespace::OW_OW, get_pot_ow_ow>},
+};
+
+}  // namespace
+
+const OW_OW_namespace::OW_OW &get_pot_ow_ow() {
+    static const OW_OW_namespace::OW_OW pot("ow", "ow");
+    return pot;
+}
+
+nbody::Kernel get_2b_kernel(const std::string *mon) {
+    return nbody::FindKernel(kernels, sizeof(kernels) / sizeof(kernels[0]), 2, mon);
+}
+
+nbody::Support get_2b_support(const std::string *mon) {
+    return nbody::FindSupport(kernels, sizeof(kernels) / sizeof(kernels[0]), 2, mon);
+}
+
 double get_2b_energy(std::string mon1, std::string mon2, size_t nm, std::vector<double> xyz1,
                      std::vector<double> xyz2) {
 
@@ -60,58 +162,9 @@ double get_2b_energy(std::string mon1, std::string mon2, size_t nm, std::vector<
     std::cerr << std::endl;
 #endif
 
-    double energy = 0.0;
-
-    // Order the two monomer names and corresponding xyz
-    if (mon2 < mon1) {
-        std::string tmp = mon1;
-        mon1 = mon2;
-        mon2 = tmp;
-        std::vector<double> tmp2 = std::move(xyz1);
-        xyz1 = std::move(xyz2);
-        xyz2 = std::move(tmp2);
-    }
-
-    // Water water
-    if (mon1 == "h2o" and mon2 == "h2o") {
-        x2o::x2b_v9x pot;
-        energy = pot.eval(xyz1.data(), xyz2.data(), nm);
-        // Ion water
-    } else if ((mon1 == "f" or mon1 == "cl" or mon1 == "br" or mon1 == "cs") and mon2 == "h2o") {
-        // The order is bc the poly were generated this way
-        // First water and then ion
-        h2o_ion::x2b_h2o_ion_v2x pot(mon2, mon1);
-        energy = pot.eval(xyz2.data(), xyz1.data(), nm);
-        // More ion water
-    } else if (mon1 == "h2o" and (mon2 == "i" or mon2 == "li" or mon2 == "na" or mon2 == "k" or mon2 == "rb")) {
-        h2o_ion::x2b_h2o_ion_v2x pot(mon1, mon2);
-        energy = pot.eval(xyz1.data(), xyz2.data(), nm);
-
-        // =====>> BEGIN SECTION 2B_NO_GRADIENT <<=====
-        // =====>> PASTE YOUR CODE BELOW <<=====
-    } else if (mon1 == "ch4" && mon2 == "ch4") {
-        x2b_A1B4_A1B4_deg4_exp0::x2b_A1B4_A1B4_v1x pot(mon1, mon2);
-        energy = pot.eval(xyz1.data(), xyz2.data(), nm);
-    } else if (mon1 == "co2" and mon2 == "co2") {
-        x2b_A1B2_A1B2_deg5::x2b_A1B2_A1B2_v1x pot(mon1, mon2);
-        energy = pot.eval(xyz1.data(), xyz2.data(), nm);
-    } else if (mon1 == "co2" and mon2 == "h2o") {
-        x2b_A1B2Z2_C1D2_deg4::x2b_A1B2Z2_C1D2_v1x pot(mon2, mon1);
-        energy = pot.eval(xyz2.data(), xyz1.data(), nm);
-    } else if (mon1 == "ch4" and mon2 == "h2o") {
-        x2b_A1B2Z2_C1D4_deg3_exp0::x2b_A1B2Z2_C1D4_v1x pot(mon2, mon1);
-        energy = pot.eval(xyz2.data(), xyz1.data(), nm);
-        // =====>> END SECTION 2B_NO_GRADIENT <<=====
-
-    }
-     else if (mon1 == "ow" and mon2 == "ow") {
-       //OW_OW_namespace::OW_OW  pot(mon1, mon2);
-        energy = pot_ow_ow.eval(xyz1.data(), xyz2.data(), nm);
-        // =====>> END SECTION 2B_NO_GRADIENT <<=====
-
-    } else {
-        energy = 0.0;
-    }
+    const std::string mon[2] = {mon1, mon2};
+    const double *xyz[2] = {xyz1.data(), xyz2.data()};
+    double energy = nbody::Evaluate(2, get_2b_kernel, mon, nm, xyz, 0, 0);
 
 #ifdef DEBUG
     std::cerr << std::scientific << std::setprecision(10);
@@ -158,69 +211,10 @@ double get_2b_energy(std::string mon1, std::string mon2, size_t nm, std::vector<
     }
 #endif
 
-    // Order the two monomer names and corresponding xyz
-    bool swaped = false;
-    if (mon2 < mon1) {
-        std::string tmp = std::move(mon1);
-        mon1 = std::move(mon2);
-        mon2 = std::move(tmp);
-        std::vector<double> tmp2 = std::move(xyz1);
-        xyz1 = std::move(xyz2);
-        xyz2 = std::move(tmp2);
-        tmp2 = std::move(grad1);
-        grad1 = std::move(grad2);
-        grad2 = std::move(tmp2);
-        swaped = true;
-    }
-
-    double energy = 0.0;
-    // Note: in the conditional, mon2 >= mon1 ALWAYS
-    if (mon1 == "h2o" and mon2 == "h2o") {
-        x2o::x2b_v9x pot;
-        energy = pot.eval(xyz1.data(), xyz2.data(), grad1.data(), grad2.data(), nm, virial);
-    } else if ((mon1 == "f" or mon1 == "cl" or mon1 == "br" or mon1 == "cs") and mon2 == "h2o") {
-        // The order is bc the poly were generated this way
-        // First water and then ion
-        h2o_ion::x2b_h2o_ion_v2x pot(mon2, mon1);
-        energy = pot.eval(xyz2.data(), xyz1.data(), grad2.data(), grad1.data(), nm, virial);
-    } else if (mon1 == "h2o" and (mon2 == "i" or mon2 == "li" or mon2 == "na" or mon2 == "k" or mon2 == "rb")) {
-        h2o_ion::x2b_h2o_ion_v2x pot(mon1, mon2);
-        energy = pot.eval(xyz1.data(), xyz2.data(), grad1.data(), grad2.data(), nm, virial);
-
-        // =====>> BEGIN SECTION 2B_GRADIENT <<=====
-        // ====>> PASTE YOUR CODE BELOW <<====
-    } else if (mon1 == "ch4" && mon2 == "ch4") {
-        x2b_A1B4_A1B4_deg4_exp0::x2b_A1B4_A1B4_v1x pot(mon1, mon2);
-        energy = pot.eval(xyz1.data(), xyz2.data(), grad1.data(), grad2.data(), nm, virial);
-    } else if (mon1 == "co2" and mon2 == "co2") {
-        x2b_A1B2_A1B2_deg5::x2b_A1B2_A1B2_v1x pot(mon1, mon2);
-        energy = pot.eval(xyz1.data(), xyz2.data(), grad1.data(), grad2.data(), nm, virial);
-    } else if (mon1 == "co2" and mon2 == "h2o") {
-        x2b_A1B2Z2_C1D2_deg4::x2b_A1B2Z2_C1D2_v1x pot(mon2, mon1);
-        energy = pot.eval(xyz2.data(), xyz1.data(), grad2.data(), grad1.data(), nm, virial);
-    } else if (mon1 == "ch4" and mon2 == "h2o") {
-        x2b_A1B2Z2_C1D4_deg3_exp0::x2b_A1B2Z2_C1D4_v1x pot(mon2, mon1);
-        energy = pot.eval(xyz2.data(), xyz1.data(), grad2.data(), grad1.data(), nm, virial);
-
-
-        // =====>> END SECTION 2B_GRADIENT <<=====
-    }
-     else if (mon1 == "ow" and mon2 == "ow") {
-       //OW_OW_namespace::OW_OW pot(mon1, mon2);
-        energy = pot_ow_ow.eval(xyz1.data(), xyz2.data(), grad1.data(), grad2.data(), nm, virial);
-	
-     }
-    
- else {
-        energy = 0.0;
-    }
-
-    // Reseting gradients in original order if necessary
-    if (swaped) {
-        std::vector<double> tmp2 = std::move(grad2);
-        grad2 = std::move(grad1);
-        grad1 = std::move(tmp2);
-    }
+    const std::string mon[2] = {mon1, mon2};
+    const double *xyz[2] = {xyz1.data(), xyz2.data()};
+    double *grad[2] = {grad1.data(), grad2.data()};
+    double energy = nbody::Evaluate(2, get_2b_kernel, mon, nm, xyz, grad, virial);
 
 #ifdef DEBUG
     std::cerr << std::scientific << std::setprecision(10);
@@ -38,6 +38,7 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #include <string>
 #include <vector>
 #include <iostream>
+#include "potential/nbody_kernel.h"
 
 // 2B
 #include "potential/2b/x2b-v9x.h"
@@ -63,6 +64,25 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
  */
 namespace e2b {
 
+/**
+ * @brief Gets the kernel that evaluates a type of dimer
+ *
+ * This is the place where the 2b potentials are registered.
+ * @param[in] mon Monomer ids of the dimer, in canonical (alphabetical) order
+ * @return Kernel of the dimer, or 0 if there is no 2b polynomial for it
+ */
+nbody::Kernel get_2b_kernel(const std::string *mon);
+
+/**
+ * @brief Gets the support of the kernel of a type of dimer
+ *
+ * The dimer can be skipped when its energy is zero by construction
+ * (see nbody::Support).
+ * @param[in] mon Monomer ids of the dimer, in canonical (alphabetical) order
+ * @return Support of the kernel. min_pairs is 0 if the kernel is not bounded.
+ */
+nbody::Support get_2b_support(const std::string *mon);
+
 /**
  * @brief Gets the two body energy for a given set of dimers
  *
@@ -97,7 +117,14 @@ double get_2b_energy(std::string m1, std::string m2, size_t nm, std::vector<doub
 double get_2b_energy(std::string m1, std::string m2, size_t nm, std::vector<double> xyz1, std::vector<double> xyz2,
                      std::vector<double> &grad1, std::vector<double> &grad2, std::vector<double> *virial = 0);
 
- const OW_OW_namespace::OW_OW pot_ow_ow("ow", "ow");
+/**
+ * @brief Gets the OW_OW potential of the OW model.
+ *
+ * There is a single instance, created on the first call, when its
+ * parameters are read (see ParamRegistry).
+ * @return The OW_OW potential
+ */
+const OW_OW_namespace::OW_OW &get_pot_ow_ow();
 
 }  // namespace e2b
 #endif
@@ -31,89 +31,23 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #ifndef OW_OW_OWHEADER
 #define OW_OW_OWHEADER
 
-#include "potential/fragmented/Polynomial.h"
-
-#include <iostream>
-#include <sstream>
-#include <fstream>
-#include <cmath>
-#include <cassert>
-#include <cstdlib>
-#include <iomanip>
-#include <string>
-#include <vector>
+#include "potential/fragmented/NBodyKernel.h"
 
 /**
  * @file OW_OW_OW.h
- * @brief Contains the structure of the polynomial holder for symmetry <TEMP TEMP TEMP>
+ * @brief Contains the kernel of the 3-body polynomial of the OW model
  */
 
 /**
  * @namespace OW_OW_OW_namespace
- * @brief Encloses the structure of the polynomial holder for symmetry <TEMP TEMP TEMP>
+ * @brief Encloses the kernel of the 3-body polynomial of the OW model
  */
 namespace OW_OW_OW_namespace {
 
-class OW_OW_OW {
-   public:
-    // Creates an empty class
-    OW_OW_OW(){};
-
-    /**
-     * @brief Creates a class and initializes the parameters corresponding to mon1 and mon2
-     * @param[in] mon1 Monomer id of the first monomer of interest
-     * @param[in] mon2 Monomer id of the second monomer of interest
-     */
-    OW_OW_OW(const std::string mon0, const std::string mon1, const std::string mon2);
-
-    // Destroys the class
-    ~OW_OW_OW(){};
-
-    /**
-     * @brief Computes the two body polynomials for the dimers
-     *
-     * Given the coordinates of a number of dimers (mon1 in xyz1 and mon2 in xyz2, it calculates the polynomial value
-     * for each one of them, and returns the sum of the contributions for the dimers.
-     * @param[in] xyz1 Pointer to a double array with the coordinates of the monomers of type mon1.
-     * @param[in] xyz2 Pointer to a double array with the coordinates of the monomers of type mon2.
-     * @param[in] ndim Number of dimers passed in the xyz arrays.
-     * @return Double with the sum of the energies of each dimer.
-     */
-    double eval(const double* xyz0, const double* xyz1, const double* xyz2, const size_t ndim) const;
-
-    /**
-     * @brief Computes the two body polynomials for the dimers
-     *
-     * Given the coordinates of a number of dimers (mon1 in xyz1 and mon2 in xyz2, it calculates the polynomial value
-     * for each one of them, and returns the sum of the contributions for the dimers.
-     * @param[in] xyz1 Pointer to a double array with the coordinates of the monomers of type mon1.
-     * @param[in] xyz2 Pointer to a double array with the coordinates of the monomers of type mon2.
-     * @param[in,out] grad1 Pointer to a double array with the gradients of the monomers of type mon1.
-     * @param[in,out] grad2 Pointer to a double array with the gradients of the monomers of type mon2.
-     * @param[in] ndim Number of dimers passed in the xyz arrays.
-     * @param[in.out] virial Vector of doubles with the energies of each monomer, in the same order as the input.
-     * @return Double with the sum of the energies of each
-     */
-    double eval(const double* xyz0, const double* xyz1, const double* xyz2, double* grad0, double* grad1, double* grad2, const size_t ndim,
-                std::vector<double>* virial = 0) const;
-
-   private:
-   
-    // Inner cutoff
-    double m_r2i = 0;
-
-    // Outer cutoff
-    double m_r2f = 0;
-
-    // Switch
-    double f_switch(const double&, double&) const;
-
-    // The polynomial
-    Polynomial* poly;
-
-};
-
-//-------------
+/**
+ * @brief Kernel of the OW_OW_OW polynomial of the FitFuncs, for N-mers of 3 monomers with one site each.
+ */
+typedef NBodyKernel<3, 1> OW_OW_OW;
 
 }  // namespace OW_OW_OW_namespace
 
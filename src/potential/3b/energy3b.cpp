@@ -37,6 +37,85 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 
 namespace e3b {
 
+namespace {
+
+// The kernels receive the monomers in canonical order (mon[0] <= mon[1] <= mon[2])
+
+double kernel_h2o_h2o_h2o(const std::string *, size_t nm, const double *const *xyz, double *const *grad,
+                          std::vector<double> *virial) {
+    if (grad == 0) return x2o::x3b_v2x::eval(xyz[0], xyz[1], xyz[2], nm);
+    return x2o::x3b_v2x::eval(xyz[0], xyz[1], xyz[2], grad[0], grad[1], grad[2], nm, virial);
+}
+
+double kernel_h2o_h2o_ion(const std::string *mon, size_t nm, const double *const *xyz, double *const *grad,
+                          std::vector<double> *virial) {
+    x3b_h2o_ion_v1x_deg4_filtered pot(mon[2]);
+    if (grad == 0) return pot(xyz[0], xyz[1], xyz[2], nm);
+    return pot(xyz[0], xyz[1], xyz[2], grad[0], grad[1], grad[2], nm, virial);
+}
+
+double kernel_ion_h2o_h2o(const std::string *mon, size_t nm, const double *const *xyz, double *const *grad,
+                          std::vector<double> *virial) {
+    x3b_h2o_ion_v1x_deg4_filtered pot(mon[0]);
+    if (grad == 0) return pot(xyz[1], xyz[2], xyz[0], nm);
+    return pot(xyz[1], xyz[2], xyz[0], grad[1], grad[2], grad[0], nm, virial);
+}
+
+// Generated kernels go in 3B_KERNELS and their table entries in 3B_REGISTRATION.
+// These sections replace 3B_NO_GRADIENT and 3B_GRADIENT; see "Adding N-body polynomials" in README.md.
+// =====>> BEGIN SECTION 3B_KERNELS <<=====
+// =====>> PASTE YOUR CODE BELOW <<=====
+double kernel_ch4_h2o_h2o(const std::string *mon, size_t nm, const double *const *xyz, double *const *grad,
+                          std::vector<double> *virial) {
+    mbnrg_A1B4_C1D2_C1D2_deg3::mbnrg_A1B4_C1D2_C1D2_deg3_v1 pot(mon[0], mon[1], mon[2]);
+    if (grad == 0) return pot.eval(xyz[0], xyz[1], xyz[2], nm);
+    return pot.eval(xyz[0], xyz[1], xyz[2], grad[0], grad[1], grad[2], nm, virial);
+}
+
+double kernel_co2_co2_co2(const std::string *mon, size_t nm, const double *const *xyz, double *const *grad,
+                          std::vector<double> *virial) {
+    mbnrg_A1B2_A1B2_A1B2_deg4::mbnrg_A1B2_A1B2_A1B2_deg4_v1 pot(mon[0], mon[1], mon[2]);
+    if (grad == 0) return pot.eval(xyz[0], xyz[1], xyz[2], nm);
+    return pot.eval(xyz[0], xyz[1], xyz[2], grad[0], grad[1], grad[2], nm, virial);
+}
+// =====>> END SECTION 3B_KERNELS <<=====
+
+double kernel_ow_ow_ow(const std::string *, size_t nm, const double *const *xyz, double *const *grad,
+                       std::vector<double> *virial) {
+    return eval_nbody_kernel(get_pot_ow_ow_ow(), nm, xyz, grad, virial);
+}
+
+// Table of the 3b kernels. Monomer ids are in canonical order.
+const nbody::Registration kernels[] = {
+    {{"h2o", "h2o", "h2o"}, &kernel_h2o_h2o_h2o, 0},
+    {{"h2o", "h2o", "k"}, &kernel_h2o_h2o_ion, 0},
+    {{"h2o", "h2o", "li"}, &kernel_h2o_h2o_ion, 0},
+    {{"h2o", "h2o", "na"}, &kernel_h2o_h2o_ion, 0},
+    {{"h2o", "h2o", "rb"}, &kernel_h2o_h2o_ion, 0},
+    {{"cs", "h2o", "h2o"}, &kernel_ion_h2o_h2o, 0},
+    // =====>> BEGIN SECTION 3B_REGISTRATION <<=====
+    // =====>> PASTE YOUR CODE BELOW <<=====
+    {{"ch4", "h2o", "h2o"}, &kernel_ch4_h2o_h2o, 0},
+    {{"co2", "co2", "co2"}, &kernel_co2_co2_co2, 0},
+    // =====>> END SECTION 3B_REGISTRATION <<=====
+    {{"ow", "ow", "ow"}, &kernel_ow_ow_ow, &nbody::SwitchedSupport<OW_OW_OW_namespace::OW_OW_OW, get_pot_ow_ow_ow>},
+};
+
+}  // namespace
+
+const OW_OW_OW_namespace::OW_OW_OW &get_pot_ow_ow_ow() {
+    static const OW_OW_OW_namespace::OW_OW_OW pot("OW_OW_OW");
+    return pot;
+}
+
+nbody::Kernel get_3b_kernel(const std::string *mon) {
+    return nbody::FindKernel(kernels, sizeof(kernels) / sizeof(kernels[0]), 3, mon);
+}
+
+nbody::Support get_3b_support(const std::string *mon) {
+    return nbody::FindSupport(kernels, sizeof(kernels) / sizeof(kernels[0]), 3, mon);
+}
+
 double get_3b_energy(std::string mon1, std::string mon2, std::string mon3, size_t nm, std::vector<double> xyz1,
                      std::vector<double> xyz2, std::vector<double> xyz3) {
 #ifdef DEBUG
@@ -60,58 +139,9 @@ double get_3b_energy(std::string mon1, std::string mon2, std::string mon3, size_
     std::cerr << std::endl;
 #endif
 
-    // Order the three monomer names and corresponding xyz
-    // Check if mon1 is the largest
-    if (mon3 < mon1 and mon3 < mon2) {
-        std::swap(mon1, mon3);
-        std::swap(xyz1, xyz3);
-    }
-    if (mon1 > mon2 and mon1 > mon3) {
-        std::swap(mon1, mon3);
-        std::swap(xyz1, xyz3);
-        // Check if mon2 is the largest
-    } else if (mon2 > mon1 and mon2 > mon3) {
-        std::swap(mon2, mon3);
-        std::swap(xyz2, xyz3);
-    }
-
-    // At this point mon3 is always the largest
-    // Now sort mon1 and mon2
-    if (mon1 > mon2) {
-        std::swap(mon1, mon2);
-        std::swap(xyz1, xyz2);
-    }
-
-    double energy = 0.0;
-
-    if (mon1 == "h2o" and mon2 == "h2o" and mon3 == "h2o") {
-        x2o::x3b_v2x pot;
-        energy = pot.eval(xyz1.data(), xyz2.data(), xyz3.data(), nm);
-    } else if (mon1 == "h2o" and mon2 == "h2o" and (mon3 == "li" or mon3 == "na" or mon3 == "k" or mon3 == "rb")) {
-        x3b_h2o_ion_v1x_deg4_filtered pot(mon3);
-        energy = pot(xyz1.data(), xyz2.data(), xyz3.data(), nm);
-    } else if (mon1 == "cs" and mon2 == "h2o" and mon3 == "h2o") {
-        x3b_h2o_ion_v1x_deg4_filtered pot(mon1);
-        energy = pot(xyz2.data(), xyz3.data(), xyz1.data(), nm);
-        // =====>> BEGIN SECTION 3B_NO_GRADIENT <<=====
-        // =====>> PASTE YOUR CODE BELOW <<=====
-    } else if (mon1 == "ch4" and mon2 == "h2o" and mon3 == "h2o") {
-        mbnrg_A1B4_C1D2_C1D2_deg3::mbnrg_A1B4_C1D2_C1D2_deg3_v1 pot(mon1, mon2, mon3);
-        energy = pot.eval(xyz1.data(), xyz2.data(), xyz3.data(), nm);
-
-    } else if (mon1 == "co2" and mon2 == "co2" and mon3 == "co2") {
-        mbnrg_A1B2_A1B2_A1B2_deg4::mbnrg_A1B2_A1B2_A1B2_deg4_v1 pot(mon1, mon2, mon3);
-        energy = pot.eval(xyz1.data(), xyz2.data(), xyz3.data(), nm);
-        // =====>> END SECTION 3B_NO_GRADIENT <<=====
-    } 
-     else if (mon1 == "ow" and mon2 == "ow" and mon3 == "ow") {
-       //OW_OW_OW_namespace::OW_OW_OW  pot(mon1, mon2, mon3);
-        energy = pot_ow_ow_ow.eval(xyz1.data(), xyz2.data(), xyz3.data(), nm);
-        // =====>> END SECTION 2B_NO_GRADIENT <<=====
-     }
-    else {
-        energy = 0.0;
-    }
+    const std::string mon[3] = {mon1, mon2, mon3};
+    const double *xyz[3] = {xyz1.data(), xyz2.data(), xyz3.data()};
+    double energy = nbody::Evaluate(3, get_3b_kernel, mon, nm, xyz, 0, 0);
 
 #ifdef DEBUG
     std::cerr << std::scientific << std::setprecision(10);
@@ -169,85 +199,10 @@ double get_3b_energy(std::string mon1, std::string mon2, std::string mon3, size_
     }
 #endif
 
-    size_t index1(1), index2(2), index3(3);
-
-    // Order the three monomer names and corresponding xyz
-    // Check if mon1 is the largest
-    if (mon3 < mon1 and mon3 < mon2) {
-        std::swap(mon1, mon3);
-        std::swap(xyz1, xyz3);
-        std::swap(grad1, grad3);
-        std::swap(index1, index3);
-    }
-
-    if (mon1 > mon2 and mon1 > mon3) {
-        std::swap(mon1, mon3);
-        std::swap(xyz1, xyz3);
-        std::swap(grad1, grad3);
-        std::swap(index1, index3);
-        // Check if mon2 is the largest
-    } else if (mon2 > mon1 and mon2 > mon3) {
-        std::swap(mon2, mon3);
-        std::swap(xyz2, xyz3);
-        std::swap(grad2, grad3);
-        std::swap(index2, index3);
-    }
-
-    // At this point mon3 is always the largest
-    // Now sort mon1 and mon2
-    if (mon1 > mon2) {
-        std::swap(mon1, mon2);
-        std::swap(xyz1, xyz2);
-        std::swap(grad1, grad2);
-        std::swap(index1, index2);
-    }
-
-    double energy = 0.0;
-    // Note: in the conditional, mon2 >= mon1 ALWAYS
-    if (mon1 == "h2o" and mon2 == "h2o" and mon3 == "h2o") {
-        x2o::x3b_v2x pot;
-        energy = pot.eval(xyz1.data(), xyz2.data(), xyz3.data(), grad1.data(), grad2.data(), grad3.data(), nm, virial);
-    } else if (mon1 == "h2o" and mon2 == "h2o" and (mon3 == "li" or mon3 == "na" or mon3 == "k" or mon3 == "rb")) {
-        x3b_h2o_ion_v1x_deg4_filtered pot(mon3);
-        energy = pot(xyz1.data(), xyz2.data(), xyz3.data(), grad1.data(), grad2.data(), grad3.data(), nm, virial);
-    } else if (mon1 == "cs" and mon2 == "h2o" and mon3 == "h2o") {
-        x3b_h2o_ion_v1x_deg4_filtered pot(mon1);
-        energy = pot(xyz2.data(), xyz3.data(), xyz1.data(), grad2.data(), grad3.data(), grad1.data(), nm, virial);
-        // =====>> BEGIN SECTION 3B_GRADIENT <<=====
-        // =====>> PASTE YOUR CODE BELOW <<=====
-    } else if (mon1 == "ch4" and mon2 == "h2o" and mon3 == "h2o") {
-        mbnrg_A1B4_C1D2_C1D2_deg3::mbnrg_A1B4_C1D2_C1D2_deg3_v1 pot(mon1, mon2, mon3);
-        energy = pot.eval(xyz1.data(), xyz2.data(), xyz3.data(), grad1.data(), grad2.data(), grad3.data(), nm, virial);
-
-    } else if (mon1 == "co2" and mon2 == "co2" and mon3 == "co2") {
-        mbnrg_A1B2_A1B2_A1B2_deg4::mbnrg_A1B2_A1B2_A1B2_deg4_v1 pot(mon1, mon2, mon3);
-        energy = pot.eval(xyz1.data(), xyz2.data(), xyz3.data(), grad1.data(), grad2.data(), grad3.data(), nm, virial);
-        // =====>> END SECTION 3B_GRADIENT <<=====
-    }
-  else if (mon1 == "ow" and mon2 == "ow" and mon3 == "ow") {
-    energy = pot_ow_ow_ow.eval(xyz1.data(), xyz2.data(), xyz3.data(), grad1.data(), grad2.data(), grad3.data(), nm, virial);
-    }
-  else {
-        energy = 0.0;
-    }
-
-    if (index1 != 1) {
-        if (index2 == 1) {
-            std::swap(index1, index2);
-            std::swap(grad1, grad2);
-            std::swap(mon1, mon2);
-        } else if (index3 == 1) {
-            std::swap(index1, index3);
-            std::swap(grad1, grad3);
-            std::swap(mon1, mon3);
-        }  // else { error
-    }
-
-    if (index2 != 2) {
-        std::swap(index2, index3);
-        std::swap(grad2, grad3);
-        std::swap(mon2, mon3);
-    }
+    const std::string mon[3] = {mon1, mon2, mon3};
+    const double *xyz[3] = {xyz1.data(), xyz2.data(), xyz3.data()};
+    double *grad[3] = {grad1.data(), grad2.data(), grad3.data()};
+    double energy = nbody::Evaluate(3, get_3b_kernel, mon, nm, xyz, grad, virial);
 
 #ifdef DEBUG
     std::cerr << std::scientific << std::setprecision(10);
@@ -37,6 +37,44 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 
 namespace e4b {
 
+namespace {
+
+// The kernels receive the monomers in canonical order (sorted alphabetically)
+
+double kernel_ow_ow_ow_ow(const std::string *, size_t nm, const double *const *xyz, double *const *grad,
+                          std::vector<double> *virial) {
+    return eval_nbody_kernel(get_pot_ow_ow_ow_ow(), nm, xyz, grad, virial);
+}
+
+// Generated kernels go in 4B_KERNELS and their table entries in 4B_REGISTRATION.
+// These sections replace 4B_NO_GRADIENT and 4B_GRADIENT; see "Adding N-body polynomials" in README.md.
+// =====>> BEGIN SECTION 4B_KERNELS <<=====
+// =====>> PASTE YOUR CODE BELOW <<=====
+// =====>> END SECTION 4B_KERNELS <<=====
+
+// Table of the 4b kernels. Monomer ids are in canonical order.
+const nbody::Registration kernels[] = {
+    {{"ow", "ow", "ow", "ow"}, &kernel_ow_ow_ow_ow, &nbody::SwitchedSupport<OW_OW_OW_OW_namespace::OW_OW_OW_OW, get_pot_ow_ow_ow_ow>},
+    // =====>> BEGIN SECTION 4B_REGISTRATION <<=====
+    // =====>> PASTE YOUR CODE BELOW <<=====
+    // =====>> END SECTION 4B_REGISTRATION <<=====
+};
+
+}  // namespace
+
+const OW_OW_OW_OW_namespace::OW_OW_OW_OW &get_pot_ow_ow_ow_ow() {
+    static const OW_OW_OW_OW_namespace::OW_OW_OW_OW pot("OW_OW_OW_OW");
+    return pot;
+}
+
+nbody::Kernel get_4b_kernel(const std::string *mon) {
+    return nbody::FindKernel(kernels, sizeof(kernels) / sizeof(kernels[0]), 4, mon);
+}
+
+nbody::Support get_4b_support(const std::string *mon) {
+    return nbody::FindSupport(kernels, sizeof(kernels) / sizeof(kernels[0]), 4, mon);
+}
+
   double get_4b_energy(std::string mon1, std::string mon2, std::string mon3, std::string mon4, size_t nm, std::vector<double> xyz1,
                      std::vector<double> xyz2, std::vector<double> xyz3, std::vector<double> xyz4) {
 #ifdef DEBUG
@@ -67,50 +105,9 @@ namespace e4b {
 
 
 
-    if(mon1>mon4)
-      {
-	std::swap(mon1, mon4);
-        std::swap(xyz1, xyz4);
-      }
-    if(mon2>mon4)
-      {
-	std::swap(mon2, mon4);
-        std::swap(xyz2, xyz4);
-      }
-    if(mon3>mon4)
-      {
-	std::swap(mon3, mon4);
-        std::swap(xyz3, xyz4);
-      }
-
-
-    if(mon1>mon3)
-      {
-	std::swap(mon1, mon3);
-        std::swap(xyz1, xyz3);
-      }
-    if(mon2>mon3)
-      {
-	std::swap(mon2, mon3);
-        std::swap(xyz2, xyz3);
-      }
-
-    if(mon1>mon2)
-      {
-	std::swap(mon1, mon2);
-        std::swap(xyz1, xyz2);
-      }
- 
-    double energy = 0.0;
-
-    if (mon1 == "ow" and mon2 == "ow" and mon3 == "ow" and mon4 == "ow") {
-      //OW_OW_OW_OW_namespace::OW_OW_OW_OW  pot(mon1, mon2, mon3, mon4);
-      energy = pot_ow_ow_ow_ow.eval(xyz1.data(), xyz2.data(), xyz3.data(), xyz4.data(), nm);
-        // =====>> END SECTION 2B_NO_GRADIENT <<=====
-    }
-    else {
-      energy = 0.0;
-    }
+    const std::string mon[4] = {mon1, mon2, mon3, mon4};
+    const double *xyz[4] = {xyz1.data(), xyz2.data(), xyz3.data(), xyz4.data()};
+    double energy = nbody::Evaluate(4, get_4b_kernel, mon, nm, xyz, 0, 0);
 
 #ifdef DEBUG
     std::cerr << std::scientific << std::setprecision(10);
@@ -173,95 +170,11 @@ namespace e4b {
     }
 #endif
 
-    size_t index1(1), index2(2), index3(3), index4(4);
-
-    // Order the three monomer names and corresponding xyz
-    // Check if mon1 is the largest 
-    if(mon1>mon4)
-      {
-	std::swap(mon1, mon4);
-        std::swap(xyz1, xyz4);
-	std::swap(index1, index4);
-      }
-    if(mon2>mon4)
-      {
-	std::swap(mon2, mon4);
-        std::swap(xyz2, xyz4);
-	std::swap(index2, index4);
-      }
-    if(mon3>mon4)
-      {
-	std::swap(mon3, mon4);
-        std::swap(xyz3, xyz4);
-	std::swap(index3, index4);
-      }
-
+    const std::string mon[4] = {mon1, mon2, mon3, mon4};
+    const double *xyz[4] = {xyz1.data(), xyz2.data(), xyz3.data(), xyz4.data()};
+    double *grad[4] = {grad1.data(), grad2.data(), grad3.data(), grad4.data()};
+    double energy = nbody::Evaluate(4, get_4b_kernel, mon, nm, xyz, grad, virial);
 
-    if(mon1>mon3)
-      {
-	std::swap(mon1, mon3);
-        std::swap(xyz1, xyz3);
-	std::swap(index1, index3);
-      }
-    if(mon2>mon3)
-      {
-	std::swap(mon2, mon3);
-        std::swap(xyz2, xyz3);
-	std::swap(index2, index3);
-      }
-
-    if(mon1>mon2)
-      {
-	std::swap(mon1, mon2);
-        std::swap(xyz1, xyz2);
-	std::swap(index1, index2);
-      }
-
-    double energy = 0.0;
-    // Note: in the conditional, mon2 >= mon1 ALWAYS
-    if (mon1 == "ow" and mon2 == "ow" and mon3 == "ow" and mon3 == "ow") {
-      //OW_OW_OW_OW_namespace::OW_OW_OW_OW pot(mon1, mon2,mon3,mon4);
-      energy = pot_ow_ow_ow_ow.eval(xyz1.data(), xyz2.data(), xyz3.data(),xyz4.data(), grad1.data(), grad2.data(), grad3.data(),grad4.data(), nm, virial);
-    }
-  else {
-        energy = 0.0;
-    }
-
-    if (index1 != 1) {
-        if (index2 == 1) {
-            std::swap(index1, index2);
-            std::swap(grad1, grad2);
-            std::swap(mon1, mon2);
-        }else if  (index3 == 1) {
-            std::swap(index1, index3);
-            std::swap(grad1, grad3);
-            std::swap(mon1, mon3);
-        } else if (index4 == 1) {
-            std::swap(index1, index4);
-            std::swap(grad1, grad4);
-            std::swap(mon1, mon4);
-        }  // else { error
-    }
-
-    if (index2 != 2) {
-      if (index3 == 2) {
-	std::swap(index2, index3);
-        std::swap(grad2, grad3);
-        std::swap(mon2, mon3);
-	}
-      else if(index4 == 2)
-	{
-	  std::swap(index2, index4);
-	  std::swap(grad2, grad4);
-	  std::swap(mon2, mon4);
-	}
-    }
-    if (index3 != 3) {
-      	  std::swap(index3, index4);
-	  std::swap(grad3, grad4);
-	  std::swap(mon3, mon4);
-    }
-    
 #ifdef DEBUG
     std::cerr << std::scientific << std::setprecision(10);
     std::cerr << "\nExiting " << __func__ << " in " << __FILE__ << std::endl;
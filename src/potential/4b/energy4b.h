@@ -39,6 +39,7 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #include <vector>
 #include <iostream>
 #include <utility>
+#include "potential/nbody_kernel.h"
 
 // 4B
 // =====>> BEGIN SECTION INCLUDE4B <<=====
@@ -57,6 +58,25 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
  */
 namespace e4b {
 
+/**
+ * @brief Gets the kernel that evaluates a type of tetramer
+ *
+ * This is the place where the 4b potentials are registered.
+ * @param[in] mon Monomer ids of the tetramer, in canonical (alphabetical) order
+ * @return Kernel of the tetramer, or 0 if there is no 4b polynomial for it
+ */
+nbody::Kernel get_4b_kernel(const std::string *mon);
+
+/**
+ * @brief Gets the support of the kernel of a type of tetramer
+ *
+ * The tetramer can be skipped when its energy is zero by construction
+ * (see nbody::Support).
+ * @param[in] mon Monomer ids of the tetramer, in canonical (alphabetical) order
+ * @return Support of the kernel. min_pairs is 0 if the kernel is not bounded.
+ */
+nbody::Support get_4b_support(const std::string *mon);
+
 /**
  * @brief Gets the four body energy for a given set of trimers
  *
@@ -102,6 +122,13 @@ double get_4b_energy(std::string m1, std::string m2, std::string m3,  std::strin
                      std::vector<double> xyz2, std::vector<double> xyz3, std::vector<double> xyz4, std::vector<double> &grd1,
                      std::vector<double> &grd2, std::vector<double> &grd3, std::vector<double> &grd4, std::vector<double> *virial = 0);
 
- const OW_OW_OW_OW_namespace::OW_OW_OW_OW pot_ow_ow_ow_ow("ow","ow","ow","ow");
+/**
+ * @brief Gets the OW_OW_OW_OW potential of the OW model.
+ *
+ * There is a single instance, created on the first call, when its
+ * parameters are read (see ParamRegistry).
+ * @return The OW_OW_OW_OW potential
+ */
+const OW_OW_OW_OW_namespace::OW_OW_OW_OW &get_pot_ow_ow_ow_ow();
 }  // namespace e4b
 #endif
@@ -59,11 +59,15 @@ void Buckingham::Initialize(const std::vector<double> &sys_xyz, const std::vecto
     sys_grad_ = std::vector<double>(natoms3, 0.0);
     virial_ = std::vector<double>(9, 0.0);
 
+    CompileMonomerTypes();
     ReorderData();
 }
 
 void Buckingham::SetJsonDispersionRepulsion(nlohmann::json repdisp_j) { repdisp_j_ = repdisp_j; }
-void Buckingham::SetJsonMonomers(nlohmann::json mon_j) { mon_j_ = mon_j; }
+void Buckingham::SetJsonMonomers(nlohmann::json mon_j) {
+    mon_j_ = mon_j;
+    CompileMonomerTypes();
+}
 
 void Buckingham::SetNewParameters(const std::vector<double> &xyz,
                                   const std::vector<std::pair<std::string, std::string> > &buck_pairs,
@@ -82,6 +86,30 @@ void Buckingham::SetNewParameters(const std::vector<double> &xyz,
     ReorderData();
 }
 
+void Buckingham::SetMonomerTypes(std::shared_ptr<const bblock::MonomerTypeTable> mon_types) {
+    sys_mon_types_ = mon_types;
+}
+
+void Buckingham::CompileMonomerTypes() {
+    // Inside a System, the types compiled by the System are used
+    if (sys_mon_types_) {
+        mon_types_ = sys_mon_types_;
+        return;
+    }
+
+    std::vector<std::string> ids;
+    std::vector<size_t> nsites;
+    size_t fi_mon = 0;
+    for (size_t mt = 0; mt < mon_type_count_.size(); mt++) {
+        ids.push_back(mon_type_count_[mt].first);
+        nsites.push_back(num_atoms_[fi_mon]);
+        fi_mon += mon_type_count_[mt].second;
+    }
+    std::shared_ptr<bblock::MonomerTypeTable> mon_types(new bblock::MonomerTypeTable());
+    mon_types->Compile(ids, nsites, mon_j_);
+    mon_types_ = mon_types;
+}
+
 void Buckingham::ReorderData() {
     size_t fi_mon = 0;
     size_t fi_crd = 0;
@@ -176,11 +204,6 @@ void Buckingham::CalculateRepulsion(bool use_ghost) {
     size_t fi_crd = 0;
     size_t fi_sites = 0;
 
-    // Excluded sets
-    excluded_set_type exc12;
-    excluded_set_type exc13;
-    excluded_set_type exc14;
-
     // Loop over each monomer type
     for (size_t mt = 0; mt < mon_type_count_.size(); mt++) {
         size_t ns = num_atoms_[fi_mon];
@@ -192,9 +215,6 @@ void Buckingham::CalculateRepulsion(bool use_ghost) {
         double dummy_b;
         bool do_buck = GetBuckParams(mon_id_[fi_mon], mon_id_[fi_mon], 0, 0, buck_pairs_, dummy_a, dummy_b, repdisp_j_);
         if (do_buck) {
-            // Obtain excluded pairs for monomer type mt
-            systools::GetExcluded(mon_id_[fi_mon], mon_j_, exc12, exc13, exc14);
-
             std::vector<std::vector<double> > grad_pool(nthreads, std::vector<double>(nmon * ns * 3, 0.0));
             std::vector<double> energy_pool(nthreads, 0.0);
             std::vector<std::vector<double> > virial_pool(nthreads, std::vector<double>(9, 0.0));
@@ -205,9 +225,10 @@ void Buckingham::CalculateRepulsion(bool use_ghost) {
                 size_t inmon3 = inmon * 3;
                 for (size_t j = i + 1; j < ns; j++) {
                     // Continue only if i and j are not bonded
-                    bool is12 = systools::IsExcluded(exc12, i, j);
-                    bool is13 = systools::IsExcluded(exc13, i, j);
-                    bool is14 = systools::IsExcluded(exc14, i, j);
+                    unsigned char exc = mon_types_->GetExclusion(mt, i, j);
+                    bool is12 = exc & bblock::EXCLUDED_12;
+                    bool is13 = exc & bblock::EXCLUDED_13;
+                    bool is14 = exc & bblock::EXCLUDED_14;
                     bool is_excluded = (is12 || is13 || is14) ? true : false;
 
                     if (is_excluded) continue;
@@ -36,6 +36,7 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #define BUCKINGHAM_H
 
 #include <vector>
+#include <memory>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -44,6 +45,7 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #include "potential/buckingham/bucktools.h"
 #include "tools/definitions.h"
 #include "bblock/sys_tools.h"
+#include "bblock/monomer_type_table.h"
 #include "tools/math_tools.h"
 #include "json/json.h"
 
@@ -106,6 +108,14 @@ class Buckingham {
     void SetJsonDispersionRepulsion(nlohmann::json repdisp_j);
     void SetJsonMonomers(nlohmann::json mon_j);
 
+    /**
+     * @brief Sets the monomer types compiled by a System, so the term does
+     * not compile them again from the json object. Takes effect in the next
+     * Initialize or SetJsonMonomers.
+     * @param[in] mon_types Monomer types of the System. Null to compile them in the term.
+     */
+    void SetMonomerTypes(std::shared_ptr<const bblock::MonomerTypeTable> mon_types);
+
     /**
      * @brief Updates the information of the system in the class.
      *
@@ -145,6 +155,12 @@ class Buckingham {
      */
     void ReorderData();
 
+    /**
+     * @brief Compiles the exclusions of each monomer type
+     * from mon_j_, so they are not looked up in every call.
+     */
+    void CompileMonomerTypes();
+
     /**
      * @brief Calculates the repulsion for the system
      *
@@ -214,6 +230,11 @@ class Buckingham {
 
     // Json object with extra monomer properties
     nlohmann::json mon_j_;
+
+    // Exclusions of each monomer type. Compiled by the term, or shared with the System.
+    std::shared_ptr<const bblock::MonomerTypeTable> mon_types_;
+    // Monomer types set by the System, if any. See SetMonomerTypes.
+    std::shared_ptr<const bblock::MonomerTypeTable> sys_mon_types_;
 };
 
 }  // namespace buck
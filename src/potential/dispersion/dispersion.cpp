@@ -141,6 +141,7 @@ void Dispersion::Initialize(const std::vector<double> sys_c6_long_range, const s
 
     user_fft_grid_ = std::vector<int>{};
 
+    CompileMonomerTypes();
     ReorderData();
 
 #ifdef DEBUG
@@ -167,8 +168,14 @@ void Dispersion::Initialize(const std::vector<double> sys_c6_long_range, const s
 #endif
 }
 
-void Dispersion::SetJsonDispersionRepulsion(nlohmann::json repdisp_j) { repdisp_j_ = repdisp_j; }
-void Dispersion::SetJsonMonomers(nlohmann::json mon_j) { mon_j_ = mon_j; }
+void Dispersion::SetJsonDispersionRepulsion(nlohmann::json repdisp_j) {
+    repdisp_j_ = repdisp_j;
+    CompileDispersion();
+}
+void Dispersion::SetJsonMonomers(nlohmann::json mon_j) {
+    mon_j_ = mon_j;
+    CompileMonomerTypes();
+}
 
 nlohmann::json Dispersion::GetJsonDispersionRepulsion() { return repdisp_j_; }
 nlohmann::json Dispersion::GetJsonMonomers() { return mon_j_; }
@@ -209,7 +216,10 @@ void Dispersion::SetNewParameters(const std::vector<double> &xyz,
     box_inverse_ = box.size() ? InvertUnitCell(box) : std::vector<double>{};
     box_ABCabc_ = box.size() ? BoxVecToBoxABCabc(box) : std::vector<double>{};
     use_pbc_ = box.size();
-    ignore_disp_ = ignore_disp;
+    if (ignore_disp != ignore_disp_) {
+        ignore_disp_ = ignore_disp;
+        CompileDispersion();
+    }
     do_grads_ = do_grads;
     cutoff_ = cutoff;
     std::fill(grad_.begin(), grad_.end(), 0.0);
@@ -237,6 +247,43 @@ void Dispersion::SetBoxPMElocal(std::vector<double> box) {
     box_ABCabc_PMElocal_ = box.size() ? BoxVecToBoxABCabc(box) : std::vector<double>{};
 }
 
+void Dispersion::SetMonomerTypes(std::shared_ptr<const bblock::MonomerTypeTable> mon_types) {
+    sys_mon_types_ = mon_types;
+}
+
+void Dispersion::CompileMonomerTypes() {
+    // Inside a System, the types compiled by the System are used
+    if (sys_mon_types_) {
+        mon_types_ = sys_mon_types_;
+    } else {
+        std::vector<std::string> ids;
+        std::vector<size_t> nsites;
+        size_t fi_mon = 0;
+        for (size_t mt = 0; mt < mon_type_count_.size(); mt++) {
+            ids.push_back(mon_type_count_[mt].first);
+            nsites.push_back(num_atoms_[fi_mon]);
+            fi_mon += mon_type_count_[mt].second;
+        }
+        std::shared_ptr<bblock::MonomerTypeTable> mon_types(new bblock::MonomerTypeTable());
+        mon_types->Compile(ids, nsites, mon_j_);
+        mon_types_ = mon_types;
+    }
+    CompileDispersion();
+}
+
+void Dispersion::CompileDispersion() {
+    // The types are compiled in Initialize
+    if (!mon_types_) return;
+
+    std::vector<size_t> natoms;
+    size_t fi_mon = 0;
+    for (size_t mt = 0; mt < mon_type_count_.size(); mt++) {
+        natoms.push_back(num_atoms_[fi_mon]);
+        fi_mon += mon_type_count_[mt].second;
+    }
+    disp_types_.Compile(*mon_types_, natoms, ignore_disp_, repdisp_j_);
+}
+
 void Dispersion::ReorderData() {
     // Organize xyz so we have
     // x1_1 x1_2 ... y1_1 y1_2... z1_1 z1_2 ... x2_1 x2_2 ...
@@ -473,6 +520,12 @@ double Dispersion::GetDispersionPMElocal(std::vector<double> &grad, std::vector<
     return disp_energy_;
 }
 
+helpme::PMEInstance<double> &Dispersion::GetPMESolver(double A, double B, double C, double alpha, double beta,
+                                                      double gamma, bool parallel) {
+    return pme_solver_.Get(6, -1.0, ewald_alpha_, pme_spline_order_, pme_grid_density_, user_fft_grid_, parallel,
+                           world_, proc_grid_x_, proc_grid_y_, proc_grid_z_, A, B, C, alpha, beta, gamma);
+}
+
 void Dispersion::CalculateDispersion(bool use_ghost) {
     disp_energy_ = 0.0;
     std::fill(phi_.begin(), phi_.end(), 0.0);
@@ -494,24 +547,17 @@ void Dispersion::CalculateDispersion(bool use_ghost) {
     size_t fi_crd = 0;
     size_t fi_sites = 0;
 
-    // Excluded sets
-    excluded_set_type exc12;
-    excluded_set_type exc13;
-    excluded_set_type exc14;
-
     // Loop over each monomer type
     for (size_t mt = 0; mt < mon_type_count_.size(); mt++) {
         size_t ns = num_atoms_[fi_mon];
         size_t nmon = mon_type_count_[mt].second;
         size_t nmon2 = 2 * nmon;
 
-        double dummy_c6, dummy_d6;
-        bool do_disp = GetC6(mon_id_[fi_mon], mon_id_[fi_mon], 0, 0, dummy_c6, dummy_d6, ignore_disp_, repdisp_j_);
+        bool do_disp = disp_types_.HasDispersion(mt, mt);
+        const double *c6_mt = disp_types_.GetC6(mt, mt);
+        const double *d6_mt = disp_types_.GetD6(mt, mt);
         std::vector<double> xyz_mt(xyz_.begin() + fi_crd, xyz_.begin() + fi_crd + nmon * ns * 3);
 
-        // Obtain excluded pairs for monomer type mt
-        systools::GetExcluded(mon_id_[fi_mon], mon_j_, exc12, exc13, exc14);
-
         // For parallel region
         std::vector<std::vector<double> > phi_pool;
         std::vector<std::vector<double> > grad_pool;
@@ -529,14 +575,15 @@ void Dispersion::CalculateDispersion(bool use_ghost) {
             size_t inmon3 = inmon * 3;
             for (size_t j = i + 1; j < ns; j++) {
                 // Continue only if i and j are not bonded
-                bool is12 = systools::IsExcluded(exc12, i, j);
-                bool is13 = systools::IsExcluded(exc13, i, j);
-                bool is14 = systools::IsExcluded(exc14, i, j);
+                unsigned char exc = mon_types_->GetExclusion(mt, i, j);
+                bool is12 = exc & bblock::EXCLUDED_12;
+                bool is13 = exc & bblock::EXCLUDED_13;
+                bool is14 = exc & bblock::EXCLUDED_14;
                 double disp_scale_factor = (is12 || is13 || is14 || !do_disp) ? 0 : 1;
-                double c6, d6;
+                double c6 = c6_mt[i * ns + j];
+                double d6 = d6_mt[i * ns + j];
                 double c6i = c6_long_range_[fi_sites + i * nmon];
                 double c6j = c6_long_range_[fi_sites + j * nmon];
-                GetC6(mon_id_[fi_mon], mon_id_[fi_mon], i, j, c6, d6, ignore_disp_, repdisp_j_);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic)
 #endif
@@ -614,9 +661,9 @@ void Dispersion::CalculateDispersion(bool use_ghost) {
             size_t ns2 = num_atoms_[fi_mon2];
             size_t nmon2 = mon_type_count_[mt2].second;
 
-            double dummy_c6, dummy_d6;
-            bool do_disp =
-                GetC6(mon_id_[fi_mon1], mon_id_[fi_mon2], 0, 0, dummy_c6, dummy_d6, ignore_disp_, repdisp_j_);
+            bool do_disp = disp_types_.HasDispersion(mt1, mt2);
+            const double *c6_mt = disp_types_.GetC6(mt1, mt2);
+            const double *d6_mt = disp_types_.GetD6(mt1, mt2);
             double disp_scale_factor = do_disp ? 1.0 : 0.0;
             std::vector<double> xyz_mt2(xyz_.begin() + fi_crd2, xyz_.begin() + fi_crd2 + nmon2 * ns2 * 3);
 
@@ -664,8 +711,8 @@ void Dispersion::CalculateDispersion(bool use_ghost) {
                         size_t jnmon2 = j * nmon2;
                         size_t jnmon23 = jnmon2 * 3;
                         double c6j = c6_long_range_[fi_sites2 + j * nmon2];
-                        double c6, d6;
-                        GetC6(mon_id_[fi_mon1], mon_id_[fi_mon2], i, j, c6, d6, ignore_disp_, repdisp_j_);
+                        double c6 = c6_mt[i * ns2 + j];
+                        double d6 = d6_mt[i * ns2 + j];
                         energy_pool[rank] += disp6(
                             c6, d6, c6i, c6j, xyz_sitei, xyz_mt2, g1, grad2_pool[rank], phi_i, phi2_pool[rank], nmon1,
                             nmon2, m2init, nmon2, i, j, disp_scale_factor, do_grads_, cutoff_, ewald_alpha_, box_,
@@ -714,8 +761,6 @@ void Dispersion::CalculateDispersion(bool use_ghost) {
     }
 
     if (ewald_alpha_ > 0 && use_pbc_) {
-        helpme::PMEInstance<double> pme_solver_;
-        if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
         // Compute the reciprocal space terms, using PME
         double A = box_ABCabc_[0];
         double B = box_ABCabc_[1];
@@ -724,11 +769,7 @@ void Dispersion::CalculateDispersion(bool use_ghost) {
         double beta = box_ABCabc_[4];
         double gamma = box_ABCabc_[5];
 
-        int grid_A = pme_grid_density_ * A;
-        int grid_B = pme_grid_density_ * B;
-        int grid_C = pme_grid_density_ * C;
-        pme_solver_.setup(6, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, -1, 0);
-        pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+        helpme::PMEInstance<double> &pme_solver = GetPMESolver(A, B, C, alpha, beta, gamma, false);
         // N.B. these do not make copies; they just wrap the memory with some metadata
         auto coords = helpme::Matrix<double>(sys_xyz_.data(), natoms_, 3);
         auto params = helpme::Matrix<double>(sys_c6_long_range_.data(), natoms_, 1);
@@ -736,7 +777,7 @@ void Dispersion::CalculateDispersion(bool use_ghost) {
         std::vector<double> dummy_6vec(6, 0.0);
         auto rec_virial = helpme::Matrix<double>(dummy_6vec.data(), 6, 1);
         std::fill(sys_grad_.begin(), sys_grad_.end(), 0);
-        double rec_energy = pme_solver_.computeEFVRec(0, params, coords, forces, rec_virial);
+        double rec_energy = pme_solver.computeEFVRec(0, params, coords, forces, rec_virial);
 
         // get virial
         if (calc_virial_) {
@@ -809,8 +850,6 @@ void Dispersion::CalculateDispersionPME(bool use_ghost) {
     if (!compute_pme && use_ghost && ewald_alpha_ > 0) compute_pme = true;
 
     if (compute_pme) {
-        helpme::PMEInstance<double> pme_solver_;
-        if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
         // Compute the reciprocal space terms, using PME
         double A = box_ABCabc_[0];
         double B = box_ABCabc_[1];
@@ -819,18 +858,7 @@ void Dispersion::CalculateDispersionPME(bool use_ghost) {
         double beta = box_ABCabc_[4];
         double gamma = box_ABCabc_[5];
 
-        int grid_A = pme_grid_density_ * A;
-        int grid_B = pme_grid_density_ * B;
-        int grid_C = pme_grid_density_ * C;
-
-        if (mpi_initialized_) {
-            pme_solver_.setupParallel(6, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, -1, 0, world_,
-                                      PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
-        } else {
-            pme_solver_.setup(6, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, -1, 0);
-        }
-
-        pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+        helpme::PMEInstance<double> &pme_solver = GetPMESolver(A, B, C, alpha, beta, gamma, mpi_initialized_);
 
         // N.B. these do not make copies; they just wrap the memory with some metadata
         auto coords = helpme::Matrix<double>(sys_xyz_.data(), natoms_, 3);
@@ -841,7 +869,7 @@ void Dispersion::CalculateDispersionPME(bool use_ghost) {
         std::vector<double> dummy_6vec(6, 0.0);
         auto rec_virial = helpme::Matrix<double>(dummy_6vec.data(), 6, 1);
         std::fill(sys_grad_.begin(), sys_grad_.end(), 0);
-        double rec_energy = pme_solver_.computeEFVRec(0, params, coords, forces, rec_virial);
+        double rec_energy = pme_solver.computeEFVRec(0, params, coords, forces, rec_virial);
 
         const int num_procs = proc_grid_x_ * proc_grid_y_ * proc_grid_z_;
 
@@ -925,8 +953,6 @@ void Dispersion::CalculateDispersionPMElocal(bool use_ghost) {
     //    if(!compute_pme && use_ghost && ewald_alpha_ > 0) compute_pme = true;
 
     //    if (compute_pme) {
-    helpme::PMEInstance<double> pme_solver_;
-    if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
     // Compute the reciprocal space terms, using PME
     double A = box_ABCabc_PMElocal_[0];
     double B = box_ABCabc_PMElocal_[1];
@@ -935,18 +961,7 @@ void Dispersion::CalculateDispersionPMElocal(bool use_ghost) {
     double beta = box_ABCabc_PMElocal_[4];
     double gamma = box_ABCabc_PMElocal_[5];
 
-    int grid_A = pme_grid_density_ * A;
-    int grid_B = pme_grid_density_ * B;
-    int grid_C = pme_grid_density_ * C;
-
-    if (mpi_initialized_) {
-        pme_solver_.setupParallel(6, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, -1, 0, world_,
-                                  PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
-    } else {
-        pme_solver_.setup(6, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, -1, 0);
-    }
-
-    pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+    helpme::PMEInstance<double> &pme_solver = GetPMESolver(A, B, C, alpha, beta, gamma, mpi_initialized_);
 
     // N.B. these do not make copies; they just wrap the memory with some metadata
     auto coords = helpme::Matrix<double>(sys_xyz_.data(), natoms_, 3);
@@ -1005,7 +1020,7 @@ void Dispersion::CalculateDispersionPMElocal(bool use_ghost) {
     std::vector<double> dummy_6vec(6, 0.0);
     auto rec_virial = helpme::Matrix<double>(dummy_6vec.data(), 6, 1);
     std::fill(sys_grad_.begin(), sys_grad_.end(), 0);
-    double rec_energy = pme_solver_.computeEFVRec(0, params, coords, forces, rec_virial);
+    double rec_energy = pme_solver.computeEFVRec(0, params, coords, forces, rec_virial);
 
     // get virial
     if (calc_virial_) {
@@ -1087,18 +1102,18 @@ std::vector<int> Dispersion::GetFFTDimension(int box_id) {
         int grid_B = pme_grid_density_ * B;
         int grid_C = pme_grid_density_ * C;
 
-        helpme::PMEInstance<double> pme_solver_;
-        if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
+        helpme::PMEInstance<double> pme_solver;
+        if (user_fft_grid_.size()) pme_solver.SetFFTDimension(user_fft_grid_);
 
         if (mpi_initialized_) {
-            pme_solver_.setupParallel(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0, world_,
-                                      PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
+            pme_solver.setupParallel(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0, world_,
+                                     PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
         } else {
-            pme_solver_.setup(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0);
+            pme_solver.setup(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0);
         }
-        pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+        pme_solver.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
 
-        fft_grid = pme_solver_.GetFFTDimension();
+        fft_grid = pme_solver.GetFFTDimension();
     }
 
     return fft_grid;
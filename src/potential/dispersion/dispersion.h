@@ -36,6 +36,7 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #define DISPERSION_NEW_H
 
 #include <vector>
+#include <memory>
 
 #if HAVE_MPI
 #include <mpi.h>
@@ -48,7 +49,9 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #include "potential/dispersion/disptools.h"
 #include "potential/electrostatics/helpme.h"
 #include "tools/definitions.h"
+#include "tools/solver_cache.h"
 #include "bblock/sys_tools.h"
+#include "bblock/monomer_type_table.h"
 #include "tools/math_tools.h"
 
 #ifndef MPI_VERSION
@@ -161,6 +164,14 @@ class Dispersion {
      */
     void SetJsonMonomers(nlohmann::json mon_j);
 
+    /**
+     * @brief Sets the monomer types compiled by a System, so the term does
+     * not compile them again from the json object. Takes effect in the next
+     * Initialize or SetJsonMonomers.
+     * @param[in] mon_types Monomer types of the System. Null to compile them in the term.
+     */
+    void SetMonomerTypes(std::shared_ptr<const bblock::MonomerTypeTable> mon_types);
+
     /**
      * @brief Sets the Ewald attenuation parameter (in units of 1/Angstrom)
      *
@@ -301,11 +312,33 @@ class Dispersion {
     nlohmann::json GetJsonMonomers();
 
    private:
+    /**
+     * @brief Compiles the exclusions of each monomer type and the C6 of the pairs of types
+     * from mon_j_, so they are not looked up in every call.
+     */
+    void CompileMonomerTypes();
+
+    /**
+     * @brief Compiles the C6 of the pairs of types, with the current
+     * ignore_disp_ and repdisp_j_
+     */
+    void CompileDispersion();
+
     void ReorderData();
     void CalculateDispersion(bool use_ghost = 0);
     void CalculateDispersionPME(bool use_ghost = 0);
     void CalculateDispersionPMElocal(bool use_ghost = 0);
 
+    /**
+     * @brief Gets the PME solver for the current Ewald parameters and the given cell
+     * @param[in] A,B,C Lengths of the cell vectors
+     * @param[in] alpha,beta,gamma Angles of the cell, in degrees
+     * @param[in] parallel If true, the solver is distributed over the MPI processes
+     * @return Reference to the solver, see tools::SolverCache::Get
+     */
+    helpme::PMEInstance<double> &GetPMESolver(double A, double B, double C, double alpha, double beta, double gamma,
+                                              bool parallel);
+
     // System xyz, not ordered XYZ. xyzxyz...(mon1)xyzxyz...(mon2) ...
     std::vector<double> sys_xyz_;
     // System xyz, ordered XYZ. xx..yy..zz(mon1) xx..yy..zz(mon2) ...
@@ -377,6 +410,8 @@ class Dispersion {
     size_t proc_grid_z_;
     // User-specified FFT grid
     std::vector<int> user_fft_grid_;
+    // PME solver, persistent across calls. See tools::SolverCache::Get.
+    tools::SolverCache<helpme::PMEInstance<double>> pme_solver_;
 
     // Json object with extra user-defined dispersion coefficients
     nlohmann::json repdisp_j_;
@@ -384,6 +419,13 @@ class Dispersion {
     // Json object with extra user-defined monomer properties
     nlohmann::json mon_j_;
 
+    // Exclusions of each monomer type. Compiled by the term, or shared with the System.
+    std::shared_ptr<const bblock::MonomerTypeTable> mon_types_;
+    // Monomer types set by the System, if any. See SetMonomerTypes.
+    std::shared_ptr<const bblock::MonomerTypeTable> sys_mon_types_;
+    // C6 and d6 of each pair of types, with the atoms of the types
+    bblock::DispersionTable disp_types_;
+
     // Pairs for which dispersion will be ignored
     std::vector<std::pair<std::string, std::string> > ignore_disp_;
 };
@@ -77,9 +77,14 @@ void Electrostatics::SetDipoleTolerance(double tol) { tolerance_ = tol; }
 
 void Electrostatics::SetDipoleMaxIt(size_t maxit) { maxit_ = maxit; }
 
+void Electrostatics::SetDipoleTensorCache(double max_mb) { dip_tensor_max_mb_ = max_mb; }
+
 void Electrostatics::SetPeriodicity(bool periodic) { simcell_periodic_ = periodic; }
 
-void Electrostatics::SetJsonMonomers(nlohmann::json mon_j) { mon_j_ = mon_j; }
+void Electrostatics::SetJsonMonomers(nlohmann::json mon_j) {
+    mon_j_ = mon_j;
+    CompileMonomerTypes();
+}
 
 void Electrostatics::Initialize(const std::vector<double> &chg, const std::vector<double> &chg_grad,
                                 const std::vector<double> &polfac, const std::vector<double> &pol,
@@ -92,6 +97,9 @@ void Electrostatics::Initialize(const std::vector<double> &chg, const std::vecto
     pme_spline_order_ = 5;
     pme_grid_density_ = 1.2;
     ewald_alpha_ = 0;
+    dip_tensor_max_mb_ = 0;
+    dip_tensors_updated_ = false;
+    dip_tensors_cached_ = false;
     // Copy System data in electrostatics
     // sys_chg_ = std::vector<double>(chg.begin(),chg.end());
     sys_chg_ = chg;
@@ -189,8 +197,12 @@ void Electrostatics::Initialize(const std::vector<double> &chg, const std::vecto
     nn_first = true;
     nn_first_neigh = std::vector<size_t>(nsites_, -1);
     nn_num_neighs = std::vector<size_t>(nsites_, 0);
+    real_space_neighbors_.Clear();
+    all_pairs_in_cutoff_ = true;
 
     user_fft_grid_ = std::vector<int>{};
+
+    CompileMonomerTypes();
 }
 
 void Electrostatics::SetMPI(MPI_Comm world, size_t proc_grid_x, size_t proc_grid_y, size_t proc_grid_z) {
@@ -252,6 +264,30 @@ void Electrostatics::SetBoxPMElocal(std::vector<double> box) {
     box_inverse_PMElocal_ = InvertUnitCell(box);
 }
 
+void Electrostatics::SetMonomerTypes(std::shared_ptr<const bblock::MonomerTypeTable> mon_types) {
+    sys_mon_types_ = mon_types;
+}
+
+void Electrostatics::CompileMonomerTypes() {
+    // Inside a System, the types compiled by the System are used
+    if (sys_mon_types_) {
+        mon_types_ = sys_mon_types_;
+        return;
+    }
+
+    std::vector<std::string> ids;
+    std::vector<size_t> nsites;
+    size_t fi_mon = 0;
+    for (size_t mt = 0; mt < mon_type_count_.size(); mt++) {
+        ids.push_back(mon_type_count_[mt].first);
+        nsites.push_back(sites_[fi_mon]);
+        fi_mon += mon_type_count_[mt].second;
+    }
+    std::shared_ptr<bblock::MonomerTypeTable> mon_types(new bblock::MonomerTypeTable());
+    mon_types->Compile(ids, nsites, mon_j_);
+    mon_types_ = mon_types;
+}
+
 void Electrostatics::ReorderData() {
     ////////////////////////////////////////////////////////////////////////////////
     // DATA ORGANIZATION ///////////////////////////////////////////////////////////
@@ -310,6 +346,76 @@ void Electrostatics::ReorderData() {
     }
 }
 
+helpme::PMEInstance<double> &Electrostatics::GetPMESolver(double A, double B, double C, double alpha, double beta,
+                                                         double gamma) {
+    return pme_solver_.Get(1, 1.0, ewald_alpha_, pme_spline_order_, pme_grid_density_, user_fft_grid_,
+                           mpi_initialized_, world_, proc_grid_x_, proc_grid_y_, proc_grid_z_, A, B, C, alpha, beta,
+                           gamma);
+}
+
+void Electrostatics::UpdateRealSpaceNeighbors() {
+    // Extent of each monomer, measured from its first site. The distance
+    // between two sites of a pair of monomers is at least the distance between
+    // their first sites minus both extents, so pairs further apart than cutoff_
+    // plus the extents have no site inside the cutoff.
+    mon_extent_.resize(nmon_total_);
+    double max_extent = 0.0;
+    double rmin[3] = {0.0, 0.0, 0.0};
+    double rmax[3] = {0.0, 0.0, 0.0};
+    for (size_t n = 0; n < nmon_total_; n++) {
+        const double *r0 = sys_xyz_.data() + 3 * first_ind_[n];
+        double extent2 = 0.0;
+        for (size_t i = 1; i < sites_[n]; i++) {
+            const double *ri = r0 + 3 * i;
+            double d2 = 0.0;
+            for (size_t k = 0; k < 3; k++) d2 += (ri[k] - r0[k]) * (ri[k] - r0[k]);
+            extent2 = std::max(extent2, d2);
+        }
+        mon_extent_[n] = std::sqrt(extent2);
+        max_extent = std::max(max_extent, mon_extent_[n]);
+        for (size_t k = 0; k < 3; k++) {
+            rmin[k] = n ? std::min(rmin[k], r0[k]) : r0[k];
+            rmax[k] = n ? std::max(rmax[k], r0[k]) : r0[k];
+        }
+    }
+    const double list_cutoff = cutoff_ + 2 * max_extent;
+
+    // In gas phase, with the default (large) cutoffs, all the pairs are
+    // within the cutoff and there is no need for a list
+    double diag2 = 0.0;
+    for (size_t k = 0; k < 3; k++) diag2 += (rmax[k] - rmin[k]) * (rmax[k] - rmin[k]);
+    all_pairs_in_cutoff_ = !use_pbc_ && std::sqrt(diag2) < cutoff_;
+    if (all_pairs_in_cutoff_) {
+        real_space_neighbors_.Clear();
+        return;
+    }
+
+    if (!real_space_neighbors_.IsValid(sys_xyz_, first_ind_, nmon_total_, list_cutoff, 0.0, use_pbc_, box_)) {
+        real_space_neighbors_.Build(sys_xyz_, first_ind_, nmon_total_, list_cutoff, 0.0, use_pbc_, box_,
+                                    box_inverse_);
+    }
+}
+
+void Electrostatics::GetRealSpaceNeighbors(size_t mon1, size_t fi_mon2, size_t m2init, size_t nmon2,
+                                           std::vector<size_t> &m2_list) const {
+    m2_list.clear();
+    if (all_pairs_in_cutoff_) {
+        for (size_t m2 = m2init; m2 < nmon2; m2++) m2_list.push_back(m2);
+        return;
+    }
+
+    // The neighbors are sorted, so the ones of this monomer type are contiguous
+    const size_t *first = real_space_neighbors_.GetNeighbors(mon1);
+    const size_t *last = first + real_space_neighbors_.GetNumNeighbors(mon1);
+    const double *dist2 = real_space_neighbors_.GetDistances2(mon1);
+    const size_t *begin = std::lower_bound(first, last, fi_mon2 + m2init);
+    const size_t *end = std::lower_bound(begin, last, fi_mon2 + nmon2);
+    for (const size_t *p = begin; p != end; p++) {
+        const double rc = cutoff_ + mon_extent_[mon1] + mon_extent_[*p];
+        if (dist2[p - first] < rc * rc) m2_list.push_back(*p - fi_mon2);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // PERMANENT ELECTRIC FIELD ////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -357,29 +463,22 @@ void Electrostatics::CalculatePermanentElecFieldMPIlocal(bool use_ghost) {
         std::fill(Efq_.begin(), Efq_.end(), 0);
     }
 
-    // Excluded sets
-    excluded_set_type exc12;
-    excluded_set_type exc13;
-    excluded_set_type exc14;
-
     // Loop over each monomer type
     for (size_t mt = 0; mt < mon_type_count_.size(); mt++) {
         size_t ns = sites_[fi_mon];
         size_t nmon = mon_type_count_[mt].second;
         size_t nmon2 = 2 * nmon;
 
-        // Obtain excluded pairs for monomer type mt
-        systools::GetExcluded(mon_id_[fi_mon], mon_j_, exc12, exc13, exc14);
-
         // Loop over each pair of sites
         for (size_t i = 0; i < ns - 1; i++) {
             size_t inmon = i * nmon;
             size_t inmon3 = inmon * 3;
             for (size_t j = i + 1; j < ns; j++) {
                 // Continue only if i and j are not bonded
-                bool is12 = systools::IsExcluded(exc12, i, j);
-                bool is13 = systools::IsExcluded(exc13, i, j);
-                bool is14 = systools::IsExcluded(exc14, i, j);
+                unsigned char exc = mon_types_->GetExclusion(mt, i, j);
+                bool is12 = exc & bblock::EXCLUDED_12;
+                bool is13 = exc & bblock::EXCLUDED_13;
+                bool is14 = exc & bblock::EXCLUDED_14;
                 double elec_scale_factor = (is12 || is13 || is14) ? 0 : 1;
 
                 // Get a1a2 and check if is not 0.
@@ -696,8 +795,6 @@ void Electrostatics::CalculatePermanentElecFieldMPIlocal(bool use_ghost) {
     if (!simcell_periodic_) compute_pme = false;
 
     if (compute_pme) {
-        helpme::PMEInstance<double> pme_solver_;
-        if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
         // Compute the reciprocal space terms, using PME
         double A, B, C, alpha, beta, gamma;
         if (use_ghost) {
@@ -715,17 +812,7 @@ void Electrostatics::CalculatePermanentElecFieldMPIlocal(bool use_ghost) {
             beta = box_ABCabc_[4];
             gamma = box_ABCabc_[5];
         }
-        int grid_A = pme_grid_density_ * A;
-        int grid_B = pme_grid_density_ * B;
-        int grid_C = pme_grid_density_ * C;
-        if (mpi_initialized_) {
-            pme_solver_.setupParallel(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0, world_,
-                                      PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
-        } else {
-            pme_solver_.setup(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0);
-        }
-
-        pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+        helpme::PMEInstance<double> &pme_solver = GetPMESolver(A, B, C, alpha, beta, gamma);
 
         // N.B. these do not make copies; they just wrap the memory with some metadata
         auto coords = helpme::Matrix<double>(sys_xyz_.data(), nsites_, 3);
@@ -782,7 +869,7 @@ void Electrostatics::CalculatePermanentElecFieldMPIlocal(bool use_ghost) {
 
         auto result = helpme::Matrix<double>(rec_phi_and_field_.data(), nsites_, 4);
         std::fill(rec_phi_and_field_.begin(), rec_phi_and_field_.end(), 0);
-        pme_solver_.computePRec(0, charges, coords, coords, 1, result);
+        pme_solver.computePRec(0, charges, coords, coords, 1, result);
 
         // Resort phi from system order
         fi_mon = 0;
@@ -875,6 +962,11 @@ void Electrostatics::CalculatePermanentElecField(bool use_ghost) {
     size_t maxnmon = mon_type_count_.back().second;
     ElectricFieldHolder elec_field(maxnmon);
 
+    // Monomer pairs within the cutoff, also used by the induced dipoles
+    UpdateRealSpaceNeighbors();
+    // The dipole-dipole tensors of the previous coordinates are no longer valid
+    dip_tensors_updated_ = false;
+
     // Parallelization
     size_t nthreads = 1;
 #ifdef _OPENMP
@@ -904,29 +996,22 @@ void Electrostatics::CalculatePermanentElecField(bool use_ghost) {
     std::fill(phi_.begin(), phi_.end(), 0);
     std::fill(Efq_.begin(), Efq_.end(), 0);
 
-    // Excluded sets
-    excluded_set_type exc12;
-    excluded_set_type exc13;
-    excluded_set_type exc14;
-
     // Loop over each monomer type
     for (size_t mt = 0; mt < mon_type_count_.size(); mt++) {
         size_t ns = sites_[fi_mon];
         size_t nmon = mon_type_count_[mt].second;
         size_t nmon2 = 2 * nmon;
 
-        // Obtain excluded pairs for monomer type mt
-        systools::GetExcluded(mon_id_[fi_mon], mon_j_, exc12, exc13, exc14);
-
         // Loop over each pair of sites
         for (size_t i = 0; i < ns - 1; i++) {
             size_t inmon = i * nmon;
             size_t inmon3 = inmon * 3;
             for (size_t j = i + 1; j < ns; j++) {
                 // Continue only if i and j are not bonded
-                bool is12 = systools::IsExcluded(exc12, i, j);
-                bool is13 = systools::IsExcluded(exc13, i, j);
-                bool is14 = systools::IsExcluded(exc14, i, j);
+                unsigned char exc = mon_types_->GetExclusion(mt, i, j);
+                bool is12 = exc & bblock::EXCLUDED_12;
+                bool is13 = exc & bblock::EXCLUDED_13;
+                bool is14 = exc & bblock::EXCLUDED_14;
                 double elec_scale_factor = (is12 || is13 || is14) ? 0 : 1;
 
                 // Get a1a2 and check if is not 0.
@@ -1037,7 +1122,7 @@ void Electrostatics::CalculatePermanentElecField(bool use_ghost) {
             // previous loop.
             bool same = (mt1 == mt2);
 
-            // TODO add neighbour list here
+            // Only the monomers m2 with sites within the cutoff are visited
             // Loop over all pair of sites
 
             std::vector<std::shared_ptr<ElectricFieldHolder>> field_pool;
@@ -1067,6 +1152,36 @@ void Electrostatics::CalculatePermanentElecField(bool use_ghost) {
 #endif
                 std::shared_ptr<ElectricFieldHolder> local_field = field_pool[rank];
                 size_t m2init = same ? m1 + 1 : 0;
+
+                // Get the monomers m2 that are close to m1, and copy their
+                // sites in vectorized form, as if they were the only monomers
+                // of type mt2. xyz_sitej is x1_1 x1_2 ... y1_1 ... for site 1,
+                // then site 2, and so on.
+                std::vector<size_t> m2_list;
+                GetRealSpaceNeighbors(fi_mon1 + m1, fi_mon2, m2init, nmon2, m2_list);
+                size_t size_j = m2_list.size();
+                if (size_j == 0) continue;
+
+                std::vector<double> xyz_sitej(3 * ns2 * size_j);
+                std::vector<double> chg_sitej(ns2 * size_j);
+                std::vector<double> phi_sitej(ns2 * size_j, 0.0);
+                std::vector<double> Efq_sitej(3 * ns2 * size_j, 0.0);
+                for (size_t j = 0; j < ns2; j++) {
+                    size_t start_j = fi_crd2 + 3 * j * nmon2;
+                    for (size_t ind = 0; ind < size_j; ind++) {
+                        size_t m2 = m2_list[ind];
+                        xyz_sitej[3 * j * size_j + ind] = xyz_[start_j + m2];
+                        xyz_sitej[3 * j * size_j + size_j + ind] = xyz_[start_j + nmon2 + m2];
+                        xyz_sitej[3 * j * size_j + 2 * size_j + ind] = xyz_[start_j + 2 * nmon2 + m2];
+                        chg_sitej[j * size_j + ind] = chg_[fi_sites2 + j * nmon2 + m2];
+                    }
+                }
+
+                // local/ghost descriptor of m1, followed by the ones of the m2
+                std::vector<size_t> islocal_sitej(size_j + 1);
+                islocal_sitej[0] = islocal_[fi_mon1 + m1];
+                for (size_t ind = 0; ind < size_j; ind++) islocal_sitej[ind + 1] = islocal_[fi_mon2 + m2_list[ind]];
+
                 double ex_thread = 0.0;
                 double ey_thread = 0.0;
                 double ez_thread = 0.0;
@@ -1075,40 +1190,10 @@ void Electrostatics::CalculatePermanentElecField(bool use_ghost) {
                     size_t inmon1 = i * nmon1;
                     size_t inmon13 = inmon1 * 3;
 
-                    std::vector<double> xyz_sitei(3);
-                    xyz_sitei[0] = xyz_[fi_crd1 + inmon13 + m1];
-                    xyz_sitei[1] = xyz_[fi_crd1 + inmon13 + nmon1 + m1];
-                    xyz_sitei[2] = xyz_[fi_crd1 + inmon13 + 2 * nmon1 + m1];
-
                     for (size_t j = 0; j < ns2; j++) {
-                        size_t jnmon2 = j * nmon2;
-                        size_t jnmon23 = jnmon2 * 3;
-                        // If PBC is activated, get the xyz in vectorized form for
-                        // all the monomer2 sites j
-                        // What we are going to do here is to get all sites j of all m2
-                        // that are close to site i of the monomer m1 we are looking at
-                        size_t start_j = fi_crd2 + jnmon23;
-                        size_t size_j = nmon2 - m2init;
-                        std::vector<double> xyz_sitej(3 * size_j);
-                        // Copy x
-                        std::copy(xyz_.begin() + start_j + m2init, xyz_.begin() + start_j + nmon2, xyz_sitej.begin());
-                        // Copy y
-                        std::copy(xyz_.begin() + start_j + nmon2 + m2init, xyz_.begin() + start_j + 2 * nmon2,
-                                  xyz_sitej.begin() + size_j);
-                        // Copy y
-                        std::copy(xyz_.begin() + start_j + 2 * nmon2 + m2init, xyz_.begin() + start_j + 3 * nmon2,
-                                  xyz_sitej.begin() + 2 * size_j);
-
-                        // Vector that will tell the original position of the new sites
-                        std::vector<double> chg_sitej(size_j);
-                        std::vector<double> phi_sitej(size_j, 0.0);
-                        std::vector<double> Efq_sitej(3 * size_j, 0.0);
                         // declare temporary virial for each pair
                         std::vector<double> virial_thread(9, 0.0);
 
-                        std::copy(chg_.begin() + fi_sites2 + nmon2 * j + m2init,
-                                  chg_.begin() + fi_sites2 + nmon2 * (j + 1), chg_sitej.begin());
-
                         // Check if A = 0 and call the proper field calculation
                         double A = polfac_[fi_sites1 + i] * polfac_[fi_sites2 + j];
                         double Ai = 0.0;
@@ -1124,18 +1209,10 @@ void Electrostatics::CalculatePermanentElecField(bool use_ghost) {
                         double elec_scale_factor = 1;
                         local_field->CalcPermanentElecField(
                             xyz_.data() + fi_crd1, xyz_sitej.data(), chg_.data() + fi_sites1, chg_sitej.data(), m1, 0,
-                            size_j, nmon1, size_j, i, 0, Ai, Asqsqi, aCC_, aCC1_4_, g34_, &ex_thread, &ey_thread,
+                            size_j, nmon1, size_j, i, j, Ai, Asqsqi, aCC_, aCC1_4_, g34_, &ex_thread, &ey_thread,
                             &ez_thread, &phi1_thread, phi_sitej.data(), Efq_sitej.data(), elec_scale_factor,
-                            ewald_alpha_, use_pbc_, box_, box_inverse_, cutoff_, use_ghost, islocal_, fi_mon1 + m1,
-                            fi_mon2, m2init, &virial_thread);
-
-                        // Put proper data in field and electric field of j
-                        for (size_t ind = 0; ind < size_j; ind++) {
-                            phi_2_pool[rank][jnmon2 + m2init + ind] += phi_sitej[ind];
-                            for (size_t dim = 0; dim < 3; dim++) {
-                                Efq_2_pool[rank][jnmon23 + nmon2 * dim + m2init + ind] += Efq_sitej[dim * size_j + ind];
-                            }
-                        }
+                            ewald_alpha_, use_pbc_, box_, box_inverse_, cutoff_, use_ghost, islocal_sitej, 0, 1, 0,
+                            &virial_thread);
 
                         phi_1_pool[rank][inmon1 + m1] += phi1_thread;
                         Efq_1_pool[rank][inmon13 + m1] += ex_thread;
@@ -1148,6 +1225,20 @@ void Electrostatics::CalculatePermanentElecField(bool use_ghost) {
                         }
                     }
                 }
+
+                // Put proper data in field and electric field of j
+                for (size_t j = 0; j < ns2; j++) {
+                    size_t jnmon2 = j * nmon2;
+                    size_t jnmon23 = jnmon2 * 3;
+                    for (size_t ind = 0; ind < size_j; ind++) {
+                        size_t m2 = m2_list[ind];
+                        phi_2_pool[rank][jnmon2 + m2] += phi_sitej[j * size_j + ind];
+                        for (size_t dim = 0; dim < 3; dim++) {
+                            Efq_2_pool[rank][jnmon23 + nmon2 * dim + m2] +=
+                                Efq_sitej[3 * j * size_j + dim * size_j + ind];
+                        }
+                    }
+                }
             }
             // Compress data in Efq and phi
             for (size_t rank = 0; rank < nthreads; rank++) {
@@ -1236,8 +1327,6 @@ void Electrostatics::CalculatePermanentElecField(bool use_ghost) {
 #endif
 
     if (ewald_alpha_ > 0 && use_pbc_) {
-        helpme::PMEInstance<double> pme_solver_;
-        if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
         // Compute the reciprocal space terms, using PME
         double A, B, C, alpha, beta, gamma;
         A = box_ABCabc_[0];
@@ -1247,22 +1336,13 @@ void Electrostatics::CalculatePermanentElecField(bool use_ghost) {
         beta = box_ABCabc_[4];
         gamma = box_ABCabc_[5];
 
-        int grid_A = pme_grid_density_ * A;
-        int grid_B = pme_grid_density_ * B;
-        int grid_C = pme_grid_density_ * C;
-        if (mpi_initialized_) {
-            pme_solver_.setupParallel(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0, world_,
-                                      PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
-        } else {
-            pme_solver_.setup(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0);
-        }
-        pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+        helpme::PMEInstance<double> &pme_solver = GetPMESolver(A, B, C, alpha, beta, gamma);
         // N.B. these do not make copies; they just wrap the memory with some metadata
         auto coords = helpme::Matrix<double>(sys_xyz_.data(), nsites_, 3);
         auto charges = helpme::Matrix<double>(sys_chg_.data(), nsites_, 1);
         auto result = helpme::Matrix<double>(rec_phi_and_field_.data(), nsites_, 4);
         std::fill(rec_phi_and_field_.begin(), rec_phi_and_field_.end(), 0);
-        pme_solver_.computePRec(0, charges, coords, coords, 1, result);
+        pme_solver.computePRec(0, charges, coords, coords, 1, result);
 
 #if HAVE_MPI == 1
         MPI_Allreduce(MPI_IN_PLACE, rec_phi_and_field_.data(), rec_phi_and_field_.size(), MPI_DOUBLE, MPI_SUM, world_);
@@ -1388,6 +1468,11 @@ void Electrostatics::CalculateDipolesMPIlocal(bool use_ghost) {
 
     } else if (dip_method_ == "cg") {
         CalculateDipolesCGMPIlocal(use_ghost);
+    } else if (dip_method_ == "pcg") {
+        // CalculateDipolesPCG();
+
+        std::string text = std::string("CalculateDipolesPCGMPIlocal missing. ");
+        throw CUException(__func__, __FILE__, __LINE__, text);
     } else if (dip_method_ == "aspc") {
         // CalculateDipolesAspc();
 
@@ -1424,6 +1509,8 @@ void Electrostatics::CalculateDipoles() {
         CalculateDipolesIterative();
     else if (dip_method_ == "cg")
         CalculateDipolesCG();
+    else if (dip_method_ == "pcg")
+        CalculateDipolesPCG();
     else if (dip_method_ == "aspc")
         CalculateDipolesAspc();
 }
@@ -2047,6 +2134,235 @@ void Electrostatics::CalculateDipolesCG() {
     //    Efd = Efq - 1/pol
 }
 
+void Electrostatics::ComputeDipolePreconditioner() {
+    // Max number of monomers
+    size_t maxnmon = mon_type_count_.back().second;
+    ElectricFieldHolder elec_field(maxnmon);
+
+    // One 3n x 3n block per monomer
+    size_t nblock = 0;
+    size_t fi_mon = 0;
+    for (size_t mt = 0; mt < mon_type_count_.size(); mt++) {
+        size_t ns3 = 3 * sites_[fi_mon];
+        size_t nmon = mon_type_count_[mt].second;
+        nblock += nmon * ns3 * ns3;
+        fi_mon += nmon;
+    }
+    pcg_block_inv_.assign(nblock, 0.0);
+
+    // Auxiliary variables
+    double ex = 0.0;
+    double ey = 0.0;
+    double ez = 0.0;
+
+    fi_mon = 0;
+    size_t fi_sites = 0;
+    size_t fi_crd = 0;
+    size_t fi_block = 0;
+    for (size_t mt = 0; mt < mon_type_count_.size(); mt++) {
+        size_t ns = sites_[fi_mon];
+        size_t ns3 = 3 * ns;
+        size_t ns3sq = ns3 * ns3;
+        size_t nmon = mon_type_count_[mt].second;
+        size_t nmon2 = 2 * nmon;
+
+        // Column k = 3 * site + component of the block is the field due to a unit
+        // dipole on that site and component. In the xx..yy..zz order, element k of
+        // monomer m is at k * nmon + m.
+        std::vector<double> probe(ns3 * nmon);
+        std::vector<double> field(ns3 * nmon);
+        double *block = pcg_block_inv_.data() + fi_block;
+        for (size_t k = 0; k < ns3; k++) {
+            size_t s = k / 3;
+            std::fill(probe.begin(), probe.end(), 0.0);
+            std::fill(probe.begin() + k * nmon, probe.begin() + (k + 1) * nmon, 1.0);
+            std::fill(field.begin(), field.end(), 0.0);
+
+            // With PME, the intramolecular field is the sum of the real space, reciprocal
+            // space and self terms. Leaving aside the periodic images of the monomer, that
+            // sum is the undamped (no Ewald) field, which is what is used for the block.
+            for (size_t i = 0; i < ns - 1; i++) {
+                size_t inmon3 = 3 * i * nmon;
+                for (size_t j = i + 1; j < ns; j++) {
+                    if (i != s && j != s) continue;
+                    // Same damping as in ComputeDipoleField
+                    unsigned char exc = mon_types_->GetExclusion(mt, i, j);
+                    bool is12 = exc & bblock::EXCLUDED_12;
+                    bool is13 = exc & bblock::EXCLUDED_13;
+                    bool is14 = exc & bblock::EXCLUDED_14;
+                    double aDD = systools::GetAdd(is12, is13, is14, mon_id_[fi_mon]);
+                    double A = polfac_[fi_sites + i] * polfac_[fi_sites + j];
+                    double Asqsqi = BIGNUM;
+                    if (A > constants::EPS) {
+                        A = std::pow(A, 1.0 / 6.0);
+                        double Ai = 1 / A;
+                        Asqsqi = Ai * Ai * Ai * Ai;
+                    }
+
+                    for (size_t m = 0; m < nmon; m++) {
+                        elec_field.CalcDipoleElecField(xyz_.data() + fi_crd, xyz_.data() + fi_crd, probe.data(),
+                                                       probe.data(), m, m, m + 1, nmon, nmon, i, j, Asqsqi, aDD,
+                                                       field.data(), &ex, &ey, &ez, 0.0, use_pbc_, box_,
+                                                       box_inverse_, cutoff_, false, islocal_, fi_mon + m, fi_mon);
+                        field[inmon3 + m] += ex;
+                        field[inmon3 + nmon + m] += ey;
+                        field[inmon3 + nmon2 + m] += ez;
+                    }
+                }
+            }
+
+            // Same scaling as in DipolesCGIteration: B = 1 - sqrt(pol) F sqrt(pol)
+            for (size_t m = 0; m < nmon; m++) {
+                double pk = pol_sqrt_[fi_crd + k * nmon + m];
+                for (size_t l = 0; l < ns3; l++) {
+                    double f = field[l * nmon + m];
+                    block[m * ns3sq + l * ns3 + k] = (l == k ? 1.0 : 0.0) - pol_sqrt_[fi_crd + l * nmon + m] * f * pk;
+                }
+            }
+        }
+
+        // Invert each block in place with Gauss-Jordan elimination and partial pivoting.
+        // A singular block is replaced by the identity, which is plain CG for that monomer.
+        std::vector<double> a(ns3sq);
+        for (size_t m = 0; m < nmon; m++) {
+            double *inv = block + m * ns3sq;
+            std::copy(inv, inv + ns3sq, a.begin());
+            std::fill(inv, inv + ns3sq, 0.0);
+            for (size_t l = 0; l < ns3; l++) inv[l * ns3 + l] = 1.0;
+
+            bool singular = false;
+            for (size_t col = 0; col < ns3; col++) {
+                size_t piv = col;
+                for (size_t r = col + 1; r < ns3; r++) {
+                    if (std::abs(a[r * ns3 + col]) > std::abs(a[piv * ns3 + col])) piv = r;
+                }
+                if (std::abs(a[piv * ns3 + col]) < constants::EPS) {
+                    singular = true;
+                    break;
+                }
+                if (piv != col) {
+                    std::swap_ranges(a.begin() + piv * ns3, a.begin() + (piv + 1) * ns3, a.begin() + col * ns3);
+                    std::swap_ranges(inv + piv * ns3, inv + (piv + 1) * ns3, inv + col * ns3);
+                }
+                double d = 1.0 / a[col * ns3 + col];
+                for (size_t c = 0; c < ns3; c++) {
+                    a[col * ns3 + c] *= d;
+                    inv[col * ns3 + c] *= d;
+                }
+                for (size_t r = 0; r < ns3; r++) {
+                    double f = a[r * ns3 + col];
+                    if (r == col || f == 0.0) continue;
+                    for (size_t c = 0; c < ns3; c++) {
+                        a[r * ns3 + c] -= f * a[col * ns3 + c];
+                        inv[r * ns3 + c] -= f * inv[col * ns3 + c];
+                    }
+                }
+            }
+
+            if (singular) {
+                std::fill(inv, inv + ns3sq, 0.0);
+                for (size_t l = 0; l < ns3; l++) inv[l * ns3 + l] = 1.0;
+            }
+        }
+
+        // Update first indexes
+        fi_mon += nmon;
+        fi_sites += nmon * ns;
+        fi_crd += nmon * ns3;
+        fi_block += nmon * ns3sq;
+    }
+}
+
+void Electrostatics::ApplyDipolePreconditioner(const std::vector<double> &in_v, std::vector<double> &out_v) {
+    size_t fi_mon = 0;
+    size_t fi_crd = 0;
+    size_t fi_block = 0;
+    for (size_t mt = 0; mt < mon_type_count_.size(); mt++) {
+        size_t ns3 = 3 * sites_[fi_mon];
+        size_t ns3sq = ns3 * ns3;
+        size_t nmon = mon_type_count_[mt].second;
+        const double *in_ptr = in_v.data() + fi_crd;
+        double *out_ptr = out_v.data() + fi_crd;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (size_t m = 0; m < nmon; m++) {
+            const double *inv = pcg_block_inv_.data() + fi_block + m * ns3sq;
+            for (size_t l = 0; l < ns3; l++) {
+                double sum = 0.0;
+                for (size_t k = 0; k < ns3; k++) sum += inv[l * ns3 + k] * in_ptr[k * nmon + m];
+                out_ptr[l * nmon + m] = sum;
+            }
+        }
+
+        // Update first indexes
+        fi_mon += nmon;
+        fi_crd += nmon * ns3;
+        fi_block += nmon * ns3sq;
+    }
+}
+
+void Electrostatics::CalculateDipolesPCG() {
+    size_t nsites3 = nsites_ * 3;
+
+    // Same initial guess as in CalculateDipolesCG
+    for (size_t i = 0; i < nsites3; i++) {
+        mu_[i] = pol_sqrt_[i] * pol_sqrt_[i] * Efq_[i];
+    }
+
+    // The intramolecular blocks only depend on the coordinates,
+    // so they are built once per call
+    ComputeDipolePreconditioner();
+
+    // Preconditioned CG. Same system as in CalculateDipolesCG, following:
+    // https://en.wikipedia.org/wiki/Conjugate_gradient_method#The_preconditioned_conjugate_gradient_method
+    std::vector<double> ts2v(nsites3);
+    std::vector<double> rv(nsites3);
+    std::vector<double> zv(nsites3);
+    std::vector<double> pv(nsites3);
+
+    DipolesCGIteration(mu_, ts2v);
+    for (size_t i = 0; i < nsites3; i++) {
+        rv[i] = Efq_[i] * pol_sqrt_[i] - ts2v[i];
+    }
+    ApplyDipolePreconditioner(rv, zv);
+    pv = zv;
+
+    size_t iter = 1;
+    double rvrv = DotProduct(rv, rv);
+    double rvzv = DotProduct(rv, zv);
+    while (rvrv >= tolerance_) {
+        DipolesCGIteration(pv, ts2v);
+        double alphak = rvzv / DotProduct(pv, ts2v);
+        for (size_t i = 0; i < nsites3; i++) {
+            mu_[i] += alphak * pv[i];
+            rv[i] -= alphak * ts2v[i];
+        }
+
+        rvrv = DotProduct(rv, rv);
+        if (rvrv < tolerance_) break;
+
+        if (iter > maxit_) {
+            // Exit with error
+            std::cerr << "Max number of iterations reached" << std::endl;
+        }
+
+        // Prepare next iteration
+        ApplyDipolePreconditioner(rv, zv);
+        double rvzv_new = DotProduct(rv, zv);
+        double betak = rvzv_new / rvzv;
+        for (size_t i = 0; i < nsites3; i++) {
+            pv[i] = zv[i] + betak * pv[i];
+        }
+        rvzv = rvzv_new;
+        iter++;
+    }
+
+    for (size_t i = 0; i < nsites3; i++) {
+        mu_[i] *= pol_sqrt_[i];
+    }
+}
+
 void Electrostatics::SetAspcParameters(size_t k) {
     k_aspc_ = k;
     b_consts_aspc_ = std::vector<double>(k + 2, 0.0);
@@ -2519,11 +2835,6 @@ void Electrostatics::ComputeDipoleFieldMPIlocal(std::vector<double> &in_v, std::
     double *in_ptr = in_v.data();
     double aDD = 0.0;
 
-    // Excluded sets
-    excluded_set_type exc12;
-    excluded_set_type exc13;
-    excluded_set_type exc14;
-
     // Auxiliary variables
     double ex = 0.0;
     double ey = 0.0;
@@ -2540,15 +2851,14 @@ void Electrostatics::ComputeDipoleFieldMPIlocal(std::vector<double> &in_v, std::
         //      if (ns == 1) continue;
         size_t nmon = mon_type_count_[mt].second;
         size_t nmon2 = 2 * nmon;
-        // Get excluded pairs for this monomer
-        systools::GetExcluded(mon_id_[fi_mon], mon_j_, exc12, exc13, exc14);
         for (size_t i = 0; i < ns - 1; i++) {
             size_t inmon3 = 3 * i * nmon;
             for (size_t j = i + 1; j < ns; j++) {
                 // Set the proper aDD
-                bool is12 = systools::IsExcluded(exc12, i, j);
-                bool is13 = systools::IsExcluded(exc13, i, j);
-                bool is14 = systools::IsExcluded(exc14, i, j);
+                unsigned char exc = mon_types_->GetExclusion(mt, i, j);
+                bool is12 = exc & bblock::EXCLUDED_12;
+                bool is13 = exc & bblock::EXCLUDED_13;
+                bool is14 = exc & bblock::EXCLUDED_14;
                 aDD = systools::GetAdd(is12, is13, is14, mon_id_[fi_mon]);
                 double A = polfac_[fi_sites + i] * polfac_[fi_sites + j];
                 double Ai = 0.0;
@@ -2808,8 +3118,6 @@ void Electrostatics::ComputeDipoleFieldMPIlocal(std::vector<double> &in_v, std::
             fi_crd += nmon * ns * 3;
         }
 
-        helpme::PMEInstance<double> pme_solver_;
-        if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
         // Compute the reciprocal space terms, using PME
         double A, B, C, alpha, beta, gamma;
         if (use_ghost) {
@@ -2827,16 +3135,7 @@ void Electrostatics::ComputeDipoleFieldMPIlocal(std::vector<double> &in_v, std::
             beta = box_ABCabc_[4];
             gamma = box_ABCabc_[5];
         }
-        int grid_A = pme_grid_density_ * A;
-        int grid_B = pme_grid_density_ * B;
-        int grid_C = pme_grid_density_ * C;
-        if (mpi_initialized_) {
-            pme_solver_.setupParallel(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0, world_,
-                                      PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
-        } else {
-            pme_solver_.setup(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0);
-        }
-        pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+        helpme::PMEInstance<double> &pme_solver = GetPMESolver(A, B, C, alpha, beta, gamma);
 
         // N.B. these do not make copies; they just wrap the memory with some metadata
         auto coords = helpme::Matrix<double>(sys_xyz_.data(), nsites_, 3);
@@ -2918,7 +3217,7 @@ void Electrostatics::ComputeDipoleFieldMPIlocal(std::vector<double> &in_v, std::
         }  // debug print
 #endif
 
-        pme_solver_.computePRec(-1, dipoles, coords, coords, -1, result);
+        pme_solver.computePRec(-1, dipoles, coords, coords, -1, result);
 
 #ifdef _DEBUG_DIPFIELD
         {  // debug print
@@ -3028,7 +3327,265 @@ void Electrostatics::ComputeDipoleFieldMPIlocal(std::vector<double> &in_v, std::
     reverse_forward_comm(out_v);
 }
 
+bool Electrostatics::UpdateDipoleTensors() {
+    if (dip_tensor_max_mb_ <= 0) return false;
+    if (dip_tensors_updated_) return dip_tensors_cached_;
+    dip_tensors_updated_ = true;
+    dip_tensors_cached_ = false;
+
+    // Monomers m2 visited by each m1, with the same loops and
+    // the same split among MPI ranks as in ComputeDipoleField
+    dip_tensor_m2_.clear();
+    dip_tensor_m2_first_.clear();
+    dip_tensors_first_.clear();
+    size_t ntensors = 0;
+    std::vector<size_t> m2_list;
+    size_t fi_mon1 = 0;
+    for (size_t mt1 = 0; mt1 < mon_type_count_.size(); mt1++) {
+        size_t ns1 = sites_[fi_mon1];
+        size_t nmon1 = mon_type_count_[mt1].second;
+        size_t fi_mon2 = fi_mon1;
+        for (size_t mt2 = mt1; mt2 < mon_type_count_.size(); mt2++) {
+            size_t ns2 = sites_[fi_mon2];
+            size_t nmon2 = mon_type_count_[mt2].second;
+            bool same = (mt1 == mt2);
+            for (size_t m1 = 0; m1 < nmon1; m1++) {
+                dip_tensor_m2_first_.push_back(dip_tensor_m2_.size());
+                dip_tensors_first_.push_back(ntensors);
+                if (m1 < size_t(mpi_rank_) || (m1 - mpi_rank_) % num_mpi_ranks_) continue;
+                GetRealSpaceNeighbors(fi_mon1 + m1, fi_mon2, same ? m1 + 1 : 0, nmon2, m2_list);
+                dip_tensor_m2_.insert(dip_tensor_m2_.end(), m2_list.begin(), m2_list.end());
+                // Five values per pair of sites
+                ntensors += 5 * ns1 * ns2 * m2_list.size();
+            }
+            fi_mon2 += nmon2;
+        }
+        fi_mon1 += nmon1;
+    }
+    dip_tensor_m2_first_.push_back(dip_tensor_m2_.size());
+    dip_tensors_first_.push_back(ntensors);
+
+    // If the tensors do not fit, they are recomputed in every iteration
+    double size_mb = (sizeof(double) * ntensors +
+                      sizeof(size_t) * (dip_tensor_m2_.size() + 2 * dip_tensor_m2_first_.size())) /
+                     (1024.0 * 1024.0);
+    if (size_mb > dip_tensor_max_mb_) {
+        std::vector<size_t>().swap(dip_tensor_m2_);
+        std::vector<size_t>().swap(dip_tensor_m2_first_);
+        std::vector<size_t>().swap(dip_tensors_first_);
+        std::vector<double>().swap(dip_tensors_);
+        return false;
+    }
+    dip_tensors_.resize(ntensors);
+
+    // Parallelization
+    size_t nthreads = 1;
+#ifdef _OPENMP
+#pragma omp parallel  // omp_get_num_threads() needs to be inside
+                      // parallel region to get number of threads
+    {
+        if (omp_get_thread_num() == 0) nthreads = omp_get_num_threads();
+    }
+#endif
+
+    // Max number of monomers
+    size_t maxnmon = mon_type_count_.back().second;
+    std::vector<std::shared_ptr<ElectricFieldHolder>> field_pool;
+    for (size_t i = 0; i < nthreads; i++) field_pool.push_back(std::make_shared<ElectricFieldHolder>(maxnmon));
+
+    fi_mon1 = 0;
+    size_t fi_sites1 = 0;
+    size_t fi_crd1 = 0;
+    size_t fi_key = 0;
+    // aDD intermolecular is always 0.055
+    double aDD = 0.055;
+    for (size_t mt1 = 0; mt1 < mon_type_count_.size(); mt1++) {
+        size_t ns1 = sites_[fi_mon1];
+        size_t nmon1 = mon_type_count_[mt1].second;
+        size_t fi_mon2 = fi_mon1;
+        size_t fi_sites2 = fi_sites1;
+        size_t fi_crd2 = fi_crd1;
+        for (size_t mt2 = mt1; mt2 < mon_type_count_.size(); mt2++) {
+            size_t ns2 = sites_[fi_mon2];
+            size_t nmon2 = mon_type_count_[mt2].second;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (size_t m1 = 0; m1 < nmon1; m1++) {
+                int rank = 0;
+#ifdef _OPENMP
+                rank = omp_get_thread_num();
+#endif
+                size_t key = fi_key + m1;
+                const size_t *m2_list_ptr = dip_tensor_m2_.data() + dip_tensor_m2_first_[key];
+                size_t size_j = dip_tensor_m2_first_[key + 1] - dip_tensor_m2_first_[key];
+                if (size_j == 0) continue;
+
+                // Copy the sites of the monomers m2 in vectorized form
+                std::vector<double> xyz_sitej(3 * ns2 * size_j);
+                for (size_t j = 0; j < ns2; j++) {
+                    for (size_t dim = 0; dim < 3; dim++) {
+                        size_t start_j = fi_crd2 + 3 * j * nmon2 + dim * nmon2;
+                        size_t start_sitej = 3 * j * size_j + dim * size_j;
+                        for (size_t ind = 0; ind < size_j; ind++) {
+                            xyz_sitej[start_sitej + ind] = xyz_[start_j + m2_list_ptr[ind]];
+                        }
+                    }
+                }
+
+                double *tensors = dip_tensors_.data() + dip_tensors_first_[key];
+                for (size_t i = 0; i < ns1; i++) {
+                    for (size_t j = 0; j < ns2; j++) {
+                        double A = polfac_[fi_sites1 + i] * polfac_[fi_sites2 + j];
+                        double Asqsqi = BIGNUM;
+                        if (A > constants::EPS) {
+                            A = std::pow(A, 1.0 / 6.0);
+                            double Ai = 1 / A;
+                            Asqsqi = Ai * Ai * Ai * Ai;
+                        }
+                        field_pool[rank]->CalcDipoleTensors(xyz_.data() + fi_crd1, xyz_sitej.data(), m1, 0, size_j,
+                                                            nmon1, size_j, i, j, Asqsqi, aDD,
+                                                            tensors + 5 * size_j * (i * ns2 + j), ewald_alpha_,
+                                                            use_pbc_, box_, box_inverse_, cutoff_);
+                    }
+                }
+            }
+
+            // Update first indexes
+            fi_key += nmon1;
+            fi_mon2 += nmon2;
+            fi_sites2 += nmon2 * ns2;
+            fi_crd2 += nmon2 * ns2 * 3;
+        }
+        // Update first indexes
+        fi_mon1 += nmon1;
+        fi_sites1 += nmon1 * ns1;
+        fi_crd1 += nmon1 * ns1 * 3;
+    }
+
+    dip_tensors_cached_ = true;
+    return true;
+}
+
+void Electrostatics::ComputeDipoleFieldFromTensors(std::vector<double> &in_v, std::vector<double> &out_v) {
+    // Parallelization
+    size_t nthreads = 1;
+#ifdef _OPENMP
+#pragma omp parallel  // omp_get_num_threads() needs to be inside
+                      // parallel region to get number of threads
+    {
+        if (omp_get_thread_num() == 0) nthreads = omp_get_num_threads();
+    }
+#endif
+
+    // Max number of monomers
+    size_t maxnmon = mon_type_count_.back().second;
+    double *in_ptr = in_v.data();
+
+    size_t fi_mon1 = 0;
+    size_t fi_crd1 = 0;
+    size_t fi_key = 0;
+    for (size_t mt1 = 0; mt1 < mon_type_count_.size(); mt1++) {
+        size_t ns1 = sites_[fi_mon1];
+        size_t nmon1 = mon_type_count_[mt1].second;
+        size_t nmon12 = 2 * nmon1;
+        size_t fi_mon2 = fi_mon1;
+        size_t fi_crd2 = fi_crd1;
+        for (size_t mt2 = mt1; mt2 < mon_type_count_.size(); mt2++) {
+            size_t ns2 = sites_[fi_mon2];
+            size_t nmon2 = mon_type_count_[mt2].second;
+            // Prepare for parallelization
+            std::vector<std::shared_ptr<ElectricFieldHolder>> field_pool;
+            std::vector<std::vector<double>> Efd_1_pool;
+            std::vector<std::vector<double>> Efd_2_pool;
+            for (size_t i = 0; i < nthreads; i++) {
+                field_pool.push_back(std::make_shared<ElectricFieldHolder>(maxnmon));
+                Efd_1_pool.push_back(std::vector<double>(nmon1 * ns1 * 3, 0.0));
+                Efd_2_pool.push_back(std::vector<double>(nmon2 * ns2 * 3, 0.0));
+            }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (size_t m1 = 0; m1 < nmon1; m1++) {
+                int rank = 0;
+#ifdef _OPENMP
+                rank = omp_get_thread_num();
+#endif
+                size_t key = fi_key + m1;
+                const size_t *m2_list_ptr = dip_tensor_m2_.data() + dip_tensor_m2_first_[key];
+                size_t size_j = dip_tensor_m2_first_[key + 1] - dip_tensor_m2_first_[key];
+                if (size_j == 0) continue;
+
+                // Copy the dipoles of the monomers m2 in vectorized form
+                std::vector<double> mu_sitej(3 * ns2 * size_j);
+                std::vector<double> Efd_sitej(3 * ns2 * size_j, 0.0);
+                for (size_t j = 0; j < ns2; j++) {
+                    for (size_t dim = 0; dim < 3; dim++) {
+                        size_t start_j = fi_crd2 + 3 * j * nmon2 + dim * nmon2;
+                        size_t start_sitej = 3 * j * size_j + dim * size_j;
+                        for (size_t ind = 0; ind < size_j; ind++) {
+                            mu_sitej[start_sitej + ind] = in_ptr[start_j + m2_list_ptr[ind]];
+                        }
+                    }
+                }
+
+                const double *tensors = dip_tensors_.data() + dip_tensors_first_[key];
+                double ex_thread = 0.0;
+                double ey_thread = 0.0;
+                double ez_thread = 0.0;
+                for (size_t i = 0; i < ns1; i++) {
+                    size_t inmon13 = 3 * nmon1 * i;
+                    for (size_t j = 0; j < ns2; j++) {
+                        field_pool[rank]->CalcDipoleElecFieldFromTensors(
+                            tensors + 5 * size_j * (i * ns2 + j), in_ptr + fi_crd1, mu_sitej.data(), m1, 0, size_j,
+                            nmon1, size_j, i, j, Efd_sitej.data(), &ex_thread, &ey_thread, &ez_thread);
+                        Efd_1_pool[rank][inmon13 + m1] += ex_thread;
+                        Efd_1_pool[rank][inmon13 + nmon1 + m1] += ey_thread;
+                        Efd_1_pool[rank][inmon13 + nmon12 + m1] += ez_thread;
+                    }
+                }
+
+                // Put the field on the sites of the monomers m2 back in place
+                for (size_t j = 0; j < ns2; j++) {
+                    for (size_t dim = 0; dim < 3; dim++) {
+                        size_t start_j = 3 * j * nmon2 + dim * nmon2;
+                        size_t start_sitej = 3 * j * size_j + dim * size_j;
+                        for (size_t ind = 0; ind < size_j; ind++) {
+                            Efd_2_pool[rank][start_j + m2_list_ptr[ind]] += Efd_sitej[start_sitej + ind];
+                        }
+                    }
+                }
+            }
+
+            // Compress data in Efd
+            for (size_t rank = 0; rank < nthreads; rank++) {
+                size_t kend1 = Efd_1_pool[rank].size();
+                size_t kend2 = Efd_2_pool[rank].size();
+                for (size_t k = 0; k < kend1; k++) {
+                    out_v[fi_crd1 + k] += Efd_1_pool[rank][k];
+                }
+                for (size_t k = 0; k < kend2; k++) {
+                    out_v[fi_crd2 + k] += Efd_2_pool[rank][k];
+                }
+            }
+
+            // Update first indexes
+            fi_key += nmon1;
+            fi_mon2 += nmon2;
+            fi_crd2 += nmon2 * ns2 * 3;
+        }
+        // Update first indexes
+        fi_mon1 += nmon1;
+        fi_crd1 += nmon1 * ns1 * 3;
+    }
+}
+
 void Electrostatics::ComputeDipoleField(std::vector<double> &in_v, std::vector<double> &out_v, bool use_ghost) {
+    // Monomer pairs within the cutoff. Only rebuilt if the coordinates
+    // changed since the permanent electric field was computed.
+    UpdateRealSpaceNeighbors();
+
     // Parallelization
     size_t nthreads = 1;
 #ifdef _OPENMP
@@ -3098,11 +3655,6 @@ void Electrostatics::ComputeDipoleField(std::vector<double> &in_v, std::vector<d
     double *in_ptr = in_v.data();
     double aDD = 0.0;
 
-    // Excluded sets
-    excluded_set_type exc12;
-    excluded_set_type exc13;
-    excluded_set_type exc14;
-
     // Auxiliary variables
     double ex = 0.0;
     double ey = 0.0;
@@ -3119,15 +3671,14 @@ void Electrostatics::ComputeDipoleField(std::vector<double> &in_v, std::vector<d
         //      if (ns == 1) continue;
         size_t nmon = mon_type_count_[mt].second;
         size_t nmon2 = 2 * nmon;
-        // Get excluded pairs for this monomer
-        systools::GetExcluded(mon_id_[fi_mon], mon_j_, exc12, exc13, exc14);
         for (size_t i = 0; i < ns - 1; i++) {
             size_t inmon3 = 3 * i * nmon;
             for (size_t j = i + 1; j < ns; j++) {
                 // Set the proper aDD
-                bool is12 = systools::IsExcluded(exc12, i, j);
-                bool is13 = systools::IsExcluded(exc13, i, j);
-                bool is14 = systools::IsExcluded(exc14, i, j);
+                unsigned char exc = mon_types_->GetExclusion(mt, i, j);
+                bool is12 = exc & bblock::EXCLUDED_12;
+                bool is13 = exc & bblock::EXCLUDED_13;
+                bool is14 = exc & bblock::EXCLUDED_14;
                 aDD = systools::GetAdd(is12, is13, is14, mon_id_[fi_mon]);
                 double A = polfac_[fi_sites + i] * polfac_[fi_sites + j];
                 double Ai = 0.0;
@@ -3205,98 +3756,142 @@ void Electrostatics::ComputeDipoleField(std::vector<double> &in_v, std::vector<d
     }  // debug print
 #endif
 
-    size_t fi_mon1 = 0;
-    size_t fi_mon2 = 0;
-    size_t fi_sites1 = 0;
-    size_t fi_sites2 = 0;
-    size_t fi_crd1 = 0;
-    size_t fi_crd2 = 0;
-    // aDD intermolecular is always 0.055
-    aDD = 0.055;
-    for (size_t mt1 = 0; mt1 < mon_type_count_.size(); mt1++) {
-        size_t ns1 = sites_[fi_mon1];
-        size_t nmon1 = mon_type_count_[mt1].second;
-        size_t nmon12 = 2 * nmon1;
-        fi_mon2 = fi_mon1;
-        fi_sites2 = fi_sites1;
-        fi_crd2 = fi_crd1;
-        for (size_t mt2 = mt1; mt2 < mon_type_count_.size(); mt2++) {
-            size_t ns2 = sites_[fi_mon2];
-            size_t nmon2 = mon_type_count_[mt2].second;
-            bool same = (mt1 == mt2);
-            // TODO add neighbour list here
-            // Prepare for parallelization
-            std::vector<std::shared_ptr<ElectricFieldHolder>> field_pool;
-            std::vector<std::vector<double>> Efd_1_pool;
-            std::vector<std::vector<double>> Efd_2_pool;
-            for (size_t i = 0; i < nthreads; i++) {
-                field_pool.push_back(std::make_shared<ElectricFieldHolder>(maxnmon));
-                Efd_1_pool.push_back(std::vector<double>(nmon1 * ns1 * 3, 0.0));
-                Efd_2_pool.push_back(std::vector<double>(nmon2 * ns2 * 3, 0.0));
-            }
+    // Sites on different monomers. If the tensors are cached for these
+    // coordinates, the field is just their product with the dipoles.
+    if (!use_ghost && UpdateDipoleTensors()) {
+        ComputeDipoleFieldFromTensors(in_v, out_v);
+    } else {
+        size_t fi_mon1 = 0;
+        size_t fi_mon2 = 0;
+        size_t fi_sites1 = 0;
+        size_t fi_sites2 = 0;
+        size_t fi_crd1 = 0;
+        size_t fi_crd2 = 0;
+        // aDD intermolecular is always 0.055
+        aDD = 0.055;
+        for (size_t mt1 = 0; mt1 < mon_type_count_.size(); mt1++) {
+            size_t ns1 = sites_[fi_mon1];
+            size_t nmon1 = mon_type_count_[mt1].second;
+            size_t nmon12 = 2 * nmon1;
+            fi_mon2 = fi_mon1;
+            fi_sites2 = fi_sites1;
+            fi_crd2 = fi_crd1;
+            for (size_t mt2 = mt1; mt2 < mon_type_count_.size(); mt2++) {
+                size_t ns2 = sites_[fi_mon2];
+                size_t nmon2 = mon_type_count_[mt2].second;
+                bool same = (mt1 == mt2);
+                // Only the monomers m2 with sites within the cutoff are visited
+                // Prepare for parallelization
+                std::vector<std::shared_ptr<ElectricFieldHolder>> field_pool;
+                std::vector<std::vector<double>> Efd_1_pool;
+                std::vector<std::vector<double>> Efd_2_pool;
+                for (size_t i = 0; i < nthreads; i++) {
+                    field_pool.push_back(std::make_shared<ElectricFieldHolder>(maxnmon));
+                    Efd_1_pool.push_back(std::vector<double>(nmon1 * ns1 * 3, 0.0));
+                    Efd_2_pool.push_back(std::vector<double>(nmon2 * ns2 * 3, 0.0));
+                }
 
-            // Parallel loop
-            size_t m1start = (mpi_rank_ < nmon1) ? mpi_rank_ : nmon1;
+                // Parallel loop
+                size_t m1start = (mpi_rank_ < nmon1) ? mpi_rank_ : nmon1;
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic)
 #endif
-            for (size_t m1 = m1start; m1 < nmon1; m1 += num_mpi_ranks_) {
-                //            for (size_t m1 = 0; m1 < nmon1; m1++) {
-                int rank = 0;
+                for (size_t m1 = m1start; m1 < nmon1; m1 += num_mpi_ranks_) {
+                    //            for (size_t m1 = 0; m1 < nmon1; m1++) {
+                    int rank = 0;
 #ifdef _OPENMP
-                rank = omp_get_thread_num();
+                    rank = omp_get_thread_num();
 #endif
-                std::shared_ptr<ElectricFieldHolder> local_field = field_pool[rank];
-                size_t m2init = same ? m1 + 1 : 0;
-                double ex_thread = 0.0;
-                double ey_thread = 0.0;
-                double ez_thread = 0.0;
-                for (size_t i = 0; i < ns1; i++) {
-                    size_t inmon13 = 3 * nmon1 * i;
+                    std::shared_ptr<ElectricFieldHolder> local_field = field_pool[rank];
+                    size_t m2init = same ? m1 + 1 : 0;
+
+                    // Copy the sites and dipoles of the monomers m2 close to m1
+                    // in vectorized form, as in CalculatePermanentElecField
+                    std::vector<size_t> m2_list;
+                    GetRealSpaceNeighbors(fi_mon1 + m1, fi_mon2, m2init, nmon2, m2_list);
+                    size_t size_j = m2_list.size();
+                    if (size_j == 0) continue;
+
+                    std::vector<double> xyz_sitej(3 * ns2 * size_j);
+                    std::vector<double> mu_sitej(3 * ns2 * size_j);
+                    std::vector<double> Efd_sitej(3 * ns2 * size_j, 0.0);
                     for (size_t j = 0; j < ns2; j++) {
-                        double A = polfac_[fi_sites1 + i] * polfac_[fi_sites2 + j];
-                        double Ai = 0.0;
-                        double Asqsqi = 0.0;
-                        if (A > constants::EPS) {
-                            A = std::pow(A, 1.0 / 6.0);
-                            Ai = 1 / A;
-                            Asqsqi = Ai * Ai * Ai * Ai;
-                        } else {
-                            Ai = BIGNUM;
-                            Asqsqi = Ai;
+                        for (size_t dim = 0; dim < 3; dim++) {
+                            size_t start_j = fi_crd2 + 3 * j * nmon2 + dim * nmon2;
+                            size_t start_sitej = 3 * j * size_j + dim * size_j;
+                            for (size_t ind = 0; ind < size_j; ind++) {
+                                xyz_sitej[start_sitej + ind] = xyz_[start_j + m2_list[ind]];
+                                mu_sitej[start_sitej + ind] = in_ptr[start_j + m2_list[ind]];
+                            }
                         }
-                        local_field->CalcDipoleElecField(xyz_.data() + fi_crd1, xyz_.data() + fi_crd2, in_ptr + fi_crd1,
-                                                         in_ptr + fi_crd2, m1, m2init, nmon2, nmon1, nmon2, i, j,
-                                                         Asqsqi, aDD, Efd_2_pool[rank].data(), &ex_thread, &ey_thread,
-                                                         &ez_thread, ewald_alpha_, use_pbc_, box_, box_inverse_,
-                                                         cutoff_, use_ghost, islocal_, fi_mon1 + m1, fi_mon2);
-                        Efd_1_pool[rank][inmon13 + m1] += ex_thread;
-                        Efd_1_pool[rank][inmon13 + nmon1 + m1] += ey_thread;
-                        Efd_1_pool[rank][inmon13 + nmon12 + m1] += ez_thread;
                     }
-                }
-            }
 
-            // Compress data in Efd
-            for (size_t rank = 0; rank < nthreads; rank++) {
-                size_t kend1 = Efd_1_pool[rank].size();
-                size_t kend2 = Efd_2_pool[rank].size();
-                for (size_t k = 0; k < kend1; k++) {
-                    out_v[fi_crd1 + k] += Efd_1_pool[rank][k];
+                    // local/ghost descriptor of m1, followed by the ones of the m2
+                    std::vector<size_t> islocal_sitej(size_j + 1);
+                    islocal_sitej[0] = islocal_[fi_mon1 + m1];
+                    for (size_t ind = 0; ind < size_j; ind++) islocal_sitej[ind + 1] = islocal_[fi_mon2 + m2_list[ind]];
+
+                    double ex_thread = 0.0;
+                    double ey_thread = 0.0;
+                    double ez_thread = 0.0;
+                    for (size_t i = 0; i < ns1; i++) {
+                        size_t inmon13 = 3 * nmon1 * i;
+                        for (size_t j = 0; j < ns2; j++) {
+                            double A = polfac_[fi_sites1 + i] * polfac_[fi_sites2 + j];
+                            double Ai = 0.0;
+                            double Asqsqi = 0.0;
+                            if (A > constants::EPS) {
+                                A = std::pow(A, 1.0 / 6.0);
+                                Ai = 1 / A;
+                                Asqsqi = Ai * Ai * Ai * Ai;
+                            } else {
+                                Ai = BIGNUM;
+                                Asqsqi = Ai;
+                            }
+                            local_field->CalcDipoleElecField(
+                                xyz_.data() + fi_crd1, xyz_sitej.data(), in_ptr + fi_crd1, mu_sitej.data(), m1, 0,
+                                size_j, nmon1, size_j, i, j, Asqsqi, aDD, Efd_sitej.data(), &ex_thread, &ey_thread,
+                                &ez_thread, ewald_alpha_, use_pbc_, box_, box_inverse_, cutoff_, use_ghost,
+                                islocal_sitej, 0, 1);
+                            Efd_1_pool[rank][inmon13 + m1] += ex_thread;
+                            Efd_1_pool[rank][inmon13 + nmon1 + m1] += ey_thread;
+                            Efd_1_pool[rank][inmon13 + nmon12 + m1] += ez_thread;
+                        }
+                    }
+
+                    // Put the field on the sites of the monomers m2 back in place
+                    for (size_t j = 0; j < ns2; j++) {
+                        for (size_t dim = 0; dim < 3; dim++) {
+                            size_t start_j = 3 * j * nmon2 + dim * nmon2;
+                            size_t start_sitej = 3 * j * size_j + dim * size_j;
+                            for (size_t ind = 0; ind < size_j; ind++) {
+                                Efd_2_pool[rank][start_j + m2_list[ind]] += Efd_sitej[start_sitej + ind];
+                            }
+                        }
+                    }
                 }
-                for (size_t k = 0; k < kend2; k++) {
-                    out_v[fi_crd2 + k] += Efd_2_pool[rank][k];
+
+                // Compress data in Efd
+                for (size_t rank = 0; rank < nthreads; rank++) {
+                    size_t kend1 = Efd_1_pool[rank].size();
+                    size_t kend2 = Efd_2_pool[rank].size();
+                    for (size_t k = 0; k < kend1; k++) {
+                        out_v[fi_crd1 + k] += Efd_1_pool[rank][k];
+                    }
+                    for (size_t k = 0; k < kend2; k++) {
+                        out_v[fi_crd2 + k] += Efd_2_pool[rank][k];
+                    }
                 }
+                // Update first indexes
+                fi_mon2 += nmon2;
+                fi_sites2 += nmon2 * ns2;
+                fi_crd2 += nmon2 * ns2 * 3;
             }
             // Update first indexes
-            fi_mon2 += nmon2;
-            fi_sites2 += nmon2 * ns2;
-            fi_crd2 += nmon2 * ns2 * 3;
+            fi_mon1 += nmon1;
+            fi_sites1 += nmon1 * ns1;
+            fi_crd1 += nmon1 * ns1 * 3;
         }
-        // Update first indexes
-        fi_mon1 += nmon1;
-        fi_sites1 += nmon1 * ns1;
-        fi_crd1 += nmon1 * ns1 * 3;
     }
 
 #if HAVE_MPI == 1
@@ -3375,8 +3970,6 @@ void Electrostatics::ComputeDipoleField(std::vector<double> &in_v, std::vector<d
             fi_crd += nmon * ns * 3;
         }
 
-        helpme::PMEInstance<double> pme_solver_;
-        if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
         double A, B, C, alpha, beta, gamma;
         A = box_ABCabc_[0];
         B = box_ABCabc_[1];
@@ -3386,16 +3979,7 @@ void Electrostatics::ComputeDipoleField(std::vector<double> &in_v, std::vector<d
         gamma = box_ABCabc_[5];
 
         // Compute the reciprocal space terms, using PME
-        int grid_A = pme_grid_density_ * A;
-        int grid_B = pme_grid_density_ * B;
-        int grid_C = pme_grid_density_ * C;
-        if (mpi_initialized_) {
-            pme_solver_.setupParallel(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0, world_,
-                                      PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
-        } else {
-            pme_solver_.setup(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0);
-        }
-        pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+        helpme::PMEInstance<double> &pme_solver = GetPMESolver(A, B, C, alpha, beta, gamma);
         // N.B. these do not make copies; they just wrap the memory with some metadata
         auto coords = helpme::Matrix<double>(sys_xyz_.data(), nsites_, 3);
         auto dipoles = helpme::Matrix<double>(sys_mu_.data(), nsites_, 3);
@@ -3423,7 +4007,7 @@ void Electrostatics::ComputeDipoleField(std::vector<double> &in_v, std::vector<d
         }  // debug print
 #endif
 
-        pme_solver_.computePRec(-1, dipoles, coords, coords, -1, result);
+        pme_solver.computePRec(-1, dipoles, coords, coords, -1, result);
 
 #ifdef _DEBUG_DIPFIELD
         {  // debug print
@@ -3681,11 +4265,6 @@ void Electrostatics::CalculateGradientsMPIlocal(std::vector<double> &grad, bool
     double time1 = MPI_Wtime();
 #endif
 
-    // Excluded sets
-    excluded_set_type exc12;
-    excluded_set_type exc13;
-    excluded_set_type exc14;
-
     // Auxiliary variables
     double ex = 0.0;
     double ey = 0.0;
@@ -3776,15 +4355,15 @@ void Electrostatics::CalculateGradientsMPIlocal(std::vector<double> &grad, bool
         size_t ns = sites_[fi_mon];
         size_t nmon = mon_type_count_[mt].second;
         size_t nmon2 = nmon * 2;
-        systools::GetExcluded(mon_id_[fi_mon], mon_j_, exc12, exc13, exc14);
         for (size_t i = 0; i < ns - 1; i++) {
             size_t inmon = i * nmon;
             size_t inmon3 = 3 * inmon;
             for (size_t j = i + 1; j < ns; j++) {
                 // Set the proper aDD
-                bool is12 = systools::IsExcluded(exc12, i, j);
-                bool is13 = systools::IsExcluded(exc13, i, j);
-                bool is14 = systools::IsExcluded(exc14, i, j);
+                unsigned char exc = mon_types_->GetExclusion(mt, i, j);
+                bool is12 = exc & bblock::EXCLUDED_12;
+                bool is13 = exc & bblock::EXCLUDED_13;
+                bool is14 = exc & bblock::EXCLUDED_14;
                 // Don't do charge-dipole and modify phi if pair is excluded
                 // TODO check this for distances more than 1-4
                 double elec_scale_factor = (is12 || is13 || is14) ? 0 : 1;
@@ -4063,8 +4642,6 @@ void Electrostatics::CalculateGradientsMPIlocal(std::vector<double> &grad, bool
             fi_crd += nmon * ns * 3;
         }
 
-        helpme::PMEInstance<double> pme_solver_;
-        if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
         // Compute the reciprocal space terms, using PME
 
         double A, B, C, alpha, beta, gamma;
@@ -4083,16 +4660,7 @@ void Electrostatics::CalculateGradientsMPIlocal(std::vector<double> &grad, bool
             beta = box_ABCabc_[4];
             gamma = box_ABCabc_[5];
         }
-        int grid_A = pme_grid_density_ * A;
-        int grid_B = pme_grid_density_ * B;
-        int grid_C = pme_grid_density_ * C;
-        if (mpi_initialized_) {
-            pme_solver_.setupParallel(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0, world_,
-                                      PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
-        } else {
-            pme_solver_.setup(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0);
-        }
-        pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+        helpme::PMEInstance<double> &pme_solver = GetPMESolver(A, B, C, alpha, beta, gamma);
         // N.B. these do not make copies; they just wrap the memory with some metadata
         auto coords = helpme::Matrix<double>(sys_xyz_.data(), nsites_, 3);
         auto dipoles = helpme::Matrix<double>(sys_mu_.data(), nsites_, 3);
@@ -4130,7 +4698,7 @@ void Electrostatics::CalculateGradientsMPIlocal(std::vector<double> &grad, bool
             int ns_ = (nsites_ == 0) ? 1 : nsites_;
             auto tmpforces2 = helpme::Matrix<double>(tforcevec.data(), ns_, 3);
 
-            double fulldummy_rec_energy = pme_solver_.computeEFVRecIsotropicInducedDipoles(
+            double fulldummy_rec_energy = pme_solver.computeEFVRecIsotropicInducedDipoles(
                 0, charges, dipoles, PMEInstanceD::PolarizationType::Mutual, coords, tmpforces2, drecvirial);
 
             virial_[0] += (*drecvirial[0]) * constants::COULOMB;
@@ -4145,7 +4713,7 @@ void Electrostatics::CalculateGradientsMPIlocal(std::vector<double> &grad, bool
             virial_[7] = virial_[5];
         }
 
-        pme_solver_.computePRec(-1, dipoles, coords, coords, 2, result);
+        pme_solver.computePRec(-1, dipoles, coords, coords, 2, result);
 
         double *ptr = result[0];
 
@@ -4193,7 +4761,7 @@ void Electrostatics::CalculateGradientsMPIlocal(std::vector<double> &grad, bool
         }
         // Now grid up the charges
         result.setZero();
-        pme_solver_.computePRec(0, charges, coords, coords, -2, result);
+        pme_solver.computePRec(0, charges, coords, coords, -2, result);
 
         // Resort field from system order
         fi_mon = 0;
@@ -4436,11 +5004,6 @@ void Electrostatics::CalculateGradients(std::vector<double> &grad, bool use_ghos
     double time1 = MPI_Wtime();
 #endif
 
-    // Excluded sets
-    excluded_set_type exc12;
-    excluded_set_type exc13;
-    excluded_set_type exc14;
-
     // Auxiliary variables
     double ex = 0.0;
     double ey = 0.0;
@@ -4528,15 +5091,15 @@ void Electrostatics::CalculateGradients(std::vector<double> &grad, bool use_ghos
         size_t ns = sites_[fi_mon];
         size_t nmon = mon_type_count_[mt].second;
         size_t nmon2 = nmon * 2;
-        systools::GetExcluded(mon_id_[fi_mon], mon_j_, exc12, exc13, exc14);
         for (size_t i = 0; i < ns - 1; i++) {
             size_t inmon = i * nmon;
             size_t inmon3 = 3 * inmon;
             for (size_t j = i + 1; j < ns; j++) {
                 // Set the proper aDD
-                bool is12 = systools::IsExcluded(exc12, i, j);
-                bool is13 = systools::IsExcluded(exc13, i, j);
-                bool is14 = systools::IsExcluded(exc14, i, j);
+                unsigned char exc = mon_types_->GetExclusion(mt, i, j);
+                bool is12 = exc & bblock::EXCLUDED_12;
+                bool is13 = exc & bblock::EXCLUDED_13;
+                bool is14 = exc & bblock::EXCLUDED_14;
                 // Don't do charge-dipole and modify phi if pair is excluded
                 // TODO check this for distances more than 1-4
                 double elec_scale_factor = (is12 || is13 || is14) ? 0 : 1;
@@ -4635,7 +5198,7 @@ void Electrostatics::CalculateGradients(std::vector<double> &grad, bool use_ghos
             size_t ns2 = sites_[fi_mon2];
             size_t nmon2 = mon_type_count_[mt2].second;
             bool same = (mt1 == mt2);
-            // TODO add neighbour list here
+            // Only the monomers m2 with sites within the cutoff are visited
             std::vector<std::shared_ptr<ElectricFieldHolder>> field_pool;
             std::vector<std::vector<double>> grad_1_pool;
             std::vector<std::vector<double>> grad_2_pool;
@@ -4658,6 +5221,38 @@ void Electrostatics::CalculateGradients(std::vector<double> &grad, bool use_ghos
 #endif
                 std::shared_ptr<ElectricFieldHolder> local_field = field_pool[rank];
                 size_t m2init = same ? m1 + 1 : 0;
+
+                // Copy the sites, charges and dipoles of the monomers m2 close
+                // to m1 in vectorized form, as in CalculatePermanentElecField
+                std::vector<size_t> m2_list;
+                GetRealSpaceNeighbors(fi_mon1 + m1, fi_mon2, m2init, nmon2, m2_list);
+                size_t size_j = m2_list.size();
+                if (size_j == 0) continue;
+
+                std::vector<double> xyz_sitej(3 * ns2 * size_j);
+                std::vector<double> mu_sitej(3 * ns2 * size_j);
+                std::vector<double> chg_sitej(ns2 * size_j);
+                std::vector<double> grad_sitej(3 * ns2 * size_j, 0.0);
+                std::vector<double> phi_sitej(ns2 * size_j, 0.0);
+                for (size_t j = 0; j < ns2; j++) {
+                    for (size_t ind = 0; ind < size_j; ind++) {
+                        chg_sitej[j * size_j + ind] = chg_[fi_sites2 + j * nmon2 + m2_list[ind]];
+                    }
+                    for (size_t dim = 0; dim < 3; dim++) {
+                        size_t start_j = fi_crd2 + 3 * j * nmon2 + dim * nmon2;
+                        size_t start_sitej = 3 * j * size_j + dim * size_j;
+                        for (size_t ind = 0; ind < size_j; ind++) {
+                            xyz_sitej[start_sitej + ind] = xyz_[start_j + m2_list[ind]];
+                            mu_sitej[start_sitej + ind] = mu_[start_j + m2_list[ind]];
+                        }
+                    }
+                }
+
+                // local/ghost descriptor of m1, followed by the ones of the m2
+                std::vector<size_t> islocal_sitej(size_j + 1);
+                islocal_sitej[0] = islocal_[fi_mon1 + m1];
+                for (size_t ind = 0; ind < size_j; ind++) islocal_sitej[ind + 1] = islocal_[fi_mon2 + m2_list[ind]];
+
                 double ex_thread = 0.0;
                 double ey_thread = 0.0;
                 double ez_thread = 0.0;
@@ -4678,17 +5273,31 @@ void Electrostatics::CalculateGradients(std::vector<double> &grad, bool use_ghos
                             Asqsqi = Ai;
                         }
                         local_field->CalcElecFieldGrads(
-                            xyz_.data() + fi_crd1, xyz_.data() + fi_crd2, chg_.data() + fi_sites1,
-                            chg_.data() + fi_sites2, mu_.data() + fi_crd1, mu_.data() + fi_crd2, m1, m2init, nmon2,
-                            nmon1, nmon2, i, j, aDD, aCD_, Asqsqi, &ex_thread, &ey_thread, &ez_thread, &phi1_thread,
-                            phi_2_pool[rank].data(), grad_2_pool[rank].data(), 1, ewald_alpha_, use_pbc_, box_,
-                            box_inverse_, cutoff_, use_ghost, islocal_, fi_mon + m1, fi_mon2, &virial_pool[rank]);
+                            xyz_.data() + fi_crd1, xyz_sitej.data(), chg_.data() + fi_sites1, chg_sitej.data(),
+                            mu_.data() + fi_crd1, mu_sitej.data(), m1, 0, size_j, nmon1, size_j, i, j, aDD, aCD_,
+                            Asqsqi, &ex_thread, &ey_thread, &ez_thread, &phi1_thread, phi_sitej.data(),
+                            grad_sitej.data(), 1, ewald_alpha_, use_pbc_, box_, box_inverse_, cutoff_, use_ghost,
+                            islocal_sitej, 0, 1, &virial_pool[rank]);
                         grad_1_pool[rank][inmon13 + m1] += ex_thread;
                         grad_1_pool[rank][inmon13 + nmon1 + m1] += ey_thread;
                         grad_1_pool[rank][inmon13 + nmon12 + m1] += ez_thread;
                         phi_1_pool[rank][inmon1 + m1] += phi1_thread;
                     }
                 }
+
+                // Put the gradients and potential on the sites of the monomers m2 back in place
+                for (size_t j = 0; j < ns2; j++) {
+                    for (size_t ind = 0; ind < size_j; ind++) {
+                        phi_2_pool[rank][j * nmon2 + m2_list[ind]] += phi_sitej[j * size_j + ind];
+                    }
+                    for (size_t dim = 0; dim < 3; dim++) {
+                        size_t start_j = 3 * j * nmon2 + dim * nmon2;
+                        size_t start_sitej = 3 * j * size_j + dim * size_j;
+                        for (size_t ind = 0; ind < size_j; ind++) {
+                            grad_2_pool[rank][start_j + m2_list[ind]] += grad_sitej[start_sitej + ind];
+                        }
+                    }
+                }
             }
             // Compress data in grad and phi
             for (size_t rank = 0; rank < nthreads; rank++) {
@@ -4801,8 +5410,6 @@ void Electrostatics::CalculateGradients(std::vector<double> &grad, bool use_ghos
             fi_crd += nmon * ns * 3;
         }
 
-        helpme::PMEInstance<double> pme_solver_;
-        if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
         // Compute the reciprocal space terms, using PME
         double A = box_ABCabc_[0];
         double B = box_ABCabc_[1];
@@ -4810,16 +5417,7 @@ void Electrostatics::CalculateGradients(std::vector<double> &grad, bool use_ghos
         double alpha = box_ABCabc_[3];
         double beta = box_ABCabc_[4];
         double gamma = box_ABCabc_[5];
-        int grid_A = pme_grid_density_ * A;
-        int grid_B = pme_grid_density_ * B;
-        int grid_C = pme_grid_density_ * C;
-        if (mpi_initialized_) {
-            pme_solver_.setupParallel(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0, world_,
-                                      PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
-        } else {
-            pme_solver_.setup(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0);
-        }
-        pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+        helpme::PMEInstance<double> &pme_solver = GetPMESolver(A, B, C, alpha, beta, gamma);
         // N.B. these do not make copies; they just wrap the memory with some metadata
         auto coords = helpme::Matrix<double>(sys_xyz_.data(), nsites_, 3);
         auto dipoles = helpme::Matrix<double>(sys_mu_.data(), nsites_, 3);
@@ -4856,7 +5454,7 @@ void Electrostatics::CalculateGradients(std::vector<double> &grad, bool use_ghos
             auto drecvirial = helpme::Matrix<double>(trecvir.data(), 6, 1);
             auto tmpforces2 = helpme::Matrix<double>(tforcevec.data(), nsites_, 3);
 
-            double fulldummy_rec_energy = pme_solver_.computeEFVRecIsotropicInducedDipoles(
+            double fulldummy_rec_energy = pme_solver.computeEFVRecIsotropicInducedDipoles(
                 0, charges, dipoles, PMEInstanceD::PolarizationType::Mutual, coords, tmpforces2, drecvirial);
 
 #if HAVE_MPI == 1
@@ -4875,7 +5473,7 @@ void Electrostatics::CalculateGradients(std::vector<double> &grad, bool use_ghos
             virial_[7] = virial_[5];
         }
 
-        pme_solver_.computePRec(-1, dipoles, coords, coords, 2, result);
+        pme_solver.computePRec(-1, dipoles, coords, coords, 2, result);
 
         double *ptr = result[0];
 #if HAVE_MPI == 1
@@ -4926,7 +5524,7 @@ void Electrostatics::CalculateGradients(std::vector<double> &grad, bool use_ghos
         }
         // Now grid up the charges
         result.setZero();
-        pme_solver_.computePRec(0, charges, coords, coords, -2, result);
+        pme_solver.computePRec(0, charges, coords, coords, -2, result);
 
 #if HAVE_MPI == 1
         MPI_Allreduce(MPI_IN_PLACE, ptr, nsites_ * 10, MPI_DOUBLE, MPI_SUM, world_);
@@ -5321,18 +5919,18 @@ std::vector<int> Electrostatics::GetFFTDimension(int box_id) {
         int grid_B = pme_grid_density_ * B;
         int grid_C = pme_grid_density_ * C;
 
-        helpme::PMEInstance<double> pme_solver_;
-        if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
+        helpme::PMEInstance<double> pme_solver;
+        if (user_fft_grid_.size()) pme_solver.SetFFTDimension(user_fft_grid_);
 
         if (mpi_initialized_) {
-            pme_solver_.setupParallel(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0, world_,
-                                      PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
+            pme_solver.setupParallel(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0, world_,
+                                     PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
         } else {
-            pme_solver_.setup(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0);
+            pme_solver.setup(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0);
         }
-        pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+        pme_solver.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
 
-        fft_grid = pme_solver_.GetFFTDimension();
+        fft_grid = pme_solver.GetFFTDimension();
     }
 
     return fft_grid;
@@ -46,7 +46,10 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #endif
 
 #include "bblock/sys_tools.h"
+#include "bblock/monomer_type_table.h"
+#include "bblock/neighbor_list.h"
 #include "tools/definitions.h"
+#include "tools/solver_cache.h"
 #include "tools/constants.h"
 #include "tools/math_tools.h"
 #include "potential/electrostatics/gammq.h"
@@ -127,6 +130,14 @@ class Electrostatics {
 
     void SetJsonMonomers(nlohmann::json mon_j);
 
+    /**
+     * @brief Sets the monomer types compiled by a System, so the term does
+     * not compile them again from the json object. Takes effect in the next
+     * Initialize or SetJsonMonomers.
+     * @param[in] mon_types Monomer types of the System. Null to compile them in the term.
+     */
+    void SetMonomerTypes(std::shared_ptr<const bblock::MonomerTypeTable> mon_types);
+
     void SetMPI(MPI_Comm world_, size_t proc_grid_x, size_t proc_grid_y, size_t proc_grid_z);
 
     /**
@@ -194,6 +205,16 @@ class Electrostatics {
      */
     void SetDipoleMaxIt(size_t maxit);
 
+    /**
+     * @brief Sets the memory available to keep the real space dipole-dipole
+     * tensors between the monomers during the induced dipole calculation,
+     * instead of recomputing them in every iteration
+     *
+     * @param[in] max_mb Maximum memory in MB. If 0 (default), or if the
+     * tensors of a configuration do not fit, they are recomputed.
+     */
+    void SetDipoleTensorCache(double max_mb);
+
     /**
      * @brief Sets the Ewald attenuation parameter (in units of 1/Angstrom)
      *
@@ -278,7 +299,40 @@ class Electrostatics {
     void ComputeDipoleFieldMPIlocal(std::vector<double> &in_v, std::vector<double> &out_v, bool use_ghost = 0);
     void CalculateDipolesCG();
     void CalculateDipolesCGMPIlocal(bool use_ghost = 0);
+    /**
+     * @brief Computes the induced dipoles with a block-Jacobi preconditioned
+     * conjugate gradient. The preconditioner is the exact inverse of the
+     * intramolecular block of each monomer (see ComputeDipolePreconditioner).
+     */
+    void CalculateDipolesPCG();
+    /**
+     * @brief Builds and inverts the 3n x 3n intramolecular block of the
+     * polarization matrix of each monomer, and stores it in pcg_block_inv_.
+     * The block is the Thole damped dipole-dipole field between the sites of
+     * the monomer, without Ewald splitting.
+     */
+    void ComputeDipolePreconditioner();
+    /**
+     * @brief Applies the block-Jacobi preconditioner to a vector
+     * @param[in] in_v Vector in the electrostatics (xx..yy..zz) order
+     * @param[out] out_v Result of the product, same order as in_v
+     */
+    void ApplyDipolePreconditioner(const std::vector<double> &in_v, std::vector<double> &out_v);
     void DipolesCGIteration(std::vector<double> &in_v, std::vector<double> &out_v);
+    /**
+     * @brief Computes the real space dipole-dipole tensors between the sites of
+     * different monomers, if they are not computed yet for these coordinates
+     * and they fit in the memory set with SetDipoleTensorCache.
+     * @return True if the tensors are available
+     */
+    bool UpdateDipoleTensors();
+    /**
+     * @brief Adds the real space dipole field between different monomers to
+     * out_v, using the tensors computed by UpdateDipoleTensors
+     * @param[in] in_v Dipoles, in the electrostatics order
+     * @param[in,out] out_v Dipole field, in the electrostatics order
+     */
+    void ComputeDipoleFieldFromTensors(std::vector<double> &in_v, std::vector<double> &out_v);
     void DipolesCGIterationMPIlocal(std::vector<double> &in_v, std::vector<double> &out_v, bool use_ghost = 0);
     void CalculateDipolesAspc();
     void SetAspcParameters(size_t k);
@@ -291,10 +345,46 @@ class Electrostatics {
 
     void reverse_forward_comm(std::vector<double> &in_v);
 
+    /**
+     * @brief Compiles the exclusions of each monomer type
+     * from mon_j_, so they are not looked up in every call.
+     */
+    void CompileMonomerTypes();
+
     void ReorderData();
 
-    // PME solver
-    // helpme::PMEInstance<double> pme_solver_;
+    /**
+     * @brief Makes sure that the list of monomer pairs within the real space
+     * cutoff corresponds to the current coordinates, box and cutoff.
+     *
+     * The list is only rebuilt when one of them has changed, so it is built
+     * once per step and then shared by the permanent field and all the
+     * induced dipole iterations.
+     */
+    void UpdateRealSpaceNeighbors();
+
+    /**
+     * @brief Gets the monomers m2 of a monomer type that can have a site
+     * within the real space cutoff of any site of monomer mon1.
+     * @param[in] mon1 Index of monomer 1 among all the monomers
+     * @param[in] fi_mon2 Index of the first monomer of the type of monomer 2
+     * @param[in] m2init First monomer of that type to consider
+     * @param[in] nmon2 Number of monomers of that type
+     * @param[out] m2_list Sorted indexes m2, with m2init <= m2 < nmon2
+     */
+    void GetRealSpaceNeighbors(size_t mon1, size_t fi_mon2, size_t m2init, size_t nmon2,
+                               std::vector<size_t> &m2_list) const;
+
+    /**
+     * @brief Gets the PME solver for the current Ewald parameters and the given cell
+     * @param[in] A,B,C Lengths of the cell vectors
+     * @param[in] alpha,beta,gamma Angles of the cell, in degrees
+     * @return Reference to the solver, see tools::SolverCache::Get
+     */
+    helpme::PMEInstance<double> &GetPMESolver(double A, double B, double C, double alpha, double beta, double gamma);
+
+    // PME solver, persistent across calls. See tools::SolverCache::Get.
+    tools::SolverCache<helpme::PMEInstance<double>> pme_solver_;
     // Charges of each site. Order has to follow mon_type_count.
     std::vector<double> chg_;
     // Charges of each site. Order has to follow mon_type_count.
@@ -326,6 +416,13 @@ class Electrostatics {
     std::vector<size_t> nn_num_neighs;
     std::vector<size_t> nn_neighs;
     bool nn_first;
+    // Neighbor list of monomers for the real space electrostatics. Two monomers are
+    // neighbors if their first sites are closer than cutoff_ plus their extents.
+    bblock::NeighborList real_space_neighbors_;
+    // Largest distance between the first site of each monomer and its other sites
+    std::vector<double> mon_extent_;
+    // True if every monomer pair is within the cutoff, and the list is not used
+    bool all_pairs_in_cutoff_;
     // Name of the monomers (h2o, f...)
     std::vector<std::string> mon_id_;
     // Number of sites of each mon
@@ -383,6 +480,26 @@ class Electrostatics {
     size_t hist_num_aspc_;
     // Order of ASPC
     size_t k_aspc_;
+    // Memory available for the dipole-dipole tensors, in MB. 0 to recompute them
+    double dip_tensor_max_mb_;
+    // True if UpdateDipoleTensors was called for the current coordinates
+    bool dip_tensors_updated_;
+    // True if the tensors for the current coordinates are in dip_tensors_
+    bool dip_tensors_cached_;
+    // Monomers m2 visited by each monomer m1 in ComputeDipoleField, for each
+    // monomer type 2, following the order of the loops there. First index of
+    // each m1 and monomer type 2 in dip_tensor_m2_.
+    std::vector<size_t> dip_tensor_m2_;
+    std::vector<size_t> dip_tensor_m2_first_;
+    // Compressed dipole-dipole tensors (see ElectricFieldHolder::CalcDipoleTensors)
+    // of each pair of sites, with the same order. First index of each m1 and
+    // monomer type 2 in dip_tensors_.
+    std::vector<double> dip_tensors_;
+    std::vector<size_t> dip_tensors_first_;
+    // Inverse of the intramolecular polarization block of each monomer, used
+    // as preconditioner by the PCG. One 3n x 3n block per monomer, row major,
+    // with index 3 * site + component. Blocks follow mon_type_count_.
+    std::vector<double> pcg_block_inv_;
     // Total number of electrostatic sites
     size_t nsites_;
     // Total number of monomers (sum of monomer type)
@@ -400,7 +517,7 @@ class Electrostatics {
     double Eperm_;
     // Induced electrostatics
     double Eind_;
-    // Method for dipoles (ITERative, Conjugate Gradient, ASPC, INVersion)
+    // Method for dipoles (ITERative, Conjugate Gradient, Preconditioned CG, ASPC, INVersion)
     std::string dip_method_;
     // box of the system
     std::vector<double> box_;
@@ -451,6 +568,11 @@ class Electrostatics {
     std::vector<int> user_fft_grid_;
 
     nlohmann::json mon_j_;
+
+    // Exclusions of each monomer type. Compiled by the term, or shared with the System.
+    std::shared_ptr<const bblock::MonomerTypeTable> mon_types_;
+    // Monomer types set by the System, if any. See SetMonomerTypes.
+    std::shared_ptr<const bblock::MonomerTypeTable> sys_mon_types_;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
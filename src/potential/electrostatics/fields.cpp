@@ -366,6 +366,154 @@ void ElectricFieldHolder::CalcDipoleElecField(double *xyz1, double *xyz2, double
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void ElectricFieldHolder::CalcDipoleTensors(double *xyz1, double *xyz2, size_t mon1_index, size_t mon2_index_start,
+                                            size_t mon2_index_end, size_t nmon1, size_t nmon2, size_t site_i,
+                                            size_t site_j, double Asqsqi, double aDD, double *tensors,
+                                            double ewald_alpha, bool use_pbc, const std::vector<double> &box,
+                                            const std::vector<double> &box_inverse, double cutoff) {
+    // Shifts that will be useful in the loops
+    const size_t nmon12 = nmon1 * 2;
+    const size_t nmon22 = nmon2 * 2;
+    const size_t site_inmon13 = nmon1 * site_i * 3;
+    const size_t site_jnmon23 = nmon2 * site_j * 3;
+
+    // Output arrays
+    const size_t n = mon2_index_end - mon2_index_start;
+    double *trijx = tensors;
+    double *trijy = tensors + n;
+    double *trijz = tensors + 2 * n;
+    double *ts1r3 = tensors + 3 * n;
+    double *ts2r5_3 = tensors + 4 * n;
+
+    // Coordinates x, y and z of site i of monomer 1
+    const double xyzmon1_x = xyz1[site_inmon13 + mon1_index];
+    const double xyzmon1_y = xyz1[site_inmon13 + nmon1 + mon1_index];
+    const double xyzmon1_z = xyz1[site_inmon13 + nmon12 + mon1_index];
+
+    double alpha_pi_term = ewald_alpha == 0 ? 0 : 1 / (std::sqrt(M_PI) * ewald_alpha);
+    double two_alpha_squared = 2.0 * ewald_alpha * ewald_alpha;
+    alpha_pi_term *= two_alpha_squared;
+
+    const double cutoffsq = cutoff * cutoff;
+#pragma omp simd
+    for (size_t m = mon2_index_start; m < mon2_index_end; m++) {
+        const size_t k = m - mon2_index_start;
+
+        // Distances between sites i and j from mon1 and mon2
+        double rijx = xyzmon1_x - xyz2[site_jnmon23 + m];
+        double rijy = xyzmon1_y - xyz2[site_jnmon23 + nmon2 + m];
+        double rijz = xyzmon1_z - xyz2[site_jnmon23 + nmon22 + m];
+
+        // Apply the minimum image convention via fractional coordinates
+        if (use_pbc) {
+            // Convert to fractional coordinates
+            double fracrijx = box_inverse[0] * rijx + box_inverse[3] * rijy + box_inverse[6] * rijz;
+            double fracrijy = box_inverse[1] * rijx + box_inverse[4] * rijy + box_inverse[7] * rijz;
+            double fracrijz = box_inverse[2] * rijx + box_inverse[5] * rijy + box_inverse[8] * rijz;
+            // Put in the range 0 to 1
+            fracrijx -= std::floor(fracrijx + 0.5);
+            fracrijy -= std::floor(fracrijy + 0.5);
+            fracrijz -= std::floor(fracrijz + 0.5);
+            // Convert back to Cartesian coordinates
+            rijx = box[0] * fracrijx + box[3] * fracrijy + box[6] * fracrijz;
+            rijy = box[1] * fracrijx + box[4] * fracrijy + box[7] * fracrijz;
+            rijz = box[2] * fracrijx + box[5] * fracrijy + box[8] * fracrijz;
+        }
+
+        trijx[k] = rijx;
+        trijy[k] = rijy;
+        trijz[k] = rijz;
+        ts1r3[k] = 0.0;
+        ts2r5_3[k] = 0.0;
+
+        const double rsq = rijx * rijx + rijy * rijy + rijz * rijz;
+        if (rsq < cutoffsq) {
+            const double ri = 1 / sqrt(rsq);
+            const double risq = ri * ri;
+
+            // Same screening functions as in CalcDipoleElecField
+            double r_alpha = ewald_alpha * sqrt(rsq);
+            double exp_alpha2_r2 = exp(-r_alpha * r_alpha);
+            double bn1 = (erfc(r_alpha) * ri + alpha_pi_term * exp_alpha2_r2) * risq;
+            double bn2 = (3 * bn1 + alpha_pi_term * two_alpha_squared * exp_alpha2_r2) * risq;
+
+            const double rA4 = rsq * rsq * Asqsqi;
+#if NO_THOLE
+            const double exp1 = 0;
+#else
+            const double exp1 = std::exp(-aDD * rA4);
+#endif
+
+            ts1r3[k] = bn1 - exp1 * ri * risq;
+            ts2r5_3[k] = bn2 - (3 + 4 * aDD * rA4) * exp1 * ri * risq * risq;
+        }  // if(r<cutoff)
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ElectricFieldHolder::CalcDipoleElecFieldFromTensors(const double *tensors, double *mu1, double *mu2,
+                                                         size_t mon1_index, size_t mon2_index_start,
+                                                         size_t mon2_index_end, size_t nmon1, size_t nmon2,
+                                                         size_t site_i, size_t site_j, double *Efd2,
+                                                         double *Efdx_mon1, double *Efdy_mon1, double *Efdz_mon1) {
+    // Shifts that will be useful in the loops
+    const size_t nmon12 = nmon1 * 2;
+    const size_t nmon22 = nmon2 * 2;
+    const size_t site_inmon13 = nmon1 * site_i * 3;
+    const size_t site_jnmon23 = nmon2 * site_j * 3;
+
+    // Input arrays
+    const size_t n = mon2_index_end - mon2_index_start;
+    const double *trijx = tensors;
+    const double *trijy = tensors + n;
+    const double *trijz = tensors + 2 * n;
+    const double *ts1r3 = tensors + 3 * n;
+    const double *ts2r5_3 = tensors + 4 * n;
+
+    // Dipole of site i of monomer 1
+    const double mu1x = mu1[site_inmon13 + mon1_index];
+    const double mu1y = mu1[site_inmon13 + nmon1 + mon1_index];
+    const double mu1z = mu1[site_inmon13 + nmon12 + mon1_index];
+
+    double v0 = 0.0;
+    double v1 = 0.0;
+    double v2 = 0.0;
+
+#pragma omp simd reduction(+ : v0, v1, v2)
+    for (size_t m = mon2_index_start; m < mon2_index_end; m++) {
+        const size_t k = m - mon2_index_start;
+        const double rijx = trijx[k];
+        const double rijy = trijy[k];
+        const double rijz = trijz[k];
+        const double s1r3 = ts1r3[k];
+        const double s2r5_3 = ts2r5_3[k];
+        const double ts2x = s2r5_3 * rijx;
+        const double ts2y = s2r5_3 * rijy;
+        const double ts2z = s2r5_3 * rijz;
+
+        // Contributions to the dipole electric field to site i of mon1
+        v0 += (ts2x * rijx - s1r3) * mu2[site_jnmon23 + m] + ts2x * rijy * mu2[site_jnmon23 + nmon2 + m] +
+              ts2x * rijz * mu2[site_jnmon23 + nmon22 + m];
+        v1 += ts2y * rijx * mu2[site_jnmon23 + m] + (ts2y * rijy - s1r3) * mu2[site_jnmon23 + nmon2 + m] +
+              ts2y * rijz * mu2[site_jnmon23 + nmon22 + m];
+        v2 += ts2z * rijx * mu2[site_jnmon23 + m] + ts2z * rijy * mu2[site_jnmon23 + nmon2 + m] +
+              (ts2z * rijz - s1r3) * mu2[site_jnmon23 + nmon22 + m];
+
+        // Contributions to the dipole electric field to site j of mon2
+        Efd2[site_jnmon23 + m] += (ts2x * rijx - s1r3) * mu1x + ts2x * rijy * mu1y + ts2x * rijz * mu1z;
+        Efd2[site_jnmon23 + nmon2 + m] += (ts2y * rijx) * mu1x + (ts2y * rijy - s1r3) * mu1y + ts2y * rijz * mu1z;
+        Efd2[site_jnmon23 + nmon22 + m] += (ts2z * rijx) * mu1x + ts2z * rijy * mu1y + (ts2z * rijz - s1r3) * mu1z;
+    }
+
+    // Setting the values to the output
+    *Efdx_mon1 = v0;
+    *Efdy_mon1 = v1;
+    *Efdz_mon1 = v2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void ElectricFieldHolder::CalcElecFieldGrads(
     double *xyz1, double *xyz2, double *chg1, double *chg2, double *mu1, double *mu2, size_t mon1_index,
     size_t mon2_index_start, size_t mon2_index_end, size_t nmon1, size_t nmon2, size_t site_i, size_t site_j,
@@ -151,6 +151,43 @@ class ElectricFieldHolder {
                              bool use_ghost,                          // use ghost monomers
                              const std::vector<size_t> &islocal, const size_t isl1_offset, const size_t isl2_offset);
 
+    // Computes the dipole-dipole tensors of CalcDipoleElecField for a pair of sites
+    // for a number of monomers # = mon2_index_end - mon2_index_start, and stores them
+    // in compressed form, so the dipole field can be computed again with
+    // CalcDipoleElecFieldFromTensors. The tensors are stored in five arrays of size #:
+    // rijx, rijy, rijz (minimum image), s1r3 and s2r5_3, such that the field on
+    // site i is (s2r5_3 * rij rij^T - s1r3) * mu_j. Both are zero beyond the cutoff.
+    // Ghost monomers are not supported.
+
+    void CalcDipoleTensors(double *xyz1, double *xyz2,              // Coordinates of mon type 1 and 2
+                           size_t mon1_index,                       // Mon 1 index
+                           size_t mon2_index_start,                 // Mon 2 initial index
+                           size_t mon2_index_end,                   // Mon 2 final index
+                           size_t nmon1, size_t nmon2,              // # monomers of types 1 and 2
+                           size_t site_i, size_t site_j,            // Site # i of mon1 and # j of mon 2
+                           double Asqsqi,                           // (polfac[i] * polfac[j])^4 inverted
+                           double aDD,                              // Thole damping aDD (dipole - dipole)
+                           double *tensors,                         // Output compressed tensors
+                           double ewald_alpha,                      // Ewald attenuation paramter
+                           bool use_pbc,                            // Whether to enforce periodic boundary conditions
+                           const std::vector<double> &box,          // The lattice vectors
+                           const std::vector<double> &box_inverse,  // The inverse lattice vectors
+                           double cutoff);                          // The real space cutoff for pairs
+
+    // Same as CalcDipoleElecField, with the tensors computed by CalcDipoleTensors
+
+    void CalcDipoleElecFieldFromTensors(const double *tensors,         // Compressed tensors from CalcDipoleTensors
+                                        double *mu1, double *mu2,      // Dipoles of mon type 1 and 2
+                                        size_t mon1_index,             // Mon 1 index
+                                        size_t mon2_index_start,       // Mon 2 initial index
+                                        size_t mon2_index_end,         // Mon 2 final index
+                                        size_t nmon1, size_t nmon2,    // # monomers of types 1 and 2
+                                        size_t site_i, size_t site_j,  // Site # i of mon1 and # j of mon 2
+                                        double *Efd2,                  // Electric field on Mon 2
+                                        double *Efdx_mon1,             // Output electric field on X for Mon 1
+                                        double *Efdy_mon1,             // Output electric field on Y for Mon 1
+                                        double *Efdz_mon1);            // Output electric field on Z for Mon 1
+
     ////////////////////////////////////////////////////////////////////////////////
     // GRADIENTS AND ADD DIPOLE CONTRIBUTIONS TO POTENTIAL /////////////////////////
     ////////////////////////////////////////////////////////////////////////////////
@@ -1,8 +1,11 @@
 #include "SwitchFunction.h"
+#include "tools/custom_exceptions.h"
 #include <vector>
 #include <iostream>
 #include <cmath>
 #include <algorithm>
+#include <cassert>
+#include <string>
 
 class CoarseGrainSwitch: public SwitchFunction {
 
@@ -11,43 +14,40 @@ class CoarseGrainSwitch: public SwitchFunction {
 
 
   CoarseGrainSwitch(int nb, double ri, double ro) : nb(nb), ri(ri), ro(ro) {
-            
+            // e_0 .. e_{nb-1} are kept in a stack buffer
+            if (nb < 1 || nb - 1 > static_cast<int>(max_distances)) {
+                std::string text = "Coarse grain switch of " + std::to_string(nb) + " bodies is not supported. " +
+                                   "Maximum is " + std::to_string(max_distances + 1) + ".";
+                throw CUException(__func__, __FILE__, __LINE__, text);
+            }
         }
   
-        double eval(const std::vector<double>& distances) const {
-
-            // depending on the number of distanes, return the value of the switch function.
-            // finish this later I am sleepy
-            // use recursive algorithm, that divides the siwtch function into half that is multiplied
-            // by switch 0, and half that is not multiplied by switch 0, and recurses on each half.
-            
+        using SwitchFunction::eval;
+        using SwitchFunction::gradient;
+
+        double eval(const double* distances, std::size_t n) const {
+            assert(n <= max_distances);
+            double value;
+            this->eval_lane(distances, 1, n, &value, 0);
+            return value;
+        }
 
-            //std::cout << "Beginning switch eval: ";
+        void gradient(const double* distances, std::size_t n, double* gradients) const {
+            assert(n <= max_distances);
+            double value;
+            this->eval_lane(distances, 1, n, &value, gradients);
+        }
 
-	    std::vector<double> tc(distances.size());
-	    for (std::size_t i = 0; i < distances.size(); i++)
-	      tc[i] = this->single_switch(distances[i]);
-	    double result =  this->combination_prod_sum(tc,this->nb-1);
-	    //double result = this->eval_helper(distances, 0, 0);
-            //std::cout << std::endl;
-            return result;
+        void eval_batch(std::size_t n, std::size_t stride, std::size_t num_distances, const double* distances,
+                        double* values, double* gradients) const {
+            assert(num_distances <= max_distances);
 
+#pragma omp simd
+            for (std::size_t j = 0; j < n; j++)
+                this->eval_lane(distances + j, stride, num_distances, values + j,
+                                gradients == 0 ? 0 : gradients + j);
         }
 
-        std::vector<double> gradient(const std::vector<double>& distances) const {
-	  // std::cout << "Beginning switch gradient: ";
-	  //	  std::vector<double> result = this->gradients_helper(distances, 0, 0);
-          //   std::cout << std::endl;
-
-	    
-	    std::vector<double> tc(distances.size()),tc_grad(distances.size());
-	    for (std::size_t i = 0; i < distances.size(); i++){
-	      tc[i] = this->single_switch(distances[i]);
-	      tc_grad[i]=this->single_gradient(distances[i]);
-	    }
-	    std::vector<double> result = this->grad_comb(tc,tc_grad,this->nb-1);
-	  return result;
-        }
   double GetRo()const{return ro;};
   int GetNb()const{return nb;};
  
@@ -57,106 +57,40 @@ class CoarseGrainSwitch: public SwitchFunction {
         double ri;
         double ro;
 
-        double eval_helper(const std::vector<double>& distances, int start_index, int switches_included) const {
-
-            if(this->nb - 1 == switches_included) {
-	      //std::cout << "1";
-                return 1;
-            }
-
-            int remaining_switches = this->nb - 1 - switches_included;
-            int remaining_distances = distances.size() - start_index;
-
-            if(remaining_switches - 1 == remaining_distances) {
-	      //std::cout << "0";
-                return 0;
-            }
-
-            double switch0 = this->single_switch(distances[switches_included]);
-
-	    //            std::cout << "S" << start_index << " * (";
-            double a = eval_helper(distances, start_index + 1, switches_included + 1);
-            //std::cout << ") + ";
-            double b = eval_helper(distances, start_index + 1, switches_included);
-            
-            return switch0*a + b;
-
-        }
-
-        std::vector<double> gradients_helper(const std::vector<double>& distances, int start_index, int switches_included) const {
-
-            if(this->nb - 1 == switches_included) {
-	      //std::cout << "1";
-                return std::vector<double>(distances.size(), 1);
+        // The switch is the sum of the products of the single switches of
+        // all the combinations of nb-1 distances, which is the elementary
+        // symmetric polynomial e_{nb-1} of the single switches. It is built
+        // one switch at a time, so the cost is O(n*nb) instead of growing
+        // with the number of combinations. The derivative with respect to
+        // distance i is e_{nb-2} of all the switches but i, obtained by
+        // removing switch i from e_1 .. e_{nb-2}, times the derivative of
+        // switch i. Distance k is distances[k*stride].
+        void eval_lane(const double* distances, std::size_t stride, std::size_t n,
+                       double* value, double* gradients) const {
+            const std::size_t m = this->nb - 1;
+
+            double s[max_distances];
+            double e[max_distances + 1];
+            e[0] = 1;
+            for (std::size_t p = 1; p <= m; p++)
+                e[p] = 0;
+            for (std::size_t i = 0; i < n; i++) {
+                s[i] = this->single_switch(distances[i*stride]);
+                for (std::size_t p = m; p > 0; p--)
+                    e[p] += s[i]*e[p - 1];
             }
+            *value = e[m];
 
-            int remaining_switches = this->nb - 1 - switches_included;
-            int remaining_distances = distances.size() - start_index;
+            if (gradients == 0) return;
 
-            if(remaining_switches - 1 == remaining_distances) {
-	      //std::cout << "0";
-                return std::vector<double>(distances.size(), 0);
+            for (std::size_t i = 0; i < n; i++) {
+                double f = m > 0 ? 1 : 0;
+                for (std::size_t p = 1; p < m; p++)
+                    f = e[p] - s[i]*f;
+                gradients[i*stride] = f*this->single_gradient(distances[i*stride]);
             }
-
-            //std::cout << "S" << start_index << " * (";
-            std::vector<double> a = gradients_helper(distances, start_index + 1, switches_included + 1);
-            //std::cout << ") + ";
-            std::vector<double> b = gradients_helper(distances, start_index + 1, switches_included);
-
-            std::vector<double> gradients(distances.size());
-
-            for(int i = 0; i < distances.size(); i++) {
-
-
-                double switch0;
-                if(start_index == i)
-                    switch0 = this->single_gradient(distances[switches_included]);
-                else
-                    switch0 = this->single_switch(distances[switches_included]);
-
-                gradients[i] = switch0*a[i] + b[i];
-
-            }
-            return gradients;
         }
 
-
-  double  combination_prod_sum(const std::vector<double>& v, std::size_t count)const
-  {
-    double ret=0;
-    std::vector<bool> bitset(v.size() - count, 0);
-    bitset.resize(v.size(), 1);
-
-    do {
-      double a=1;
-      for (std::size_t i = 0; i != v.size(); ++i) {
-	if (bitset[i]) {
-	  a *= v[i];
-	}
-      }
-      ret+=a;
-    } while (std::next_permutation(bitset.begin(), bitset.end()));
-    return ret;
-  }
-  
-  std::vector<double> grad_comb(const std::vector<double>& v,const std::vector<double>& grad_v, std::size_t count) const
-  {
- 
-    std::vector<double> grad_ret;
-
-    //loop through switches
-    for (std::size_t i = 0; i < v.size(); i++)
-      {   
-	//Vector containing all switches except i
-	std::vector<double> v_switch_i(v);
-	v_switch_i.erase(v_switch_i.begin()+i);
-	
-	grad_ret.push_back(combination_prod_sum(v_switch_i, count-1)*grad_v[i]);
-      }
-    return grad_ret;
-  }
-
-   
   double single_switch(const double distance) const {
     if(distance > this->ro) return 0;
     if(distance > this->ri) {
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "potential/fragmented/Polynomial.h"
 
 namespace FitFuncs {
     void add_polynomials(std::vector<Polynomial*>& polynomials);
+
+    // New polynomial with the given name, or 0 if there is none
+    Polynomial* create_polynomial(const std::string& name);
 }
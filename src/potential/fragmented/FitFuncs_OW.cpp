@@ -1,3 +1,5 @@
+// Generated by scripts/fitfuncs_generator/generate_fitfuncs.py from OW.json.
+// Edit the term list and regenerate rather than editing this file by hand.
 #include <vector>
 #include "FitFuncs.h"
 #include "LocalSystem.h"
@@ -15,39 +17,96 @@ class OW_OW : public Polynomial {
 
         OW_OW() : Polynomial(OW_OW::get_system(), "OW_OW", 10, 1, OW_OW::get_nl_param_indices(), new CoarseGrainSwitch(2, 6.0, 8.0)) {}
 
-        std::vector<double> eval_terms_from_variables(const std::vector<double>& variables) const {
-            std::vector<double> terms(10);
-            terms[0] = variables[0];
-            terms[1] = variables[0]*variables[0];
-            terms[2] = variables[0]*variables[0]*variables[0];
-            terms[3] = variables[0]*variables[0]*variables[0]*variables[0];
-            terms[4] = variables[0]*variables[0]*variables[0]*variables[0]*variables[0];
-            terms[5] = variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0];
-            terms[6] = variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0];
-            terms[7] = variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0];
-            terms[8] = variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0];
-            terms[9] = variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0];
-            return terms;
+        void eval_terms_from_variables(const double* variables, double* terms) const {
+            const double x0 = variables[0];
+            const double p_2 = x0*x0;
+            const double p_3 = p_2*x0;
+            const double p_4 = p_3*x0;
+            const double p_5 = p_4*x0;
+            const double p_6 = p_5*x0;
+            const double p_7 = p_6*x0;
+            const double p_8 = p_7*x0;
+            const double p_9 = p_8*x0;
+            const double p_10 = p_9*x0;
+            terms[0] = x0;
+            terms[1] = p_2;
+            terms[2] = p_3;
+            terms[3] = p_4;
+            terms[4] = p_5;
+            terms[5] = p_6;
+            terms[6] = p_7;
+            terms[7] = p_8;
+            terms[8] = p_9;
+            terms[9] = p_10;
         }
 
-        std::vector<double> polynomial_gradient(const std::vector<double>& variables) const {
-            std::vector<double> grad(variables.size());
-            grad[0] = 0 + this->get_coefficients()[0]*(1) + this->get_coefficients()[1]*(2*variables[0]) + this->get_coefficients()[2]*(3*variables[0]*variables[0]) + this->get_coefficients()[3]*(4*variables[0]*variables[0]*variables[0]) + this->get_coefficients()[4]*(5*variables[0]*variables[0]*variables[0]*variables[0]) + this->get_coefficients()[5]*(6*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]) + this->get_coefficients()[6]*(7*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]) + this->get_coefficients()[7]*(8*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]) + this->get_coefficients()[8]*(9*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]) + this->get_coefficients()[9]*(10*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]);
-            return grad;
+        void polynomial_gradient(const double* variables, double* grad) const {
+            const double* coefficients = this->get_coefficients().data();
+            const double x0 = variables[0];
+            grad[0] = coefficients[0] + x0*(2*coefficients[1] + x0*(3*coefficients[2] + x0*(4*coefficients[3] + x0*(5*coefficients[4] + x0*(6*coefficients[5] + x0*(7*coefficients[6] + x0*(8*coefficients[7] + x0*(9*coefficients[8] + x0*10*coefficients[9]))))))));
+        }
+
+        void polynomial_batch(std::size_t n, std::size_t stride, const double* variables, double* values, double* grad) const {
+            const double* coefficients = this->get_coefficients().data();
+            const double* v0 = variables + 0*stride;
+            if(grad == 0) {
+#pragma omp simd
+                for(std::size_t j = 0; j < n; j++) {
+                    const double x0 = v0[j];
+                    values[j] = x0*(coefficients[0] + x0*(coefficients[1] + x0*(coefficients[2] + x0*(coefficients[3] + x0*(coefficients[4] + x0*(coefficients[5] + x0*(coefficients[6] + x0*(coefficients[7] + x0*(coefficients[8] + x0*coefficients[9])))))))));
+                }
+                return;
+            }
+            double* g0 = grad + 0*stride;
+#pragma omp simd
+            for(std::size_t j = 0; j < n; j++) {
+                const double x0 = v0[j];
+                values[j] = x0*(coefficients[0] + x0*(coefficients[1] + x0*(coefficients[2] + x0*(coefficients[3] + x0*(coefficients[4] + x0*(coefficients[5] + x0*(coefficients[6] + x0*(coefficients[7] + x0*(coefficients[8] + x0*coefficients[9])))))))));
+                g0[j] = coefficients[0] + x0*(2*coefficients[1] + x0*(3*coefficients[2] + x0*(4*coefficients[3] + x0*(5*coefficients[4] + x0*(6*coefficients[5] + x0*(7*coefficients[6] + x0*(8*coefficients[7] + x0*(9*coefficients[8] + x0*10*coefficients[9]))))))));
+            }
+        }
+
+        void polynomial_batch(std::size_t n, std::size_t stride, const float* variables, float* values, float* grad) const {
+            const float* coefficients = this->get_coefficients_float().data();
+            const float* v0 = variables + 0*stride;
+            if(grad == 0) {
+#pragma omp simd
+                for(std::size_t j = 0; j < n; j++) {
+                    const float x0 = v0[j];
+                    values[j] = x0*(coefficients[0] + x0*(coefficients[1] + x0*(coefficients[2] + x0*(coefficients[3] + x0*(coefficients[4] + x0*(coefficients[5] + x0*(coefficients[6] + x0*(coefficients[7] + x0*(coefficients[8] + x0*coefficients[9])))))))));
+                }
+                return;
+            }
+            float* g0 = grad + 0*stride;
+#pragma omp simd
+            for(std::size_t j = 0; j < n; j++) {
+                const float x0 = v0[j];
+                values[j] = x0*(coefficients[0] + x0*(coefficients[1] + x0*(coefficients[2] + x0*(coefficients[3] + x0*(coefficients[4] + x0*(coefficients[5] + x0*(coefficients[6] + x0*(coefficients[7] + x0*(coefficients[8] + x0*coefficients[9])))))))));
+                g0[j] = coefficients[0] + x0*(2*coefficients[1] + x0*(3*coefficients[2] + x0*(4*coefficients[3] + x0*(5*coefficients[4] + x0*(6*coefficients[5] + x0*(7*coefficients[6] + x0*(8*coefficients[7] + x0*(9*coefficients[8] + x0*10*coefficients[9]))))))));
+            }
         }
 
         std::vector<double> polynomial_terms_gradient(const std::vector<double>& variables) const {
             std::vector<double> grad(variables.size()*this->get_coefficients().size());
-            grad[0] = 0 + (1);
-            grad[1] = 0 + (2*variables[0]);
-            grad[2] = 0 + (3*variables[0]*variables[0]);
-            grad[3] = 0 + (4*variables[0]*variables[0]*variables[0]);
-            grad[4] = 0 + (5*variables[0]*variables[0]*variables[0]*variables[0]);
-            grad[5] = 0 + (6*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]);
-            grad[6] = 0 + (7*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]);
-            grad[7] = 0 + (8*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]);
-            grad[8] = 0 + (9*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]);
-            grad[9] = 0 + (10*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]*variables[0]);
+            const double x0 = variables[0];
+            const double p_2 = x0*x0;
+            const double p_3 = p_2*x0;
+            const double p_4 = p_3*x0;
+            const double p_5 = p_4*x0;
+            const double p_6 = p_5*x0;
+            const double p_7 = p_6*x0;
+            const double p_8 = p_7*x0;
+            const double p_9 = p_8*x0;
+            grad[0] = 1;
+            grad[1] = 2*x0;
+            grad[2] = 3*p_2;
+            grad[3] = 4*p_3;
+            grad[4] = 5*p_4;
+            grad[5] = 6*p_5;
+            grad[6] = 7*p_6;
+            grad[7] = 8*p_7;
+            grad[8] = 9*p_8;
+            grad[9] = 10*p_9;
             return grad;
         }
 
@@ -78,81 +137,230 @@ class OW_OW_OW : public Polynomial {
 
         OW_OW_OW() : Polynomial(OW_OW_OW::get_system(), "OW_OW_OW", 15, 1, OW_OW_OW::get_nl_param_indices(), new CoarseGrainSwitch(3, 2.0, 4.0)) {}
 
-        std::vector<double> eval_terms_from_variables(const std::vector<double>& variables) const {
-            std::vector<double> terms(15);
-            terms[0] = variables[0] + variables[1] + variables[2];
-            terms[1] = variables[1]*variables[1] + variables[0]*variables[0] + variables[2]*variables[2];
-            terms[2] = variables[1]*variables[2] + variables[0]*variables[2] + variables[0]*variables[1];
-            terms[3] = variables[0]*variables[1]*variables[2];
-            terms[4] = variables[0]*variables[0]*variables[0] + variables[1]*variables[1]*variables[1] + variables[2]*variables[2]*variables[2];
-            terms[5] = variables[0]*variables[2]*variables[2] + variables[0]*variables[1]*variables[1] + variables[1]*variables[2]*variables[2] + variables[0]*variables[0]*variables[1] + variables[1]*variables[1]*variables[2] + variables[0]*variables[0]*variables[2];
-            terms[6] = variables[0]*variables[0]*variables[0]*variables[0] + variables[2]*variables[2]*variables[2]*variables[2] + variables[1]*variables[1]*variables[1]*variables[1];
-            terms[7] = variables[0]*variables[0]*variables[1]*variables[2] + variables[0]*variables[1]*variables[2]*variables[2] + variables[0]*variables[1]*variables[1]*variables[2];
-            terms[8] = variables[0]*variables[0]*variables[0]*variables[2] + variables[0]*variables[2]*variables[2]*variables[2] + variables[0]*variables[0]*variables[0]*variables[1] + variables[0]*variables[1]*variables[1]*variables[1] + variables[1]*variables[1]*variables[1]*variables[2] + variables[1]*variables[2]*variables[2]*variables[2];
-            terms[9] = variables[0]*variables[0]*variables[2]*variables[2] + variables[1]*variables[1]*variables[2]*variables[2] + variables[0]*variables[0]*variables[1]*variables[1];
-            terms[10] = variables[0]*variables[0]*variables[1]*variables[2]*variables[2] + variables[0]*variables[1]*variables[1]*variables[2]*variables[2] + variables[0]*variables[0]*variables[1]*variables[1]*variables[2];
-            terms[11] = variables[1]*variables[1]*variables[1]*variables[1]*variables[2] + variables[0]*variables[0]*variables[0]*variables[0]*variables[2] + variables[0]*variables[2]*variables[2]*variables[2]*variables[2] + variables[0]*variables[0]*variables[0]*variables[0]*variables[1] + variables[1]*variables[2]*variables[2]*variables[2]*variables[2] + variables[0]*variables[1]*variables[1]*variables[1]*variables[1];
-            terms[12] = variables[0]*variables[0]*variables[0]*variables[0]*variables[0] + variables[2]*variables[2]*variables[2]*variables[2]*variables[2] + variables[1]*variables[1]*variables[1]*variables[1]*variables[1];
-            terms[13] = variables[0]*variables[1]*variables[1]*variables[1]*variables[2] + variables[0]*variables[1]*variables[2]*variables[2]*variables[2] + variables[0]*variables[0]*variables[0]*variables[1]*variables[2];
-            terms[14] = variables[1]*variables[1]*variables[1]*variables[2]*variables[2] + variables[1]*variables[1]*variables[2]*variables[2]*variables[2] + variables[0]*variables[0]*variables[1]*variables[1]*variables[1] + variables[0]*variables[0]*variables[2]*variables[2]*variables[2] + variables[0]*variables[0]*variables[0]*variables[1]*variables[1] + variables[0]*variables[0]*variables[0]*variables[2]*variables[2];
-            return terms;
+        void eval_terms_from_variables(const double* variables, double* terms) const {
+            const double x0 = variables[0];
+            const double x1 = variables[1];
+            const double x2 = variables[2];
+            const double p_0_0_2 = x2*x2;
+            const double p_0_1_1 = x1*x2;
+            const double p_0_2_0 = x1*x1;
+            const double p_1_0_1 = x0*x2;
+            const double p_1_1_0 = x0*x1;
+            const double p_2_0_0 = x0*x0;
+            const double p_0_0_3 = p_0_0_2*x2;
+            const double p_0_1_2 = p_0_1_1*x2;
+            const double p_0_2_1 = p_0_2_0*x2;
+            const double p_0_3_0 = p_0_2_0*x1;
+            const double p_1_0_2 = p_1_0_1*x2;
+            const double p_1_1_1 = p_1_1_0*x2;
+            const double p_1_2_0 = p_1_1_0*x1;
+            const double p_2_0_1 = p_2_0_0*x2;
+            const double p_2_1_0 = p_2_0_0*x1;
+            const double p_3_0_0 = p_2_0_0*x0;
+            const double p_0_0_4 = p_0_0_3*x2;
+            const double p_0_1_3 = p_0_1_2*x2;
+            const double p_0_2_2 = p_0_2_1*x2;
+            const double p_0_3_1 = p_0_3_0*x2;
+            const double p_0_4_0 = p_0_3_0*x1;
+            const double p_1_0_3 = p_1_0_2*x2;
+            const double p_1_1_2 = p_1_1_1*x2;
+            const double p_1_2_1 = p_1_2_0*x2;
+            const double p_1_3_0 = p_1_2_0*x1;
+            const double p_2_0_2 = p_2_0_1*x2;
+            const double p_2_1_1 = p_2_1_0*x2;
+            const double p_2_2_0 = p_2_1_0*x1;
+            const double p_3_0_1 = p_3_0_0*x2;
+            const double p_3_1_0 = p_3_0_0*x1;
+            const double p_4_0_0 = p_3_0_0*x0;
+            const double p_0_0_5 = p_0_0_4*x2;
+            const double p_0_1_4 = p_0_1_3*x2;
+            const double p_0_2_3 = p_0_2_2*x2;
+            const double p_0_3_2 = p_0_3_1*x2;
+            const double p_0_4_1 = p_0_4_0*x2;
+            const double p_0_5_0 = p_0_4_0*x1;
+            const double p_1_0_4 = p_1_0_3*x2;
+            const double p_1_1_3 = p_1_1_2*x2;
+            const double p_1_2_2 = p_1_2_1*x2;
+            const double p_1_3_1 = p_1_3_0*x2;
+            const double p_1_4_0 = p_1_3_0*x1;
+            const double p_2_0_3 = p_2_0_2*x2;
+            const double p_2_1_2 = p_2_1_1*x2;
+            const double p_2_2_1 = p_2_2_0*x2;
+            const double p_2_3_0 = p_2_2_0*x1;
+            const double p_3_0_2 = p_3_0_1*x2;
+            const double p_3_1_1 = p_3_1_0*x2;
+            const double p_3_2_0 = p_3_1_0*x1;
+            const double p_4_0_1 = p_4_0_0*x2;
+            const double p_4_1_0 = p_4_0_0*x1;
+            const double p_5_0_0 = p_4_0_0*x0;
+            terms[0] = x0 + x1 + x2;
+            terms[1] = p_0_2_0 + p_2_0_0 + p_0_0_2;
+            terms[2] = p_0_1_1 + p_1_0_1 + p_1_1_0;
+            terms[3] = p_1_1_1;
+            terms[4] = p_3_0_0 + p_0_3_0 + p_0_0_3;
+            terms[5] = p_1_0_2 + p_1_2_0 + p_0_1_2 + p_2_1_0 + p_0_2_1 + p_2_0_1;
+            terms[6] = p_4_0_0 + p_0_0_4 + p_0_4_0;
+            terms[7] = p_2_1_1 + p_1_1_2 + p_1_2_1;
+            terms[8] = p_3_0_1 + p_1_0_3 + p_3_1_0 + p_1_3_0 + p_0_3_1 + p_0_1_3;
+            terms[9] = p_2_0_2 + p_0_2_2 + p_2_2_0;
+            terms[10] = p_2_1_2 + p_1_2_2 + p_2_2_1;
+            terms[11] = p_0_4_1 + p_4_0_1 + p_1_0_4 + p_4_1_0 + p_0_1_4 + p_1_4_0;
+            terms[12] = p_5_0_0 + p_0_0_5 + p_0_5_0;
+            terms[13] = p_1_3_1 + p_1_1_3 + p_3_1_1;
+            terms[14] = p_0_3_2 + p_0_2_3 + p_2_3_0 + p_2_0_3 + p_3_2_0 + p_3_0_2;
         }
 
-        std::vector<double> polynomial_gradient(const std::vector<double>& variables) const {
-            std::vector<double> grad(variables.size());
-            grad[0] = 0 + this->get_coefficients()[0]*(1) + this->get_coefficients()[1]*(2*variables[0]) + this->get_coefficients()[2]*(1*variables[2] + 1*variables[1]) + this->get_coefficients()[3]*(1*variables[1]*variables[2]) + this->get_coefficients()[4]*(3*variables[0]*variables[0]) + this->get_coefficients()[5]*(1*variables[2]*variables[2] + 1*variables[1]*variables[1] + 2*variables[0]*variables[1] + 2*variables[0]*variables[2]) + this->get_coefficients()[6]*(4*variables[0]*variables[0]*variables[0]) + this->get_coefficients()[7]*(2*variables[0]*variables[1]*variables[2] + 1*variables[1]*variables[2]*variables[2] + 1*variables[1]*variables[1]*variables[2]) + this->get_coefficients()[8]*(3*variables[0]*variables[0]*variables[2] + 1*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[1] + 1*variables[1]*variables[1]*variables[1]) + this->get_coefficients()[9]*(2*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[1]*variables[1]) + this->get_coefficients()[10]*(2*variables[0]*variables[1]*variables[2]*variables[2] + 1*variables[1]*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[1]*variables[1]*variables[2]) + this->get_coefficients()[11]*(4*variables[0]*variables[0]*variables[0]*variables[2] + 1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[0]*variables[0]*variables[0]*variables[1] + 1*variables[1]*variables[1]*variables[1]*variables[1]) + this->get_coefficients()[12]*(5*variables[0]*variables[0]*variables[0]*variables[0]) + this->get_coefficients()[13]*(1*variables[1]*variables[1]*variables[1]*variables[2] + 1*variables[1]*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[1]*variables[2]) + this->get_coefficients()[14]*(2*variables[0]*variables[1]*variables[1]*variables[1] + 2*variables[0]*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[1]*variables[1] + 3*variables[0]*variables[0]*variables[2]*variables[2]);
-            grad[1] = 0 + this->get_coefficients()[0]*(1) + this->get_coefficients()[1]*(2*variables[1]) + this->get_coefficients()[2]*(1*variables[2] + 1*variables[0]) + this->get_coefficients()[3]*(1*variables[0]*variables[2]) + this->get_coefficients()[4]*(3*variables[1]*variables[1]) + this->get_coefficients()[5]*(2*variables[0]*variables[1] + 1*variables[2]*variables[2] + 1*variables[0]*variables[0] + 2*variables[1]*variables[2]) + this->get_coefficients()[6]*(4*variables[1]*variables[1]*variables[1]) + this->get_coefficients()[7]*(1*variables[0]*variables[0]*variables[2] + 1*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[1]*variables[2]) + this->get_coefficients()[8]*(1*variables[0]*variables[0]*variables[0] + 3*variables[0]*variables[1]*variables[1] + 3*variables[1]*variables[1]*variables[2] + 1*variables[2]*variables[2]*variables[2]) + this->get_coefficients()[9]*(2*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[0]*variables[1]) + this->get_coefficients()[10]*(1*variables[0]*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[0]*variables[1]*variables[2]) + this->get_coefficients()[11]*(4*variables[1]*variables[1]*variables[1]*variables[2] + 1*variables[0]*variables[0]*variables[0]*variables[0] + 1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[0]*variables[1]*variables[1]*variables[1]) + this->get_coefficients()[12]*(5*variables[1]*variables[1]*variables[1]*variables[1]) + this->get_coefficients()[13]*(3*variables[0]*variables[1]*variables[1]*variables[2] + 1*variables[0]*variables[2]*variables[2]*variables[2] + 1*variables[0]*variables[0]*variables[0]*variables[2]) + this->get_coefficients()[14]*(3*variables[1]*variables[1]*variables[2]*variables[2] + 2*variables[1]*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[1]*variables[1] + 2*variables[0]*variables[0]*variables[0]*variables[1]);
-            grad[2] = 0 + this->get_coefficients()[0]*(1) + this->get_coefficients()[1]*(2*variables[2]) + this->get_coefficients()[2]*(1*variables[1] + 1*variables[0]) + this->get_coefficients()[3]*(1*variables[0]*variables[1]) + this->get_coefficients()[4]*(3*variables[2]*variables[2]) + this->get_coefficients()[5]*(2*variables[0]*variables[2] + 2*variables[1]*variables[2] + 1*variables[1]*variables[1] + 1*variables[0]*variables[0]) + this->get_coefficients()[6]*(4*variables[2]*variables[2]*variables[2]) + this->get_coefficients()[7]*(1*variables[0]*variables[0]*variables[1] + 2*variables[0]*variables[1]*variables[2] + 1*variables[0]*variables[1]*variables[1]) + this->get_coefficients()[8]*(1*variables[0]*variables[0]*variables[0] + 3*variables[0]*variables[2]*variables[2] + 1*variables[1]*variables[1]*variables[1] + 3*variables[1]*variables[2]*variables[2]) + this->get_coefficients()[9]*(2*variables[0]*variables[0]*variables[2] + 2*variables[1]*variables[1]*variables[2]) + this->get_coefficients()[10]*(2*variables[0]*variables[0]*variables[1]*variables[2] + 2*variables[0]*variables[1]*variables[1]*variables[2] + 1*variables[0]*variables[0]*variables[1]*variables[1]) + this->get_coefficients()[11]*(1*variables[1]*variables[1]*variables[1]*variables[1] + 1*variables[0]*variables[0]*variables[0]*variables[0] + 4*variables[0]*variables[2]*variables[2]*variables[2] + 4*variables[1]*variables[2]*variables[2]*variables[2]) + this->get_coefficients()[12]*(5*variables[2]*variables[2]*variables[2]*variables[2]) + this->get_coefficients()[13]*(1*variables[0]*variables[1]*variables[1]*variables[1] + 3*variables[0]*variables[1]*variables[2]*variables[2] + 1*variables[0]*variables[0]*variables[0]*variables[1]) + this->get_coefficients()[14]*(2*variables[1]*variables[1]*variables[1]*variables[2] + 3*variables[1]*variables[1]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[0]*variables[0]*variables[2]);
-            return grad;
+        void polynomial_gradient(const double* variables, double* grad) const {
+            const double* coefficients = this->get_coefficients().data();
+            const double x0 = variables[0];
+            const double x1 = variables[1];
+            const double x2 = variables[2];
+            grad[0] = coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(coefficients[2] + x2*(coefficients[3] + x2*(coefficients[7] + x2*coefficients[13])) + x1*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(coefficients[8] + x2*coefficients[13] + x1*coefficients[11]))) + x0*(2*coefficients[1] + x2*(2*coefficients[5] + x2*(2*coefficients[9] + x2*2*coefficients[14])) + x1*(2*coefficients[5] + x2*(2*coefficients[7] + x2*2*coefficients[10]) + x1*(2*coefficients[9] + x2*2*coefficients[10] + x1*2*coefficients[14])) + x0*(3*coefficients[4] + x2*(3*coefficients[8] + x2*3*coefficients[14]) + x1*(3*coefficients[8] + x2*3*coefficients[13] + x1*3*coefficients[14]) + x0*(4*coefficients[6] + x2*4*coefficients[11] + x1*4*coefficients[11] + x0*5*coefficients[12])));
+            grad[1] = coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(2*coefficients[1] + x2*(2*coefficients[5] + x2*(2*coefficients[9] + x2*2*coefficients[14])) + x1*(3*coefficients[4] + x2*(3*coefficients[8] + x2*3*coefficients[14]) + x1*(4*coefficients[6] + x2*4*coefficients[11] + x1*5*coefficients[12]))) + x0*(coefficients[2] + x2*(coefficients[3] + x2*(coefficients[7] + x2*coefficients[13])) + x1*(2*coefficients[5] + x2*(2*coefficients[7] + x2*2*coefficients[10]) + x1*(3*coefficients[8] + x2*3*coefficients[13] + x1*4*coefficients[11])) + x0*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(2*coefficients[9] + x2*2*coefficients[10] + x1*3*coefficients[14]) + x0*(coefficients[8] + x2*coefficients[13] + x1*2*coefficients[14] + x0*coefficients[11])));
+            grad[2] = coefficients[0] + x2*(2*coefficients[1] + x2*(3*coefficients[4] + x2*(4*coefficients[6] + x2*5*coefficients[12]))) + x1*(coefficients[2] + x2*(2*coefficients[5] + x2*(3*coefficients[8] + x2*4*coefficients[11])) + x1*(coefficients[5] + x2*(2*coefficients[9] + x2*3*coefficients[14]) + x1*(coefficients[8] + x2*2*coefficients[14] + x1*coefficients[11]))) + x0*(coefficients[2] + x2*(2*coefficients[5] + x2*(3*coefficients[8] + x2*4*coefficients[11])) + x1*(coefficients[3] + x2*(2*coefficients[7] + x2*3*coefficients[13]) + x1*(coefficients[7] + x2*2*coefficients[10] + x1*coefficients[13])) + x0*(coefficients[5] + x2*(2*coefficients[9] + x2*3*coefficients[14]) + x1*(coefficients[7] + x2*2*coefficients[10] + x1*coefficients[10]) + x0*(coefficients[8] + x2*2*coefficients[14] + x1*coefficients[13] + x0*coefficients[11])));
+        }
+
+        void polynomial_batch(std::size_t n, std::size_t stride, const double* variables, double* values, double* grad) const {
+            const double* coefficients = this->get_coefficients().data();
+            const double* v0 = variables + 0*stride;
+            const double* v1 = variables + 1*stride;
+            const double* v2 = variables + 2*stride;
+            if(grad == 0) {
+#pragma omp simd
+                for(std::size_t j = 0; j < n; j++) {
+                    const double x0 = v0[j];
+                    const double x1 = v1[j];
+                    const double x2 = v2[j];
+                    values[j] = x2*(coefficients[0] + x2*(coefficients[1] + x2*(coefficients[4] + x2*(coefficients[6] + x2*coefficients[12])))) + x1*(coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(coefficients[1] + x2*(coefficients[5] + x2*(coefficients[9] + x2*coefficients[14])) + x1*(coefficients[4] + x2*(coefficients[8] + x2*coefficients[14]) + x1*(coefficients[6] + x2*coefficients[11] + x1*coefficients[12])))) + x0*(coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(coefficients[2] + x2*(coefficients[3] + x2*(coefficients[7] + x2*coefficients[13])) + x1*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(coefficients[8] + x2*coefficients[13] + x1*coefficients[11]))) + x0*(coefficients[1] + x2*(coefficients[5] + x2*(coefficients[9] + x2*coefficients[14])) + x1*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(coefficients[9] + x2*coefficients[10] + x1*coefficients[14])) + x0*(coefficients[4] + x2*(coefficients[8] + x2*coefficients[14]) + x1*(coefficients[8] + x2*coefficients[13] + x1*coefficients[14]) + x0*(coefficients[6] + x2*coefficients[11] + x1*coefficients[11] + x0*coefficients[12]))));
+                }
+                return;
+            }
+            double* g0 = grad + 0*stride;
+            double* g1 = grad + 1*stride;
+            double* g2 = grad + 2*stride;
+#pragma omp simd
+            for(std::size_t j = 0; j < n; j++) {
+                const double x0 = v0[j];
+                const double x1 = v1[j];
+                const double x2 = v2[j];
+                values[j] = x2*(coefficients[0] + x2*(coefficients[1] + x2*(coefficients[4] + x2*(coefficients[6] + x2*coefficients[12])))) + x1*(coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(coefficients[1] + x2*(coefficients[5] + x2*(coefficients[9] + x2*coefficients[14])) + x1*(coefficients[4] + x2*(coefficients[8] + x2*coefficients[14]) + x1*(coefficients[6] + x2*coefficients[11] + x1*coefficients[12])))) + x0*(coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(coefficients[2] + x2*(coefficients[3] + x2*(coefficients[7] + x2*coefficients[13])) + x1*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(coefficients[8] + x2*coefficients[13] + x1*coefficients[11]))) + x0*(coefficients[1] + x2*(coefficients[5] + x2*(coefficients[9] + x2*coefficients[14])) + x1*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(coefficients[9] + x2*coefficients[10] + x1*coefficients[14])) + x0*(coefficients[4] + x2*(coefficients[8] + x2*coefficients[14]) + x1*(coefficients[8] + x2*coefficients[13] + x1*coefficients[14]) + x0*(coefficients[6] + x2*coefficients[11] + x1*coefficients[11] + x0*coefficients[12]))));
+                g0[j] = coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(coefficients[2] + x2*(coefficients[3] + x2*(coefficients[7] + x2*coefficients[13])) + x1*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(coefficients[8] + x2*coefficients[13] + x1*coefficients[11]))) + x0*(2*coefficients[1] + x2*(2*coefficients[5] + x2*(2*coefficients[9] + x2*2*coefficients[14])) + x1*(2*coefficients[5] + x2*(2*coefficients[7] + x2*2*coefficients[10]) + x1*(2*coefficients[9] + x2*2*coefficients[10] + x1*2*coefficients[14])) + x0*(3*coefficients[4] + x2*(3*coefficients[8] + x2*3*coefficients[14]) + x1*(3*coefficients[8] + x2*3*coefficients[13] + x1*3*coefficients[14]) + x0*(4*coefficients[6] + x2*4*coefficients[11] + x1*4*coefficients[11] + x0*5*coefficients[12])));
+                g1[j] = coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(2*coefficients[1] + x2*(2*coefficients[5] + x2*(2*coefficients[9] + x2*2*coefficients[14])) + x1*(3*coefficients[4] + x2*(3*coefficients[8] + x2*3*coefficients[14]) + x1*(4*coefficients[6] + x2*4*coefficients[11] + x1*5*coefficients[12]))) + x0*(coefficients[2] + x2*(coefficients[3] + x2*(coefficients[7] + x2*coefficients[13])) + x1*(2*coefficients[5] + x2*(2*coefficients[7] + x2*2*coefficients[10]) + x1*(3*coefficients[8] + x2*3*coefficients[13] + x1*4*coefficients[11])) + x0*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(2*coefficients[9] + x2*2*coefficients[10] + x1*3*coefficients[14]) + x0*(coefficients[8] + x2*coefficients[13] + x1*2*coefficients[14] + x0*coefficients[11])));
+                g2[j] = coefficients[0] + x2*(2*coefficients[1] + x2*(3*coefficients[4] + x2*(4*coefficients[6] + x2*5*coefficients[12]))) + x1*(coefficients[2] + x2*(2*coefficients[5] + x2*(3*coefficients[8] + x2*4*coefficients[11])) + x1*(coefficients[5] + x2*(2*coefficients[9] + x2*3*coefficients[14]) + x1*(coefficients[8] + x2*2*coefficients[14] + x1*coefficients[11]))) + x0*(coefficients[2] + x2*(2*coefficients[5] + x2*(3*coefficients[8] + x2*4*coefficients[11])) + x1*(coefficients[3] + x2*(2*coefficients[7] + x2*3*coefficients[13]) + x1*(coefficients[7] + x2*2*coefficients[10] + x1*coefficients[13])) + x0*(coefficients[5] + x2*(2*coefficients[9] + x2*3*coefficients[14]) + x1*(coefficients[7] + x2*2*coefficients[10] + x1*coefficients[10]) + x0*(coefficients[8] + x2*2*coefficients[14] + x1*coefficients[13] + x0*coefficients[11])));
+            }
+        }
+
+        void polynomial_batch(std::size_t n, std::size_t stride, const float* variables, float* values, float* grad) const {
+            const float* coefficients = this->get_coefficients_float().data();
+            const float* v0 = variables + 0*stride;
+            const float* v1 = variables + 1*stride;
+            const float* v2 = variables + 2*stride;
+            if(grad == 0) {
+#pragma omp simd
+                for(std::size_t j = 0; j < n; j++) {
+                    const float x0 = v0[j];
+                    const float x1 = v1[j];
+                    const float x2 = v2[j];
+                    values[j] = x2*(coefficients[0] + x2*(coefficients[1] + x2*(coefficients[4] + x2*(coefficients[6] + x2*coefficients[12])))) + x1*(coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(coefficients[1] + x2*(coefficients[5] + x2*(coefficients[9] + x2*coefficients[14])) + x1*(coefficients[4] + x2*(coefficients[8] + x2*coefficients[14]) + x1*(coefficients[6] + x2*coefficients[11] + x1*coefficients[12])))) + x0*(coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(coefficients[2] + x2*(coefficients[3] + x2*(coefficients[7] + x2*coefficients[13])) + x1*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(coefficients[8] + x2*coefficients[13] + x1*coefficients[11]))) + x0*(coefficients[1] + x2*(coefficients[5] + x2*(coefficients[9] + x2*coefficients[14])) + x1*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(coefficients[9] + x2*coefficients[10] + x1*coefficients[14])) + x0*(coefficients[4] + x2*(coefficients[8] + x2*coefficients[14]) + x1*(coefficients[8] + x2*coefficients[13] + x1*coefficients[14]) + x0*(coefficients[6] + x2*coefficients[11] + x1*coefficients[11] + x0*coefficients[12]))));
+                }
+                return;
+            }
+            float* g0 = grad + 0*stride;
+            float* g1 = grad + 1*stride;
+            float* g2 = grad + 2*stride;
+#pragma omp simd
+            for(std::size_t j = 0; j < n; j++) {
+                const float x0 = v0[j];
+                const float x1 = v1[j];
+                const float x2 = v2[j];
+                values[j] = x2*(coefficients[0] + x2*(coefficients[1] + x2*(coefficients[4] + x2*(coefficients[6] + x2*coefficients[12])))) + x1*(coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(coefficients[1] + x2*(coefficients[5] + x2*(coefficients[9] + x2*coefficients[14])) + x1*(coefficients[4] + x2*(coefficients[8] + x2*coefficients[14]) + x1*(coefficients[6] + x2*coefficients[11] + x1*coefficients[12])))) + x0*(coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(coefficients[2] + x2*(coefficients[3] + x2*(coefficients[7] + x2*coefficients[13])) + x1*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(coefficients[8] + x2*coefficients[13] + x1*coefficients[11]))) + x0*(coefficients[1] + x2*(coefficients[5] + x2*(coefficients[9] + x2*coefficients[14])) + x1*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(coefficients[9] + x2*coefficients[10] + x1*coefficients[14])) + x0*(coefficients[4] + x2*(coefficients[8] + x2*coefficients[14]) + x1*(coefficients[8] + x2*coefficients[13] + x1*coefficients[14]) + x0*(coefficients[6] + x2*coefficients[11] + x1*coefficients[11] + x0*coefficients[12]))));
+                g0[j] = coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(coefficients[2] + x2*(coefficients[3] + x2*(coefficients[7] + x2*coefficients[13])) + x1*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(coefficients[8] + x2*coefficients[13] + x1*coefficients[11]))) + x0*(2*coefficients[1] + x2*(2*coefficients[5] + x2*(2*coefficients[9] + x2*2*coefficients[14])) + x1*(2*coefficients[5] + x2*(2*coefficients[7] + x2*2*coefficients[10]) + x1*(2*coefficients[9] + x2*2*coefficients[10] + x1*2*coefficients[14])) + x0*(3*coefficients[4] + x2*(3*coefficients[8] + x2*3*coefficients[14]) + x1*(3*coefficients[8] + x2*3*coefficients[13] + x1*3*coefficients[14]) + x0*(4*coefficients[6] + x2*4*coefficients[11] + x1*4*coefficients[11] + x0*5*coefficients[12])));
+                g1[j] = coefficients[0] + x2*(coefficients[2] + x2*(coefficients[5] + x2*(coefficients[8] + x2*coefficients[11]))) + x1*(2*coefficients[1] + x2*(2*coefficients[5] + x2*(2*coefficients[9] + x2*2*coefficients[14])) + x1*(3*coefficients[4] + x2*(3*coefficients[8] + x2*3*coefficients[14]) + x1*(4*coefficients[6] + x2*4*coefficients[11] + x1*5*coefficients[12]))) + x0*(coefficients[2] + x2*(coefficients[3] + x2*(coefficients[7] + x2*coefficients[13])) + x1*(2*coefficients[5] + x2*(2*coefficients[7] + x2*2*coefficients[10]) + x1*(3*coefficients[8] + x2*3*coefficients[13] + x1*4*coefficients[11])) + x0*(coefficients[5] + x2*(coefficients[7] + x2*coefficients[10]) + x1*(2*coefficients[9] + x2*2*coefficients[10] + x1*3*coefficients[14]) + x0*(coefficients[8] + x2*coefficients[13] + x1*2*coefficients[14] + x0*coefficients[11])));
+                g2[j] = coefficients[0] + x2*(2*coefficients[1] + x2*(3*coefficients[4] + x2*(4*coefficients[6] + x2*5*coefficients[12]))) + x1*(coefficients[2] + x2*(2*coefficients[5] + x2*(3*coefficients[8] + x2*4*coefficients[11])) + x1*(coefficients[5] + x2*(2*coefficients[9] + x2*3*coefficients[14]) + x1*(coefficients[8] + x2*2*coefficients[14] + x1*coefficients[11]))) + x0*(coefficients[2] + x2*(2*coefficients[5] + x2*(3*coefficients[8] + x2*4*coefficients[11])) + x1*(coefficients[3] + x2*(2*coefficients[7] + x2*3*coefficients[13]) + x1*(coefficients[7] + x2*2*coefficients[10] + x1*coefficients[13])) + x0*(coefficients[5] + x2*(2*coefficients[9] + x2*3*coefficients[14]) + x1*(coefficients[7] + x2*2*coefficients[10] + x1*coefficients[10]) + x0*(coefficients[8] + x2*2*coefficients[14] + x1*coefficients[13] + x0*coefficients[11])));
+            }
         }
 
         std::vector<double> polynomial_terms_gradient(const std::vector<double>& variables) const {
             std::vector<double> grad(variables.size()*this->get_coefficients().size());
-            grad[0] = 0 + (1);
-            grad[1] = 0 + (2*variables[0]);
-            grad[2] = 0 + (1*variables[2] + 1*variables[1]);
-            grad[3] = 0 + (1*variables[1]*variables[2]);
-            grad[4] = 0 + (3*variables[0]*variables[0]);
-            grad[5] = 0 + (1*variables[2]*variables[2] + 1*variables[1]*variables[1] + 2*variables[0]*variables[1] + 2*variables[0]*variables[2]);
-            grad[6] = 0 + (4*variables[0]*variables[0]*variables[0]);
-            grad[7] = 0 + (2*variables[0]*variables[1]*variables[2] + 1*variables[1]*variables[2]*variables[2] + 1*variables[1]*variables[1]*variables[2]);
-            grad[8] = 0 + (3*variables[0]*variables[0]*variables[2] + 1*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[1] + 1*variables[1]*variables[1]*variables[1]);
-            grad[9] = 0 + (2*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[1]*variables[1]);
-            grad[10] = 0 + (2*variables[0]*variables[1]*variables[2]*variables[2] + 1*variables[1]*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[1]*variables[1]*variables[2]);
-            grad[11] = 0 + (4*variables[0]*variables[0]*variables[0]*variables[2] + 1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[0]*variables[0]*variables[0]*variables[1] + 1*variables[1]*variables[1]*variables[1]*variables[1]);
-            grad[12] = 0 + (5*variables[0]*variables[0]*variables[0]*variables[0]);
-            grad[13] = 0 + (1*variables[1]*variables[1]*variables[1]*variables[2] + 1*variables[1]*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[1]*variables[2]);
-            grad[14] = 0 + (2*variables[0]*variables[1]*variables[1]*variables[1] + 2*variables[0]*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[1]*variables[1] + 3*variables[0]*variables[0]*variables[2]*variables[2]);
-            grad[15] = 0 + (1);
-            grad[16] = 0 + (2*variables[1]);
-            grad[17] = 0 + (1*variables[2] + 1*variables[0]);
-            grad[18] = 0 + (1*variables[0]*variables[2]);
-            grad[19] = 0 + (3*variables[1]*variables[1]);
-            grad[20] = 0 + (2*variables[0]*variables[1] + 1*variables[2]*variables[2] + 1*variables[0]*variables[0] + 2*variables[1]*variables[2]);
-            grad[21] = 0 + (4*variables[1]*variables[1]*variables[1]);
-            grad[22] = 0 + (1*variables[0]*variables[0]*variables[2] + 1*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[1]*variables[2]);
-            grad[23] = 0 + (1*variables[0]*variables[0]*variables[0] + 3*variables[0]*variables[1]*variables[1] + 3*variables[1]*variables[1]*variables[2] + 1*variables[2]*variables[2]*variables[2]);
-            grad[24] = 0 + (2*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[0]*variables[1]);
-            grad[25] = 0 + (1*variables[0]*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[0]*variables[1]*variables[2]);
-            grad[26] = 0 + (4*variables[1]*variables[1]*variables[1]*variables[2] + 1*variables[0]*variables[0]*variables[0]*variables[0] + 1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[0]*variables[1]*variables[1]*variables[1]);
-            grad[27] = 0 + (5*variables[1]*variables[1]*variables[1]*variables[1]);
-            grad[28] = 0 + (3*variables[0]*variables[1]*variables[1]*variables[2] + 1*variables[0]*variables[2]*variables[2]*variables[2] + 1*variables[0]*variables[0]*variables[0]*variables[2]);
-            grad[29] = 0 + (3*variables[1]*variables[1]*variables[2]*variables[2] + 2*variables[1]*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[1]*variables[1] + 2*variables[0]*variables[0]*variables[0]*variables[1]);
-            grad[30] = 0 + (1);
-            grad[31] = 0 + (2*variables[2]);
-            grad[32] = 0 + (1*variables[1] + 1*variables[0]);
-            grad[33] = 0 + (1*variables[0]*variables[1]);
-            grad[34] = 0 + (3*variables[2]*variables[2]);
-            grad[35] = 0 + (2*variables[0]*variables[2] + 2*variables[1]*variables[2] + 1*variables[1]*variables[1] + 1*variables[0]*variables[0]);
-            grad[36] = 0 + (4*variables[2]*variables[2]*variables[2]);
-            grad[37] = 0 + (1*variables[0]*variables[0]*variables[1] + 2*variables[0]*variables[1]*variables[2] + 1*variables[0]*variables[1]*variables[1]);
-            grad[38] = 0 + (1*variables[0]*variables[0]*variables[0] + 3*variables[0]*variables[2]*variables[2] + 1*variables[1]*variables[1]*variables[1] + 3*variables[1]*variables[2]*variables[2]);
-            grad[39] = 0 + (2*variables[0]*variables[0]*variables[2] + 2*variables[1]*variables[1]*variables[2]);
-            grad[40] = 0 + (2*variables[0]*variables[0]*variables[1]*variables[2] + 2*variables[0]*variables[1]*variables[1]*variables[2] + 1*variables[0]*variables[0]*variables[1]*variables[1]);
-            grad[41] = 0 + (1*variables[1]*variables[1]*variables[1]*variables[1] + 1*variables[0]*variables[0]*variables[0]*variables[0] + 4*variables[0]*variables[2]*variables[2]*variables[2] + 4*variables[1]*variables[2]*variables[2]*variables[2]);
-            grad[42] = 0 + (5*variables[2]*variables[2]*variables[2]*variables[2]);
-            grad[43] = 0 + (1*variables[0]*variables[1]*variables[1]*variables[1] + 3*variables[0]*variables[1]*variables[2]*variables[2] + 1*variables[0]*variables[0]*variables[0]*variables[1]);
-            grad[44] = 0 + (2*variables[1]*variables[1]*variables[1]*variables[2] + 3*variables[1]*variables[1]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[0]*variables[0]*variables[2]);
+            const double x0 = variables[0];
+            const double x1 = variables[1];
+            const double x2 = variables[2];
+            const double p_0_0_2 = x2*x2;
+            const double p_0_1_1 = x1*x2;
+            const double p_0_2_0 = x1*x1;
+            const double p_1_0_1 = x0*x2;
+            const double p_1_1_0 = x0*x1;
+            const double p_2_0_0 = x0*x0;
+            const double p_0_0_3 = p_0_0_2*x2;
+            const double p_0_1_2 = p_0_1_1*x2;
+            const double p_0_2_1 = p_0_2_0*x2;
+            const double p_0_3_0 = p_0_2_0*x1;
+            const double p_1_0_2 = p_1_0_1*x2;
+            const double p_1_1_1 = p_1_1_0*x2;
+            const double p_1_2_0 = p_1_1_0*x1;
+            const double p_2_0_1 = p_2_0_0*x2;
+            const double p_2_1_0 = p_2_0_0*x1;
+            const double p_3_0_0 = p_2_0_0*x0;
+            const double p_0_0_4 = p_0_0_3*x2;
+            const double p_0_1_3 = p_0_1_2*x2;
+            const double p_0_2_2 = p_0_2_1*x2;
+            const double p_0_3_1 = p_0_3_0*x2;
+            const double p_0_4_0 = p_0_3_0*x1;
+            const double p_1_0_3 = p_1_0_2*x2;
+            const double p_1_1_2 = p_1_1_1*x2;
+            const double p_1_2_1 = p_1_2_0*x2;
+            const double p_1_3_0 = p_1_2_0*x1;
+            const double p_2_0_2 = p_2_0_1*x2;
+            const double p_2_1_1 = p_2_1_0*x2;
+            const double p_2_2_0 = p_2_1_0*x1;
+            const double p_3_0_1 = p_3_0_0*x2;
+            const double p_3_1_0 = p_3_0_0*x1;
+            const double p_4_0_0 = p_3_0_0*x0;
+            grad[0] = 1;
+            grad[1] = 2*x0;
+            grad[2] = x2 + x1;
+            grad[3] = p_0_1_1;
+            grad[4] = 3*p_2_0_0;
+            grad[5] = p_0_0_2 + p_0_2_0 + 2*p_1_1_0 + 2*p_1_0_1;
+            grad[6] = 4*p_3_0_0;
+            grad[7] = 2*p_1_1_1 + p_0_1_2 + p_0_2_1;
+            grad[8] = 3*p_2_0_1 + p_0_0_3 + 3*p_2_1_0 + p_0_3_0;
+            grad[9] = 2*p_1_0_2 + 2*p_1_2_0;
+            grad[10] = 2*p_1_1_2 + p_0_2_2 + 2*p_1_2_1;
+            grad[11] = 4*p_3_0_1 + p_0_0_4 + 4*p_3_1_0 + p_0_4_0;
+            grad[12] = 5*p_4_0_0;
+            grad[13] = p_0_3_1 + p_0_1_3 + 3*p_2_1_1;
+            grad[14] = 2*p_1_3_0 + 2*p_1_0_3 + 3*p_2_2_0 + 3*p_2_0_2;
+            grad[15] = 1;
+            grad[16] = 2*x1;
+            grad[17] = x2 + x0;
+            grad[18] = p_1_0_1;
+            grad[19] = 3*p_0_2_0;
+            grad[20] = 2*p_1_1_0 + p_0_0_2 + p_2_0_0 + 2*p_0_1_1;
+            grad[21] = 4*p_0_3_0;
+            grad[22] = p_2_0_1 + p_1_0_2 + 2*p_1_1_1;
+            grad[23] = p_3_0_0 + 3*p_1_2_0 + 3*p_0_2_1 + p_0_0_3;
+            grad[24] = 2*p_0_1_2 + 2*p_2_1_0;
+            grad[25] = p_2_0_2 + 2*p_1_1_2 + 2*p_2_1_1;
+            grad[26] = 4*p_0_3_1 + p_4_0_0 + p_0_0_4 + 4*p_1_3_0;
+            grad[27] = 5*p_0_4_0;
+            grad[28] = 3*p_1_2_1 + p_1_0_3 + p_3_0_1;
+            grad[29] = 3*p_0_2_2 + 2*p_0_1_3 + 3*p_2_2_0 + 2*p_3_1_0;
+            grad[30] = 1;
+            grad[31] = 2*x2;
+            grad[32] = x1 + x0;
+            grad[33] = p_1_1_0;
+            grad[34] = 3*p_0_0_2;
+            grad[35] = 2*p_1_0_1 + 2*p_0_1_1 + p_0_2_0 + p_2_0_0;
+            grad[36] = 4*p_0_0_3;
+            grad[37] = p_2_1_0 + 2*p_1_1_1 + p_1_2_0;
+            grad[38] = p_3_0_0 + 3*p_1_0_2 + p_0_3_0 + 3*p_0_1_2;
+            grad[39] = 2*p_2_0_1 + 2*p_0_2_1;
+            grad[40] = 2*p_2_1_1 + 2*p_1_2_1 + p_2_2_0;
+            grad[41] = p_0_4_0 + p_4_0_0 + 4*p_1_0_3 + 4*p_0_1_3;
+            grad[42] = 5*p_0_0_4;
+            grad[43] = p_1_3_0 + 3*p_1_1_2 + p_3_1_0;
+            grad[44] = 2*p_0_3_1 + 3*p_0_2_2 + 3*p_2_0_2 + 2*p_3_0_1;
             return grad;
         }
 
@@ -186,297 +394,1060 @@ class OW_OW_OW_OW : public Polynomial {
 
         OW_OW_OW_OW() : Polynomial(OW_OW_OW_OW::get_system(), "OW_OW_OW_OW", 39, 1, OW_OW_OW_OW::get_nl_param_indices(), new CoarseGrainSwitch(4, 1.0, 3.0)) {}
 
-        std::vector<double> eval_terms_from_variables(const std::vector<double>& variables) const {
-            std::vector<double> terms(39);
-            terms[0] = variables[0] + variables[4] + variables[1] + variables[2] + variables[3] + variables[5];
-            terms[1] = variables[0]*variables[5] + variables[1]*variables[4] + variables[2]*variables[3];
-            terms[2] = variables[4]*variables[5] + variables[2]*variables[4] + variables[0]*variables[2] + variables[2]*variables[5] + variables[1]*variables[3] + variables[0]*variables[4] + variables[1]*variables[5] + variables[1]*variables[2] + variables[3]*variables[5] + variables[3]*variables[4] + variables[0]*variables[1] + variables[0]*variables[3];
-            terms[3] = variables[4]*variables[4] + variables[3]*variables[3] + variables[1]*variables[1] + variables[5]*variables[5] + variables[2]*variables[2] + variables[0]*variables[0];
-            terms[4] = variables[0]*variables[0]*variables[5] + variables[0]*variables[5]*variables[5] + variables[2]*variables[2]*variables[3] + variables[1]*variables[4]*variables[4] + variables[2]*variables[3]*variables[3] + variables[1]*variables[1]*variables[4];
-            terms[5] = variables[0]*variables[0]*variables[0] + variables[4]*variables[4]*variables[4] + variables[2]*variables[2]*variables[2] + variables[1]*variables[1]*variables[1] + variables[3]*variables[3]*variables[3] + variables[5]*variables[5]*variables[5];
-            terms[6] = variables[0]*variables[3]*variables[4] + variables[1]*variables[3]*variables[5] + variables[2]*variables[4]*variables[5] + variables[0]*variables[1]*variables[2];
-            terms[7] = variables[0]*variables[0]*variables[3] + variables[0]*variables[0]*variables[2] + variables[1]*variables[3]*variables[3] + variables[0]*variables[1]*variables[1] + variables[0]*variables[0]*variables[1] + variables[2]*variables[2]*variables[5] + variables[1]*variables[2]*variables[2] + variables[2]*variables[4]*variables[4] + variables[0]*variables[3]*variables[3] + variables[0]*variables[2]*variables[2] + variables[3]*variables[3]*variables[4] + variables[4]*variables[4]*variables[5] + variables[1]*variables[5]*variables[5] + variables[3]*variables[4]*variables[4] + variables[3]*variables[3]*variables[5] + variables[0]*variables[0]*variables[4] + variables[3]*variables[5]*variables[5] + variables[4]*variables[5]*variables[5] + variables[1]*variables[1]*variables[5] + variables[2]*variables[2]*variables[4] + variables[2]*variables[5]*variables[5] + variables[1]*variables[1]*variables[2] + variables[0]*variables[4]*variables[4] + variables[1]*variables[1]*variables[3];
-            terms[8] = variables[0]*variables[1]*variables[3] + variables[0]*variables[2]*variables[4] + variables[1]*variables[2]*variables[5] + variables[3]*variables[4]*variables[5];
-            terms[9] = variables[1]*variables[2]*variables[4] + variables[1]*variables[4]*variables[5] + variables[2]*variables[3]*variables[4] + variables[2]*variables[3]*variables[5] + variables[0]*variables[2]*variables[3] + variables[0]*variables[2]*variables[5] + variables[1]*variables[2]*variables[3] + variables[0]*variables[4]*variables[5] + variables[1]*variables[3]*variables[4] + variables[0]*variables[3]*variables[5] + variables[0]*variables[1]*variables[4] + variables[0]*variables[1]*variables[5];
-            terms[10] = variables[0]*variables[1]*variables[4]*variables[5] + variables[0]*variables[2]*variables[3]*variables[5] + variables[1]*variables[2]*variables[3]*variables[4];
-            terms[11] = variables[1]*variables[1]*variables[4]*variables[4] + variables[2]*variables[2]*variables[3]*variables[3] + variables[0]*variables[0]*variables[5]*variables[5];
-            terms[12] = variables[1]*variables[3]*variables[5]*variables[5] + variables[0]*variables[1]*variables[2]*variables[2] + variables[0]*variables[0]*variables[3]*variables[4] + variables[0]*variables[3]*variables[3]*variables[4] + variables[2]*variables[4]*variables[4]*variables[5] + variables[0]*variables[0]*variables[1]*variables[2] + variables[0]*variables[3]*variables[4]*variables[4] + variables[2]*variables[4]*variables[5]*variables[5] + variables[1]*variables[1]*variables[3]*variables[5] + variables[1]*variables[3]*variables[3]*variables[5] + variables[2]*variables[2]*variables[4]*variables[5] + variables[0]*variables[1]*variables[1]*variables[2];
-            terms[13] = variables[1]*variables[2]*variables[3]*variables[5] + variables[1]*variables[2]*variables[4]*variables[5] + variables[1]*variables[3]*variables[4]*variables[5] + variables[0]*variables[1]*variables[3]*variables[5] + variables[0]*variables[1]*variables[2]*variables[3] + variables[0]*variables[2]*variables[3]*variables[4] + variables[0]*variables[2]*variables[4]*variables[5] + variables[0]*variables[1]*variables[2]*variables[5] + variables[0]*variables[3]*variables[4]*variables[5] + variables[0]*variables[1]*variables[3]*variables[4] + variables[2]*variables[3]*variables[4]*variables[5] + variables[0]*variables[1]*variables[2]*variables[4];
-            terms[14] = variables[2]*variables[3]*variables[3]*variables[3] + variables[2]*variables[2]*variables[2]*variables[3] + variables[0]*variables[5]*variables[5]*variables[5] + variables[1]*variables[1]*variables[1]*variables[4] + variables[0]*variables[0]*variables[0]*variables[5] + variables[1]*variables[4]*variables[4]*variables[4];
-            terms[15] = variables[0]*variables[1]*variables[1]*variables[1] + variables[4]*variables[5]*variables[5]*variables[5] + variables[0]*variables[0]*variables[0]*variables[3] + variables[3]*variables[3]*variables[3]*variables[4] + variables[3]*variables[3]*variables[3]*variables[5] + variables[1]*variables[1]*variables[1]*variables[3] + variables[1]*variables[3]*variables[3]*variables[3] + variables[3]*variables[5]*variables[5]*variables[5] + variables[2]*variables[4]*variables[4]*variables[4] + variables[1]*variables[2]*variables[2]*variables[2] + variables[1]*variables[1]*variables[1]*variables[5] + variables[1]*variables[5]*variables[5]*variables[5] + variables[2]*variables[2]*variables[2]*variables[4] + variables[4]*variables[4]*variables[4]*variables[5] + variables[0]*variables[3]*variables[3]*variables[3] + variables[1]*variables[1]*variables[1]*variables[2] + variables[0]*variables[0]*variables[0]*variables[2] + variables[0]*variables[4]*variables[4]*variables[4] + variables[0]*variables[0]*variables[0]*variables[4] + variables[3]*variables[4]*variables[4]*variables[4] + variables[2]*variables[5]*variables[5]*variables[5] + variables[0]*variables[2]*variables[2]*variables[2] + variables[0]*variables[0]*variables[0]*variables[1] + variables[2]*variables[2]*variables[2]*variables[5];
-            terms[16] = variables[1]*variables[1]*variables[3]*variables[3] + variables[1]*variables[1]*variables[5]*variables[5] + variables[2]*variables[2]*variables[5]*variables[5] + variables[0]*variables[0]*variables[2]*variables[2] + variables[1]*variables[1]*variables[2]*variables[2] + variables[4]*variables[4]*variables[5]*variables[5] + variables[0]*variables[0]*variables[4]*variables[4] + variables[0]*variables[0]*variables[1]*variables[1] + variables[3]*variables[3]*variables[4]*variables[4] + variables[0]*variables[0]*variables[3]*variables[3] + variables[2]*variables[2]*variables[4]*variables[4] + variables[3]*variables[3]*variables[5]*variables[5];
-            terms[17] = variables[0]*variables[1]*variables[1]*variables[5] + variables[0]*variables[2]*variables[2]*variables[5] + variables[2]*variables[3]*variables[5]*variables[5] + variables[0]*variables[4]*variables[4]*variables[5] + variables[1]*variables[3]*variables[3]*variables[4] + variables[1]*variables[1]*variables[2]*variables[3] + variables[2]*variables[3]*variables[4]*variables[4] + variables[1]*variables[4]*variables[5]*variables[5] + variables[0]*variables[0]*variables[1]*variables[4] + variables[1]*variables[2]*variables[2]*variables[4] + variables[0]*variables[3]*variables[3]*variables[5] + variables[0]*variables[0]*variables[2]*variables[3];
-            terms[18] = variables[1]*variables[2]*variables[2]*variables[3] + variables[2]*variables[2]*variables[3]*variables[5] + variables[0]*variables[2]*variables[3]*variables[3] + variables[0]*variables[0]*variables[1]*variables[5] + variables[0]*variables[0]*variables[2]*variables[5] + variables[2]*variables[3]*variables[3]*variables[5] + variables[0]*variables[0]*variables[3]*variables[5] + variables[0]*variables[4]*variables[5]*variables[5] + variables[2]*variables[3]*variables[3]*variables[4] + variables[1]*variables[2]*variables[3]*variables[3] + variables[2]*variables[2]*variables[3]*variables[4] + variables[0]*variables[0]*variables[4]*variables[5] + variables[1]*variables[3]*variables[4]*variables[4] + variables[1]*variables[1]*variables[4]*variables[5] + variables[0]*variables[3]*variables[5]*variables[5] + variables[0]*variables[1]*variables[1]*variables[4] + variables[0]*variables[2]*variables[5]*variables[5] + variables[0]*variables[2]*variables[2]*variables[3] + variables[1]*variables[2]*variables[4]*variables[4] + variables[1]*variables[1]*variables[3]*variables[4] + variables[0]*variables[1]*variables[4]*variables[4] + variables[1]*variables[1]*variables[2]*variables[4] + variables[1]*variables[4]*variables[4]*variables[5] + variables[0]*variables[1]*variables[5]*variables[5];
-            terms[19] = variables[1]*variables[1]*variables[1]*variables[1] + variables[2]*variables[2]*variables[2]*variables[2] + variables[5]*variables[5]*variables[5]*variables[5] + variables[3]*variables[3]*variables[3]*variables[3] + variables[4]*variables[4]*variables[4]*variables[4] + variables[0]*variables[0]*variables[0]*variables[0];
-            terms[20] = variables[0]*variables[0]*variables[2]*variables[4] + variables[0]*variables[2]*variables[4]*variables[4] + variables[1]*variables[2]*variables[2]*variables[5] + variables[3]*variables[4]*variables[4]*variables[5] + variables[0]*variables[1]*variables[1]*variables[3] + variables[3]*variables[3]*variables[4]*variables[5] + variables[1]*variables[2]*variables[5]*variables[5] + variables[3]*variables[4]*variables[5]*variables[5] + variables[0]*variables[2]*variables[2]*variables[4] + variables[1]*variables[1]*variables[2]*variables[5] + variables[0]*variables[1]*variables[3]*variables[3] + variables[0]*variables[0]*variables[1]*variables[3];
-            terms[21] = variables[0]*variables[2]*variables[4]*variables[4]*variables[4] + variables[0]*variables[0]*variables[0]*variables[1]*variables[3] + variables[1]*variables[2]*variables[2]*variables[2]*variables[5] + variables[3]*variables[3]*variables[3]*variables[4]*variables[5] + variables[1]*variables[2]*variables[5]*variables[5]*variables[5] + variables[3]*variables[4]*variables[5]*variables[5]*variables[5] + variables[0]*variables[0]*variables[0]*variables[2]*variables[4] + variables[3]*variables[4]*variables[4]*variables[4]*variables[5] + variables[0]*variables[2]*variables[2]*variables[2]*variables[4] + variables[1]*variables[1]*variables[1]*variables[2]*variables[5] + variables[0]*variables[1]*variables[3]*variables[3]*variables[3] + variables[0]*variables[1]*variables[1]*variables[1]*variables[3];
-            terms[22] = variables[0]*variables[3]*variables[4]*variables[4]*variables[5] + variables[2]*variables[3]*variables[4]*variables[4]*variables[5] + variables[1]*variables[1]*variables[2]*variables[3]*variables[5] + variables[0]*variables[1]*variables[2]*variables[2]*variables[5] + variables[1]*variables[3]*variables[4]*variables[5]*variables[5] + variables[0]*variables[0]*variables[1]*variables[2]*variables[3] + variables[2]*variables[3]*variables[4]*variables[5]*variables[5] + variables[1]*variables[3]*variables[3]*variables[4]*variables[5] + variables[1]*variables[2]*variables[3]*variables[5]*variables[5] + variables[0]*variables[1]*variables[1]*variables[2]*variables[3] + variables[0]*variables[1]*variables[1]*variables[2]*variables[5] + variables[0]*variables[1]*variables[3]*variables[3]*variables[5] + variables[0]*variables[0]*variables[1]*variables[3]*variables[4] + variables[0]*variables[0]*variables[1]*variables[2]*variables[4] + variables[0]*variables[2]*variables[4]*variables[4]*variables[5] + variables[1]*variables[2]*variables[4]*variables[5]*variables[5] + variables[0]*variables[2]*variables[2]*variables[4]*variables[5] + variables[0]*variables[1]*variables[2]*variables[2]*variables[4] + variables[0]*variables[2]*variables[3]*variables[4]*variables[4] + variables[1]*variables[2]*variables[2]*variables[4]*variables[5] + variables[0]*variables[1]*variables[3]*variables[3]*variables[4] + variables[0]*variables[0]*variables[2]*variables[3]*variables[4] + variables[0]*variables[1]*variables[1]*variables[3]*variables[5] + variables[0]*variables[3]*variables[3]*variables[4]*variables[5];
-            terms[23] = variables[0]*variables[0]*variables[0]*variables[5]*variables[5] + variables[1]*variables[1]*variables[4]*variables[4]*variables[4] + variables[2]*variables[2]*variables[3]*variables[3]*variables[3] + variables[0]*variables[0]*variables[5]*variables[5]*variables[5] + variables[1]*variables[1]*variables[1]*variables[4]*variables[4] + variables[2]*variables[2]*variables[2]*variables[3]*variables[3];
-            terms[24] = variables[3]*variables[5]*variables[5]*variables[5]*variables[5] + variables[2]*variables[2]*variables[2]*variables[2]*variables[5] + variables[0]*variables[3]*variables[3]*variables[3]*variables[3] + variables[1]*variables[5]*variables[5]*variables[5]*variables[5] + variables[1]*variables[2]*variables[2]*variables[2]*variables[2] + variables[2]*variables[2]*variables[2]*variables[2]*variables[4] + variables[1]*variables[1]*variables[1]*variables[1]*variables[5] + variables[4]*variables[4]*variables[4]*variables[4]*variables[5] + variables[0]*variables[2]*variables[2]*variables[2]*variables[2] + variables[1]*variables[3]*variables[3]*variables[3]*variables[3] + variables[4]*variables[5]*variables[5]*variables[5]*variables[5] + variables[3]*variables[3]*variables[3]*variables[3]*variables[5] + variables[0]*variables[0]*variables[0]*variables[0]*variables[2] + variables[0]*variables[1]*variables[1]*variables[1]*variables[1] + variables[0]*variables[0]*variables[0]*variables[0]*variables[4] + variables[0]*variables[0]*variables[0]*variables[0]*variables[1] + variables[0]*variables[0]*variables[0]*variables[0]*variables[3] + variables[3]*variables[4]*variables[4]*variables[4]*variables[4] + variables[3]*variables[3]*variables[3]*variables[3]*variables[4] + variables[1]*variables[1]*variables[1]*variables[1]*variables[2] + variables[2]*variables[4]*variables[4]*variables[4]*variables[4] + variables[1]*variables[1]*variables[1]*variables[1]*variables[3] + variables[0]*variables[4]*variables[4]*variables[4]*variables[4] + variables[2]*variables[5]*variables[5]*variables[5]*variables[5];
-            terms[25] = variables[1]*variables[1]*variables[2]*variables[5]*variables[5] + variables[0]*variables[0]*variables[2]*variables[2]*variables[4] + variables[3]*variables[3]*variables[4]*variables[4]*variables[5] + variables[0]*variables[0]*variables[1]*variables[1]*variables[3] + variables[1]*variables[2]*variables[2]*variables[5]*variables[5] + variables[3]*variables[4]*variables[4]*variables[5]*variables[5] + variables[3]*variables[3]*variables[4]*variables[5]*variables[5] + variables[1]*variables[1]*variables[2]*variables[2]*variables[5] + variables[0]*variables[1]*variables[1]*variables[3]*variables[3] + variables[0]*variables[0]*variables[2]*variables[4]*variables[4] + variables[0]*variables[0]*variables[1]*variables[3]*variables[3] + variables[0]*variables[2]*variables[2]*variables[4]*variables[4];
-            terms[26] = variables[1]*variables[1]*variables[3]*variables[3]*variables[5] + variables[0]*variables[0]*variables[3]*variables[4]*variables[4] + variables[2]*variables[2]*variables[4]*variables[4]*variables[5] + variables[0]*variables[3]*variables[3]*variables[4]*variables[4] + variables[0]*variables[0]*variables[1]*variables[1]*variables[2] + variables[0]*variables[1]*variables[1]*variables[2]*variables[2] + variables[1]*variables[1]*variables[3]*variables[5]*variables[5] + variables[0]*variables[0]*variables[3]*variables[3]*variables[4] + variables[2]*variables[4]*variables[4]*variables[5]*variables[5] + variables[2]*variables[2]*variables[4]*variables[5]*variables[5] + variables[0]*variables[0]*variables[1]*variables[2]*variables[2] + variables[1]*variables[3]*variables[3]*variables[5]*variables[5];
-            terms[27] = variables[0]*variables[1]*variables[3]*variables[4]*variables[5] + variables[1]*variables[2]*variables[3]*variables[4]*variables[5] + variables[0]*variables[1]*variables[2]*variables[4]*variables[5] + variables[0]*variables[1]*variables[2]*variables[3]*variables[4] + variables[0]*variables[1]*variables[2]*variables[3]*variables[5] + variables[0]*variables[2]*variables[3]*variables[4]*variables[5];
-            terms[28] = variables[0]*variables[2]*variables[2]*variables[2]*variables[5] + variables[0]*variables[3]*variables[3]*variables[3]*variables[5] + variables[1]*variables[3]*variables[3]*variables[3]*variables[4] + variables[0]*variables[4]*variables[4]*variables[4]*variables[5] + variables[0]*variables[0]*variables[0]*variables[1]*variables[4] + variables[1]*variables[4]*variables[5]*variables[5]*variables[5] + variables[1]*variables[1]*variables[1]*variables[2]*variables[3] + variables[2]*variables[3]*variables[4]*variables[4]*variables[4] + variables[0]*variables[1]*variables[1]*variables[1]*variables[5] + variables[0]*variables[0]*variables[0]*variables[2]*variables[3] + variables[2]*variables[3]*variables[5]*variables[5]*variables[5] + variables[1]*variables[2]*variables[2]*variables[2]*variables[4];
-            terms[29] = variables[1]*variables[1]*variables[3]*variables[3]*variables[4] + variables[0]*variables[4]*variables[4]*variables[5]*variables[5] + variables[0]*variables[0]*variables[2]*variables[2]*variables[3] + variables[1]*variables[3]*variables[3]*variables[4]*variables[4] + variables[0]*variables[0]*variables[1]*variables[1]*variables[5] + variables[0]*variables[2]*variables[2]*variables[5]*variables[5] + variables[0]*variables[0]*variables[1]*variables[1]*variables[4] + variables[1]*variables[4]*variables[4]*variables[5]*variables[5] + variables[0]*variables[0]*variables[2]*variables[2]*variables[5] + variables[1]*variables[1]*variables[2]*variables[3]*variables[3] + variables[1]*variables[2]*variables[2]*variables[4]*variables[4] + variables[1]*variables[1]*variables[2]*variables[2]*variables[3] + variables[0]*variables[3]*variables[3]*variables[5]*variables[5] + variables[0]*variables[0]*variables[4]*variables[4]*variables[5] + variables[1]*variables[1]*variables[4]*variables[5]*variables[5] + variables[2]*variables[2]*variables[3]*variables[4]*variables[4] + variables[0]*variables[0]*variables[1]*variables[4]*variables[4] + variables[0]*variables[0]*variables[3]*variables[3]*variables[5] + variables[0]*variables[1]*variables[1]*variables[5]*variables[5] + variables[0]*variables[0]*variables[2]*variables[3]*variables[3] + variables[2]*variables[3]*variables[3]*variables[4]*variables[4] + variables[1]*variables[1]*variables[2]*variables[2]*variables[4] + variables[2]*variables[2]*variables[3]*variables[5]*variables[5] + variables[2]*variables[3]*variables[3]*variables[5]*variables[5];
-            terms[30] = variables[1]*variables[1]*variables[2]*variables[4]*variables[5] + variables[1]*variables[3]*variables[4]*variables[4]*variables[5] + variables[0]*variables[2]*variables[2]*variables[3]*variables[4] + variables[0]*variables[0]*variables[1]*variables[3]*variables[5] + variables[2]*variables[3]*variables[3]*variables[4]*variables[5] + variables[0]*variables[1]*variables[2]*variables[4]*variables[4] + variables[0]*variables[3]*variables[4]*variables[5]*variables[5] + variables[0]*variables[1]*variables[1]*variables[3]*variables[4] + variables[0]*variables[1]*variables[2]*variables[3]*variables[3] + variables[1]*variables[2]*variables[2]*variables[3]*variables[5] + variables[0]*variables[1]*variables[2]*variables[5]*variables[5] + variables[0]*variables[0]*variables[2]*variables[4]*variables[5];
-            terms[31] = variables[2]*variables[3]*variables[3]*variables[3]*variables[5] + variables[1]*variables[2]*variables[4]*variables[4]*variables[4] + variables[0]*variables[0]*variables[0]*variables[2]*variables[5] + variables[0]*variables[1]*variables[4]*variables[4]*variables[4] + variables[0]*variables[1]*variables[5]*variables[5]*variables[5] + variables[2]*variables[2]*variables[2]*variables[3]*variables[4] + variables[0]*variables[3]*variables[5]*variables[5]*variables[5] + variables[1]*variables[1]*variables[1]*variables[2]*variables[4] + variables[0]*variables[1]*variables[1]*variables[1]*variables[4] + variables[0]*variables[0]*variables[0]*variables[3]*variables[5] + variables[1]*variables[2]*variables[3]*variables[3]*variables[3] + variables[1]*variables[1]*variables[1]*variables[4]*variables[5] + variables[1]*variables[4]*variables[4]*variables[4]*variables[5] + variables[0]*variables[4]*variables[5]*variables[5]*variables[5] + variables[1]*variables[3]*variables[4]*variables[4]*variables[4] + variables[0]*variables[2]*variables[2]*variables[2]*variables[3] + variables[1]*variables[1]*variables[1]*variables[3]*variables[4] + variables[2]*variables[2]*variables[2]*variables[3]*variables[5] + variables[1]*variables[2]*variables[2]*variables[2]*variables[3] + variables[0]*variables[0]*variables[0]*variables[1]*variables[5] + variables[2]*variables[3]*variables[3]*variables[3]*variables[4] + variables[0]*variables[0]*variables[0]*variables[4]*variables[5] + variables[0]*variables[2]*variables[3]*variables[3]*variables[3] + variables[0]*variables[2]*variables[5]*variables[5]*variables[5];
-            terms[32] = variables[0]*variables[0]*variables[3]*variables[4]*variables[5] + variables[0]*variables[1]*variables[2]*variables[2]*variables[3] + variables[2]*variables[2]*variables[3]*variables[4]*variables[5] + variables[1]*variables[1]*variables[3]*variables[4]*variables[5] + variables[0]*variables[0]*variables[1]*variables[2]*variables[5] + variables[0]*variables[1]*variables[3]*variables[4]*variables[4] + variables[0]*variables[2]*variables[3]*variables[3]*variables[4] + variables[0]*variables[1]*variables[1]*variables[2]*variables[4] + variables[1]*variables[2]*variables[4]*variables[4]*variables[5] + variables[1]*variables[2]*variables[3]*variables[3]*variables[5] + variables[0]*variables[1]*variables[3]*variables[5]*variables[5] + variables[0]*variables[2]*variables[4]*variables[5]*variables[5];
-            terms[33] = variables[1]*variables[2]*variables[2]*variables[3]*variables[4] + variables[0]*variables[2]*variables[2]*variables[3]*variables[5] + variables[0]*variables[0]*variables[2]*variables[3]*variables[5] + variables[1]*variables[2]*variables[3]*variables[3]*variables[4] + variables[0]*variables[1]*variables[4]*variables[4]*variables[5] + variables[1]*variables[1]*variables[2]*variables[3]*variables[4] + variables[0]*variables[2]*variables[3]*variables[3]*variables[5] + variables[0]*variables[1]*variables[4]*variables[5]*variables[5] + variables[0]*variables[0]*variables[1]*variables[4]*variables[5] + variables[0]*variables[2]*variables[3]*variables[5]*variables[5] + variables[1]*variables[2]*variables[3]*variables[4]*variables[4] + variables[0]*variables[1]*variables[1]*variables[4]*variables[5];
-            terms[34] = variables[1]*variables[1]*variables[1]*variables[1]*variables[4] + variables[1]*variables[4]*variables[4]*variables[4]*variables[4] + variables[0]*variables[0]*variables[0]*variables[0]*variables[5] + variables[2]*variables[2]*variables[2]*variables[2]*variables[3] + variables[0]*variables[5]*variables[5]*variables[5]*variables[5] + variables[2]*variables[3]*variables[3]*variables[3]*variables[3];
-            terms[35] = variables[4]*variables[4]*variables[4]*variables[5]*variables[5] + variables[0]*variables[0]*variables[0]*variables[3]*variables[3] + variables[3]*variables[3]*variables[3]*variables[5]*variables[5] + variables[3]*variables[3]*variables[3]*variables[4]*variables[4] + variables[3]*variables[3]*variables[4]*variables[4]*variables[4] + variables[3]*variables[3]*variables[5]*variables[5]*variables[5] + variables[0]*variables[0]*variables[0]*variables[2]*variables[2] + variables[1]*variables[1]*variables[1]*variables[3]*variables[3] + variables[1]*variables[1]*variables[2]*variables[2]*variables[2] + variables[2]*variables[2]*variables[2]*variables[5]*variables[5] + variables[2]*variables[2]*variables[4]*variables[4]*variables[4] + variables[1]*variables[1]*variables[1]*variables[5]*variables[5] + variables[2]*variables[2]*variables[5]*variables[5]*variables[5] + variables[2]*variables[2]*variables[2]*variables[4]*variables[4] + variables[0]*variables[0]*variables[1]*variables[1]*variables[1] + variables[1]*variables[1]*variables[5]*variables[5]*variables[5] + variables[1]*variables[1]*variables[1]*variables[2]*variables[2] + variables[0]*variables[0]*variables[0]*variables[1]*variables[1] + variables[0]*variables[0]*variables[4]*variables[4]*variables[4] + variables[0]*variables[0]*variables[2]*variables[2]*variables[2] + variables[0]*variables[0]*variables[0]*variables[4]*variables[4] + variables[0]*variables[0]*variables[3]*variables[3]*variables[3] + variables[1]*variables[1]*variables[3]*variables[3]*variables[3] + variables[4]*variables[4]*variables[5]*variables[5]*variables[5];
-            terms[36] = variables[0]*variables[1]*variables[1]*variables[4]*variables[4] + variables[0]*variables[0]*variables[4]*variables[5]*variables[5] + variables[1]*variables[1]*variables[3]*variables[4]*variables[4] + variables[1]*variables[2]*variables[2]*variables[3]*variables[3] + variables[0]*variables[0]*variables[2]*variables[5]*variables[5] + variables[0]*variables[0]*variables[3]*variables[5]*variables[5] + variables[1]*variables[1]*variables[2]*variables[4]*variables[4] + variables[0]*variables[2]*variables[2]*variables[3]*variables[3] + variables[2]*variables[2]*variables[3]*variables[3]*variables[4] + variables[0]*variables[0]*variables[1]*variables[5]*variables[5] + variables[1]*variables[1]*variables[4]*variables[4]*variables[5] + variables[2]*variables[2]*variables[3]*variables[3]*variables[5];
-            terms[37] = variables[5]*variables[5]*variables[5]*variables[5]*variables[5] + variables[1]*variables[1]*variables[1]*variables[1]*variables[1] + variables[2]*variables[2]*variables[2]*variables[2]*variables[2] + variables[4]*variables[4]*variables[4]*variables[4]*variables[4] + variables[3]*variables[3]*variables[3]*variables[3]*variables[3] + variables[0]*variables[0]*variables[0]*variables[0]*variables[0];
-            terms[38] = variables[0]*variables[3]*variables[3]*variables[3]*variables[4] + variables[1]*variables[3]*variables[3]*variables[3]*variables[5] + variables[0]*variables[1]*variables[1]*variables[1]*variables[2] + variables[2]*variables[2]*variables[2]*variables[4]*variables[5] + variables[1]*variables[3]*variables[5]*variables[5]*variables[5] + variables[2]*variables[4]*variables[4]*variables[4]*variables[5] + variables[0]*variables[1]*variables[2]*variables[2]*variables[2] + variables[1]*variables[1]*variables[1]*variables[3]*variables[5] + variables[0]*variables[0]*variables[0]*variables[3]*variables[4] + variables[2]*variables[4]*variables[5]*variables[5]*variables[5] + variables[0]*variables[0]*variables[0]*variables[1]*variables[2] + variables[0]*variables[3]*variables[4]*variables[4]*variables[4];
-            return terms;
+        void eval_terms_from_variables(const double* variables, double* terms) const {
+            const double x0 = variables[0];
+            const double x1 = variables[1];
+            const double x2 = variables[2];
+            const double x3 = variables[3];
+            const double x4 = variables[4];
+            const double x5 = variables[5];
+            const double p_0_0_0_0_0_2 = x5*x5;
+            const double p_0_0_0_0_1_1 = x4*x5;
+            const double p_0_0_0_0_2_0 = x4*x4;
+            const double p_0_0_0_1_0_1 = x3*x5;
+            const double p_0_0_0_1_1_0 = x3*x4;
+            const double p_0_0_0_2_0_0 = x3*x3;
+            const double p_0_0_1_0_0_1 = x2*x5;
+            const double p_0_0_1_0_1_0 = x2*x4;
+            const double p_0_0_1_1_0_0 = x2*x3;
+            const double p_0_0_2_0_0_0 = x2*x2;
+            const double p_0_1_0_0_0_1 = x1*x5;
+            const double p_0_1_0_0_1_0 = x1*x4;
+            const double p_0_1_0_1_0_0 = x1*x3;
+            const double p_0_1_1_0_0_0 = x1*x2;
+            const double p_0_2_0_0_0_0 = x1*x1;
+            const double p_1_0_0_0_0_1 = x0*x5;
+            const double p_1_0_0_0_1_0 = x0*x4;
+            const double p_1_0_0_1_0_0 = x0*x3;
+            const double p_1_0_1_0_0_0 = x0*x2;
+            const double p_1_1_0_0_0_0 = x0*x1;
+            const double p_2_0_0_0_0_0 = x0*x0;
+            const double p_0_0_0_0_0_3 = p_0_0_0_0_0_2*x5;
+            const double p_0_0_0_0_1_2 = p_0_0_0_0_1_1*x5;
+            const double p_0_0_0_0_2_1 = p_0_0_0_0_2_0*x5;
+            const double p_0_0_0_0_3_0 = p_0_0_0_0_2_0*x4;
+            const double p_0_0_0_1_0_2 = p_0_0_0_1_0_1*x5;
+            const double p_0_0_0_1_1_1 = p_0_0_0_1_1_0*x5;
+            const double p_0_0_0_1_2_0 = p_0_0_0_1_1_0*x4;
+            const double p_0_0_0_2_0_1 = p_0_0_0_2_0_0*x5;
+            const double p_0_0_0_2_1_0 = p_0_0_0_2_0_0*x4;
+            const double p_0_0_0_3_0_0 = p_0_0_0_2_0_0*x3;
+            const double p_0_0_1_0_0_2 = p_0_0_1_0_0_1*x5;
+            const double p_0_0_1_0_1_1 = p_0_0_1_0_1_0*x5;
+            const double p_0_0_1_0_2_0 = p_0_0_1_0_1_0*x4;
+            const double p_0_0_1_1_0_1 = p_0_0_1_1_0_0*x5;
+            const double p_0_0_1_1_1_0 = p_0_0_1_1_0_0*x4;
+            const double p_0_0_1_2_0_0 = p_0_0_1_1_0_0*x3;
+            const double p_0_0_2_0_0_1 = p_0_0_2_0_0_0*x5;
+            const double p_0_0_2_0_1_0 = p_0_0_2_0_0_0*x4;
+            const double p_0_0_2_1_0_0 = p_0_0_2_0_0_0*x3;
+            const double p_0_0_3_0_0_0 = p_0_0_2_0_0_0*x2;
+            const double p_0_1_0_0_0_2 = p_0_1_0_0_0_1*x5;
+            const double p_0_1_0_0_1_1 = p_0_1_0_0_1_0*x5;
+            const double p_0_1_0_0_2_0 = p_0_1_0_0_1_0*x4;
+            const double p_0_1_0_1_0_1 = p_0_1_0_1_0_0*x5;
+            const double p_0_1_0_1_1_0 = p_0_1_0_1_0_0*x4;
+            const double p_0_1_0_2_0_0 = p_0_1_0_1_0_0*x3;
+            const double p_0_1_1_0_0_1 = p_0_1_1_0_0_0*x5;
+            const double p_0_1_1_0_1_0 = p_0_1_1_0_0_0*x4;
+            const double p_0_1_1_1_0_0 = p_0_1_1_0_0_0*x3;
+            const double p_0_1_2_0_0_0 = p_0_1_1_0_0_0*x2;
+            const double p_0_2_0_0_0_1 = p_0_2_0_0_0_0*x5;
+            const double p_0_2_0_0_1_0 = p_0_2_0_0_0_0*x4;
+            const double p_0_2_0_1_0_0 = p_0_2_0_0_0_0*x3;
+            const double p_0_2_1_0_0_0 = p_0_2_0_0_0_0*x2;
+            const double p_0_3_0_0_0_0 = p_0_2_0_0_0_0*x1;
+            const double p_1_0_0_0_0_2 = p_1_0_0_0_0_1*x5;
+            const double p_1_0_0_0_1_1 = p_1_0_0_0_1_0*x5;
+            const double p_1_0_0_0_2_0 = p_1_0_0_0_1_0*x4;
+            const double p_1_0_0_1_0_1 = p_1_0_0_1_0_0*x5;
+            const double p_1_0_0_1_1_0 = p_1_0_0_1_0_0*x4;
+            const double p_1_0_0_2_0_0 = p_1_0_0_1_0_0*x3;
+            const double p_1_0_1_0_0_1 = p_1_0_1_0_0_0*x5;
+            const double p_1_0_1_0_1_0 = p_1_0_1_0_0_0*x4;
+            const double p_1_0_1_1_0_0 = p_1_0_1_0_0_0*x3;
+            const double p_1_0_2_0_0_0 = p_1_0_1_0_0_0*x2;
+            const double p_1_1_0_0_0_1 = p_1_1_0_0_0_0*x5;
+            const double p_1_1_0_0_1_0 = p_1_1_0_0_0_0*x4;
+            const double p_1_1_0_1_0_0 = p_1_1_0_0_0_0*x3;
+            const double p_1_1_1_0_0_0 = p_1_1_0_0_0_0*x2;
+            const double p_1_2_0_0_0_0 = p_1_1_0_0_0_0*x1;
+            const double p_2_0_0_0_0_1 = p_2_0_0_0_0_0*x5;
+            const double p_2_0_0_0_1_0 = p_2_0_0_0_0_0*x4;
+            const double p_2_0_0_1_0_0 = p_2_0_0_0_0_0*x3;
+            const double p_2_0_1_0_0_0 = p_2_0_0_0_0_0*x2;
+            const double p_2_1_0_0_0_0 = p_2_0_0_0_0_0*x1;
+            const double p_3_0_0_0_0_0 = p_2_0_0_0_0_0*x0;
+            const double p_0_0_0_0_0_4 = p_0_0_0_0_0_3*x5;
+            const double p_0_0_0_0_1_3 = p_0_0_0_0_1_2*x5;
+            const double p_0_0_0_0_2_2 = p_0_0_0_0_2_1*x5;
+            const double p_0_0_0_0_3_1 = p_0_0_0_0_3_0*x5;
+            const double p_0_0_0_0_4_0 = p_0_0_0_0_3_0*x4;
+            const double p_0_0_0_1_0_3 = p_0_0_0_1_0_2*x5;
+            const double p_0_0_0_1_1_2 = p_0_0_0_1_1_1*x5;
+            const double p_0_0_0_1_2_1 = p_0_0_0_1_2_0*x5;
+            const double p_0_0_0_1_3_0 = p_0_0_0_1_2_0*x4;
+            const double p_0_0_0_2_0_2 = p_0_0_0_2_0_1*x5;
+            const double p_0_0_0_2_1_1 = p_0_0_0_2_1_0*x5;
+            const double p_0_0_0_2_2_0 = p_0_0_0_2_1_0*x4;
+            const double p_0_0_0_3_0_1 = p_0_0_0_3_0_0*x5;
+            const double p_0_0_0_3_1_0 = p_0_0_0_3_0_0*x4;
+            const double p_0_0_0_4_0_0 = p_0_0_0_3_0_0*x3;
+            const double p_0_0_1_0_0_3 = p_0_0_1_0_0_2*x5;
+            const double p_0_0_1_0_1_2 = p_0_0_1_0_1_1*x5;
+            const double p_0_0_1_0_2_1 = p_0_0_1_0_2_0*x5;
+            const double p_0_0_1_0_3_0 = p_0_0_1_0_2_0*x4;
+            const double p_0_0_1_1_0_2 = p_0_0_1_1_0_1*x5;
+            const double p_0_0_1_1_1_1 = p_0_0_1_1_1_0*x5;
+            const double p_0_0_1_1_2_0 = p_0_0_1_1_1_0*x4;
+            const double p_0_0_1_2_0_1 = p_0_0_1_2_0_0*x5;
+            const double p_0_0_1_2_1_0 = p_0_0_1_2_0_0*x4;
+            const double p_0_0_1_3_0_0 = p_0_0_1_2_0_0*x3;
+            const double p_0_0_2_0_0_2 = p_0_0_2_0_0_1*x5;
+            const double p_0_0_2_0_1_1 = p_0_0_2_0_1_0*x5;
+            const double p_0_0_2_0_2_0 = p_0_0_2_0_1_0*x4;
+            const double p_0_0_2_1_0_1 = p_0_0_2_1_0_0*x5;
+            const double p_0_0_2_1_1_0 = p_0_0_2_1_0_0*x4;
+            const double p_0_0_2_2_0_0 = p_0_0_2_1_0_0*x3;
+            const double p_0_0_3_0_0_1 = p_0_0_3_0_0_0*x5;
+            const double p_0_0_3_0_1_0 = p_0_0_3_0_0_0*x4;
+            const double p_0_0_3_1_0_0 = p_0_0_3_0_0_0*x3;
+            const double p_0_0_4_0_0_0 = p_0_0_3_0_0_0*x2;
+            const double p_0_1_0_0_0_3 = p_0_1_0_0_0_2*x5;
+            const double p_0_1_0_0_1_2 = p_0_1_0_0_1_1*x5;
+            const double p_0_1_0_0_2_1 = p_0_1_0_0_2_0*x5;
+            const double p_0_1_0_0_3_0 = p_0_1_0_0_2_0*x4;
+            const double p_0_1_0_1_0_2 = p_0_1_0_1_0_1*x5;
+            const double p_0_1_0_1_1_1 = p_0_1_0_1_1_0*x5;
+            const double p_0_1_0_1_2_0 = p_0_1_0_1_1_0*x4;
+            const double p_0_1_0_2_0_1 = p_0_1_0_2_0_0*x5;
+            const double p_0_1_0_2_1_0 = p_0_1_0_2_0_0*x4;
+            const double p_0_1_0_3_0_0 = p_0_1_0_2_0_0*x3;
+            const double p_0_1_1_0_0_2 = p_0_1_1_0_0_1*x5;
+            const double p_0_1_1_0_1_1 = p_0_1_1_0_1_0*x5;
+            const double p_0_1_1_0_2_0 = p_0_1_1_0_1_0*x4;
+            const double p_0_1_1_1_0_1 = p_0_1_1_1_0_0*x5;
+            const double p_0_1_1_1_1_0 = p_0_1_1_1_0_0*x4;
+            const double p_0_1_1_2_0_0 = p_0_1_1_1_0_0*x3;
+            const double p_0_1_2_0_0_1 = p_0_1_2_0_0_0*x5;
+            const double p_0_1_2_0_1_0 = p_0_1_2_0_0_0*x4;
+            const double p_0_1_2_1_0_0 = p_0_1_2_0_0_0*x3;
+            const double p_0_1_3_0_0_0 = p_0_1_2_0_0_0*x2;
+            const double p_0_2_0_0_0_2 = p_0_2_0_0_0_1*x5;
+            const double p_0_2_0_0_1_1 = p_0_2_0_0_1_0*x5;
+            const double p_0_2_0_0_2_0 = p_0_2_0_0_1_0*x4;
+            const double p_0_2_0_1_0_1 = p_0_2_0_1_0_0*x5;
+            const double p_0_2_0_1_1_0 = p_0_2_0_1_0_0*x4;
+            const double p_0_2_0_2_0_0 = p_0_2_0_1_0_0*x3;
+            const double p_0_2_1_0_0_1 = p_0_2_1_0_0_0*x5;
+            const double p_0_2_1_0_1_0 = p_0_2_1_0_0_0*x4;
+            const double p_0_2_1_1_0_0 = p_0_2_1_0_0_0*x3;
+            const double p_0_2_2_0_0_0 = p_0_2_1_0_0_0*x2;
+            const double p_0_3_0_0_0_1 = p_0_3_0_0_0_0*x5;
+            const double p_0_3_0_0_1_0 = p_0_3_0_0_0_0*x4;
+            const double p_0_3_0_1_0_0 = p_0_3_0_0_0_0*x3;
+            const double p_0_3_1_0_0_0 = p_0_3_0_0_0_0*x2;
+            const double p_0_4_0_0_0_0 = p_0_3_0_0_0_0*x1;
+            const double p_1_0_0_0_0_3 = p_1_0_0_0_0_2*x5;
+            const double p_1_0_0_0_1_2 = p_1_0_0_0_1_1*x5;
+            const double p_1_0_0_0_2_1 = p_1_0_0_0_2_0*x5;
+            const double p_1_0_0_0_3_0 = p_1_0_0_0_2_0*x4;
+            const double p_1_0_0_1_0_2 = p_1_0_0_1_0_1*x5;
+            const double p_1_0_0_1_1_1 = p_1_0_0_1_1_0*x5;
+            const double p_1_0_0_1_2_0 = p_1_0_0_1_1_0*x4;
+            const double p_1_0_0_2_0_1 = p_1_0_0_2_0_0*x5;
+            const double p_1_0_0_2_1_0 = p_1_0_0_2_0_0*x4;
+            const double p_1_0_0_3_0_0 = p_1_0_0_2_0_0*x3;
+            const double p_1_0_1_0_0_2 = p_1_0_1_0_0_1*x5;
+            const double p_1_0_1_0_1_1 = p_1_0_1_0_1_0*x5;
+            const double p_1_0_1_0_2_0 = p_1_0_1_0_1_0*x4;
+            const double p_1_0_1_1_0_1 = p_1_0_1_1_0_0*x5;
+            const double p_1_0_1_1_1_0 = p_1_0_1_1_0_0*x4;
+            const double p_1_0_1_2_0_0 = p_1_0_1_1_0_0*x3;
+            const double p_1_0_2_0_0_1 = p_1_0_2_0_0_0*x5;
+            const double p_1_0_2_0_1_0 = p_1_0_2_0_0_0*x4;
+            const double p_1_0_2_1_0_0 = p_1_0_2_0_0_0*x3;
+            const double p_1_0_3_0_0_0 = p_1_0_2_0_0_0*x2;
+            const double p_1_1_0_0_0_2 = p_1_1_0_0_0_1*x5;
+            const double p_1_1_0_0_1_1 = p_1_1_0_0_1_0*x5;
+            const double p_1_1_0_0_2_0 = p_1_1_0_0_1_0*x4;
+            const double p_1_1_0_1_0_1 = p_1_1_0_1_0_0*x5;
+            const double p_1_1_0_1_1_0 = p_1_1_0_1_0_0*x4;
+            const double p_1_1_0_2_0_0 = p_1_1_0_1_0_0*x3;
+            const double p_1_1_1_0_0_1 = p_1_1_1_0_0_0*x5;
+            const double p_1_1_1_0_1_0 = p_1_1_1_0_0_0*x4;
+            const double p_1_1_1_1_0_0 = p_1_1_1_0_0_0*x3;
+            const double p_1_1_2_0_0_0 = p_1_1_1_0_0_0*x2;
+            const double p_1_2_0_0_0_1 = p_1_2_0_0_0_0*x5;
+            const double p_1_2_0_0_1_0 = p_1_2_0_0_0_0*x4;
+            const double p_1_2_0_1_0_0 = p_1_2_0_0_0_0*x3;
+            const double p_1_2_1_0_0_0 = p_1_2_0_0_0_0*x2;
+            const double p_1_3_0_0_0_0 = p_1_2_0_0_0_0*x1;
+            const double p_2_0_0_0_0_2 = p_2_0_0_0_0_1*x5;
+            const double p_2_0_0_0_1_1 = p_2_0_0_0_1_0*x5;
+            const double p_2_0_0_0_2_0 = p_2_0_0_0_1_0*x4;
+            const double p_2_0_0_1_0_1 = p_2_0_0_1_0_0*x5;
+            const double p_2_0_0_1_1_0 = p_2_0_0_1_0_0*x4;
+            const double p_2_0_0_2_0_0 = p_2_0_0_1_0_0*x3;
+            const double p_2_0_1_0_0_1 = p_2_0_1_0_0_0*x5;
+            const double p_2_0_1_0_1_0 = p_2_0_1_0_0_0*x4;
+            const double p_2_0_1_1_0_0 = p_2_0_1_0_0_0*x3;
+            const double p_2_0_2_0_0_0 = p_2_0_1_0_0_0*x2;
+            const double p_2_1_0_0_0_1 = p_2_1_0_0_0_0*x5;
+            const double p_2_1_0_0_1_0 = p_2_1_0_0_0_0*x4;
+            const double p_2_1_0_1_0_0 = p_2_1_0_0_0_0*x3;
+            const double p_2_1_1_0_0_0 = p_2_1_0_0_0_0*x2;
+            const double p_2_2_0_0_0_0 = p_2_1_0_0_0_0*x1;
+            const double p_3_0_0_0_0_1 = p_3_0_0_0_0_0*x5;
+            const double p_3_0_0_0_1_0 = p_3_0_0_0_0_0*x4;
+            const double p_3_0_0_1_0_0 = p_3_0_0_0_0_0*x3;
+            const double p_3_0_1_0_0_0 = p_3_0_0_0_0_0*x2;
+            const double p_3_1_0_0_0_0 = p_3_0_0_0_0_0*x1;
+            const double p_4_0_0_0_0_0 = p_3_0_0_0_0_0*x0;
+            const double p_0_0_0_0_0_5 = p_0_0_0_0_0_4*x5;
+            const double p_0_0_0_0_1_4 = p_0_0_0_0_1_3*x5;
+            const double p_0_0_0_0_2_3 = p_0_0_0_0_2_2*x5;
+            const double p_0_0_0_0_3_2 = p_0_0_0_0_3_1*x5;
+            const double p_0_0_0_0_4_1 = p_0_0_0_0_4_0*x5;
+            const double p_0_0_0_0_5_0 = p_0_0_0_0_4_0*x4;
+            const double p_0_0_0_1_0_4 = p_0_0_0_1_0_3*x5;
+            const double p_0_0_0_1_1_3 = p_0_0_0_1_1_2*x5;
+            const double p_0_0_0_1_2_2 = p_0_0_0_1_2_1*x5;
+            const double p_0_0_0_1_3_1 = p_0_0_0_1_3_0*x5;
+            const double p_0_0_0_1_4_0 = p_0_0_0_1_3_0*x4;
+            const double p_0_0_0_2_0_3 = p_0_0_0_2_0_2*x5;
+            const double p_0_0_0_2_1_2 = p_0_0_0_2_1_1*x5;
+            const double p_0_0_0_2_2_1 = p_0_0_0_2_2_0*x5;
+            const double p_0_0_0_2_3_0 = p_0_0_0_2_2_0*x4;
+            const double p_0_0_0_3_0_2 = p_0_0_0_3_0_1*x5;
+            const double p_0_0_0_3_1_1 = p_0_0_0_3_1_0*x5;
+            const double p_0_0_0_3_2_0 = p_0_0_0_3_1_0*x4;
+            const double p_0_0_0_4_0_1 = p_0_0_0_4_0_0*x5;
+            const double p_0_0_0_4_1_0 = p_0_0_0_4_0_0*x4;
+            const double p_0_0_0_5_0_0 = p_0_0_0_4_0_0*x3;
+            const double p_0_0_1_0_0_4 = p_0_0_1_0_0_3*x5;
+            const double p_0_0_1_0_1_3 = p_0_0_1_0_1_2*x5;
+            const double p_0_0_1_0_2_2 = p_0_0_1_0_2_1*x5;
+            const double p_0_0_1_0_3_1 = p_0_0_1_0_3_0*x5;
+            const double p_0_0_1_0_4_0 = p_0_0_1_0_3_0*x4;
+            const double p_0_0_1_1_0_3 = p_0_0_1_1_0_2*x5;
+            const double p_0_0_1_1_1_2 = p_0_0_1_1_1_1*x5;
+            const double p_0_0_1_1_2_1 = p_0_0_1_1_2_0*x5;
+            const double p_0_0_1_1_3_0 = p_0_0_1_1_2_0*x4;
+            const double p_0_0_1_2_0_2 = p_0_0_1_2_0_1*x5;
+            const double p_0_0_1_2_1_1 = p_0_0_1_2_1_0*x5;
+            const double p_0_0_1_2_2_0 = p_0_0_1_2_1_0*x4;
+            const double p_0_0_1_3_0_1 = p_0_0_1_3_0_0*x5;
+            const double p_0_0_1_3_1_0 = p_0_0_1_3_0_0*x4;
+            const double p_0_0_1_4_0_0 = p_0_0_1_3_0_0*x3;
+            const double p_0_0_2_0_0_3 = p_0_0_2_0_0_2*x5;
+            const double p_0_0_2_0_1_2 = p_0_0_2_0_1_1*x5;
+            const double p_0_0_2_0_2_1 = p_0_0_2_0_2_0*x5;
+            const double p_0_0_2_0_3_0 = p_0_0_2_0_2_0*x4;
+            const double p_0_0_2_1_0_2 = p_0_0_2_1_0_1*x5;
+            const double p_0_0_2_1_1_1 = p_0_0_2_1_1_0*x5;
+            const double p_0_0_2_1_2_0 = p_0_0_2_1_1_0*x4;
+            const double p_0_0_2_2_0_1 = p_0_0_2_2_0_0*x5;
+            const double p_0_0_2_2_1_0 = p_0_0_2_2_0_0*x4;
+            const double p_0_0_2_3_0_0 = p_0_0_2_2_0_0*x3;
+            const double p_0_0_3_0_0_2 = p_0_0_3_0_0_1*x5;
+            const double p_0_0_3_0_1_1 = p_0_0_3_0_1_0*x5;
+            const double p_0_0_3_0_2_0 = p_0_0_3_0_1_0*x4;
+            const double p_0_0_3_1_0_1 = p_0_0_3_1_0_0*x5;
+            const double p_0_0_3_1_1_0 = p_0_0_3_1_0_0*x4;
+            const double p_0_0_3_2_0_0 = p_0_0_3_1_0_0*x3;
+            const double p_0_0_4_0_0_1 = p_0_0_4_0_0_0*x5;
+            const double p_0_0_4_0_1_0 = p_0_0_4_0_0_0*x4;
+            const double p_0_0_4_1_0_0 = p_0_0_4_0_0_0*x3;
+            const double p_0_0_5_0_0_0 = p_0_0_4_0_0_0*x2;
+            const double p_0_1_0_0_0_4 = p_0_1_0_0_0_3*x5;
+            const double p_0_1_0_0_1_3 = p_0_1_0_0_1_2*x5;
+            const double p_0_1_0_0_2_2 = p_0_1_0_0_2_1*x5;
+            const double p_0_1_0_0_3_1 = p_0_1_0_0_3_0*x5;
+            const double p_0_1_0_0_4_0 = p_0_1_0_0_3_0*x4;
+            const double p_0_1_0_1_0_3 = p_0_1_0_1_0_2*x5;
+            const double p_0_1_0_1_1_2 = p_0_1_0_1_1_1*x5;
+            const double p_0_1_0_1_2_1 = p_0_1_0_1_2_0*x5;
+            const double p_0_1_0_1_3_0 = p_0_1_0_1_2_0*x4;
+            const double p_0_1_0_2_0_2 = p_0_1_0_2_0_1*x5;
+            const double p_0_1_0_2_1_1 = p_0_1_0_2_1_0*x5;
+            const double p_0_1_0_2_2_0 = p_0_1_0_2_1_0*x4;
+            const double p_0_1_0_3_0_1 = p_0_1_0_3_0_0*x5;
+            const double p_0_1_0_3_1_0 = p_0_1_0_3_0_0*x4;
+            const double p_0_1_0_4_0_0 = p_0_1_0_3_0_0*x3;
+            const double p_0_1_1_0_0_3 = p_0_1_1_0_0_2*x5;
+            const double p_0_1_1_0_1_2 = p_0_1_1_0_1_1*x5;
+            const double p_0_1_1_0_2_1 = p_0_1_1_0_2_0*x5;
+            const double p_0_1_1_0_3_0 = p_0_1_1_0_2_0*x4;
+            const double p_0_1_1_1_0_2 = p_0_1_1_1_0_1*x5;
+            const double p_0_1_1_1_1_1 = p_0_1_1_1_1_0*x5;
+            const double p_0_1_1_1_2_0 = p_0_1_1_1_1_0*x4;
+            const double p_0_1_1_2_0_1 = p_0_1_1_2_0_0*x5;
+            const double p_0_1_1_2_1_0 = p_0_1_1_2_0_0*x4;
+            const double p_0_1_1_3_0_0 = p_0_1_1_2_0_0*x3;
+            const double p_0_1_2_0_0_2 = p_0_1_2_0_0_1*x5;
+            const double p_0_1_2_0_1_1 = p_0_1_2_0_1_0*x5;
+            const double p_0_1_2_0_2_0 = p_0_1_2_0_1_0*x4;
+            const double p_0_1_2_1_0_1 = p_0_1_2_1_0_0*x5;
+            const double p_0_1_2_1_1_0 = p_0_1_2_1_0_0*x4;
+            const double p_0_1_2_2_0_0 = p_0_1_2_1_0_0*x3;
+            const double p_0_1_3_0_0_1 = p_0_1_3_0_0_0*x5;
+            const double p_0_1_3_0_1_0 = p_0_1_3_0_0_0*x4;
+            const double p_0_1_3_1_0_0 = p_0_1_3_0_0_0*x3;
+            const double p_0_1_4_0_0_0 = p_0_1_3_0_0_0*x2;
+            const double p_0_2_0_0_0_3 = p_0_2_0_0_0_2*x5;
+            const double p_0_2_0_0_1_2 = p_0_2_0_0_1_1*x5;
+            const double p_0_2_0_0_2_1 = p_0_2_0_0_2_0*x5;
+            const double p_0_2_0_0_3_0 = p_0_2_0_0_2_0*x4;
+            const double p_0_2_0_1_0_2 = p_0_2_0_1_0_1*x5;
+            const double p_0_2_0_1_1_1 = p_0_2_0_1_1_0*x5;
+            const double p_0_2_0_1_2_0 = p_0_2_0_1_1_0*x4;
+            const double p_0_2_0_2_0_1 = p_0_2_0_2_0_0*x5;
+            const double p_0_2_0_2_1_0 = p_0_2_0_2_0_0*x4;
+            const double p_0_2_0_3_0_0 = p_0_2_0_2_0_0*x3;
+            const double p_0_2_1_0_0_2 = p_0_2_1_0_0_1*x5;
+            const double p_0_2_1_0_1_1 = p_0_2_1_0_1_0*x5;
+            const double p_0_2_1_0_2_0 = p_0_2_1_0_1_0*x4;
+            const double p_0_2_1_1_0_1 = p_0_2_1_1_0_0*x5;
+            const double p_0_2_1_1_1_0 = p_0_2_1_1_0_0*x4;
+            const double p_0_2_1_2_0_0 = p_0_2_1_1_0_0*x3;
+            const double p_0_2_2_0_0_1 = p_0_2_2_0_0_0*x5;
+            const double p_0_2_2_0_1_0 = p_0_2_2_0_0_0*x4;
+            const double p_0_2_2_1_0_0 = p_0_2_2_0_0_0*x3;
+            const double p_0_2_3_0_0_0 = p_0_2_2_0_0_0*x2;
+            const double p_0_3_0_0_0_2 = p_0_3_0_0_0_1*x5;
+            const double p_0_3_0_0_1_1 = p_0_3_0_0_1_0*x5;
+            const double p_0_3_0_0_2_0 = p_0_3_0_0_1_0*x4;
+            const double p_0_3_0_1_0_1 = p_0_3_0_1_0_0*x5;
+            const double p_0_3_0_1_1_0 = p_0_3_0_1_0_0*x4;
+            const double p_0_3_0_2_0_0 = p_0_3_0_1_0_0*x3;
+            const double p_0_3_1_0_0_1 = p_0_3_1_0_0_0*x5;
+            const double p_0_3_1_0_1_0 = p_0_3_1_0_0_0*x4;
+            const double p_0_3_1_1_0_0 = p_0_3_1_0_0_0*x3;
+            const double p_0_3_2_0_0_0 = p_0_3_1_0_0_0*x2;
+            const double p_0_4_0_0_0_1 = p_0_4_0_0_0_0*x5;
+            const double p_0_4_0_0_1_0 = p_0_4_0_0_0_0*x4;
+            const double p_0_4_0_1_0_0 = p_0_4_0_0_0_0*x3;
+            const double p_0_4_1_0_0_0 = p_0_4_0_0_0_0*x2;
+            const double p_0_5_0_0_0_0 = p_0_4_0_0_0_0*x1;
+            const double p_1_0_0_0_0_4 = p_1_0_0_0_0_3*x5;
+            const double p_1_0_0_0_1_3 = p_1_0_0_0_1_2*x5;
+            const double p_1_0_0_0_2_2 = p_1_0_0_0_2_1*x5;
+            const double p_1_0_0_0_3_1 = p_1_0_0_0_3_0*x5;
+            const double p_1_0_0_0_4_0 = p_1_0_0_0_3_0*x4;
+            const double p_1_0_0_1_0_3 = p_1_0_0_1_0_2*x5;
+            const double p_1_0_0_1_1_2 = p_1_0_0_1_1_1*x5;
+            const double p_1_0_0_1_2_1 = p_1_0_0_1_2_0*x5;
+            const double p_1_0_0_1_3_0 = p_1_0_0_1_2_0*x4;
+            const double p_1_0_0_2_0_2 = p_1_0_0_2_0_1*x5;
+            const double p_1_0_0_2_1_1 = p_1_0_0_2_1_0*x5;
+            const double p_1_0_0_2_2_0 = p_1_0_0_2_1_0*x4;
+            const double p_1_0_0_3_0_1 = p_1_0_0_3_0_0*x5;
+            const double p_1_0_0_3_1_0 = p_1_0_0_3_0_0*x4;
+            const double p_1_0_0_4_0_0 = p_1_0_0_3_0_0*x3;
+            const double p_1_0_1_0_0_3 = p_1_0_1_0_0_2*x5;
+            const double p_1_0_1_0_1_2 = p_1_0_1_0_1_1*x5;
+            const double p_1_0_1_0_2_1 = p_1_0_1_0_2_0*x5;
+            const double p_1_0_1_0_3_0 = p_1_0_1_0_2_0*x4;
+            const double p_1_0_1_1_0_2 = p_1_0_1_1_0_1*x5;
+            const double p_1_0_1_1_1_1 = p_1_0_1_1_1_0*x5;
+            const double p_1_0_1_1_2_0 = p_1_0_1_1_1_0*x4;
+            const double p_1_0_1_2_0_1 = p_1_0_1_2_0_0*x5;
+            const double p_1_0_1_2_1_0 = p_1_0_1_2_0_0*x4;
+            const double p_1_0_1_3_0_0 = p_1_0_1_2_0_0*x3;
+            const double p_1_0_2_0_0_2 = p_1_0_2_0_0_1*x5;
+            const double p_1_0_2_0_1_1 = p_1_0_2_0_1_0*x5;
+            const double p_1_0_2_0_2_0 = p_1_0_2_0_1_0*x4;
+            const double p_1_0_2_1_0_1 = p_1_0_2_1_0_0*x5;
+            const double p_1_0_2_1_1_0 = p_1_0_2_1_0_0*x4;
+            const double p_1_0_2_2_0_0 = p_1_0_2_1_0_0*x3;
+            const double p_1_0_3_0_0_1 = p_1_0_3_0_0_0*x5;
+            const double p_1_0_3_0_1_0 = p_1_0_3_0_0_0*x4;
+            const double p_1_0_3_1_0_0 = p_1_0_3_0_0_0*x3;
+            const double p_1_0_4_0_0_0 = p_1_0_3_0_0_0*x2;
+            const double p_1_1_0_0_0_3 = p_1_1_0_0_0_2*x5;
+            const double p_1_1_0_0_1_2 = p_1_1_0_0_1_1*x5;
+            const double p_1_1_0_0_2_1 = p_1_1_0_0_2_0*x5;
+            const double p_1_1_0_0_3_0 = p_1_1_0_0_2_0*x4;
+            const double p_1_1_0_1_0_2 = p_1_1_0_1_0_1*x5;
+            const double p_1_1_0_1_1_1 = p_1_1_0_1_1_0*x5;
+            const double p_1_1_0_1_2_0 = p_1_1_0_1_1_0*x4;
+            const double p_1_1_0_2_0_1 = p_1_1_0_2_0_0*x5;
+            const double p_1_1_0_2_1_0 = p_1_1_0_2_0_0*x4;
+            const double p_1_1_0_3_0_0 = p_1_1_0_2_0_0*x3;
+            const double p_1_1_1_0_0_2 = p_1_1_1_0_0_1*x5;
+            const double p_1_1_1_0_1_1 = p_1_1_1_0_1_0*x5;
+            const double p_1_1_1_0_2_0 = p_1_1_1_0_1_0*x4;
+            const double p_1_1_1_1_0_1 = p_1_1_1_1_0_0*x5;
+            const double p_1_1_1_1_1_0 = p_1_1_1_1_0_0*x4;
+            const double p_1_1_1_2_0_0 = p_1_1_1_1_0_0*x3;
+            const double p_1_1_2_0_0_1 = p_1_1_2_0_0_0*x5;
+            const double p_1_1_2_0_1_0 = p_1_1_2_0_0_0*x4;
+            const double p_1_1_2_1_0_0 = p_1_1_2_0_0_0*x3;
+            const double p_1_1_3_0_0_0 = p_1_1_2_0_0_0*x2;
+            const double p_1_2_0_0_0_2 = p_1_2_0_0_0_1*x5;
+            const double p_1_2_0_0_1_1 = p_1_2_0_0_1_0*x5;
+            const double p_1_2_0_0_2_0 = p_1_2_0_0_1_0*x4;
+            const double p_1_2_0_1_0_1 = p_1_2_0_1_0_0*x5;
+            const double p_1_2_0_1_1_0 = p_1_2_0_1_0_0*x4;
+            const double p_1_2_0_2_0_0 = p_1_2_0_1_0_0*x3;
+            const double p_1_2_1_0_0_1 = p_1_2_1_0_0_0*x5;
+            const double p_1_2_1_0_1_0 = p_1_2_1_0_0_0*x4;
+            const double p_1_2_1_1_0_0 = p_1_2_1_0_0_0*x3;
+            const double p_1_2_2_0_0_0 = p_1_2_1_0_0_0*x2;
+            const double p_1_3_0_0_0_1 = p_1_3_0_0_0_0*x5;
+            const double p_1_3_0_0_1_0 = p_1_3_0_0_0_0*x4;
+            const double p_1_3_0_1_0_0 = p_1_3_0_0_0_0*x3;
+            const double p_1_3_1_0_0_0 = p_1_3_0_0_0_0*x2;
+            const double p_1_4_0_0_0_0 = p_1_3_0_0_0_0*x1;
+            const double p_2_0_0_0_0_3 = p_2_0_0_0_0_2*x5;
+            const double p_2_0_0_0_1_2 = p_2_0_0_0_1_1*x5;
+            const double p_2_0_0_0_2_1 = p_2_0_0_0_2_0*x5;
+            const double p_2_0_0_0_3_0 = p_2_0_0_0_2_0*x4;
+            const double p_2_0_0_1_0_2 = p_2_0_0_1_0_1*x5;
+            const double p_2_0_0_1_1_1 = p_2_0_0_1_1_0*x5;
+            const double p_2_0_0_1_2_0 = p_2_0_0_1_1_0*x4;
+            const double p_2_0_0_2_0_1 = p_2_0_0_2_0_0*x5;
+            const double p_2_0_0_2_1_0 = p_2_0_0_2_0_0*x4;
+            const double p_2_0_0_3_0_0 = p_2_0_0_2_0_0*x3;
+            const double p_2_0_1_0_0_2 = p_2_0_1_0_0_1*x5;
+            const double p_2_0_1_0_1_1 = p_2_0_1_0_1_0*x5;
+            const double p_2_0_1_0_2_0 = p_2_0_1_0_1_0*x4;
+            const double p_2_0_1_1_0_1 = p_2_0_1_1_0_0*x5;
+            const double p_2_0_1_1_1_0 = p_2_0_1_1_0_0*x4;
+            const double p_2_0_1_2_0_0 = p_2_0_1_1_0_0*x3;
+            const double p_2_0_2_0_0_1 = p_2_0_2_0_0_0*x5;
+            const double p_2_0_2_0_1_0 = p_2_0_2_0_0_0*x4;
+            const double p_2_0_2_1_0_0 = p_2_0_2_0_0_0*x3;
+            const double p_2_0_3_0_0_0 = p_2_0_2_0_0_0*x2;
+            const double p_2_1_0_0_0_2 = p_2_1_0_0_0_1*x5;
+            const double p_2_1_0_0_1_1 = p_2_1_0_0_1_0*x5;
+            const double p_2_1_0_0_2_0 = p_2_1_0_0_1_0*x4;
+            const double p_2_1_0_1_0_1 = p_2_1_0_1_0_0*x5;
+            const double p_2_1_0_1_1_0 = p_2_1_0_1_0_0*x4;
+            const double p_2_1_0_2_0_0 = p_2_1_0_1_0_0*x3;
+            const double p_2_1_1_0_0_1 = p_2_1_1_0_0_0*x5;
+            const double p_2_1_1_0_1_0 = p_2_1_1_0_0_0*x4;
+            const double p_2_1_1_1_0_0 = p_2_1_1_0_0_0*x3;
+            const double p_2_1_2_0_0_0 = p_2_1_1_0_0_0*x2;
+            const double p_2_2_0_0_0_1 = p_2_2_0_0_0_0*x5;
+            const double p_2_2_0_0_1_0 = p_2_2_0_0_0_0*x4;
+            const double p_2_2_0_1_0_0 = p_2_2_0_0_0_0*x3;
+            const double p_2_2_1_0_0_0 = p_2_2_0_0_0_0*x2;
+            const double p_2_3_0_0_0_0 = p_2_2_0_0_0_0*x1;
+            const double p_3_0_0_0_0_2 = p_3_0_0_0_0_1*x5;
+            const double p_3_0_0_0_1_1 = p_3_0_0_0_1_0*x5;
+            const double p_3_0_0_0_2_0 = p_3_0_0_0_1_0*x4;
+            const double p_3_0_0_1_0_1 = p_3_0_0_1_0_0*x5;
+            const double p_3_0_0_1_1_0 = p_3_0_0_1_0_0*x4;
+            const double p_3_0_0_2_0_0 = p_3_0_0_1_0_0*x3;
+            const double p_3_0_1_0_0_1 = p_3_0_1_0_0_0*x5;
+            const double p_3_0_1_0_1_0 = p_3_0_1_0_0_0*x4;
+            const double p_3_0_1_1_0_0 = p_3_0_1_0_0_0*x3;
+            const double p_3_0_2_0_0_0 = p_3_0_1_0_0_0*x2;
+            const double p_3_1_0_0_0_1 = p_3_1_0_0_0_0*x5;
+            const double p_3_1_0_0_1_0 = p_3_1_0_0_0_0*x4;
+            const double p_3_1_0_1_0_0 = p_3_1_0_0_0_0*x3;
+            const double p_3_1_1_0_0_0 = p_3_1_0_0_0_0*x2;
+            const double p_3_2_0_0_0_0 = p_3_1_0_0_0_0*x1;
+            const double p_4_0_0_0_0_1 = p_4_0_0_0_0_0*x5;
+            const double p_4_0_0_0_1_0 = p_4_0_0_0_0_0*x4;
+            const double p_4_0_0_1_0_0 = p_4_0_0_0_0_0*x3;
+            const double p_4_0_1_0_0_0 = p_4_0_0_0_0_0*x2;
+            const double p_4_1_0_0_0_0 = p_4_0_0_0_0_0*x1;
+            const double p_5_0_0_0_0_0 = p_4_0_0_0_0_0*x0;
+            terms[0] = x0 + x4 + x1 + x2 + x3 + x5;
+            terms[1] = p_1_0_0_0_0_1 + p_0_1_0_0_1_0 + p_0_0_1_1_0_0;
+            terms[2] = p_0_0_0_0_1_1 + p_0_0_1_0_1_0 + p_1_0_1_0_0_0 + p_0_0_1_0_0_1 + p_0_1_0_1_0_0 + p_1_0_0_0_1_0 + p_0_1_0_0_0_1 + p_0_1_1_0_0_0 + p_0_0_0_1_0_1 + p_0_0_0_1_1_0 + p_1_1_0_0_0_0 + p_1_0_0_1_0_0;
+            terms[3] = p_0_0_0_0_2_0 + p_0_0_0_2_0_0 + p_0_2_0_0_0_0 + p_0_0_0_0_0_2 + p_0_0_2_0_0_0 + p_2_0_0_0_0_0;
+            terms[4] = p_2_0_0_0_0_1 + p_1_0_0_0_0_2 + p_0_0_2_1_0_0 + p_0_1_0_0_2_0 + p_0_0_1_2_0_0 + p_0_2_0_0_1_0;
+            terms[5] = p_3_0_0_0_0_0 + p_0_0_0_0_3_0 + p_0_0_3_0_0_0 + p_0_3_0_0_0_0 + p_0_0_0_3_0_0 + p_0_0_0_0_0_3;
+            terms[6] = p_1_0_0_1_1_0 + p_0_1_0_1_0_1 + p_0_0_1_0_1_1 + p_1_1_1_0_0_0;
+            terms[7] = p_2_0_0_1_0_0 + p_2_0_1_0_0_0 + p_0_1_0_2_0_0 + p_1_2_0_0_0_0 + p_2_1_0_0_0_0 + p_0_0_2_0_0_1 + p_0_1_2_0_0_0 + p_0_0_1_0_2_0 + p_1_0_0_2_0_0 + p_1_0_2_0_0_0 + p_0_0_0_2_1_0 + p_0_0_0_0_2_1 + p_0_1_0_0_0_2 + p_0_0_0_1_2_0 + p_0_0_0_2_0_1 + p_2_0_0_0_1_0 + p_0_0_0_1_0_2 + p_0_0_0_0_1_2 + p_0_2_0_0_0_1 + p_0_0_2_0_1_0 + p_0_0_1_0_0_2 + p_0_2_1_0_0_0 + p_1_0_0_0_2_0 + p_0_2_0_1_0_0;
+            terms[8] = p_1_1_0_1_0_0 + p_1_0_1_0_1_0 + p_0_1_1_0_0_1 + p_0_0_0_1_1_1;
+            terms[9] = p_0_1_1_0_1_0 + p_0_1_0_0_1_1 + p_0_0_1_1_1_0 + p_0_0_1_1_0_1 + p_1_0_1_1_0_0 + p_1_0_1_0_0_1 + p_0_1_1_1_0_0 + p_1_0_0_0_1_1 + p_0_1_0_1_1_0 + p_1_0_0_1_0_1 + p_1_1_0_0_1_0 + p_1_1_0_0_0_1;
+            terms[10] = p_1_1_0_0_1_1 + p_1_0_1_1_0_1 + p_0_1_1_1_1_0;
+            terms[11] = p_0_2_0_0_2_0 + p_0_0_2_2_0_0 + p_2_0_0_0_0_2;
+            terms[12] = p_0_1_0_1_0_2 + p_1_1_2_0_0_0 + p_2_0_0_1_1_0 + p_1_0_0_2_1_0 + p_0_0_1_0_2_1 + p_2_1_1_0_0_0 + p_1_0_0_1_2_0 + p_0_0_1_0_1_2 + p_0_2_0_1_0_1 + p_0_1_0_2_0_1 + p_0_0_2_0_1_1 + p_1_2_1_0_0_0;
+            terms[13] = p_0_1_1_1_0_1 + p_0_1_1_0_1_1 + p_0_1_0_1_1_1 + p_1_1_0_1_0_1 + p_1_1_1_1_0_0 + p_1_0_1_1_1_0 + p_1_0_1_0_1_1 + p_1_1_1_0_0_1 + p_1_0_0_1_1_1 + p_1_1_0_1_1_0 + p_0_0_1_1_1_1 + p_1_1_1_0_1_0;
+            terms[14] = p_0_0_1_3_0_0 + p_0_0_3_1_0_0 + p_1_0_0_0_0_3 + p_0_3_0_0_1_0 + p_3_0_0_0_0_1 + p_0_1_0_0_3_0;
+            terms[15] = p_1_3_0_0_0_0 + p_0_0_0_0_1_3 + p_3_0_0_1_0_0 + p_0_0_0_3_1_0 + p_0_0_0_3_0_1 + p_0_3_0_1_0_0 + p_0_1_0_3_0_0 + p_0_0_0_1_0_3 + p_0_0_1_0_3_0 + p_0_1_3_0_0_0 + p_0_3_0_0_0_1 + p_0_1_0_0_0_3 + p_0_0_3_0_1_0 + p_0_0_0_0_3_1 + p_1_0_0_3_0_0 + p_0_3_1_0_0_0 + p_3_0_1_0_0_0 + p_1_0_0_0_3_0 + p_3_0_0_0_1_0 + p_0_0_0_1_3_0 + p_0_0_1_0_0_3 + p_1_0_3_0_0_0 + p_3_1_0_0_0_0 + p_0_0_3_0_0_1;
+            terms[16] = p_0_2_0_2_0_0 + p_0_2_0_0_0_2 + p_0_0_2_0_0_2 + p_2_0_2_0_0_0 + p_0_2_2_0_0_0 + p_0_0_0_0_2_2 + p_2_0_0_0_2_0 + p_2_2_0_0_0_0 + p_0_0_0_2_2_0 + p_2_0_0_2_0_0 + p_0_0_2_0_2_0 + p_0_0_0_2_0_2;
+            terms[17] = p_1_2_0_0_0_1 + p_1_0_2_0_0_1 + p_0_0_1_1_0_2 + p_1_0_0_0_2_1 + p_0_1_0_2_1_0 + p_0_2_1_1_0_0 + p_0_0_1_1_2_0 + p_0_1_0_0_1_2 + p_2_1_0_0_1_0 + p_0_1_2_0_1_0 + p_1_0_0_2_0_1 + p_2_0_1_1_0_0;
+            terms[18] = p_0_1_2_1_0_0 + p_0_0_2_1_0_1 + p_1_0_1_2_0_0 + p_2_1_0_0_0_1 + p_2_0_1_0_0_1 + p_0_0_1_2_0_1 + p_2_0_0_1_0_1 + p_1_0_0_0_1_2 + p_0_0_1_2_1_0 + p_0_1_1_2_0_0 + p_0_0_2_1_1_0 + p_2_0_0_0_1_1 + p_0_1_0_1_2_0 + p_0_2_0_0_1_1 + p_1_0_0_1_0_2 + p_1_2_0_0_1_0 + p_1_0_1_0_0_2 + p_1_0_2_1_0_0 + p_0_1_1_0_2_0 + p_0_2_0_1_1_0 + p_1_1_0_0_2_0 + p_0_2_1_0_1_0 + p_0_1_0_0_2_1 + p_1_1_0_0_0_2;
+            terms[19] = p_0_4_0_0_0_0 + p_0_0_4_0_0_0 + p_0_0_0_0_0_4 + p_0_0_0_4_0_0 + p_0_0_0_0_4_0 + p_4_0_0_0_0_0;
+            terms[20] = p_2_0_1_0_1_0 + p_1_0_1_0_2_0 + p_0_1_2_0_0_1 + p_0_0_0_1_2_1 + p_1_2_0_1_0_0 + p_0_0_0_2_1_1 + p_0_1_1_0_0_2 + p_0_0_0_1_1_2 + p_1_0_2_0_1_0 + p_0_2_1_0_0_1 + p_1_1_0_2_0_0 + p_2_1_0_1_0_0;
+            terms[21] = p_1_0_1_0_3_0 + p_3_1_0_1_0_0 + p_0_1_3_0_0_1 + p_0_0_0_3_1_1 + p_0_1_1_0_0_3 + p_0_0_0_1_1_3 + p_3_0_1_0_1_0 + p_0_0_0_1_3_1 + p_1_0_3_0_1_0 + p_0_3_1_0_0_1 + p_1_1_0_3_0_0 + p_1_3_0_1_0_0;
+            terms[22] = p_1_0_0_1_2_1 + p_0_0_1_1_2_1 + p_0_2_1_1_0_1 + p_1_1_2_0_0_1 + p_0_1_0_1_1_2 + p_2_1_1_1_0_0 + p_0_0_1_1_1_2 + p_0_1_0_2_1_1 + p_0_1_1_1_0_2 + p_1_2_1_1_0_0 + p_1_2_1_0_0_1 + p_1_1_0_2_0_1 + p_2_1_0_1_1_0 + p_2_1_1_0_1_0 + p_1_0_1_0_2_1 + p_0_1_1_0_1_2 + p_1_0_2_0_1_1 + p_1_1_2_0_1_0 + p_1_0_1_1_2_0 + p_0_1_2_0_1_1 + p_1_1_0_2_1_0 + p_2_0_1_1_1_0 + p_1_2_0_1_0_1 + p_1_0_0_2_1_1;
+            terms[23] = p_3_0_0_0_0_2 + p_0_2_0_0_3_0 + p_0_0_2_3_0_0 + p_2_0_0_0_0_3 + p_0_3_0_0_2_0 + p_0_0_3_2_0_0;
+            terms[24] = p_0_0_0_1_0_4 + p_0_0_4_0_0_1 + p_1_0_0_4_0_0 + p_0_1_0_0_0_4 + p_0_1_4_0_0_0 + p_0_0_4_0_1_0 + p_0_4_0_0_0_1 + p_0_0_0_0_4_1 + p_1_0_4_0_0_0 + p_0_1_0_4_0_0 + p_0_0_0_0_1_4 + p_0_0_0_4_0_1 + p_4_0_1_0_0_0 + p_1_4_0_0_0_0 + p_4_0_0_0_1_0 + p_4_1_0_0_0_0 + p_4_0_0_1_0_0 + p_0_0_0_1_4_0 + p_0_0_0_4_1_0 + p_0_4_1_0_0_0 + p_0_0_1_0_4_0 + p_0_4_0_1_0_0 + p_1_0_0_0_4_0 + p_0_0_1_0_0_4;
+            terms[25] = p_0_2_1_0_0_2 + p_2_0_2_0_1_0 + p_0_0_0_2_2_1 + p_2_2_0_1_0_0 + p_0_1_2_0_0_2 + p_0_0_0_1_2_2 + p_0_0_0_2_1_2 + p_0_2_2_0_0_1 + p_1_2_0_2_0_0 + p_2_0_1_0_2_0 + p_2_1_0_2_0_0 + p_1_0_2_0_2_0;
+            terms[26] = p_0_2_0_2_0_1 + p_2_0_0_1_2_0 + p_0_0_2_0_2_1 + p_1_0_0_2_2_0 + p_2_2_1_0_0_0 + p_1_2_2_0_0_0 + p_0_2_0_1_0_2 + p_2_0_0_2_1_0 + p_0_0_1_0_2_2 + p_0_0_2_0_1_2 + p_2_1_2_0_0_0 + p_0_1_0_2_0_2;
+            terms[27] = p_1_1_0_1_1_1 + p_0_1_1_1_1_1 + p_1_1_1_0_1_1 + p_1_1_1_1_1_0 + p_1_1_1_1_0_1 + p_1_0_1_1_1_1;
+            terms[28] = p_1_0_3_0_0_1 + p_1_0_0_3_0_1 + p_0_1_0_3_1_0 + p_1_0_0_0_3_1 + p_3_1_0_0_1_0 + p_0_1_0_0_1_3 + p_0_3_1_1_0_0 + p_0_0_1_1_3_0 + p_1_3_0_0_0_1 + p_3_0_1_1_0_0 + p_0_0_1_1_0_3 + p_0_1_3_0_1_0;
+            terms[29] = p_0_2_0_2_1_0 + p_1_0_0_0_2_2 + p_2_0_2_1_0_0 + p_0_1_0_2_2_0 + p_2_2_0_0_0_1 + p_1_0_2_0_0_2 + p_2_2_0_0_1_0 + p_0_1_0_0_2_2 + p_2_0_2_0_0_1 + p_0_2_1_2_0_0 + p_0_1_2_0_2_0 + p_0_2_2_1_0_0 + p_1_0_0_2_0_2 + p_2_0_0_0_2_1 + p_0_2_0_0_1_2 + p_0_0_2_1_2_0 + p_2_1_0_0_2_0 + p_2_0_0_2_0_1 + p_1_2_0_0_0_2 + p_2_0_1_2_0_0 + p_0_0_1_2_2_0 + p_0_2_2_0_1_0 + p_0_0_2_1_0_2 + p_0_0_1_2_0_2;
+            terms[30] = p_0_2_1_0_1_1 + p_0_1_0_1_2_1 + p_1_0_2_1_1_0 + p_2_1_0_1_0_1 + p_0_0_1_2_1_1 + p_1_1_1_0_2_0 + p_1_0_0_1_1_2 + p_1_2_0_1_1_0 + p_1_1_1_2_0_0 + p_0_1_2_1_0_1 + p_1_1_1_0_0_2 + p_2_0_1_0_1_1;
+            terms[31] = p_0_0_1_3_0_1 + p_0_1_1_0_3_0 + p_3_0_1_0_0_1 + p_1_1_0_0_3_0 + p_1_1_0_0_0_3 + p_0_0_3_1_1_0 + p_1_0_0_1_0_3 + p_0_3_1_0_1_0 + p_1_3_0_0_1_0 + p_3_0_0_1_0_1 + p_0_1_1_3_0_0 + p_0_3_0_0_1_1 + p_0_1_0_0_3_1 + p_1_0_0_0_1_3 + p_0_1_0_1_3_0 + p_1_0_3_1_0_0 + p_0_3_0_1_1_0 + p_0_0_3_1_0_1 + p_0_1_3_1_0_0 + p_3_1_0_0_0_1 + p_0_0_1_3_1_0 + p_3_0_0_0_1_1 + p_1_0_1_3_0_0 + p_1_0_1_0_0_3;
+            terms[32] = p_2_0_0_1_1_1 + p_1_1_2_1_0_0 + p_0_0_2_1_1_1 + p_0_2_0_1_1_1 + p_2_1_1_0_0_1 + p_1_1_0_1_2_0 + p_1_0_1_2_1_0 + p_1_2_1_0_1_0 + p_0_1_1_0_2_1 + p_0_1_1_2_0_1 + p_1_1_0_1_0_2 + p_1_0_1_0_1_2;
+            terms[33] = p_0_1_2_1_1_0 + p_1_0_2_1_0_1 + p_2_0_1_1_0_1 + p_0_1_1_2_1_0 + p_1_1_0_0_2_1 + p_0_2_1_1_1_0 + p_1_0_1_2_0_1 + p_1_1_0_0_1_2 + p_2_1_0_0_1_1 + p_1_0_1_1_0_2 + p_0_1_1_1_2_0 + p_1_2_0_0_1_1;
+            terms[34] = p_0_4_0_0_1_0 + p_0_1_0_0_4_0 + p_4_0_0_0_0_1 + p_0_0_4_1_0_0 + p_1_0_0_0_0_4 + p_0_0_1_4_0_0;
+            terms[35] = p_0_0_0_0_3_2 + p_3_0_0_2_0_0 + p_0_0_0_3_0_2 + p_0_0_0_3_2_0 + p_0_0_0_2_3_0 + p_0_0_0_2_0_3 + p_3_0_2_0_0_0 + p_0_3_0_2_0_0 + p_0_2_3_0_0_0 + p_0_0_3_0_0_2 + p_0_0_2_0_3_0 + p_0_3_0_0_0_2 + p_0_0_2_0_0_3 + p_0_0_3_0_2_0 + p_2_3_0_0_0_0 + p_0_2_0_0_0_3 + p_0_3_2_0_0_0 + p_3_2_0_0_0_0 + p_2_0_0_0_3_0 + p_2_0_3_0_0_0 + p_3_0_0_0_2_0 + p_2_0_0_3_0_0 + p_0_2_0_3_0_0 + p_0_0_0_0_2_3;
+            terms[36] = p_1_2_0_0_2_0 + p_2_0_0_0_1_2 + p_0_2_0_1_2_0 + p_0_1_2_2_0_0 + p_2_0_1_0_0_2 + p_2_0_0_1_0_2 + p_0_2_1_0_2_0 + p_1_0_2_2_0_0 + p_0_0_2_2_1_0 + p_2_1_0_0_0_2 + p_0_2_0_0_2_1 + p_0_0_2_2_0_1;
+            terms[37] = p_0_0_0_0_0_5 + p_0_5_0_0_0_0 + p_0_0_5_0_0_0 + p_0_0_0_0_5_0 + p_0_0_0_5_0_0 + p_5_0_0_0_0_0;
+            terms[38] = p_1_0_0_3_1_0 + p_0_1_0_3_0_1 + p_1_3_1_0_0_0 + p_0_0_3_0_1_1 + p_0_1_0_1_0_3 + p_0_0_1_0_3_1 + p_1_1_3_0_0_0 + p_0_3_0_1_0_1 + p_3_0_0_1_1_0 + p_0_0_1_0_1_3 + p_3_1_1_0_0_0 + p_1_0_0_1_3_0;
         }
 
-        std::vector<double> polynomial_gradient(const std::vector<double>& variables) const {
-            std::vector<double> grad(variables.size());
-            grad[0] = 0 + this->get_coefficients()[0]*(1) + this->get_coefficients()[1]*(1*variables[5]) + this->get_coefficients()[2]*(1*variables[2] + 1*variables[4] + 1*variables[1] + 1*variables[3]) + this->get_coefficients()[3]*(2*variables[0]) + this->get_coefficients()[4]*(2*variables[0]*variables[5] + 1*variables[5]*variables[5]) + this->get_coefficients()[5]*(3*variables[0]*variables[0]) + this->get_coefficients()[6]*(1*variables[3]*variables[4] + 1*variables[1]*variables[2]) + this->get_coefficients()[7]*(2*variables[0]*variables[3] + 2*variables[0]*variables[2] + 1*variables[1]*variables[1] + 2*variables[0]*variables[1] + 1*variables[3]*variables[3] + 1*variables[2]*variables[2] + 2*variables[0]*variables[4] + 1*variables[4]*variables[4]) + this->get_coefficients()[8]*(1*variables[1]*variables[3] + 1*variables[2]*variables[4]) + this->get_coefficients()[9]*(1*variables[2]*variables[3] + 1*variables[2]*variables[5] + 1*variables[4]*variables[5] + 1*variables[3]*variables[5] + 1*variables[1]*variables[4] + 1*variables[1]*variables[5]) + this->get_coefficients()[10]*(1*variables[1]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[5]) + this->get_coefficients()[11]*(2*variables[0]*variables[5]*variables[5]) + this->get_coefficients()[12]*(1*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[3]*variables[4] + 1*variables[3]*variables[3]*variables[4] + 2*variables[0]*variables[1]*variables[2] + 1*variables[3]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[2]) + this->get_coefficients()[13]*(1*variables[1]*variables[3]*variables[5] + 1*variables[1]*variables[2]*variables[3] + 1*variables[2]*variables[3]*variables[4] + 1*variables[2]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[5] + 1*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[3]*variables[4] + 1*variables[1]*variables[2]*variables[4]) + this->get_coefficients()[14]*(1*variables[5]*variables[5]*variables[5] + 3*variables[0]*variables[0]*variables[5]) + this->get_coefficients()[15]*(1*variables[1]*variables[1]*variables[1] + 3*variables[0]*variables[0]*variables[3] + 1*variables[3]*variables[3]*variables[3] + 3*variables[0]*variables[0]*variables[2] + 1*variables[4]*variables[4]*variables[4] + 3*variables[0]*variables[0]*variables[4] + 1*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[1]) + this->get_coefficients()[16]*(2*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[1] + 2*variables[0]*variables[3]*variables[3]) + this->get_coefficients()[17]*(1*variables[1]*variables[1]*variables[5] + 1*variables[2]*variables[2]*variables[5] + 1*variables[4]*variables[4]*variables[5] + 2*variables[0]*variables[1]*variables[4] + 1*variables[3]*variables[3]*variables[5] + 2*variables[0]*variables[2]*variables[3]) + this->get_coefficients()[18]*(1*variables[2]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[5] + 2*variables[0]*variables[2]*variables[5] + 2*variables[0]*variables[3]*variables[5] + 1*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[4]*variables[5] + 1*variables[3]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[4] + 1*variables[2]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[3] + 1*variables[1]*variables[4]*variables[4] + 1*variables[1]*variables[5]*variables[5]) + this->get_coefficients()[19]*(4*variables[0]*variables[0]*variables[0]) + this->get_coefficients()[20]*(2*variables[0]*variables[2]*variables[4] + 1*variables[2]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[3] + 1*variables[2]*variables[2]*variables[4] + 1*variables[1]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[3]) + this->get_coefficients()[21]*(1*variables[2]*variables[4]*variables[4]*variables[4] + 3*variables[0]*variables[0]*variables[1]*variables[3] + 3*variables[0]*variables[0]*variables[2]*variables[4] + 1*variables[2]*variables[2]*variables[2]*variables[4] + 1*variables[1]*variables[3]*variables[3]*variables[3] + 1*variables[1]*variables[1]*variables[1]*variables[3]) + this->get_coefficients()[22]*(1*variables[3]*variables[4]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[2]*variables[5] + 2*variables[0]*variables[1]*variables[2]*variables[3] + 1*variables[1]*variables[1]*variables[2]*variables[3] + 1*variables[1]*variables[1]*variables[2]*variables[5] + 1*variables[1]*variables[3]*variables[3]*variables[5] + 2*variables[0]*variables[1]*variables[3]*variables[4] + 2*variables[0]*variables[1]*variables[2]*variables[4] + 1*variables[2]*variables[4]*variables[4]*variables[5] + 1*variables[2]*variables[2]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[2]*variables[4] + 1*variables[2]*variables[3]*variables[4]*variables[4] + 1*variables[1]*variables[3]*variables[3]*variables[4] + 2*variables[0]*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[3]*variables[5] + 1*variables[3]*variables[3]*variables[4]*variables[5]) + this->get_coefficients()[23]*(3*variables[0]*variables[0]*variables[5]*variables[5] + 2*variables[0]*variables[5]*variables[5]*variables[5]) + this->get_coefficients()[24]*(1*variables[3]*variables[3]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[0]*variables[0]*variables[0]*variables[2] + 1*variables[1]*variables[1]*variables[1]*variables[1] + 4*variables[0]*variables[0]*variables[0]*variables[4] + 4*variables[0]*variables[0]*variables[0]*variables[1] + 4*variables[0]*variables[0]*variables[0]*variables[3] + 1*variables[4]*variables[4]*variables[4]*variables[4]) + this->get_coefficients()[25]*(2*variables[0]*variables[2]*variables[2]*variables[4] + 2*variables[0]*variables[1]*variables[1]*variables[3] + 1*variables[1]*variables[1]*variables[3]*variables[3] + 2*variables[0]*variables[2]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[4]*variables[4]) + this->get_coefficients()[26]*(2*variables[0]*variables[3]*variables[4]*variables[4] + 1*variables[3]*variables[3]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[1]*variables[2] + 1*variables[1]*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[3]*variables[3]*variables[4] + 2*variables[0]*variables[1]*variables[2]*variables[2]) + this->get_coefficients()[27]*(1*variables[1]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[2]*variables[3]*variables[5] + 1*variables[2]*variables[3]*variables[4]*variables[5]) + this->get_coefficients()[28]*(1*variables[2]*variables[2]*variables[2]*variables[5] + 1*variables[3]*variables[3]*variables[3]*variables[5] + 1*variables[4]*variables[4]*variables[4]*variables[5] + 3*variables[0]*variables[0]*variables[1]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[5] + 3*variables[0]*variables[0]*variables[2]*variables[3]) + this->get_coefficients()[29]*(1*variables[4]*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[2]*variables[3] + 2*variables[0]*variables[1]*variables[1]*variables[5] + 1*variables[2]*variables[2]*variables[5]*variables[5] + 2*variables[0]*variables[1]*variables[1]*variables[4] + 2*variables[0]*variables[2]*variables[2]*variables[5] + 1*variables[3]*variables[3]*variables[5]*variables[5] + 2*variables[0]*variables[4]*variables[4]*variables[5] + 2*variables[0]*variables[1]*variables[4]*variables[4] + 2*variables[0]*variables[3]*variables[3]*variables[5] + 1*variables[1]*variables[1]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[3]*variables[3]) + this->get_coefficients()[30]*(1*variables[2]*variables[2]*variables[3]*variables[4] + 2*variables[0]*variables[1]*variables[3]*variables[5] + 1*variables[1]*variables[2]*variables[4]*variables[4] + 1*variables[3]*variables[4]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[3]*variables[4] + 1*variables[1]*variables[2]*variables[3]*variables[3] + 1*variables[1]*variables[2]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[4]*variables[5]) + this->get_coefficients()[31]*(3*variables[0]*variables[0]*variables[2]*variables[5] + 1*variables[1]*variables[4]*variables[4]*variables[4] + 1*variables[1]*variables[5]*variables[5]*variables[5] + 1*variables[3]*variables[5]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[1]*variables[4] + 3*variables[0]*variables[0]*variables[3]*variables[5] + 1*variables[4]*variables[5]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[2]*variables[3] + 3*variables[0]*variables[0]*variables[1]*variables[5] + 3*variables[0]*variables[0]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[3]*variables[3] + 1*variables[2]*variables[5]*variables[5]*variables[5]) + this->get_coefficients()[32]*(2*variables[0]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[2]*variables[3] + 2*variables[0]*variables[1]*variables[2]*variables[5] + 1*variables[1]*variables[3]*variables[4]*variables[4] + 1*variables[2]*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[2]*variables[4] + 1*variables[1]*variables[3]*variables[5]*variables[5] + 1*variables[2]*variables[4]*variables[5]*variables[5]) + this->get_coefficients()[33]*(1*variables[2]*variables[2]*variables[3]*variables[5] + 2*variables[0]*variables[2]*variables[3]*variables[5] + 1*variables[1]*variables[4]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[3]*variables[5] + 1*variables[1]*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[1]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[4]*variables[5]) + this->get_coefficients()[34]*(4*variables[0]*variables[0]*variables[0]*variables[5] + 1*variables[5]*variables[5]*variables[5]*variables[5]) + this->get_coefficients()[35]*(3*variables[0]*variables[0]*variables[3]*variables[3] + 3*variables[0]*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[1]*variables[1]*variables[1] + 3*variables[0]*variables[0]*variables[1]*variables[1] + 2*variables[0]*variables[4]*variables[4]*variables[4] + 2*variables[0]*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[4]*variables[4] + 2*variables[0]*variables[3]*variables[3]*variables[3]) + this->get_coefficients()[36]*(1*variables[1]*variables[1]*variables[4]*variables[4] + 2*variables[0]*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[5]*variables[5] + 2*variables[0]*variables[3]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[5]*variables[5]) + this->get_coefficients()[37]*(5*variables[0]*variables[0]*variables[0]*variables[0]) + this->get_coefficients()[38]*(1*variables[3]*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[2] + 1*variables[1]*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[3]*variables[4] + 3*variables[0]*variables[0]*variables[1]*variables[2] + 1*variables[3]*variables[4]*variables[4]*variables[4]);
-            grad[1] = 0 + this->get_coefficients()[0]*(1) + this->get_coefficients()[1]*(1*variables[4]) + this->get_coefficients()[2]*(1*variables[3] + 1*variables[5] + 1*variables[2] + 1*variables[0]) + this->get_coefficients()[3]*(2*variables[1]) + this->get_coefficients()[4]*(1*variables[4]*variables[4] + 2*variables[1]*variables[4]) + this->get_coefficients()[5]*(3*variables[1]*variables[1]) + this->get_coefficients()[6]*(1*variables[3]*variables[5] + 1*variables[0]*variables[2]) + this->get_coefficients()[7]*(1*variables[3]*variables[3] + 2*variables[0]*variables[1] + 1*variables[0]*variables[0] + 1*variables[2]*variables[2] + 1*variables[5]*variables[5] + 2*variables[1]*variables[5] + 2*variables[1]*variables[2] + 2*variables[1]*variables[3]) + this->get_coefficients()[8]*(1*variables[0]*variables[3] + 1*variables[2]*variables[5]) + this->get_coefficients()[9]*(1*variables[2]*variables[4] + 1*variables[4]*variables[5] + 1*variables[2]*variables[3] + 1*variables[3]*variables[4] + 1*variables[0]*variables[4] + 1*variables[0]*variables[5]) + this->get_coefficients()[10]*(1*variables[0]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[4]) + this->get_coefficients()[11]*(2*variables[1]*variables[4]*variables[4]) + this->get_coefficients()[12]*(1*variables[3]*variables[5]*variables[5] + 1*variables[0]*variables[2]*variables[2] + 1*variables[0]*variables[0]*variables[2] + 2*variables[1]*variables[3]*variables[5] + 1*variables[3]*variables[3]*variables[5] + 2*variables[0]*variables[1]*variables[2]) + this->get_coefficients()[13]*(1*variables[2]*variables[3]*variables[5] + 1*variables[2]*variables[4]*variables[5] + 1*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[3]*variables[5] + 1*variables[0]*variables[2]*variables[3] + 1*variables[0]*variables[2]*variables[5] + 1*variables[0]*variables[3]*variables[4] + 1*variables[0]*variables[2]*variables[4]) + this->get_coefficients()[14]*(3*variables[1]*variables[1]*variables[4] + 1*variables[4]*variables[4]*variables[4]) + this->get_coefficients()[15]*(3*variables[0]*variables[1]*variables[1] + 3*variables[1]*variables[1]*variables[3] + 1*variables[3]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[2] + 3*variables[1]*variables[1]*variables[5] + 1*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[1]*variables[2] + 1*variables[0]*variables[0]*variables[0]) + this->get_coefficients()[16]*(2*variables[1]*variables[3]*variables[3] + 2*variables[1]*variables[5]*variables[5] + 2*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[0]*variables[1]) + this->get_coefficients()[17]*(2*variables[0]*variables[1]*variables[5] + 1*variables[3]*variables[3]*variables[4] + 2*variables[1]*variables[2]*variables[3] + 1*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[4] + 1*variables[2]*variables[2]*variables[4]) + this->get_coefficients()[18]*(1*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[5] + 1*variables[2]*variables[3]*variables[3] + 1*variables[3]*variables[4]*variables[4] + 2*variables[1]*variables[4]*variables[5] + 2*variables[0]*variables[1]*variables[4] + 1*variables[2]*variables[4]*variables[4] + 2*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[4] + 1*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[5]*variables[5]) + this->get_coefficients()[19]*(4*variables[1]*variables[1]*variables[1]) + this->get_coefficients()[20]*(1*variables[2]*variables[2]*variables[5] + 2*variables[0]*variables[1]*variables[3] + 1*variables[2]*variables[5]*variables[5] + 2*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[3]) + this->get_coefficients()[21]*(1*variables[0]*variables[0]*variables[0]*variables[3] + 1*variables[2]*variables[2]*variables[2]*variables[5] + 1*variables[2]*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[3]*variables[3]*variables[3] + 3*variables[0]*variables[1]*variables[1]*variables[3]) + this->get_coefficients()[22]*(2*variables[1]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[5] + 1*variables[3]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[2]*variables[3] + 1*variables[3]*variables[3]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[5]*variables[5] + 2*variables[0]*variables[1]*variables[2]*variables[3] + 2*variables[0]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[2]*variables[4] + 1*variables[2]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[4] + 1*variables[2]*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[3]*variables[3]*variables[4] + 2*variables[0]*variables[1]*variables[3]*variables[5]) + this->get_coefficients()[23]*(2*variables[1]*variables[4]*variables[4]*variables[4] + 3*variables[1]*variables[1]*variables[4]*variables[4]) + this->get_coefficients()[24]*(1*variables[5]*variables[5]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[1]*variables[1]*variables[1]*variables[5] + 1*variables[3]*variables[3]*variables[3]*variables[3] + 4*variables[0]*variables[1]*variables[1]*variables[1] + 1*variables[0]*variables[0]*variables[0]*variables[0] + 4*variables[1]*variables[1]*variables[1]*variables[2] + 4*variables[1]*variables[1]*variables[1]*variables[3]) + this->get_coefficients()[25]*(2*variables[1]*variables[2]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[1]*variables[3] + 1*variables[2]*variables[2]*variables[5]*variables[5] + 2*variables[1]*variables[2]*variables[2]*variables[5] + 2*variables[0]*variables[1]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[3]*variables[3]) + this->get_coefficients()[26]*(2*variables[1]*variables[3]*variables[3]*variables[5] + 2*variables[0]*variables[0]*variables[1]*variables[2] + 2*variables[0]*variables[1]*variables[2]*variables[2] + 2*variables[1]*variables[3]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[2]*variables[2] + 1*variables[3]*variables[3]*variables[5]*variables[5]) + this->get_coefficients()[27]*(1*variables[0]*variables[3]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[3]*variables[4] + 1*variables[0]*variables[2]*variables[3]*variables[5]) + this->get_coefficients()[28]*(1*variables[3]*variables[3]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[0]*variables[4] + 1*variables[4]*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[1]*variables[2]*variables[3] + 3*variables[0]*variables[1]*variables[1]*variables[5] + 1*variables[2]*variables[2]*variables[2]*variables[4]) + this->get_coefficients()[29]*(2*variables[1]*variables[3]*variables[3]*variables[4] + 1*variables[3]*variables[3]*variables[4]*variables[4] + 2*variables[0]*variables[0]*variables[1]*variables[5] + 2*variables[0]*variables[0]*variables[1]*variables[4] + 1*variables[4]*variables[4]*variables[5]*variables[5] + 2*variables[1]*variables[2]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[2]*variables[3] + 2*variables[1]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[5]*variables[5] + 2*variables[1]*variables[2]*variables[2]*variables[4]) + this->get_coefficients()[30]*(2*variables[1]*variables[2]*variables[4]*variables[5] + 1*variables[3]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[3]*variables[5] + 1*variables[0]*variables[2]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[2]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[2]*variables[5]*variables[5]) + this->get_coefficients()[31]*(1*variables[2]*variables[4]*variables[4]*variables[4] + 1*variables[0]*variables[4]*variables[4]*variables[4] + 1*variables[0]*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[1]*variables[2]*variables[4] + 3*variables[0]*variables[1]*variables[1]*variables[4] + 1*variables[2]*variables[3]*variables[3]*variables[3] + 3*variables[1]*variables[1]*variables[4]*variables[5] + 1*variables[4]*variables[4]*variables[4]*variables[5] + 1*variables[3]*variables[4]*variables[4]*variables[4] + 3*variables[1]*variables[1]*variables[3]*variables[4] + 1*variables[2]*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[0]*variables[5]) + this->get_coefficients()[32]*(1*variables[0]*variables[2]*variables[2]*variables[3] + 2*variables[1]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[2]*variables[5] + 1*variables[0]*variables[3]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[2]*variables[4] + 1*variables[2]*variables[4]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[3]*variables[5]*variables[5]) + this->get_coefficients()[33]*(1*variables[2]*variables[2]*variables[3]*variables[4] + 1*variables[2]*variables[3]*variables[3]*variables[4] + 1*variables[0]*variables[4]*variables[4]*variables[5] + 2*variables[1]*variables[2]*variables[3]*variables[4] + 1*variables[0]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[4]*variables[5]) + this->get_coefficients()[34]*(4*variables[1]*variables[1]*variables[1]*variables[4] + 1*variables[4]*variables[4]*variables[4]*variables[4]) + this->get_coefficients()[35]*(3*variables[1]*variables[1]*variables[3]*variables[3] + 2*variables[1]*variables[2]*variables[2]*variables[2] + 3*variables[1]*variables[1]*variables[5]*variables[5] + 3*variables[0]*variables[0]*variables[1]*variables[1] + 2*variables[1]*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[0]*variables[0]*variables[1] + 2*variables[1]*variables[3]*variables[3]*variables[3]) + this->get_coefficients()[36]*(2*variables[0]*variables[1]*variables[4]*variables[4] + 2*variables[1]*variables[3]*variables[4]*variables[4] + 1*variables[2]*variables[2]*variables[3]*variables[3] + 2*variables[1]*variables[2]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[5]*variables[5] + 2*variables[1]*variables[4]*variables[4]*variables[5]) + this->get_coefficients()[37]*(5*variables[1]*variables[1]*variables[1]*variables[1]) + this->get_coefficients()[38]*(1*variables[3]*variables[3]*variables[3]*variables[5] + 3*variables[0]*variables[1]*variables[1]*variables[2] + 1*variables[3]*variables[5]*variables[5]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[2] + 3*variables[1]*variables[1]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[2]);
-            grad[2] = 0 + this->get_coefficients()[0]*(1) + this->get_coefficients()[1]*(1*variables[3]) + this->get_coefficients()[2]*(1*variables[4] + 1*variables[0] + 1*variables[5] + 1*variables[1]) + this->get_coefficients()[3]*(2*variables[2]) + this->get_coefficients()[4]*(2*variables[2]*variables[3] + 1*variables[3]*variables[3]) + this->get_coefficients()[5]*(3*variables[2]*variables[2]) + this->get_coefficients()[6]*(1*variables[4]*variables[5] + 1*variables[0]*variables[1]) + this->get_coefficients()[7]*(1*variables[0]*variables[0] + 2*variables[2]*variables[5] + 2*variables[1]*variables[2] + 1*variables[4]*variables[4] + 2*variables[0]*variables[2] + 2*variables[2]*variables[4] + 1*variables[5]*variables[5] + 1*variables[1]*variables[1]) + this->get_coefficients()[8]*(1*variables[0]*variables[4] + 1*variables[1]*variables[5]) + this->get_coefficients()[9]*(1*variables[1]*variables[4] + 1*variables[3]*variables[4] + 1*variables[3]*variables[5] + 1*variables[0]*variables[3] + 1*variables[0]*variables[5] + 1*variables[1]*variables[3]) + this->get_coefficients()[10]*(1*variables[0]*variables[3]*variables[5] + 1*variables[1]*variables[3]*variables[4]) + this->get_coefficients()[11]*(2*variables[2]*variables[3]*variables[3]) + this->get_coefficients()[12]*(2*variables[0]*variables[1]*variables[2] + 1*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[1] + 1*variables[4]*variables[5]*variables[5] + 2*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[1]) + this->get_coefficients()[13]*(1*variables[1]*variables[3]*variables[5] + 1*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[3] + 1*variables[0]*variables[3]*variables[4] + 1*variables[0]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[5] + 1*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[4]) + this->get_coefficients()[14]*(1*variables[3]*variables[3]*variables[3] + 3*variables[2]*variables[2]*variables[3]) + this->get_coefficients()[15]*(1*variables[4]*variables[4]*variables[4] + 3*variables[1]*variables[2]*variables[2] + 3*variables[2]*variables[2]*variables[4] + 1*variables[1]*variables[1]*variables[1] + 1*variables[0]*variables[0]*variables[0] + 1*variables[5]*variables[5]*variables[5] + 3*variables[0]*variables[2]*variables[2] + 3*variables[2]*variables[2]*variables[5]) + this->get_coefficients()[16]*(2*variables[2]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[2] + 2*variables[1]*variables[1]*variables[2] + 2*variables[2]*variables[4]*variables[4]) + this->get_coefficients()[17]*(2*variables[0]*variables[2]*variables[5] + 1*variables[3]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[3] + 1*variables[3]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[4] + 1*variables[0]*variables[0]*variables[3]) + this->get_coefficients()[18]*(2*variables[1]*variables[2]*variables[3] + 2*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[5] + 1*variables[3]*variables[3]*variables[5] + 1*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[3]*variables[3] + 2*variables[2]*variables[3]*variables[4] + 1*variables[0]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[3] + 1*variables[1]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[4]) + this->get_coefficients()[19]*(4*variables[2]*variables[2]*variables[2]) + this->get_coefficients()[20]*(1*variables[0]*variables[0]*variables[4] + 1*variables[0]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[5] + 1*variables[1]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[4] + 1*variables[1]*variables[1]*variables[5]) + this->get_coefficients()[21]*(1*variables[0]*variables[4]*variables[4]*variables[4] + 3*variables[1]*variables[2]*variables[2]*variables[5] + 1*variables[1]*variables[5]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[4] + 3*variables[0]*variables[2]*variables[2]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[5]) + this->get_coefficients()[22]*(1*variables[3]*variables[4]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[3]*variables[5] + 2*variables[0]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[3] + 1*variables[3]*variables[4]*variables[5]*variables[5] + 1*variables[1]*variables[3]*variables[5]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[3] + 1*variables[0]*variables[1]*variables[1]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[4] + 1*variables[0]*variables[4]*variables[4]*variables[5] + 1*variables[1]*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[4]*variables[5] + 2*variables[0]*variables[1]*variables[2]*variables[4] + 1*variables[0]*variables[3]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[3]*variables[4]) + this->get_coefficients()[23]*(2*variables[2]*variables[3]*variables[3]*variables[3] + 3*variables[2]*variables[2]*variables[3]*variables[3]) + this->get_coefficients()[24]*(4*variables[2]*variables[2]*variables[2]*variables[5] + 4*variables[1]*variables[2]*variables[2]*variables[2] + 4*variables[2]*variables[2]*variables[2]*variables[4] + 4*variables[0]*variables[2]*variables[2]*variables[2] + 1*variables[0]*variables[0]*variables[0]*variables[0] + 1*variables[1]*variables[1]*variables[1]*variables[1] + 1*variables[4]*variables[4]*variables[4]*variables[4] + 1*variables[5]*variables[5]*variables[5]*variables[5]) + this->get_coefficients()[25]*(1*variables[1]*variables[1]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[2]*variables[4] + 2*variables[1]*variables[2]*variables[5]*variables[5] + 2*variables[1]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[0]*variables[4]*variables[4] + 2*variables[0]*variables[2]*variables[4]*variables[4]) + this->get_coefficients()[26]*(2*variables[2]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[1] + 2*variables[0]*variables[1]*variables[1]*variables[2] + 1*variables[4]*variables[4]*variables[5]*variables[5] + 2*variables[2]*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[1]*variables[2]) + this->get_coefficients()[27]*(1*variables[1]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[1]*variables[3]*variables[5] + 1*variables[0]*variables[3]*variables[4]*variables[5]) + this->get_coefficients()[28]*(3*variables[0]*variables[2]*variables[2]*variables[5] + 1*variables[1]*variables[1]*variables[1]*variables[3] + 1*variables[3]*variables[4]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[0]*variables[3] + 1*variables[3]*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[2]*variables[2]*variables[4]) + this->get_coefficients()[29]*(2*variables[0]*variables[0]*variables[2]*variables[3] + 2*variables[0]*variables[2]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[2]*variables[5] + 1*variables[1]*variables[1]*variables[3]*variables[3] + 2*variables[1]*variables[2]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[2]*variables[3] + 2*variables[2]*variables[3]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[3]*variables[3] + 1*variables[3]*variables[3]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[2]*variables[4] + 2*variables[2]*variables[3]*variables[5]*variables[5] + 1*variables[3]*variables[3]*variables[5]*variables[5]) + this->get_coefficients()[30]*(1*variables[1]*variables[1]*variables[4]*variables[5] + 2*variables[0]*variables[2]*variables[3]*variables[4] + 1*variables[3]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[4]*variables[4] + 1*variables[0]*variables[1]*variables[3]*variables[3] + 2*variables[1]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[4]*variables[5]) + this->get_coefficients()[31]*(1*variables[3]*variables[3]*variables[3]*variables[5] + 1*variables[1]*variables[4]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[0]*variables[5] + 3*variables[2]*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[4] + 1*variables[1]*variables[3]*variables[3]*variables[3] + 3*variables[0]*variables[2]*variables[2]*variables[3] + 3*variables[2]*variables[2]*variables[3]*variables[5] + 3*variables[1]*variables[2]*variables[2]*variables[3] + 1*variables[3]*variables[3]*variables[3]*variables[4] + 1*variables[0]*variables[3]*variables[3]*variables[3] + 1*variables[0]*variables[5]*variables[5]*variables[5]) + this->get_coefficients()[32]*(2*variables[0]*variables[1]*variables[2]*variables[3] + 2*variables[2]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[5] + 1*variables[0]*variables[3]*variables[3]*variables[4] + 1*variables[0]*variables[1]*variables[1]*variables[4] + 1*variables[1]*variables[4]*variables[4]*variables[5] + 1*variables[1]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[4]*variables[5]*variables[5]) + this->get_coefficients()[33]*(2*variables[1]*variables[2]*variables[3]*variables[4] + 2*variables[0]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[3]*variables[5] + 1*variables[1]*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[3]*variables[5]*variables[5] + 1*variables[1]*variables[3]*variables[4]*variables[4]) + this->get_coefficients()[34]*(4*variables[2]*variables[2]*variables[2]*variables[3] + 1*variables[3]*variables[3]*variables[3]*variables[3]) + this->get_coefficients()[35]*(2*variables[0]*variables[0]*variables[0]*variables[2] + 3*variables[1]*variables[1]*variables[2]*variables[2] + 3*variables[2]*variables[2]*variables[5]*variables[5] + 2*variables[2]*variables[4]*variables[4]*variables[4] + 2*variables[2]*variables[5]*variables[5]*variables[5] + 3*variables[2]*variables[2]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[1]*variables[2] + 3*variables[0]*variables[0]*variables[2]*variables[2]) + this->get_coefficients()[36]*(2*variables[1]*variables[2]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[4]*variables[4] + 2*variables[0]*variables[2]*variables[3]*variables[3] + 2*variables[2]*variables[3]*variables[3]*variables[4] + 2*variables[2]*variables[3]*variables[3]*variables[5]) + this->get_coefficients()[37]*(5*variables[2]*variables[2]*variables[2]*variables[2]) + this->get_coefficients()[38]*(1*variables[0]*variables[1]*variables[1]*variables[1] + 3*variables[2]*variables[2]*variables[4]*variables[5] + 1*variables[4]*variables[4]*variables[4]*variables[5] + 3*variables[0]*variables[1]*variables[2]*variables[2] + 1*variables[4]*variables[5]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[1]);
-            grad[3] = 0 + this->get_coefficients()[0]*(1) + this->get_coefficients()[1]*(1*variables[2]) + this->get_coefficients()[2]*(1*variables[1] + 1*variables[5] + 1*variables[4] + 1*variables[0]) + this->get_coefficients()[3]*(2*variables[3]) + this->get_coefficients()[4]*(1*variables[2]*variables[2] + 2*variables[2]*variables[3]) + this->get_coefficients()[5]*(3*variables[3]*variables[3]) + this->get_coefficients()[6]*(1*variables[0]*variables[4] + 1*variables[1]*variables[5]) + this->get_coefficients()[7]*(1*variables[0]*variables[0] + 2*variables[1]*variables[3] + 2*variables[0]*variables[3] + 2*variables[3]*variables[4] + 1*variables[4]*variables[4] + 2*variables[3]*variables[5] + 1*variables[5]*variables[5] + 1*variables[1]*variables[1]) + this->get_coefficients()[8]*(1*variables[0]*variables[1] + 1*variables[4]*variables[5]) + this->get_coefficients()[9]*(1*variables[2]*variables[4] + 1*variables[2]*variables[5] + 1*variables[0]*variables[2] + 1*variables[1]*variables[2] + 1*variables[1]*variables[4] + 1*variables[0]*variables[5]) + this->get_coefficients()[10]*(1*variables[0]*variables[2]*variables[5] + 1*variables[1]*variables[2]*variables[4]) + this->get_coefficients()[11]*(2*variables[2]*variables[2]*variables[3]) + this->get_coefficients()[12]*(1*variables[1]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[4] + 2*variables[0]*variables[3]*variables[4] + 1*variables[0]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[5] + 2*variables[1]*variables[3]*variables[5]) + this->get_coefficients()[13]*(1*variables[1]*variables[2]*variables[5] + 1*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[5] + 1*variables[0]*variables[1]*variables[2] + 1*variables[0]*variables[2]*variables[4] + 1*variables[0]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[4] + 1*variables[2]*variables[4]*variables[5]) + this->get_coefficients()[14]*(3*variables[2]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[2]) + this->get_coefficients()[15]*(1*variables[0]*variables[0]*variables[0] + 3*variables[3]*variables[3]*variables[4] + 3*variables[3]*variables[3]*variables[5] + 1*variables[1]*variables[1]*variables[1] + 3*variables[1]*variables[3]*variables[3] + 1*variables[5]*variables[5]*variables[5] + 3*variables[0]*variables[3]*variables[3] + 1*variables[4]*variables[4]*variables[4]) + this->get_coefficients()[16]*(2*variables[1]*variables[1]*variables[3] + 2*variables[3]*variables[4]*variables[4] + 2*variables[0]*variables[0]*variables[3] + 2*variables[3]*variables[5]*variables[5]) + this->get_coefficients()[17]*(1*variables[2]*variables[5]*variables[5] + 2*variables[1]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[2] + 1*variables[2]*variables[4]*variables[4] + 2*variables[0]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[2]) + this->get_coefficients()[18]*(1*variables[1]*variables[2]*variables[2] + 1*variables[2]*variables[2]*variables[5] + 2*variables[0]*variables[2]*variables[3] + 2*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[5] + 2*variables[2]*variables[3]*variables[4] + 2*variables[1]*variables[2]*variables[3] + 1*variables[2]*variables[2]*variables[4] + 1*variables[1]*variables[4]*variables[4] + 1*variables[0]*variables[5]*variables[5] + 1*variables[0]*variables[2]*variables[2] + 1*variables[1]*variables[1]*variables[4]) + this->get_coefficients()[19]*(4*variables[3]*variables[3]*variables[3]) + this->get_coefficients()[20]*(1*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[1] + 2*variables[3]*variables[4]*variables[5] + 1*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[1]*variables[3] + 1*variables[0]*variables[0]*variables[1]) + this->get_coefficients()[21]*(1*variables[0]*variables[0]*variables[0]*variables[1] + 3*variables[3]*variables[3]*variables[4]*variables[5] + 1*variables[4]*variables[5]*variables[5]*variables[5] + 1*variables[4]*variables[4]*variables[4]*variables[5] + 3*variables[0]*variables[1]*variables[3]*variables[3] + 1*variables[0]*variables[1]*variables[1]*variables[1]) + this->get_coefficients()[22]*(1*variables[0]*variables[4]*variables[4]*variables[5] + 1*variables[2]*variables[4]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[2]*variables[5] + 1*variables[1]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[2] + 1*variables[2]*variables[4]*variables[5]*variables[5] + 2*variables[1]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[5]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[2] + 2*variables[0]*variables[1]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[4] + 1*variables[0]*variables[2]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[2]*variables[4] + 1*variables[0]*variables[1]*variables[1]*variables[5] + 2*variables[0]*variables[3]*variables[4]*variables[5]) + this->get_coefficients()[23]*(3*variables[2]*variables[2]*variables[3]*variables[3] + 2*variables[2]*variables[2]*variables[2]*variables[3]) + this->get_coefficients()[24]*(1*variables[5]*variables[5]*variables[5]*variables[5] + 4*variables[0]*variables[3]*variables[3]*variables[3] + 4*variables[1]*variables[3]*variables[3]*variables[3] + 4*variables[3]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[0] + 1*variables[4]*variables[4]*variables[4]*variables[4] + 4*variables[3]*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[1]) + this->get_coefficients()[25]*(2*variables[3]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[1] + 1*variables[4]*variables[4]*variables[5]*variables[5] + 2*variables[3]*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[1]*variables[1]*variables[3] + 2*variables[0]*variables[0]*variables[1]*variables[3]) + this->get_coefficients()[26]*(2*variables[1]*variables[1]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[4]*variables[4] + 2*variables[0]*variables[3]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[3]*variables[4] + 2*variables[1]*variables[3]*variables[5]*variables[5]) + this->get_coefficients()[27]*(1*variables[0]*variables[1]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[2]*variables[4] + 1*variables[0]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[2]*variables[4]*variables[5]) + this->get_coefficients()[28]*(3*variables[0]*variables[3]*variables[3]*variables[5] + 3*variables[1]*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[2] + 1*variables[2]*variables[4]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[0]*variables[2] + 1*variables[2]*variables[5]*variables[5]*variables[5]) + this->get_coefficients()[29]*(2*variables[1]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[2]*variables[2] + 2*variables[1]*variables[3]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[2]*variables[3] + 1*variables[1]*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[3]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[4]*variables[4] + 2*variables[0]*variables[0]*variables[3]*variables[5] + 2*variables[0]*variables[0]*variables[2]*variables[3] + 2*variables[2]*variables[3]*variables[4]*variables[4] + 1*variables[2]*variables[2]*variables[5]*variables[5] + 2*variables[2]*variables[3]*variables[5]*variables[5]) + this->get_coefficients()[30]*(1*variables[1]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[4] + 1*variables[0]*variables[0]*variables[1]*variables[5] + 2*variables[2]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[4] + 2*variables[0]*variables[1]*variables[2]*variables[3] + 1*variables[1]*variables[2]*variables[2]*variables[5]) + this->get_coefficients()[31]*(3*variables[2]*variables[3]*variables[3]*variables[5] + 1*variables[2]*variables[2]*variables[2]*variables[4] + 1*variables[0]*variables[5]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[5] + 3*variables[1]*variables[2]*variables[3]*variables[3] + 1*variables[1]*variables[4]*variables[4]*variables[4] + 1*variables[0]*variables[2]*variables[2]*variables[2] + 1*variables[1]*variables[1]*variables[1]*variables[4] + 1*variables[2]*variables[2]*variables[2]*variables[5] + 1*variables[1]*variables[2]*variables[2]*variables[2] + 3*variables[2]*variables[3]*variables[3]*variables[4] + 3*variables[0]*variables[2]*variables[3]*variables[3]) + this->get_coefficients()[32]*(1*variables[0]*variables[0]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[2]*variables[2] + 1*variables[2]*variables[2]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[4]*variables[4] + 2*variables[0]*variables[2]*variables[3]*variables[4] + 2*variables[1]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[5]*variables[5]) + this->get_coefficients()[33]*(1*variables[1]*variables[2]*variables[2]*variables[4] + 1*variables[0]*variables[2]*variables[2]*variables[5] + 1*variables[0]*variables[0]*variables[2]*variables[5] + 2*variables[1]*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[2]*variables[4] + 2*variables[0]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[2]*variables[5]*variables[5] + 1*variables[1]*variables[2]*variables[4]*variables[4]) + this->get_coefficients()[34]*(1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[2]*variables[3]*variables[3]*variables[3]) + this->get_coefficients()[35]*(2*variables[0]*variables[0]*variables[0]*variables[3] + 3*variables[3]*variables[3]*variables[5]*variables[5] + 3*variables[3]*variables[3]*variables[4]*variables[4] + 2*variables[3]*variables[4]*variables[4]*variables[4] + 2*variables[3]*variables[5]*variables[5]*variables[5] + 2*variables[1]*variables[1]*variables[1]*variables[3] + 3*variables[0]*variables[0]*variables[3]*variables[3] + 3*variables[1]*variables[1]*variables[3]*variables[3]) + this->get_coefficients()[36]*(1*variables[1]*variables[1]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[2]*variables[3] + 2*variables[2]*variables[2]*variables[3]*variables[4] + 2*variables[2]*variables[2]*variables[3]*variables[5]) + this->get_coefficients()[37]*(5*variables[3]*variables[3]*variables[3]*variables[3]) + this->get_coefficients()[38]*(3*variables[0]*variables[3]*variables[3]*variables[4] + 3*variables[1]*variables[3]*variables[3]*variables[5] + 1*variables[1]*variables[5]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[1]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[4] + 1*variables[0]*variables[4]*variables[4]*variables[4]);
-            grad[4] = 0 + this->get_coefficients()[0]*(1) + this->get_coefficients()[1]*(1*variables[1]) + this->get_coefficients()[2]*(1*variables[5] + 1*variables[2] + 1*variables[0] + 1*variables[3]) + this->get_coefficients()[3]*(2*variables[4]) + this->get_coefficients()[4]*(2*variables[1]*variables[4] + 1*variables[1]*variables[1]) + this->get_coefficients()[5]*(3*variables[4]*variables[4]) + this->get_coefficients()[6]*(1*variables[0]*variables[3] + 1*variables[2]*variables[5]) + this->get_coefficients()[7]*(2*variables[2]*variables[4] + 1*variables[3]*variables[3] + 2*variables[4]*variables[5] + 2*variables[3]*variables[4] + 1*variables[0]*variables[0] + 1*variables[5]*variables[5] + 1*variables[2]*variables[2] + 2*variables[0]*variables[4]) + this->get_coefficients()[8]*(1*variables[0]*variables[2] + 1*variables[3]*variables[5]) + this->get_coefficients()[9]*(1*variables[1]*variables[2] + 1*variables[1]*variables[5] + 1*variables[2]*variables[3] + 1*variables[0]*variables[5] + 1*variables[1]*variables[3] + 1*variables[0]*variables[1]) + this->get_coefficients()[10]*(1*variables[0]*variables[1]*variables[5] + 1*variables[1]*variables[2]*variables[3]) + this->get_coefficients()[11]*(2*variables[1]*variables[1]*variables[4]) + this->get_coefficients()[12]*(1*variables[0]*variables[0]*variables[3] + 1*variables[0]*variables[3]*variables[3] + 2*variables[2]*variables[4]*variables[5] + 2*variables[0]*variables[3]*variables[4] + 1*variables[2]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[5]) + this->get_coefficients()[13]*(1*variables[1]*variables[2]*variables[5] + 1*variables[1]*variables[3]*variables[5] + 1*variables[0]*variables[2]*variables[3] + 1*variables[0]*variables[2]*variables[5] + 1*variables[0]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[3] + 1*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[2]) + this->get_coefficients()[14]*(1*variables[1]*variables[1]*variables[1] + 3*variables[1]*variables[4]*variables[4]) + this->get_coefficients()[15]*(1*variables[5]*variables[5]*variables[5] + 1*variables[3]*variables[3]*variables[3] + 3*variables[2]*variables[4]*variables[4] + 1*variables[2]*variables[2]*variables[2] + 3*variables[4]*variables[4]*variables[5] + 3*variables[0]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[0] + 3*variables[3]*variables[4]*variables[4]) + this->get_coefficients()[16]*(2*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[4] + 2*variables[3]*variables[3]*variables[4] + 2*variables[2]*variables[2]*variables[4]) + this->get_coefficients()[17]*(2*variables[0]*variables[4]*variables[5] + 1*variables[1]*variables[3]*variables[3] + 2*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[1] + 1*variables[1]*variables[2]*variables[2]) + this->get_coefficients()[18]*(1*variables[0]*variables[5]*variables[5] + 1*variables[2]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[5] + 2*variables[1]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[5] + 1*variables[0]*variables[1]*variables[1] + 2*variables[1]*variables[2]*variables[4] + 1*variables[1]*variables[1]*variables[3] + 2*variables[0]*variables[1]*variables[4] + 1*variables[1]*variables[1]*variables[2] + 2*variables[1]*variables[4]*variables[5]) + this->get_coefficients()[19]*(4*variables[4]*variables[4]*variables[4]) + this->get_coefficients()[20]*(1*variables[0]*variables[0]*variables[2] + 2*variables[0]*variables[2]*variables[4] + 2*variables[3]*variables[4]*variables[5] + 1*variables[3]*variables[3]*variables[5] + 1*variables[3]*variables[5]*variables[5] + 1*variables[0]*variables[2]*variables[2]) + this->get_coefficients()[21]*(3*variables[0]*variables[2]*variables[4]*variables[4] + 1*variables[3]*variables[3]*variables[3]*variables[5] + 1*variables[3]*variables[5]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[2] + 3*variables[3]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[2]) + this->get_coefficients()[22]*(2*variables[0]*variables[3]*variables[4]*variables[5] + 2*variables[2]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[3]*variables[5]*variables[5] + 1*variables[2]*variables[3]*variables[5]*variables[5] + 1*variables[1]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[3] + 1*variables[0]*variables[0]*variables[1]*variables[2] + 2*variables[0]*variables[2]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[5]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[5] + 1*variables[0]*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[2]*variables[2]*variables[5] + 1*variables[0]*variables[1]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[2]*variables[3] + 1*variables[0]*variables[3]*variables[3]*variables[5]) + this->get_coefficients()[23]*(3*variables[1]*variables[1]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[1]*variables[4]) + this->get_coefficients()[24]*(1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[4]*variables[4]*variables[4]*variables[5] + 1*variables[5]*variables[5]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[0] + 4*variables[3]*variables[4]*variables[4]*variables[4] + 1*variables[3]*variables[3]*variables[3]*variables[3] + 4*variables[2]*variables[4]*variables[4]*variables[4] + 4*variables[0]*variables[4]*variables[4]*variables[4]) + this->get_coefficients()[25]*(1*variables[0]*variables[0]*variables[2]*variables[2] + 2*variables[3]*variables[3]*variables[4]*variables[5] + 2*variables[3]*variables[4]*variables[5]*variables[5] + 1*variables[3]*variables[3]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[2]*variables[4] + 2*variables[0]*variables[2]*variables[2]*variables[4]) + this->get_coefficients()[26]*(2*variables[0]*variables[0]*variables[3]*variables[4] + 2*variables[2]*variables[2]*variables[4]*variables[5] + 2*variables[0]*variables[3]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[3]*variables[3] + 2*variables[2]*variables[4]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[5]*variables[5]) + this->get_coefficients()[27]*(1*variables[0]*variables[1]*variables[3]*variables[5] + 1*variables[1]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[1]*variables[2]*variables[3] + 1*variables[0]*variables[2]*variables[3]*variables[5]) + this->get_coefficients()[28]*(1*variables[1]*variables[3]*variables[3]*variables[3] + 3*variables[0]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[1] + 1*variables[1]*variables[5]*variables[5]*variables[5] + 3*variables[2]*variables[3]*variables[4]*variables[4] + 1*variables[1]*variables[2]*variables[2]*variables[2]) + this->get_coefficients()[29]*(1*variables[1]*variables[1]*variables[3]*variables[3] + 2*variables[0]*variables[4]*variables[5]*variables[5] + 2*variables[1]*variables[3]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[1]*variables[1] + 2*variables[1]*variables[4]*variables[5]*variables[5] + 2*variables[1]*variables[2]*variables[2]*variables[4] + 2*variables[0]*variables[0]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[5]*variables[5] + 2*variables[2]*variables[2]*variables[3]*variables[4] + 2*variables[0]*variables[0]*variables[1]*variables[4] + 2*variables[2]*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[2]*variables[2]) + this->get_coefficients()[30]*(1*variables[1]*variables[1]*variables[2]*variables[5] + 2*variables[1]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[3] + 1*variables[2]*variables[3]*variables[3]*variables[5] + 2*variables[0]*variables[1]*variables[2]*variables[4] + 1*variables[0]*variables[3]*variables[5]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[3] + 1*variables[0]*variables[0]*variables[2]*variables[5]) + this->get_coefficients()[31]*(3*variables[1]*variables[2]*variables[4]*variables[4] + 3*variables[0]*variables[1]*variables[4]*variables[4] + 1*variables[2]*variables[2]*variables[2]*variables[3] + 1*variables[1]*variables[1]*variables[1]*variables[2] + 1*variables[0]*variables[1]*variables[1]*variables[1] + 1*variables[1]*variables[1]*variables[1]*variables[5] + 3*variables[1]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[3]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[3] + 1*variables[2]*variables[3]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[0]*variables[5]) + this->get_coefficients()[32]*(1*variables[0]*variables[0]*variables[3]*variables[5] + 1*variables[2]*variables[2]*variables[3]*variables[5] + 1*variables[1]*variables[1]*variables[3]*variables[5] + 2*variables[0]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[2]*variables[3]*variables[3] + 1*variables[0]*variables[1]*variables[1]*variables[2] + 2*variables[1]*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[5]*variables[5]) + this->get_coefficients()[33]*(1*variables[1]*variables[2]*variables[2]*variables[3] + 1*variables[1]*variables[2]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[2]*variables[3] + 1*variables[0]*variables[1]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[5] + 2*variables[1]*variables[2]*variables[3]*variables[4] + 1*variables[0]*variables[1]*variables[1]*variables[5]) + this->get_coefficients()[34]*(1*variables[1]*variables[1]*variables[1]*variables[1] + 4*variables[1]*variables[4]*variables[4]*variables[4]) + this->get_coefficients()[35]*(3*variables[4]*variables[4]*variables[5]*variables[5] + 2*variables[3]*variables[3]*variables[3]*variables[4] + 3*variables[3]*variables[3]*variables[4]*variables[4] + 3*variables[2]*variables[2]*variables[4]*variables[4] + 2*variables[2]*variables[2]*variables[2]*variables[4] + 3*variables[0]*variables[0]*variables[4]*variables[4] + 2*variables[0]*variables[0]*variables[0]*variables[4] + 2*variables[4]*variables[5]*variables[5]*variables[5]) + this->get_coefficients()[36]*(2*variables[0]*variables[1]*variables[1]*variables[4] + 1*variables[0]*variables[0]*variables[5]*variables[5] + 2*variables[1]*variables[1]*variables[3]*variables[4] + 2*variables[1]*variables[1]*variables[2]*variables[4] + 1*variables[2]*variables[2]*variables[3]*variables[3] + 2*variables[1]*variables[1]*variables[4]*variables[5]) + this->get_coefficients()[37]*(5*variables[4]*variables[4]*variables[4]*variables[4]) + this->get_coefficients()[38]*(1*variables[0]*variables[3]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[2]*variables[5] + 3*variables[2]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[3] + 1*variables[2]*variables[5]*variables[5]*variables[5] + 3*variables[0]*variables[3]*variables[4]*variables[4]);
-            grad[5] = 0 + this->get_coefficients()[0]*(1) + this->get_coefficients()[1]*(1*variables[0]) + this->get_coefficients()[2]*(1*variables[4] + 1*variables[2] + 1*variables[1] + 1*variables[3]) + this->get_coefficients()[3]*(2*variables[5]) + this->get_coefficients()[4]*(1*variables[0]*variables[0] + 2*variables[0]*variables[5]) + this->get_coefficients()[5]*(3*variables[5]*variables[5]) + this->get_coefficients()[6]*(1*variables[1]*variables[3] + 1*variables[2]*variables[4]) + this->get_coefficients()[7]*(1*variables[2]*variables[2] + 1*variables[4]*variables[4] + 2*variables[1]*variables[5] + 1*variables[3]*variables[3] + 2*variables[3]*variables[5] + 2*variables[4]*variables[5] + 1*variables[1]*variables[1] + 2*variables[2]*variables[5]) + this->get_coefficients()[8]*(1*variables[1]*variables[2] + 1*variables[3]*variables[4]) + this->get_coefficients()[9]*(1*variables[1]*variables[4] + 1*variables[2]*variables[3] + 1*variables[0]*variables[2] + 1*variables[0]*variables[4] + 1*variables[0]*variables[3] + 1*variables[0]*variables[1]) + this->get_coefficients()[10]*(1*variables[0]*variables[1]*variables[4] + 1*variables[0]*variables[2]*variables[3]) + this->get_coefficients()[11]*(2*variables[0]*variables[0]*variables[5]) + this->get_coefficients()[12]*(2*variables[1]*variables[3]*variables[5] + 1*variables[2]*variables[4]*variables[4] + 2*variables[2]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[3] + 1*variables[1]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[4]) + this->get_coefficients()[13]*(1*variables[1]*variables[2]*variables[3] + 1*variables[1]*variables[2]*variables[4] + 1*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[1]*variables[3] + 1*variables[0]*variables[2]*variables[4] + 1*variables[0]*variables[1]*variables[2] + 1*variables[0]*variables[3]*variables[4] + 1*variables[2]*variables[3]*variables[4]) + this->get_coefficients()[14]*(3*variables[0]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]) + this->get_coefficients()[15]*(3*variables[4]*variables[5]*variables[5] + 1*variables[3]*variables[3]*variables[3] + 3*variables[3]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[1] + 3*variables[1]*variables[5]*variables[5] + 1*variables[4]*variables[4]*variables[4] + 3*variables[2]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[2]) + this->get_coefficients()[16]*(2*variables[1]*variables[1]*variables[5] + 2*variables[2]*variables[2]*variables[5] + 2*variables[4]*variables[4]*variables[5] + 2*variables[3]*variables[3]*variables[5]) + this->get_coefficients()[17]*(1*variables[0]*variables[1]*variables[1] + 1*variables[0]*variables[2]*variables[2] + 2*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[4]*variables[4] + 2*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[3]*variables[3]) + this->get_coefficients()[18]*(1*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[1] + 1*variables[0]*variables[0]*variables[2] + 1*variables[2]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[3] + 2*variables[0]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[4] + 1*variables[1]*variables[1]*variables[4] + 2*variables[0]*variables[3]*variables[5] + 2*variables[0]*variables[2]*variables[5] + 1*variables[1]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[5]) + this->get_coefficients()[19]*(4*variables[5]*variables[5]*variables[5]) + this->get_coefficients()[20]*(1*variables[1]*variables[2]*variables[2] + 1*variables[3]*variables[4]*variables[4] + 1*variables[3]*variables[3]*variables[4] + 2*variables[1]*variables[2]*variables[5] + 2*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[2]) + this->get_coefficients()[21]*(1*variables[1]*variables[2]*variables[2]*variables[2] + 1*variables[3]*variables[3]*variables[3]*variables[4] + 3*variables[1]*variables[2]*variables[5]*variables[5] + 3*variables[3]*variables[4]*variables[5]*variables[5] + 1*variables[3]*variables[4]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[2]) + this->get_coefficients()[22]*(1*variables[0]*variables[3]*variables[4]*variables[4] + 1*variables[2]*variables[3]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[2]*variables[3] + 1*variables[0]*variables[1]*variables[2]*variables[2] + 2*variables[1]*variables[3]*variables[4]*variables[5] + 2*variables[2]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[3]*variables[3]*variables[4] + 2*variables[1]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[2] + 1*variables[0]*variables[1]*variables[3]*variables[3] + 1*variables[0]*variables[2]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[4] + 1*variables[1]*variables[2]*variables[2]*variables[4] + 1*variables[0]*variables[1]*variables[1]*variables[3] + 1*variables[0]*variables[3]*variables[3]*variables[4]) + this->get_coefficients()[23]*(2*variables[0]*variables[0]*variables[0]*variables[5] + 3*variables[0]*variables[0]*variables[5]*variables[5]) + this->get_coefficients()[24]*(4*variables[3]*variables[5]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[1]*variables[5]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[1]*variables[1] + 1*variables[4]*variables[4]*variables[4]*variables[4] + 4*variables[4]*variables[5]*variables[5]*variables[5] + 1*variables[3]*variables[3]*variables[3]*variables[3] + 4*variables[2]*variables[5]*variables[5]*variables[5]) + this->get_coefficients()[25]*(2*variables[1]*variables[1]*variables[2]*variables[5] + 1*variables[3]*variables[3]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[2]*variables[5] + 2*variables[3]*variables[4]*variables[4]*variables[5] + 2*variables[3]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[2]*variables[2]) + this->get_coefficients()[26]*(1*variables[1]*variables[1]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[3]*variables[5] + 2*variables[2]*variables[4]*variables[4]*variables[5] + 2*variables[2]*variables[2]*variables[4]*variables[5] + 2*variables[1]*variables[3]*variables[3]*variables[5]) + this->get_coefficients()[27]*(1*variables[0]*variables[1]*variables[3]*variables[4] + 1*variables[1]*variables[2]*variables[3]*variables[4] + 1*variables[0]*variables[1]*variables[2]*variables[4] + 1*variables[0]*variables[1]*variables[2]*variables[3] + 1*variables[0]*variables[2]*variables[3]*variables[4]) + this->get_coefficients()[28]*(1*variables[0]*variables[2]*variables[2]*variables[2] + 1*variables[0]*variables[3]*variables[3]*variables[3] + 1*variables[0]*variables[4]*variables[4]*variables[4] + 3*variables[1]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[1] + 3*variables[2]*variables[3]*variables[5]*variables[5]) + this->get_coefficients()[29]*(2*variables[0]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[1] + 2*variables[0]*variables[2]*variables[2]*variables[5] + 2*variables[1]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[1]*variables[5] + 2*variables[2]*variables[2]*variables[3]*variables[5] + 2*variables[2]*variables[3]*variables[3]*variables[5]) + this->get_coefficients()[30]*(1*variables[1]*variables[1]*variables[2]*variables[4] + 1*variables[1]*variables[3]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[1]*variables[3] + 1*variables[2]*variables[3]*variables[3]*variables[4] + 2*variables[0]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[2]*variables[3] + 2*variables[0]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[0]*variables[2]*variables[4]) + this->get_coefficients()[31]*(1*variables[2]*variables[3]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[0]*variables[2] + 3*variables[0]*variables[1]*variables[5]*variables[5] + 3*variables[0]*variables[3]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[3] + 1*variables[1]*variables[1]*variables[1]*variables[4] + 1*variables[1]*variables[4]*variables[4]*variables[4] + 3*variables[0]*variables[4]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[0]*variables[1] + 1*variables[0]*variables[0]*variables[0]*variables[4] + 3*variables[0]*variables[2]*variables[5]*variables[5]) + this->get_coefficients()[32]*(1*variables[0]*variables[0]*variables[3]*variables[4] + 1*variables[2]*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[1]*variables[2] + 1*variables[1]*variables[2]*variables[4]*variables[4] + 1*variables[1]*variables[2]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[3]*variables[5] + 2*variables[0]*variables[2]*variables[4]*variables[5]) + this->get_coefficients()[33]*(1*variables[0]*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[2]*variables[3] + 1*variables[0]*variables[1]*variables[4]*variables[4] + 1*variables[0]*variables[2]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[4] + 2*variables[0]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[4]) + this->get_coefficients()[34]*(1*variables[0]*variables[0]*variables[0]*variables[0] + 4*variables[0]*variables[5]*variables[5]*variables[5]) + this->get_coefficients()[35]*(2*variables[4]*variables[4]*variables[4]*variables[5] + 2*variables[3]*variables[3]*variables[3]*variables[5] + 3*variables[3]*variables[3]*variables[5]*variables[5] + 2*variables[2]*variables[2]*variables[2]*variables[5] + 2*variables[1]*variables[1]*variables[1]*variables[5] + 3*variables[2]*variables[2]*variables[5]*variables[5] + 3*variables[1]*variables[1]*variables[5]*variables[5] + 3*variables[4]*variables[4]*variables[5]*variables[5]) + this->get_coefficients()[36]*(2*variables[0]*variables[0]*variables[4]*variables[5] + 2*variables[0]*variables[0]*variables[2]*variables[5] + 2*variables[0]*variables[0]*variables[3]*variables[5] + 2*variables[0]*variables[0]*variables[1]*variables[5] + 1*variables[1]*variables[1]*variables[4]*variables[4] + 1*variables[2]*variables[2]*variables[3]*variables[3]) + this->get_coefficients()[37]*(5*variables[5]*variables[5]*variables[5]*variables[5]) + this->get_coefficients()[38]*(1*variables[1]*variables[3]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[2]*variables[4] + 3*variables[1]*variables[3]*variables[5]*variables[5] + 1*variables[2]*variables[4]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[3] + 3*variables[2]*variables[4]*variables[5]*variables[5]);
-            return grad;
+        void polynomial_gradient(const double* variables, double* grad) const {
+            const double* coefficients = this->get_coefficients().data();
+            const double x0 = variables[0];
+            const double x1 = variables[1];
+            const double x2 = variables[2];
+            const double x3 = variables[3];
+            const double x4 = variables[4];
+            const double x5 = variables[5];
+            grad[0] = coefficients[0] + x5*(coefficients[1] + x5*(coefficients[4] + x5*(coefficients[14] + x5*coefficients[34]))) + x4*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[15] + x5*coefficients[28] + x4*coefficients[24]))) + x3*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[38])) + x3*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[26]) + x3*(coefficients[15] + x5*coefficients[28] + x4*coefficients[38] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[21])) + x3*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[22]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[32] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[25]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[30] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[28] + x4*coefficients[21] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[31])) + x3*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[32]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[21])) + x2*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[30]) + x3*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*coefficients[30]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[32] + x2*coefficients[38])) + x1*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[36]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[30] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[32] + x3*coefficients[22] + x2*coefficients[26]) + x1*(coefficients[15] + x5*coefficients[28] + x4*coefficients[31] + x3*coefficients[21] + x2*coefficients[38] + x1*coefficients[24]))) + x0*(2*coefficients[3] + x5*(2*coefficients[4] + x5*(2*coefficients[11] + x5*2*coefficients[23])) + x4*(2*coefficients[7] + x5*(2*coefficients[18] + x5*2*coefficients[36]) + x4*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[35])) + x3*(2*coefficients[7] + x5*(2*coefficients[18] + x5*2*coefficients[36]) + x4*(2*coefficients[12] + x5*2*coefficients[32] + x4*2*coefficients[26]) + x3*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[26] + x3*2*coefficients[35])) + x2*(2*coefficients[7] + x5*(2*coefficients[18] + x5*2*coefficients[36]) + x4*(2*coefficients[20] + x5*2*coefficients[30] + x4*2*coefficients[25]) + x3*(2*coefficients[17] + x5*2*coefficients[33] + x4*2*coefficients[22] + x3*2*coefficients[29]) + x2*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[25] + x3*2*coefficients[29] + x2*2*coefficients[35])) + x1*(2*coefficients[7] + x5*(2*coefficients[18] + x5*2*coefficients[36]) + x4*(2*coefficients[17] + x5*2*coefficients[33] + x4*2*coefficients[29]) + x3*(2*coefficients[20] + x5*2*coefficients[30] + x4*2*coefficients[22] + x3*2*coefficients[25]) + x2*(2*coefficients[12] + x5*2*coefficients[32] + x4*2*coefficients[22] + x3*2*coefficients[22] + x2*2*coefficients[26]) + x1*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[29] + x3*2*coefficients[25] + x2*2*coefficients[26] + x1*2*coefficients[35])) + x0*(3*coefficients[5] + x5*(3*coefficients[14] + x5*3*coefficients[23]) + x4*(3*coefficients[15] + x5*3*coefficients[31] + x4*3*coefficients[35]) + x3*(3*coefficients[15] + x5*3*coefficients[31] + x4*3*coefficients[38] + x3*3*coefficients[35]) + x2*(3*coefficients[15] + x5*3*coefficients[31] + x4*3*coefficients[21] + x3*3*coefficients[28] + x2*3*coefficients[35]) + x1*(3*coefficients[15] + x5*3*coefficients[31] + x4*3*coefficients[28] + x3*3*coefficients[21] + x2*3*coefficients[38] + x1*3*coefficients[35]) + x0*(4*coefficients[19] + x5*4*coefficients[34] + x4*4*coefficients[24] + x3*4*coefficients[24] + x2*4*coefficients[24] + x1*4*coefficients[24] + x0*5*coefficients[37])));
+            grad[1] = coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[14] + x5*coefficients[31] + x4*coefficients[34]))) + x3*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[31])) + x3*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[15] + x5*coefficients[38] + x4*coefficients[28] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[31])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[10] + x5*coefficients[27] + x4*coefficients[33]) + x3*(coefficients[18] + x5*coefficients[32] + x4*coefficients[33] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[18] + x5*coefficients[30] + x4*coefficients[33] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[21] + x4*coefficients[28] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(2*coefficients[3] + x5*(2*coefficients[7] + x5*(2*coefficients[16] + x5*2*coefficients[35])) + x4*(2*coefficients[4] + x5*(2*coefficients[18] + x5*2*coefficients[29]) + x4*(2*coefficients[11] + x5*2*coefficients[36] + x4*2*coefficients[23])) + x3*(2*coefficients[7] + x5*(2*coefficients[12] + x5*2*coefficients[26]) + x4*(2*coefficients[18] + x5*2*coefficients[32] + x4*2*coefficients[36]) + x3*(2*coefficients[16] + x5*2*coefficients[26] + x4*2*coefficients[29] + x3*2*coefficients[35])) + x2*(2*coefficients[7] + x5*(2*coefficients[20] + x5*2*coefficients[25]) + x4*(2*coefficients[18] + x5*2*coefficients[30] + x4*2*coefficients[36]) + x3*(2*coefficients[17] + x5*2*coefficients[22] + x4*2*coefficients[33] + x3*2*coefficients[29]) + x2*(2*coefficients[16] + x5*2*coefficients[25] + x4*2*coefficients[29] + x3*2*coefficients[29] + x2*2*coefficients[35])) + x1*(3*coefficients[5] + x5*(3*coefficients[15] + x5*3*coefficients[35]) + x4*(3*coefficients[14] + x5*3*coefficients[31] + x4*3*coefficients[23]) + x3*(3*coefficients[15] + x5*3*coefficients[38] + x4*3*coefficients[31] + x3*3*coefficients[35]) + x2*(3*coefficients[15] + x5*3*coefficients[21] + x4*3*coefficients[31] + x3*3*coefficients[28] + x2*3*coefficients[35]) + x1*(4*coefficients[19] + x5*4*coefficients[24] + x4*4*coefficients[34] + x3*4*coefficients[24] + x2*4*coefficients[24] + x1*5*coefficients[37]))) + x0*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[31])) + x3*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[32]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[21])) + x2*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[30]) + x3*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*coefficients[30]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[32] + x2*coefficients[38])) + x1*(2*coefficients[7] + x5*(2*coefficients[17] + x5*2*coefficients[29]) + x4*(2*coefficients[18] + x5*2*coefficients[33] + x4*2*coefficients[36]) + x3*(2*coefficients[20] + x5*2*coefficients[22] + x4*2*coefficients[30] + x3*2*coefficients[25]) + x2*(2*coefficients[12] + x5*2*coefficients[22] + x4*2*coefficients[32] + x3*2*coefficients[22] + x2*2*coefficients[26]) + x1*(3*coefficients[15] + x5*3*coefficients[28] + x4*3*coefficients[31] + x3*3*coefficients[21] + x2*3*coefficients[38] + x1*4*coefficients[24])) + x0*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[17] + x5*coefficients[33] + x4*coefficients[29]) + x3*(coefficients[20] + x5*coefficients[30] + x4*coefficients[22] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[32] + x4*coefficients[22] + x3*coefficients[22] + x2*coefficients[26]) + x1*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[29] + x3*2*coefficients[25] + x2*2*coefficients[26] + x1*3*coefficients[35]) + x0*(coefficients[15] + x5*coefficients[31] + x4*coefficients[28] + x3*coefficients[21] + x2*coefficients[38] + x1*2*coefficients[35] + x0*coefficients[24])));
+            grad[2] = coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[15] + x5*coefficients[38] + x4*coefficients[24]))) + x3*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[28])) + x3*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[29]) + x3*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*coefficients[34]))) + x2*(2*coefficients[3] + x5*(2*coefficients[7] + x5*(2*coefficients[16] + x5*2*coefficients[35])) + x4*(2*coefficients[7] + x5*(2*coefficients[12] + x5*2*coefficients[26]) + x4*(2*coefficients[16] + x5*2*coefficients[26] + x4*2*coefficients[35])) + x3*(2*coefficients[4] + x5*(2*coefficients[18] + x5*2*coefficients[29]) + x4*(2*coefficients[18] + x5*2*coefficients[32] + x4*2*coefficients[29]) + x3*(2*coefficients[11] + x5*2*coefficients[36] + x4*2*coefficients[36] + x3*2*coefficients[23])) + x2*(3*coefficients[5] + x5*(3*coefficients[15] + x5*3*coefficients[35]) + x4*(3*coefficients[15] + x5*3*coefficients[38] + x4*3*coefficients[35]) + x3*(3*coefficients[14] + x5*3*coefficients[31] + x4*3*coefficients[31] + x3*3*coefficients[23]) + x2*(4*coefficients[19] + x5*4*coefficients[24] + x4*4*coefficients[24] + x3*4*coefficients[34] + x2*5*coefficients[37]))) + x1*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[31])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[10] + x5*coefficients[27] + x4*coefficients[33]) + x3*(coefficients[18] + x5*coefficients[32] + x4*coefficients[33] + x3*coefficients[31])) + x2*(2*coefficients[7] + x5*(2*coefficients[20] + x5*2*coefficients[25]) + x4*(2*coefficients[17] + x5*2*coefficients[22] + x4*2*coefficients[29]) + x3*(2*coefficients[18] + x5*2*coefficients[30] + x4*2*coefficients[33] + x3*2*coefficients[36]) + x2*(3*coefficients[15] + x5*3*coefficients[21] + x4*3*coefficients[28] + x3*3*coefficients[31] + x2*4*coefficients[24])) + x1*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[36]) + x3*(coefficients[17] + x5*coefficients[22] + x4*coefficients[33] + x3*coefficients[29]) + x2*(2*coefficients[16] + x5*2*coefficients[25] + x4*2*coefficients[29] + x3*2*coefficients[29] + x2*3*coefficients[35]) + x1*(coefficients[15] + x5*coefficients[21] + x4*coefficients[31] + x3*coefficients[28] + x2*2*coefficients[35] + x1*coefficients[24]))) + x0*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[21])) + x3*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[22]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[32] + x3*coefficients[31])) + x2*(2*coefficients[7] + x5*(2*coefficients[17] + x5*2*coefficients[29]) + x4*(2*coefficients[20] + x5*2*coefficients[22] + x4*2*coefficients[25]) + x3*(2*coefficients[18] + x5*2*coefficients[33] + x4*2*coefficients[30] + x3*2*coefficients[36]) + x2*(3*coefficients[15] + x5*3*coefficients[28] + x4*3*coefficients[21] + x3*3*coefficients[31] + x2*4*coefficients[24])) + x1*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[30]) + x3*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*coefficients[30]) + x2*(2*coefficients[12] + x5*2*coefficients[22] + x4*2*coefficients[22] + x3*2*coefficients[32] + x2*3*coefficients[38]) + x1*(coefficients[12] + x5*coefficients[22] + x4*coefficients[32] + x3*coefficients[22] + x2*2*coefficients[26] + x1*coefficients[38])) + x0*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[20] + x5*coefficients[30] + x4*coefficients[25]) + x3*(coefficients[17] + x5*coefficients[33] + x4*coefficients[22] + x3*coefficients[29]) + x2*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[25] + x3*2*coefficients[29] + x2*3*coefficients[35]) + x1*(coefficients[12] + x5*coefficients[32] + x4*coefficients[22] + x3*coefficients[22] + x2*2*coefficients[26] + x1*coefficients[26]) + x0*(coefficients[15] + x5*coefficients[31] + x4*coefficients[21] + x3*coefficients[28] + x2*2*coefficients[35] + x1*coefficients[38] + x0*coefficients[24])));
+            grad[3] = coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[15] + x5*coefficients[21] + x4*coefficients[24]))) + x3*(2*coefficients[3] + x5*(2*coefficients[7] + x5*(2*coefficients[16] + x5*2*coefficients[35])) + x4*(2*coefficients[7] + x5*(2*coefficients[20] + x5*2*coefficients[25]) + x4*(2*coefficients[16] + x5*2*coefficients[25] + x4*2*coefficients[35])) + x3*(3*coefficients[5] + x5*(3*coefficients[15] + x5*3*coefficients[35]) + x4*(3*coefficients[15] + x5*3*coefficients[21] + x4*3*coefficients[35]) + x3*(4*coefficients[19] + x5*4*coefficients[24] + x4*4*coefficients[24] + x3*5*coefficients[37]))) + x2*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[28])) + x3*(2*coefficients[4] + x5*(2*coefficients[18] + x5*2*coefficients[29]) + x4*(2*coefficients[18] + x5*2*coefficients[30] + x4*2*coefficients[29]) + x3*(3*coefficients[14] + x5*3*coefficients[31] + x4*3*coefficients[31] + x3*4*coefficients[34])) + x2*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[29]) + x3*(2*coefficients[11] + x5*2*coefficients[36] + x4*2*coefficients[36] + x3*3*coefficients[23]) + x2*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*2*coefficients[23] + x2*coefficients[34]))) + x1*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[31])) + x3*(2*coefficients[7] + x5*(2*coefficients[12] + x5*2*coefficients[26]) + x4*(2*coefficients[17] + x5*2*coefficients[22] + x4*2*coefficients[29]) + x3*(3*coefficients[15] + x5*3*coefficients[38] + x4*3*coefficients[28] + x3*4*coefficients[24])) + x2*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[10] + x5*coefficients[27] + x4*coefficients[33]) + x3*(2*coefficients[18] + x5*2*coefficients[32] + x4*2*coefficients[33] + x3*3*coefficients[31]) + x2*(coefficients[18] + x5*coefficients[30] + x4*coefficients[33] + x3*2*coefficients[36] + x2*coefficients[31])) + x1*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[36]) + x3*(2*coefficients[16] + x5*2*coefficients[26] + x4*2*coefficients[29] + x3*3*coefficients[35]) + x2*(coefficients[17] + x5*coefficients[22] + x4*coefficients[33] + x3*2*coefficients[29] + x2*coefficients[29]) + x1*(coefficients[15] + x5*coefficients[38] + x4*coefficients[31] + x3*2*coefficients[35] + x2*coefficients[28] + x1*coefficients[24]))) + x0*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[38])) + x3*(2*coefficients[7] + x5*(2*coefficients[17] + x5*2*coefficients[29]) + x4*(2*coefficients[12] + x5*2*coefficients[22] + x4*2*coefficients[26]) + x3*(3*coefficients[15] + x5*3*coefficients[28] + x4*3*coefficients[38] + x3*4*coefficients[24])) + x2*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[22]) + x3*(2*coefficients[18] + x5*2*coefficients[33] + x4*2*coefficients[32] + x3*3*coefficients[31]) + x2*(coefficients[18] + x5*coefficients[33] + x4*coefficients[30] + x3*2*coefficients[36] + x2*coefficients[31])) + x1*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[32]) + x3*(2*coefficients[20] + x5*2*coefficients[22] + x4*2*coefficients[22] + x3*3*coefficients[21]) + x2*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*2*coefficients[30] + x2*coefficients[32]) + x1*(coefficients[20] + x5*coefficients[22] + x4*coefficients[30] + x3*2*coefficients[25] + x2*coefficients[22] + x1*coefficients[21])) + x0*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[12] + x5*coefficients[32] + x4*coefficients[26]) + x3*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[26] + x3*3*coefficients[35]) + x2*(coefficients[17] + x5*coefficients[33] + x4*coefficients[22] + x3*2*coefficients[29] + x2*coefficients[29]) + x1*(coefficients[20] + x5*coefficients[30] + x4*coefficients[22] + x3*2*coefficients[25] + x2*coefficients[22] + x1*coefficients[25]) + x0*(coefficients[15] + x5*coefficients[31] + x4*coefficients[38] + x3*2*coefficients[35] + x2*coefficients[28] + x1*coefficients[21] + x0*coefficients[24])));
+            grad[4] = coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(2*coefficients[3] + x5*(2*coefficients[7] + x5*(2*coefficients[16] + x5*2*coefficients[35])) + x4*(3*coefficients[5] + x5*(3*coefficients[15] + x5*3*coefficients[35]) + x4*(4*coefficients[19] + x5*4*coefficients[24] + x4*5*coefficients[37]))) + x3*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(2*coefficients[7] + x5*(2*coefficients[20] + x5*2*coefficients[25]) + x4*(3*coefficients[15] + x5*3*coefficients[21] + x4*4*coefficients[24])) + x3*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(2*coefficients[16] + x5*2*coefficients[25] + x4*3*coefficients[35]) + x3*(coefficients[15] + x5*coefficients[21] + x4*2*coefficients[35] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(2*coefficients[7] + x5*(2*coefficients[12] + x5*2*coefficients[26]) + x4*(3*coefficients[15] + x5*3*coefficients[38] + x4*4*coefficients[24])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(2*coefficients[17] + x5*2*coefficients[22] + x4*3*coefficients[28]) + x3*(coefficients[18] + x5*coefficients[30] + x4*2*coefficients[29] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(2*coefficients[16] + x5*2*coefficients[26] + x4*3*coefficients[35]) + x3*(coefficients[18] + x5*coefficients[32] + x4*2*coefficients[29] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[38] + x4*2*coefficients[35] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(2*coefficients[4] + x5*(2*coefficients[18] + x5*2*coefficients[29]) + x4*(3*coefficients[14] + x5*3*coefficients[31] + x4*4*coefficients[34])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(2*coefficients[18] + x5*2*coefficients[30] + x4*3*coefficients[31]) + x3*(coefficients[17] + x5*coefficients[22] + x4*2*coefficients[29] + x3*coefficients[28])) + x2*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(2*coefficients[18] + x5*2*coefficients[32] + x4*3*coefficients[31]) + x3*(coefficients[10] + x5*coefficients[27] + x4*2*coefficients[33] + x3*coefficients[33]) + x2*(coefficients[17] + x5*coefficients[22] + x4*2*coefficients[29] + x3*coefficients[33] + x2*coefficients[28])) + x1*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(2*coefficients[11] + x5*2*coefficients[36] + x4*3*coefficients[23]) + x3*(coefficients[18] + x5*coefficients[32] + x4*2*coefficients[36] + x3*coefficients[29]) + x2*(coefficients[18] + x5*coefficients[30] + x4*2*coefficients[36] + x3*coefficients[33] + x2*coefficients[29]) + x1*(coefficients[14] + x5*coefficients[31] + x4*2*coefficients[23] + x3*coefficients[31] + x2*coefficients[31] + x1*coefficients[34]))) + x0*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(2*coefficients[7] + x5*(2*coefficients[17] + x5*2*coefficients[29]) + x4*(3*coefficients[15] + x5*3*coefficients[28] + x4*4*coefficients[24])) + x3*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(2*coefficients[12] + x5*2*coefficients[22] + x4*3*coefficients[38]) + x3*(coefficients[12] + x5*coefficients[22] + x4*2*coefficients[26] + x3*coefficients[38])) + x2*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(2*coefficients[20] + x5*2*coefficients[22] + x4*3*coefficients[21]) + x3*(coefficients[13] + x5*coefficients[27] + x4*2*coefficients[22] + x3*coefficients[32]) + x2*(coefficients[20] + x5*coefficients[22] + x4*2*coefficients[25] + x3*coefficients[30] + x2*coefficients[21])) + x1*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(2*coefficients[18] + x5*2*coefficients[33] + x4*3*coefficients[31]) + x3*(coefficients[13] + x5*coefficients[27] + x4*2*coefficients[32] + x3*coefficients[22]) + x2*(coefficients[13] + x5*coefficients[27] + x4*2*coefficients[30] + x3*coefficients[27] + x2*coefficients[22]) + x1*(coefficients[18] + x5*coefficients[33] + x4*2*coefficients[36] + x3*coefficients[30] + x2*coefficients[32] + x1*coefficients[31])) + x0*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(2*coefficients[16] + x5*2*coefficients[29] + x4*3*coefficients[35]) + x3*(coefficients[12] + x5*coefficients[32] + x4*2*coefficients[26] + x3*coefficients[26]) + x2*(coefficients[20] + x5*coefficients[30] + x4*2*coefficients[25] + x3*coefficients[22] + x2*coefficients[25]) + x1*(coefficients[17] + x5*coefficients[33] + x4*2*coefficients[29] + x3*coefficients[22] + x2*coefficients[22] + x1*coefficients[29]) + x0*(coefficients[15] + x5*coefficients[31] + x4*2*coefficients[35] + x3*coefficients[38] + x2*coefficients[21] + x1*coefficients[28] + x0*coefficients[24])));
+            grad[5] = coefficients[0] + x5*(2*coefficients[3] + x5*(3*coefficients[5] + x5*(4*coefficients[19] + x5*5*coefficients[37]))) + x4*(coefficients[2] + x5*(2*coefficients[7] + x5*(3*coefficients[15] + x5*4*coefficients[24])) + x4*(coefficients[7] + x5*(2*coefficients[16] + x5*3*coefficients[35]) + x4*(coefficients[15] + x5*2*coefficients[35] + x4*coefficients[24]))) + x3*(coefficients[2] + x5*(2*coefficients[7] + x5*(3*coefficients[15] + x5*4*coefficients[24])) + x4*(coefficients[8] + x5*(2*coefficients[20] + x5*3*coefficients[21]) + x4*(coefficients[20] + x5*2*coefficients[25] + x4*coefficients[21])) + x3*(coefficients[7] + x5*(2*coefficients[16] + x5*3*coefficients[35]) + x4*(coefficients[20] + x5*2*coefficients[25] + x4*coefficients[25]) + x3*(coefficients[15] + x5*2*coefficients[35] + x4*coefficients[21] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(2*coefficients[7] + x5*(3*coefficients[15] + x5*4*coefficients[24])) + x4*(coefficients[6] + x5*(2*coefficients[12] + x5*3*coefficients[38]) + x4*(coefficients[12] + x5*2*coefficients[26] + x4*coefficients[38])) + x3*(coefficients[9] + x5*(2*coefficients[17] + x5*3*coefficients[28]) + x4*(coefficients[13] + x5*2*coefficients[22] + x4*coefficients[22]) + x3*(coefficients[18] + x5*2*coefficients[29] + x4*coefficients[30] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(2*coefficients[16] + x5*3*coefficients[35]) + x4*(coefficients[12] + x5*2*coefficients[26] + x4*coefficients[26]) + x3*(coefficients[18] + x5*2*coefficients[29] + x4*coefficients[32] + x3*coefficients[36]) + x2*(coefficients[15] + x5*2*coefficients[35] + x4*coefficients[38] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[2] + x5*(2*coefficients[7] + x5*(3*coefficients[15] + x5*4*coefficients[24])) + x4*(coefficients[9] + x5*(2*coefficients[17] + x5*3*coefficients[28]) + x4*(coefficients[18] + x5*2*coefficients[29] + x4*coefficients[31])) + x3*(coefficients[6] + x5*(2*coefficients[12] + x5*3*coefficients[38]) + x4*(coefficients[13] + x5*2*coefficients[22] + x4*coefficients[30]) + x3*(coefficients[12] + x5*2*coefficients[26] + x4*coefficients[22] + x3*coefficients[38])) + x2*(coefficients[8] + x5*(2*coefficients[20] + x5*3*coefficients[21]) + x4*(coefficients[13] + x5*2*coefficients[22] + x4*coefficients[32]) + x3*(coefficients[13] + x5*2*coefficients[22] + x4*coefficients[27] + x3*coefficients[32]) + x2*(coefficients[20] + x5*2*coefficients[25] + x4*coefficients[22] + x3*coefficients[30] + x2*coefficients[21])) + x1*(coefficients[7] + x5*(2*coefficients[16] + x5*3*coefficients[35]) + x4*(coefficients[18] + x5*2*coefficients[29] + x4*coefficients[36]) + x3*(coefficients[12] + x5*2*coefficients[26] + x4*coefficients[32] + x3*coefficients[26]) + x2*(coefficients[20] + x5*2*coefficients[25] + x4*coefficients[30] + x3*coefficients[22] + x2*coefficients[25]) + x1*(coefficients[15] + x5*2*coefficients[35] + x4*coefficients[31] + x3*coefficients[38] + x2*coefficients[21] + x1*coefficients[24]))) + x0*(coefficients[1] + x5*(2*coefficients[4] + x5*(3*coefficients[14] + x5*4*coefficients[34])) + x4*(coefficients[9] + x5*(2*coefficients[18] + x5*3*coefficients[31]) + x4*(coefficients[17] + x5*2*coefficients[29] + x4*coefficients[28])) + x3*(coefficients[9] + x5*(2*coefficients[18] + x5*3*coefficients[31]) + x4*(coefficients[13] + x5*2*coefficients[30] + x4*coefficients[22]) + x3*(coefficients[17] + x5*2*coefficients[29] + x4*coefficients[22] + x3*coefficients[28])) + x2*(coefficients[9] + x5*(2*coefficients[18] + x5*3*coefficients[31]) + x4*(coefficients[13] + x5*2*coefficients[32] + x4*coefficients[22]) + x3*(coefficients[10] + x5*2*coefficients[33] + x4*coefficients[27] + x3*coefficients[33]) + x2*(coefficients[17] + x5*2*coefficients[29] + x4*coefficients[22] + x3*coefficients[33] + x2*coefficients[28])) + x1*(coefficients[9] + x5*(2*coefficients[18] + x5*3*coefficients[31]) + x4*(coefficients[10] + x5*2*coefficients[33] + x4*coefficients[33]) + x3*(coefficients[13] + x5*2*coefficients[32] + x4*coefficients[27] + x3*coefficients[22]) + x2*(coefficients[13] + x5*2*coefficients[30] + x4*coefficients[27] + x3*coefficients[27] + x2*coefficients[22]) + x1*(coefficients[17] + x5*2*coefficients[29] + x4*coefficients[33] + x3*coefficients[22] + x2*coefficients[22] + x1*coefficients[28])) + x0*(coefficients[4] + x5*(2*coefficients[11] + x5*3*coefficients[23]) + x4*(coefficients[18] + x5*2*coefficients[36] + x4*coefficients[29]) + x3*(coefficients[18] + x5*2*coefficients[36] + x4*coefficients[32] + x3*coefficients[29]) + x2*(coefficients[18] + x5*2*coefficients[36] + x4*coefficients[30] + x3*coefficients[33] + x2*coefficients[29]) + x1*(coefficients[18] + x5*2*coefficients[36] + x4*coefficients[33] + x3*coefficients[30] + x2*coefficients[32] + x1*coefficients[29]) + x0*(coefficients[14] + x5*2*coefficients[23] + x4*coefficients[31] + x3*coefficients[31] + x2*coefficients[31] + x1*coefficients[31] + x0*coefficients[34])));
+        }
+
+        void polynomial_batch(std::size_t n, std::size_t stride, const double* variables, double* values, double* grad) const {
+            const double* coefficients = this->get_coefficients().data();
+            const double* v0 = variables + 0*stride;
+            const double* v1 = variables + 1*stride;
+            const double* v2 = variables + 2*stride;
+            const double* v3 = variables + 3*stride;
+            const double* v4 = variables + 4*stride;
+            const double* v5 = variables + 5*stride;
+            if(grad == 0) {
+#pragma omp simd
+                for(std::size_t j = 0; j < n; j++) {
+                    const double x0 = v0[j];
+                    const double x1 = v1[j];
+                    const double x2 = v2[j];
+                    const double x3 = v3[j];
+                    const double x4 = v4[j];
+                    const double x5 = v5[j];
+                    values[j] = x5*(coefficients[0] + x5*(coefficients[3] + x5*(coefficients[5] + x5*(coefficients[19] + x5*coefficients[37])))) + x4*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[19] + x5*coefficients[24] + x4*coefficients[37])))) + x3*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[15] + x5*coefficients[21] + x4*coefficients[24]))) + x3*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[16] + x5*coefficients[25] + x4*coefficients[35])) + x3*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[15] + x5*coefficients[21] + x4*coefficients[35]) + x3*(coefficients[19] + x5*coefficients[24] + x4*coefficients[24] + x3*coefficients[37])))) + x2*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[15] + x5*coefficients[38] + x4*coefficients[24]))) + x3*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[28])) + x3*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[29]) + x3*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*coefficients[34]))) + x2*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[16] + x5*coefficients[26] + x4*coefficients[35])) + x3*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[29]) + x3*(coefficients[11] + x5*coefficients[36] + x4*coefficients[36] + x3*coefficients[23])) + x2*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[15] + x5*coefficients[38] + x4*coefficients[35]) + x3*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*coefficients[23]) + x2*(coefficients[19] + x5*coefficients[24] + x4*coefficients[24] + x3*coefficients[34] + x2*coefficients[37])))) + x1*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[14] + x5*coefficients[31] + x4*coefficients[34]))) + x3*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[31])) + x3*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[15] + x5*coefficients[38] + x4*coefficients[28] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[31])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[10] + x5*coefficients[27] + x4*coefficients[33]) + x3*(coefficients[18] + x5*coefficients[32] + x4*coefficients[33] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[18] + x5*coefficients[30] + x4*coefficients[33] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[21] + x4*coefficients[28] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[11] + x5*coefficients[36] + x4*coefficients[23])) + x3*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[36]) + x3*(coefficients[16] + x5*coefficients[26] + x4*coefficients[29] + x3*coefficients[35])) + x2*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[36]) + x3*(coefficients[17] + x5*coefficients[22] + x4*coefficients[33] + x3*coefficients[29]) + x2*(coefficients[16] + x5*coefficients[25] + x4*coefficients[29] + x3*coefficients[29] + x2*coefficients[35])) + x1*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[14] + x5*coefficients[31] + x4*coefficients[23]) + x3*(coefficients[15] + x5*coefficients[38] + x4*coefficients[31] + x3*coefficients[35]) + x2*(coefficients[15] + x5*coefficients[21] + x4*coefficients[31] + x3*coefficients[28] + x2*coefficients[35]) + x1*(coefficients[19] + x5*coefficients[24] + x4*coefficients[34] + x3*coefficients[24] + x2*coefficients[24] + x1*coefficients[37])))) + x0*(coefficients[0] + x5*(coefficients[1] + x5*(coefficients[4] + x5*(coefficients[14] + x5*coefficients[34]))) + x4*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[15] + x5*coefficients[28] + x4*coefficients[24]))) + x3*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[38])) + x3*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[26]) + x3*(coefficients[15] + x5*coefficients[28] + x4*coefficients[38] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[21])) + x3*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[22]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[32] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[25]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[30] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[28] + x4*coefficients[21] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[31])) + x3*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[32]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[21])) + x2*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[30]) + x3*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*coefficients[30]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[32] + x2*coefficients[38])) + x1*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[36]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[30] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[32] + x3*coefficients[22] + x2*coefficients[26]) + x1*(coefficients[15] + x5*coefficients[28] + x4*coefficients[31] + x3*coefficients[21] + x2*coefficients[38] + x1*coefficients[24]))) + x0*(coefficients[3] + x5*(coefficients[4] + x5*(coefficients[11] + x5*coefficients[23])) + x4*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[16] + x5*coefficients[29] + x4*coefficients[35])) + x3*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[12] + x5*coefficients[32] + x4*coefficients[26]) + x3*(coefficients[16] + x5*coefficients[29] + x4*coefficients[26] + x3*coefficients[35])) + x2*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[20] + x5*coefficients[30] + x4*coefficients[25]) + x3*(coefficients[17] + x5*coefficients[33] + x4*coefficients[22] + x3*coefficients[29]) + x2*(coefficients[16] + x5*coefficients[29] + x4*coefficients[25] + x3*coefficients[29] + x2*coefficients[35])) + x1*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[17] + x5*coefficients[33] + x4*coefficients[29]) + x3*(coefficients[20] + x5*coefficients[30] + x4*coefficients[22] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[32] + x4*coefficients[22] + x3*coefficients[22] + x2*coefficients[26]) + x1*(coefficients[16] + x5*coefficients[29] + x4*coefficients[29] + x3*coefficients[25] + x2*coefficients[26] + x1*coefficients[35])) + x0*(coefficients[5] + x5*(coefficients[14] + x5*coefficients[23]) + x4*(coefficients[15] + x5*coefficients[31] + x4*coefficients[35]) + x3*(coefficients[15] + x5*coefficients[31] + x4*coefficients[38] + x3*coefficients[35]) + x2*(coefficients[15] + x5*coefficients[31] + x4*coefficients[21] + x3*coefficients[28] + x2*coefficients[35]) + x1*(coefficients[15] + x5*coefficients[31] + x4*coefficients[28] + x3*coefficients[21] + x2*coefficients[38] + x1*coefficients[35]) + x0*(coefficients[19] + x5*coefficients[34] + x4*coefficients[24] + x3*coefficients[24] + x2*coefficients[24] + x1*coefficients[24] + x0*coefficients[37]))));
+                }
+                return;
+            }
+            double* g0 = grad + 0*stride;
+            double* g1 = grad + 1*stride;
+            double* g2 = grad + 2*stride;
+            double* g3 = grad + 3*stride;
+            double* g4 = grad + 4*stride;
+            double* g5 = grad + 5*stride;
+#pragma omp simd
+            for(std::size_t j = 0; j < n; j++) {
+                const double x0 = v0[j];
+                const double x1 = v1[j];
+                const double x2 = v2[j];
+                const double x3 = v3[j];
+                const double x4 = v4[j];
+                const double x5 = v5[j];
+                values[j] = x5*(coefficients[0] + x5*(coefficients[3] + x5*(coefficients[5] + x5*(coefficients[19] + x5*coefficients[37])))) + x4*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[19] + x5*coefficients[24] + x4*coefficients[37])))) + x3*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[15] + x5*coefficients[21] + x4*coefficients[24]))) + x3*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[16] + x5*coefficients[25] + x4*coefficients[35])) + x3*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[15] + x5*coefficients[21] + x4*coefficients[35]) + x3*(coefficients[19] + x5*coefficients[24] + x4*coefficients[24] + x3*coefficients[37])))) + x2*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[15] + x5*coefficients[38] + x4*coefficients[24]))) + x3*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[28])) + x3*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[29]) + x3*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*coefficients[34]))) + x2*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[16] + x5*coefficients[26] + x4*coefficients[35])) + x3*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[29]) + x3*(coefficients[11] + x5*coefficients[36] + x4*coefficients[36] + x3*coefficients[23])) + x2*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[15] + x5*coefficients[38] + x4*coefficients[35]) + x3*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*coefficients[23]) + x2*(coefficients[19] + x5*coefficients[24] + x4*coefficients[24] + x3*coefficients[34] + x2*coefficients[37])))) + x1*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[14] + x5*coefficients[31] + x4*coefficients[34]))) + x3*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[31])) + x3*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[15] + x5*coefficients[38] + x4*coefficients[28] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[31])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[10] + x5*coefficients[27] + x4*coefficients[33]) + x3*(coefficients[18] + x5*coefficients[32] + x4*coefficients[33] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[18] + x5*coefficients[30] + x4*coefficients[33] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[21] + x4*coefficients[28] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[11] + x5*coefficients[36] + x4*coefficients[23])) + x3*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[36]) + x3*(coefficients[16] + x5*coefficients[26] + x4*coefficients[29] + x3*coefficients[35])) + x2*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[36]) + x3*(coefficients[17] + x5*coefficients[22] + x4*coefficients[33] + x3*coefficients[29]) + x2*(coefficients[16] + x5*coefficients[25] + x4*coefficients[29] + x3*coefficients[29] + x2*coefficients[35])) + x1*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[14] + x5*coefficients[31] + x4*coefficients[23]) + x3*(coefficients[15] + x5*coefficients[38] + x4*coefficients[31] + x3*coefficients[35]) + x2*(coefficients[15] + x5*coefficients[21] + x4*coefficients[31] + x3*coefficients[28] + x2*coefficients[35]) + x1*(coefficients[19] + x5*coefficients[24] + x4*coefficients[34] + x3*coefficients[24] + x2*coefficients[24] + x1*coefficients[37])))) + x0*(coefficients[0] + x5*(coefficients[1] + x5*(coefficients[4] + x5*(coefficients[14] + x5*coefficients[34]))) + x4*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[15] + x5*coefficients[28] + x4*coefficients[24]))) + x3*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[38])) + x3*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[26]) + x3*(coefficients[15] + x5*coefficients[28] + x4*coefficients[38] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[21])) + x3*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[22]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[32] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[25]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[30] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[28] + x4*coefficients[21] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[31])) + x3*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[32]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[21])) + x2*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[30]) + x3*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*coefficients[30]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[32] + x2*coefficients[38])) + x1*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[36]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[30] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[32] + x3*coefficients[22] + x2*coefficients[26]) + x1*(coefficients[15] + x5*coefficients[28] + x4*coefficients[31] + x3*coefficients[21] + x2*coefficients[38] + x1*coefficients[24]))) + x0*(coefficients[3] + x5*(coefficients[4] + x5*(coefficients[11] + x5*coefficients[23])) + x4*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[16] + x5*coefficients[29] + x4*coefficients[35])) + x3*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[12] + x5*coefficients[32] + x4*coefficients[26]) + x3*(coefficients[16] + x5*coefficients[29] + x4*coefficients[26] + x3*coefficients[35])) + x2*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[20] + x5*coefficients[30] + x4*coefficients[25]) + x3*(coefficients[17] + x5*coefficients[33] + x4*coefficients[22] + x3*coefficients[29]) + x2*(coefficients[16] + x5*coefficients[29] + x4*coefficients[25] + x3*coefficients[29] + x2*coefficients[35])) + x1*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[17] + x5*coefficients[33] + x4*coefficients[29]) + x3*(coefficients[20] + x5*coefficients[30] + x4*coefficients[22] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[32] + x4*coefficients[22] + x3*coefficients[22] + x2*coefficients[26]) + x1*(coefficients[16] + x5*coefficients[29] + x4*coefficients[29] + x3*coefficients[25] + x2*coefficients[26] + x1*coefficients[35])) + x0*(coefficients[5] + x5*(coefficients[14] + x5*coefficients[23]) + x4*(coefficients[15] + x5*coefficients[31] + x4*coefficients[35]) + x3*(coefficients[15] + x5*coefficients[31] + x4*coefficients[38] + x3*coefficients[35]) + x2*(coefficients[15] + x5*coefficients[31] + x4*coefficients[21] + x3*coefficients[28] + x2*coefficients[35]) + x1*(coefficients[15] + x5*coefficients[31] + x4*coefficients[28] + x3*coefficients[21] + x2*coefficients[38] + x1*coefficients[35]) + x0*(coefficients[19] + x5*coefficients[34] + x4*coefficients[24] + x3*coefficients[24] + x2*coefficients[24] + x1*coefficients[24] + x0*coefficients[37]))));
+                g0[j] = coefficients[0] + x5*(coefficients[1] + x5*(coefficients[4] + x5*(coefficients[14] + x5*coefficients[34]))) + x4*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[15] + x5*coefficients[28] + x4*coefficients[24]))) + x3*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[38])) + x3*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[26]) + x3*(coefficients[15] + x5*coefficients[28] + x4*coefficients[38] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[21])) + x3*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[22]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[32] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[25]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[30] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[28] + x4*coefficients[21] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[31])) + x3*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[32]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[21])) + x2*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[30]) + x3*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*coefficients[30]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[32] + x2*coefficients[38])) + x1*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[36]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[30] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[32] + x3*coefficients[22] + x2*coefficients[26]) + x1*(coefficients[15] + x5*coefficients[28] + x4*coefficients[31] + x3*coefficients[21] + x2*coefficients[38] + x1*coefficients[24]))) + x0*(2*coefficients[3] + x5*(2*coefficients[4] + x5*(2*coefficients[11] + x5*2*coefficients[23])) + x4*(2*coefficients[7] + x5*(2*coefficients[18] + x5*2*coefficients[36]) + x4*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[35])) + x3*(2*coefficients[7] + x5*(2*coefficients[18] + x5*2*coefficients[36]) + x4*(2*coefficients[12] + x5*2*coefficients[32] + x4*2*coefficients[26]) + x3*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[26] + x3*2*coefficients[35])) + x2*(2*coefficients[7] + x5*(2*coefficients[18] + x5*2*coefficients[36]) + x4*(2*coefficients[20] + x5*2*coefficients[30] + x4*2*coefficients[25]) + x3*(2*coefficients[17] + x5*2*coefficients[33] + x4*2*coefficients[22] + x3*2*coefficients[29]) + x2*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[25] + x3*2*coefficients[29] + x2*2*coefficients[35])) + x1*(2*coefficients[7] + x5*(2*coefficients[18] + x5*2*coefficients[36]) + x4*(2*coefficients[17] + x5*2*coefficients[33] + x4*2*coefficients[29]) + x3*(2*coefficients[20] + x5*2*coefficients[30] + x4*2*coefficients[22] + x3*2*coefficients[25]) + x2*(2*coefficients[12] + x5*2*coefficients[32] + x4*2*coefficients[22] + x3*2*coefficients[22] + x2*2*coefficients[26]) + x1*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[29] + x3*2*coefficients[25] + x2*2*coefficients[26] + x1*2*coefficients[35])) + x0*(3*coefficients[5] + x5*(3*coefficients[14] + x5*3*coefficients[23]) + x4*(3*coefficients[15] + x5*3*coefficients[31] + x4*3*coefficients[35]) + x3*(3*coefficients[15] + x5*3*coefficients[31] + x4*3*coefficients[38] + x3*3*coefficients[35]) + x2*(3*coefficients[15] + x5*3*coefficients[31] + x4*3*coefficients[21] + x3*3*coefficients[28] + x2*3*coefficients[35]) + x1*(3*coefficients[15] + x5*3*coefficients[31] + x4*3*coefficients[28] + x3*3*coefficients[21] + x2*3*coefficients[38] + x1*3*coefficients[35]) + x0*(4*coefficients[19] + x5*4*coefficients[34] + x4*4*coefficients[24] + x3*4*coefficients[24] + x2*4*coefficients[24] + x1*4*coefficients[24] + x0*5*coefficients[37])));
+                g1[j] = coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[14] + x5*coefficients[31] + x4*coefficients[34]))) + x3*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[31])) + x3*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[15] + x5*coefficients[38] + x4*coefficients[28] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[31])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[10] + x5*coefficients[27] + x4*coefficients[33]) + x3*(coefficients[18] + x5*coefficients[32] + x4*coefficients[33] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[18] + x5*coefficients[30] + x4*coefficients[33] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[21] + x4*coefficients[28] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(2*coefficients[3] + x5*(2*coefficients[7] + x5*(2*coefficients[16] + x5*2*coefficients[35])) + x4*(2*coefficients[4] + x5*(2*coefficients[18] + x5*2*coefficients[29]) + x4*(2*coefficients[11] + x5*2*coefficients[36] + x4*2*coefficients[23])) + x3*(2*coefficients[7] + x5*(2*coefficients[12] + x5*2*coefficients[26]) + x4*(2*coefficients[18] + x5*2*coefficients[32] + x4*2*coefficients[36]) + x3*(2*coefficients[16] + x5*2*coefficients[26] + x4*2*coefficients[29] + x3*2*coefficients[35])) + x2*(2*coefficients[7] + x5*(2*coefficients[20] + x5*2*coefficients[25]) + x4*(2*coefficients[18] + x5*2*coefficients[30] + x4*2*coefficients[36]) + x3*(2*coefficients[17] + x5*2*coefficients[22] + x4*2*coefficients[33] + x3*2*coefficients[29]) + x2*(2*coefficients[16] + x5*2*coefficients[25] + x4*2*coefficients[29] + x3*2*coefficients[29] + x2*2*coefficients[35])) + x1*(3*coefficients[5] + x5*(3*coefficients[15] + x5*3*coefficients[35]) + x4*(3*coefficients[14] + x5*3*coefficients[31] + x4*3*coefficients[23]) + x3*(3*coefficients[15] + x5*3*coefficients[38] + x4*3*coefficients[31] + x3*3*coefficients[35]) + x2*(3*coefficients[15] + x5*3*coefficients[21] + x4*3*coefficients[31] + x3*3*coefficients[28] + x2*3*coefficients[35]) + x1*(4*coefficients[19] + x5*4*coefficients[24] + x4*4*coefficients[34] + x3*4*coefficients[24] + x2*4*coefficients[24] + x1*5*coefficients[37]))) + x0*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[31])) + x3*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[32]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[21])) + x2*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[30]) + x3*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*coefficients[30]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[32] + x2*coefficients[38])) + x1*(2*coefficients[7] + x5*(2*coefficients[17] + x5*2*coefficients[29]) + x4*(2*coefficients[18] + x5*2*coefficients[33] + x4*2*coefficients[36]) + x3*(2*coefficients[20] + x5*2*coefficients[22] + x4*2*coefficients[30] + x3*2*coefficients[25]) + x2*(2*coefficients[12] + x5*2*coefficients[22] + x4*2*coefficients[32] + x3*2*coefficients[22] + x2*2*coefficients[26]) + x1*(3*coefficients[15] + x5*3*coefficients[28] + x4*3*coefficients[31] + x3*3*coefficients[21] + x2*3*coefficients[38] + x1*4*coefficients[24])) + x0*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[17] + x5*coefficients[33] + x4*coefficients[29]) + x3*(coefficients[20] + x5*coefficients[30] + x4*coefficients[22] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[32] + x4*coefficients[22] + x3*coefficients[22] + x2*coefficients[26]) + x1*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[29] + x3*2*coefficients[25] + x2*2*coefficients[26] + x1*3*coefficients[35]) + x0*(coefficients[15] + x5*coefficients[31] + x4*coefficients[28] + x3*coefficients[21] + x2*coefficients[38] + x1*2*coefficients[35] + x0*coefficients[24])));
+                g2[j] = coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[15] + x5*coefficients[38] + x4*coefficients[24]))) + x3*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[28])) + x3*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[29]) + x3*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*coefficients[34]))) + x2*(2*coefficients[3] + x5*(2*coefficients[7] + x5*(2*coefficients[16] + x5*2*coefficients[35])) + x4*(2*coefficients[7] + x5*(2*coefficients[12] + x5*2*coefficients[26]) + x4*(2*coefficients[16] + x5*2*coefficients[26] + x4*2*coefficients[35])) + x3*(2*coefficients[4] + x5*(2*coefficients[18] + x5*2*coefficients[29]) + x4*(2*coefficients[18] + x5*2*coefficients[32] + x4*2*coefficients[29]) + x3*(2*coefficients[11] + x5*2*coefficients[36] + x4*2*coefficients[36] + x3*2*coefficients[23])) + x2*(3*coefficients[5] + x5*(3*coefficients[15] + x5*3*coefficients[35]) + x4*(3*coefficients[15] + x5*3*coefficients[38] + x4*3*coefficients[35]) + x3*(3*coefficients[14] + x5*3*coefficients[31] + x4*3*coefficients[31] + x3*3*coefficients[23]) + x2*(4*coefficients[19] + x5*4*coefficients[24] + x4*4*coefficients[24] + x3*4*coefficients[34] + x2*5*coefficients[37]))) + x1*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[31])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[10] + x5*coefficients[27] + x4*coefficients[33]) + x3*(coefficients[18] + x5*coefficients[32] + x4*coefficients[33] + x3*coefficients[31])) + x2*(2*coefficients[7] + x5*(2*coefficients[20] + x5*2*coefficients[25]) + x4*(2*coefficients[17] + x5*2*coefficients[22] + x4*2*coefficients[29]) + x3*(2*coefficients[18] + x5*2*coefficients[30] + x4*2*coefficients[33] + x3*2*coefficients[36]) + x2*(3*coefficients[15] + x5*3*coefficients[21] + x4*3*coefficients[28] + x3*3*coefficients[31] + x2*4*coefficients[24])) + x1*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[36]) + x3*(coefficients[17] + x5*coefficients[22] + x4*coefficients[33] + x3*coefficients[29]) + x2*(2*coefficients[16] + x5*2*coefficients[25] + x4*2*coefficients[29] + x3*2*coefficients[29] + x2*3*coefficients[35]) + x1*(coefficients[15] + x5*coefficients[21] + x4*coefficients[31] + x3*coefficients[28] + x2*2*coefficients[35] + x1*coefficients[24]))) + x0*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[21])) + x3*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[22]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[32] + x3*coefficients[31])) + x2*(2*coefficients[7] + x5*(2*coefficients[17] + x5*2*coefficients[29]) + x4*(2*coefficients[20] + x5*2*coefficients[22] + x4*2*coefficients[25]) + x3*(2*coefficients[18] + x5*2*coefficients[33] + x4*2*coefficients[30] + x3*2*coefficients[36]) + x2*(3*coefficients[15] + x5*3*coefficients[28] + x4*3*coefficients[21] + x3*3*coefficients[31] + x2*4*coefficients[24])) + x1*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[30]) + x3*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*coefficients[30]) + x2*(2*coefficients[12] + x5*2*coefficients[22] + x4*2*coefficients[22] + x3*2*coefficients[32] + x2*3*coefficients[38]) + x1*(coefficients[12] + x5*coefficients[22] + x4*coefficients[32] + x3*coefficients[22] + x2*2*coefficients[26] + x1*coefficients[38])) + x0*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[20] + x5*coefficients[30] + x4*coefficients[25]) + x3*(coefficients[17] + x5*coefficients[33] + x4*coefficients[22] + x3*coefficients[29]) + x2*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[25] + x3*2*coefficients[29] + x2*3*coefficients[35]) + x1*(coefficients[12] + x5*coefficients[32] + x4*coefficients[22] + x3*coefficients[22] + x2*2*coefficients[26] + x1*coefficients[26]) + x0*(coefficients[15] + x5*coefficients[31] + x4*coefficients[21] + x3*coefficients[28] + x2*2*coefficients[35] + x1*coefficients[38] + x0*coefficients[24])));
+                g3[j] = coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[15] + x5*coefficients[21] + x4*coefficients[24]))) + x3*(2*coefficients[3] + x5*(2*coefficients[7] + x5*(2*coefficients[16] + x5*2*coefficients[35])) + x4*(2*coefficients[7] + x5*(2*coefficients[20] + x5*2*coefficients[25]) + x4*(2*coefficients[16] + x5*2*coefficients[25] + x4*2*coefficients[35])) + x3*(3*coefficients[5] + x5*(3*coefficients[15] + x5*3*coefficients[35]) + x4*(3*coefficients[15] + x5*3*coefficients[21] + x4*3*coefficients[35]) + x3*(4*coefficients[19] + x5*4*coefficients[24] + x4*4*coefficients[24] + x3*5*coefficients[37]))) + x2*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[28])) + x3*(2*coefficients[4] + x5*(2*coefficients[18] + x5*2*coefficients[29]) + x4*(2*coefficients[18] + x5*2*coefficients[30] + x4*2*coefficients[29]) + x3*(3*coefficients[14] + x5*3*coefficients[31] + x4*3*coefficients[31] + x3*4*coefficients[34])) + x2*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[29]) + x3*(2*coefficients[11] + x5*2*coefficients[36] + x4*2*coefficients[36] + x3*3*coefficients[23]) + x2*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*2*coefficients[23] + x2*coefficients[34]))) + x1*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[31])) + x3*(2*coefficients[7] + x5*(2*coefficients[12] + x5*2*coefficients[26]) + x4*(2*coefficients[17] + x5*2*coefficients[22] + x4*2*coefficients[29]) + x3*(3*coefficients[15] + x5*3*coefficients[38] + x4*3*coefficients[28] + x3*4*coefficients[24])) + x2*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[10] + x5*coefficients[27] + x4*coefficients[33]) + x3*(2*coefficients[18] + x5*2*coefficients[32] + x4*2*coefficients[33] + x3*3*coefficients[31]) + x2*(coefficients[18] + x5*coefficients[30] + x4*coefficients[33] + x3*2*coefficients[36] + x2*coefficients[31])) + x1*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[36]) + x3*(2*coefficients[16] + x5*2*coefficients[26] + x4*2*coefficients[29] + x3*3*coefficients[35]) + x2*(coefficients[17] + x5*coefficients[22] + x4*coefficients[33] + x3*2*coefficients[29] + x2*coefficients[29]) + x1*(coefficients[15] + x5*coefficients[38] + x4*coefficients[31] + x3*2*coefficients[35] + x2*coefficients[28] + x1*coefficients[24]))) + x0*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[38])) + x3*(2*coefficients[7] + x5*(2*coefficients[17] + x5*2*coefficients[29]) + x4*(2*coefficients[12] + x5*2*coefficients[22] + x4*2*coefficients[26]) + x3*(3*coefficients[15] + x5*3*coefficients[28] + x4*3*coefficients[38] + x3*4*coefficients[24])) + x2*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[22]) + x3*(2*coefficients[18] + x5*2*coefficients[33] + x4*2*coefficients[32] + x3*3*coefficients[31]) + x2*(coefficients[18] + x5*coefficients[33] + x4*coefficients[30] + x3*2*coefficients[36] + x2*coefficients[31])) + x1*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[32]) + x3*(2*coefficients[20] + x5*2*coefficients[22] + x4*2*coefficients[22] + x3*3*coefficients[21]) + x2*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*2*coefficients[30] + x2*coefficients[32]) + x1*(coefficients[20] + x5*coefficients[22] + x4*coefficients[30] + x3*2*coefficients[25] + x2*coefficients[22] + x1*coefficients[21])) + x0*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[12] + x5*coefficients[32] + x4*coefficients[26]) + x3*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[26] + x3*3*coefficients[35]) + x2*(coefficients[17] + x5*coefficients[33] + x4*coefficients[22] + x3*2*coefficients[29] + x2*coefficients[29]) + x1*(coefficients[20] + x5*coefficients[30] + x4*coefficients[22] + x3*2*coefficients[25] + x2*coefficients[22] + x1*coefficients[25]) + x0*(coefficients[15] + x5*coefficients[31] + x4*coefficients[38] + x3*2*coefficients[35] + x2*coefficients[28] + x1*coefficients[21] + x0*coefficients[24])));
+                g4[j] = coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(2*coefficients[3] + x5*(2*coefficients[7] + x5*(2*coefficients[16] + x5*2*coefficients[35])) + x4*(3*coefficients[5] + x5*(3*coefficients[15] + x5*3*coefficients[35]) + x4*(4*coefficients[19] + x5*4*coefficients[24] + x4*5*coefficients[37]))) + x3*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(2*coefficients[7] + x5*(2*coefficients[20] + x5*2*coefficients[25]) + x4*(3*coefficients[15] + x5*3*coefficients[21] + x4*4*coefficients[24])) + x3*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(2*coefficients[16] + x5*2*coefficients[25] + x4*3*coefficients[35]) + x3*(coefficients[15] + x5*coefficients[21] + x4*2*coefficients[35] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(2*coefficients[7] + x5*(2*coefficients[12] + x5*2*coefficients[26]) + x4*(3*coefficients[15] + x5*3*coefficients[38] + x4*4*coefficients[24])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(2*coefficients[17] + x5*2*coefficients[22] + x4*3*coefficients[28]) + x3*(coefficients[18] + x5*coefficients[30] + x4*2*coefficients[29] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(2*coefficients[16] + x5*2*coefficients[26] + x4*3*coefficients[35]) + x3*(coefficients[18] + x5*coefficients[32] + x4*2*coefficients[29] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[38] + x4*2*coefficients[35] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(2*coefficients[4] + x5*(2*coefficients[18] + x5*2*coefficients[29]) + x4*(3*coefficients[14] + x5*3*coefficients[31] + x4*4*coefficients[34])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(2*coefficients[18] + x5*2*coefficients[30] + x4*3*coefficients[31]) + x3*(coefficients[17] + x5*coefficients[22] + x4*2*coefficients[29] + x3*coefficients[28])) + x2*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(2*coefficients[18] + x5*2*coefficients[32] + x4*3*coefficients[31]) + x3*(coefficients[10] + x5*coefficients[27] + x4*2*coefficients[33] + x3*coefficients[33]) + x2*(coefficients[17] + x5*coefficients[22] + x4*2*coefficients[29] + x3*coefficients[33] + x2*coefficients[28])) + x1*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(2*coefficients[11] + x5*2*coefficients[36] + x4*3*coefficients[23]) + x3*(coefficients[18] + x5*coefficients[32] + x4*2*coefficients[36] + x3*coefficients[29]) + x2*(coefficients[18] + x5*coefficients[30] + x4*2*coefficients[36] + x3*coefficients[33] + x2*coefficients[29]) + x1*(coefficients[14] + x5*coefficients[31] + x4*2*coefficients[23] + x3*coefficients[31] + x2*coefficients[31] + x1*coefficients[34]))) + x0*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(2*coefficients[7] + x5*(2*coefficients[17] + x5*2*coefficients[29]) + x4*(3*coefficients[15] + x5*3*coefficients[28] + x4*4*coefficients[24])) + x3*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(2*coefficients[12] + x5*2*coefficients[22] + x4*3*coefficients[38]) + x3*(coefficients[12] + x5*coefficients[22] + x4*2*coefficients[26] + x3*coefficients[38])) + x2*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(2*coefficients[20] + x5*2*coefficients[22] + x4*3*coefficients[21]) + x3*(coefficients[13] + x5*coefficients[27] + x4*2*coefficients[22] + x3*coefficients[32]) + x2*(coefficients[20] + x5*coefficients[22] + x4*2*coefficients[25] + x3*coefficients[30] + x2*coefficients[21])) + x1*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(2*coefficients[18] + x5*2*coefficients[33] + x4*3*coefficients[31]) + x3*(coefficients[13] + x5*coefficients[27] + x4*2*coefficients[32] + x3*coefficients[22]) + x2*(coefficients[13] + x5*coefficients[27] + x4*2*coefficients[30] + x3*coefficients[27] + x2*coefficients[22]) + x1*(coefficients[18] + x5*coefficients[33] + x4*2*coefficients[36] + x3*coefficients[30] + x2*coefficients[32] + x1*coefficients[31])) + x0*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(2*coefficients[16] + x5*2*coefficients[29] + x4*3*coefficients[35]) + x3*(coefficients[12] + x5*coefficients[32] + x4*2*coefficients[26] + x3*coefficients[26]) + x2*(coefficients[20] + x5*coefficients[30] + x4*2*coefficients[25] + x3*coefficients[22] + x2*coefficients[25]) + x1*(coefficients[17] + x5*coefficients[33] + x4*2*coefficients[29] + x3*coefficients[22] + x2*coefficients[22] + x1*coefficients[29]) + x0*(coefficients[15] + x5*coefficients[31] + x4*2*coefficients[35] + x3*coefficients[38] + x2*coefficients[21] + x1*coefficients[28] + x0*coefficients[24])));
+                g5[j] = coefficients[0] + x5*(2*coefficients[3] + x5*(3*coefficients[5] + x5*(4*coefficients[19] + x5*5*coefficients[37]))) + x4*(coefficients[2] + x5*(2*coefficients[7] + x5*(3*coefficients[15] + x5*4*coefficients[24])) + x4*(coefficients[7] + x5*(2*coefficients[16] + x5*3*coefficients[35]) + x4*(coefficients[15] + x5*2*coefficients[35] + x4*coefficients[24]))) + x3*(coefficients[2] + x5*(2*coefficients[7] + x5*(3*coefficients[15] + x5*4*coefficients[24])) + x4*(coefficients[8] + x5*(2*coefficients[20] + x5*3*coefficients[21]) + x4*(coefficients[20] + x5*2*coefficients[25] + x4*coefficients[21])) + x3*(coefficients[7] + x5*(2*coefficients[16] + x5*3*coefficients[35]) + x4*(coefficients[20] + x5*2*coefficients[25] + x4*coefficients[25]) + x3*(coefficients[15] + x5*2*coefficients[35] + x4*coefficients[21] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(2*coefficients[7] + x5*(3*coefficients[15] + x5*4*coefficients[24])) + x4*(coefficients[6] + x5*(2*coefficients[12] + x5*3*coefficients[38]) + x4*(coefficients[12] + x5*2*coefficients[26] + x4*coefficients[38])) + x3*(coefficients[9] + x5*(2*coefficients[17] + x5*3*coefficients[28]) + x4*(coefficients[13] + x5*2*coefficients[22] + x4*coefficients[22]) + x3*(coefficients[18] + x5*2*coefficients[29] + x4*coefficients[30] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(2*coefficients[16] + x5*3*coefficients[35]) + x4*(coefficients[12] + x5*2*coefficients[26] + x4*coefficients[26]) + x3*(coefficients[18] + x5*2*coefficients[29] + x4*coefficients[32] + x3*coefficients[36]) + x2*(coefficients[15] + x5*2*coefficients[35] + x4*coefficients[38] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[2] + x5*(2*coefficients[7] + x5*(3*coefficients[15] + x5*4*coefficients[24])) + x4*(coefficients[9] + x5*(2*coefficients[17] + x5*3*coefficients[28]) + x4*(coefficients[18] + x5*2*coefficients[29] + x4*coefficients[31])) + x3*(coefficients[6] + x5*(2*coefficients[12] + x5*3*coefficients[38]) + x4*(coefficients[13] + x5*2*coefficients[22] + x4*coefficients[30]) + x3*(coefficients[12] + x5*2*coefficients[26] + x4*coefficients[22] + x3*coefficients[38])) + x2*(coefficients[8] + x5*(2*coefficients[20] + x5*3*coefficients[21]) + x4*(coefficients[13] + x5*2*coefficients[22] + x4*coefficients[32]) + x3*(coefficients[13] + x5*2*coefficients[22] + x4*coefficients[27] + x3*coefficients[32]) + x2*(coefficients[20] + x5*2*coefficients[25] + x4*coefficients[22] + x3*coefficients[30] + x2*coefficients[21])) + x1*(coefficients[7] + x5*(2*coefficients[16] + x5*3*coefficients[35]) + x4*(coefficients[18] + x5*2*coefficients[29] + x4*coefficients[36]) + x3*(coefficients[12] + x5*2*coefficients[26] + x4*coefficients[32] + x3*coefficients[26]) + x2*(coefficients[20] + x5*2*coefficients[25] + x4*coefficients[30] + x3*coefficients[22] + x2*coefficients[25]) + x1*(coefficients[15] + x5*2*coefficients[35] + x4*coefficients[31] + x3*coefficients[38] + x2*coefficients[21] + x1*coefficients[24]))) + x0*(coefficients[1] + x5*(2*coefficients[4] + x5*(3*coefficients[14] + x5*4*coefficients[34])) + x4*(coefficients[9] + x5*(2*coefficients[18] + x5*3*coefficients[31]) + x4*(coefficients[17] + x5*2*coefficients[29] + x4*coefficients[28])) + x3*(coefficients[9] + x5*(2*coefficients[18] + x5*3*coefficients[31]) + x4*(coefficients[13] + x5*2*coefficients[30] + x4*coefficients[22]) + x3*(coefficients[17] + x5*2*coefficients[29] + x4*coefficients[22] + x3*coefficients[28])) + x2*(coefficients[9] + x5*(2*coefficients[18] + x5*3*coefficients[31]) + x4*(coefficients[13] + x5*2*coefficients[32] + x4*coefficients[22]) + x3*(coefficients[10] + x5*2*coefficients[33] + x4*coefficients[27] + x3*coefficients[33]) + x2*(coefficients[17] + x5*2*coefficients[29] + x4*coefficients[22] + x3*coefficients[33] + x2*coefficients[28])) + x1*(coefficients[9] + x5*(2*coefficients[18] + x5*3*coefficients[31]) + x4*(coefficients[10] + x5*2*coefficients[33] + x4*coefficients[33]) + x3*(coefficients[13] + x5*2*coefficients[32] + x4*coefficients[27] + x3*coefficients[22]) + x2*(coefficients[13] + x5*2*coefficients[30] + x4*coefficients[27] + x3*coefficients[27] + x2*coefficients[22]) + x1*(coefficients[17] + x5*2*coefficients[29] + x4*coefficients[33] + x3*coefficients[22] + x2*coefficients[22] + x1*coefficients[28])) + x0*(coefficients[4] + x5*(2*coefficients[11] + x5*3*coefficients[23]) + x4*(coefficients[18] + x5*2*coefficients[36] + x4*coefficients[29]) + x3*(coefficients[18] + x5*2*coefficients[36] + x4*coefficients[32] + x3*coefficients[29]) + x2*(coefficients[18] + x5*2*coefficients[36] + x4*coefficients[30] + x3*coefficients[33] + x2*coefficients[29]) + x1*(coefficients[18] + x5*2*coefficients[36] + x4*coefficients[33] + x3*coefficients[30] + x2*coefficients[32] + x1*coefficients[29]) + x0*(coefficients[14] + x5*2*coefficients[23] + x4*coefficients[31] + x3*coefficients[31] + x2*coefficients[31] + x1*coefficients[31] + x0*coefficients[34])));
+            }
+        }
+
+        void polynomial_batch(std::size_t n, std::size_t stride, const float* variables, float* values, float* grad) const {
+            const float* coefficients = this->get_coefficients_float().data();
+            const float* v0 = variables + 0*stride;
+            const float* v1 = variables + 1*stride;
+            const float* v2 = variables + 2*stride;
+            const float* v3 = variables + 3*stride;
+            const float* v4 = variables + 4*stride;
+            const float* v5 = variables + 5*stride;
+            if(grad == 0) {
+#pragma omp simd
+                for(std::size_t j = 0; j < n; j++) {
+                    const float x0 = v0[j];
+                    const float x1 = v1[j];
+                    const float x2 = v2[j];
+                    const float x3 = v3[j];
+                    const float x4 = v4[j];
+                    const float x5 = v5[j];
+                    values[j] = x5*(coefficients[0] + x5*(coefficients[3] + x5*(coefficients[5] + x5*(coefficients[19] + x5*coefficients[37])))) + x4*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[19] + x5*coefficients[24] + x4*coefficients[37])))) + x3*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[15] + x5*coefficients[21] + x4*coefficients[24]))) + x3*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[16] + x5*coefficients[25] + x4*coefficients[35])) + x3*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[15] + x5*coefficients[21] + x4*coefficients[35]) + x3*(coefficients[19] + x5*coefficients[24] + x4*coefficients[24] + x3*coefficients[37])))) + x2*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[15] + x5*coefficients[38] + x4*coefficients[24]))) + x3*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[28])) + x3*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[29]) + x3*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*coefficients[34]))) + x2*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[16] + x5*coefficients[26] + x4*coefficients[35])) + x3*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[29]) + x3*(coefficients[11] + x5*coefficients[36] + x4*coefficients[36] + x3*coefficients[23])) + x2*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[15] + x5*coefficients[38] + x4*coefficients[35]) + x3*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*coefficients[23]) + x2*(coefficients[19] + x5*coefficients[24] + x4*coefficients[24] + x3*coefficients[34] + x2*coefficients[37])))) + x1*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[14] + x5*coefficients[31] + x4*coefficients[34]))) + x3*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[31])) + x3*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[15] + x5*coefficients[38] + x4*coefficients[28] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[31])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[10] + x5*coefficients[27] + x4*coefficients[33]) + x3*(coefficients[18] + x5*coefficients[32] + x4*coefficients[33] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[18] + x5*coefficients[30] + x4*coefficients[33] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[21] + x4*coefficients[28] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[11] + x5*coefficients[36] + x4*coefficients[23])) + x3*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[36]) + x3*(coefficients[16] + x5*coefficients[26] + x4*coefficients[29] + x3*coefficients[35])) + x2*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[36]) + x3*(coefficients[17] + x5*coefficients[22] + x4*coefficients[33] + x3*coefficients[29]) + x2*(coefficients[16] + x5*coefficients[25] + x4*coefficients[29] + x3*coefficients[29] + x2*coefficients[35])) + x1*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[14] + x5*coefficients[31] + x4*coefficients[23]) + x3*(coefficients[15] + x5*coefficients[38] + x4*coefficients[31] + x3*coefficients[35]) + x2*(coefficients[15] + x5*coefficients[21] + x4*coefficients[31] + x3*coefficients[28] + x2*coefficients[35]) + x1*(coefficients[19] + x5*coefficients[24] + x4*coefficients[34] + x3*coefficients[24] + x2*coefficients[24] + x1*coefficients[37])))) + x0*(coefficients[0] + x5*(coefficients[1] + x5*(coefficients[4] + x5*(coefficients[14] + x5*coefficients[34]))) + x4*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[15] + x5*coefficients[28] + x4*coefficients[24]))) + x3*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[38])) + x3*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[26]) + x3*(coefficients[15] + x5*coefficients[28] + x4*coefficients[38] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[21])) + x3*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[22]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[32] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[25]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[30] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[28] + x4*coefficients[21] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[31])) + x3*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[32]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[21])) + x2*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[30]) + x3*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*coefficients[30]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[32] + x2*coefficients[38])) + x1*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[36]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[30] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[32] + x3*coefficients[22] + x2*coefficients[26]) + x1*(coefficients[15] + x5*coefficients[28] + x4*coefficients[31] + x3*coefficients[21] + x2*coefficients[38] + x1*coefficients[24]))) + x0*(coefficients[3] + x5*(coefficients[4] + x5*(coefficients[11] + x5*coefficients[23])) + x4*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[16] + x5*coefficients[29] + x4*coefficients[35])) + x3*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[12] + x5*coefficients[32] + x4*coefficients[26]) + x3*(coefficients[16] + x5*coefficients[29] + x4*coefficients[26] + x3*coefficients[35])) + x2*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[20] + x5*coefficients[30] + x4*coefficients[25]) + x3*(coefficients[17] + x5*coefficients[33] + x4*coefficients[22] + x3*coefficients[29]) + x2*(coefficients[16] + x5*coefficients[29] + x4*coefficients[25] + x3*coefficients[29] + x2*coefficients[35])) + x1*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[17] + x5*coefficients[33] + x4*coefficients[29]) + x3*(coefficients[20] + x5*coefficients[30] + x4*coefficients[22] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[32] + x4*coefficients[22] + x3*coefficients[22] + x2*coefficients[26]) + x1*(coefficients[16] + x5*coefficients[29] + x4*coefficients[29] + x3*coefficients[25] + x2*coefficients[26] + x1*coefficients[35])) + x0*(coefficients[5] + x5*(coefficients[14] + x5*coefficients[23]) + x4*(coefficients[15] + x5*coefficients[31] + x4*coefficients[35]) + x3*(coefficients[15] + x5*coefficients[31] + x4*coefficients[38] + x3*coefficients[35]) + x2*(coefficients[15] + x5*coefficients[31] + x4*coefficients[21] + x3*coefficients[28] + x2*coefficients[35]) + x1*(coefficients[15] + x5*coefficients[31] + x4*coefficients[28] + x3*coefficients[21] + x2*coefficients[38] + x1*coefficients[35]) + x0*(coefficients[19] + x5*coefficients[34] + x4*coefficients[24] + x3*coefficients[24] + x2*coefficients[24] + x1*coefficients[24] + x0*coefficients[37]))));
+                }
+                return;
+            }
+            float* g0 = grad + 0*stride;
+            float* g1 = grad + 1*stride;
+            float* g2 = grad + 2*stride;
+            float* g3 = grad + 3*stride;
+            float* g4 = grad + 4*stride;
+            float* g5 = grad + 5*stride;
+#pragma omp simd
+            for(std::size_t j = 0; j < n; j++) {
+                const float x0 = v0[j];
+                const float x1 = v1[j];
+                const float x2 = v2[j];
+                const float x3 = v3[j];
+                const float x4 = v4[j];
+                const float x5 = v5[j];
+                values[j] = x5*(coefficients[0] + x5*(coefficients[3] + x5*(coefficients[5] + x5*(coefficients[19] + x5*coefficients[37])))) + x4*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[19] + x5*coefficients[24] + x4*coefficients[37])))) + x3*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[15] + x5*coefficients[21] + x4*coefficients[24]))) + x3*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[16] + x5*coefficients[25] + x4*coefficients[35])) + x3*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[15] + x5*coefficients[21] + x4*coefficients[35]) + x3*(coefficients[19] + x5*coefficients[24] + x4*coefficients[24] + x3*coefficients[37])))) + x2*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[15] + x5*coefficients[38] + x4*coefficients[24]))) + x3*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[28])) + x3*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[29]) + x3*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*coefficients[34]))) + x2*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[16] + x5*coefficients[26] + x4*coefficients[35])) + x3*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[29]) + x3*(coefficients[11] + x5*coefficients[36] + x4*coefficients[36] + x3*coefficients[23])) + x2*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[15] + x5*coefficients[38] + x4*coefficients[35]) + x3*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*coefficients[23]) + x2*(coefficients[19] + x5*coefficients[24] + x4*coefficients[24] + x3*coefficients[34] + x2*coefficients[37])))) + x1*(coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[14] + x5*coefficients[31] + x4*coefficients[34]))) + x3*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[31])) + x3*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[15] + x5*coefficients[38] + x4*coefficients[28] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[31])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[10] + x5*coefficients[27] + x4*coefficients[33]) + x3*(coefficients[18] + x5*coefficients[32] + x4*coefficients[33] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[18] + x5*coefficients[30] + x4*coefficients[33] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[21] + x4*coefficients[28] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[3] + x5*(coefficients[7] + x5*(coefficients[16] + x5*coefficients[35])) + x4*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[11] + x5*coefficients[36] + x4*coefficients[23])) + x3*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[36]) + x3*(coefficients[16] + x5*coefficients[26] + x4*coefficients[29] + x3*coefficients[35])) + x2*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[36]) + x3*(coefficients[17] + x5*coefficients[22] + x4*coefficients[33] + x3*coefficients[29]) + x2*(coefficients[16] + x5*coefficients[25] + x4*coefficients[29] + x3*coefficients[29] + x2*coefficients[35])) + x1*(coefficients[5] + x5*(coefficients[15] + x5*coefficients[35]) + x4*(coefficients[14] + x5*coefficients[31] + x4*coefficients[23]) + x3*(coefficients[15] + x5*coefficients[38] + x4*coefficients[31] + x3*coefficients[35]) + x2*(coefficients[15] + x5*coefficients[21] + x4*coefficients[31] + x3*coefficients[28] + x2*coefficients[35]) + x1*(coefficients[19] + x5*coefficients[24] + x4*coefficients[34] + x3*coefficients[24] + x2*coefficients[24] + x1*coefficients[37])))) + x0*(coefficients[0] + x5*(coefficients[1] + x5*(coefficients[4] + x5*(coefficients[14] + x5*coefficients[34]))) + x4*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[15] + x5*coefficients[28] + x4*coefficients[24]))) + x3*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[38])) + x3*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[26]) + x3*(coefficients[15] + x5*coefficients[28] + x4*coefficients[38] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[21])) + x3*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[22]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[32] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[25]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[30] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[28] + x4*coefficients[21] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[31])) + x3*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[32]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[21])) + x2*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[30]) + x3*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*coefficients[30]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[32] + x2*coefficients[38])) + x1*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[36]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[30] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[32] + x3*coefficients[22] + x2*coefficients[26]) + x1*(coefficients[15] + x5*coefficients[28] + x4*coefficients[31] + x3*coefficients[21] + x2*coefficients[38] + x1*coefficients[24]))) + x0*(coefficients[3] + x5*(coefficients[4] + x5*(coefficients[11] + x5*coefficients[23])) + x4*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[16] + x5*coefficients[29] + x4*coefficients[35])) + x3*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[12] + x5*coefficients[32] + x4*coefficients[26]) + x3*(coefficients[16] + x5*coefficients[29] + x4*coefficients[26] + x3*coefficients[35])) + x2*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[20] + x5*coefficients[30] + x4*coefficients[25]) + x3*(coefficients[17] + x5*coefficients[33] + x4*coefficients[22] + x3*coefficients[29]) + x2*(coefficients[16] + x5*coefficients[29] + x4*coefficients[25] + x3*coefficients[29] + x2*coefficients[35])) + x1*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[17] + x5*coefficients[33] + x4*coefficients[29]) + x3*(coefficients[20] + x5*coefficients[30] + x4*coefficients[22] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[32] + x4*coefficients[22] + x3*coefficients[22] + x2*coefficients[26]) + x1*(coefficients[16] + x5*coefficients[29] + x4*coefficients[29] + x3*coefficients[25] + x2*coefficients[26] + x1*coefficients[35])) + x0*(coefficients[5] + x5*(coefficients[14] + x5*coefficients[23]) + x4*(coefficients[15] + x5*coefficients[31] + x4*coefficients[35]) + x3*(coefficients[15] + x5*coefficients[31] + x4*coefficients[38] + x3*coefficients[35]) + x2*(coefficients[15] + x5*coefficients[31] + x4*coefficients[21] + x3*coefficients[28] + x2*coefficients[35]) + x1*(coefficients[15] + x5*coefficients[31] + x4*coefficients[28] + x3*coefficients[21] + x2*coefficients[38] + x1*coefficients[35]) + x0*(coefficients[19] + x5*coefficients[34] + x4*coefficients[24] + x3*coefficients[24] + x2*coefficients[24] + x1*coefficients[24] + x0*coefficients[37]))));
+                g0[j] = coefficients[0] + x5*(coefficients[1] + x5*(coefficients[4] + x5*(coefficients[14] + x5*coefficients[34]))) + x4*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[15] + x5*coefficients[28] + x4*coefficients[24]))) + x3*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[38])) + x3*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[26]) + x3*(coefficients[15] + x5*coefficients[28] + x4*coefficients[38] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[21])) + x3*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[22]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[32] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[25]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[30] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[28] + x4*coefficients[21] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[31])) + x3*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[32]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[21])) + x2*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[30]) + x3*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*coefficients[30]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[32] + x2*coefficients[38])) + x1*(coefficients[7] + x5*(coefficients[17] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[36]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[30] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[32] + x3*coefficients[22] + x2*coefficients[26]) + x1*(coefficients[15] + x5*coefficients[28] + x4*coefficients[31] + x3*coefficients[21] + x2*coefficients[38] + x1*coefficients[24]))) + x0*(2*coefficients[3] + x5*(2*coefficients[4] + x5*(2*coefficients[11] + x5*2*coefficients[23])) + x4*(2*coefficients[7] + x5*(2*coefficients[18] + x5*2*coefficients[36]) + x4*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[35])) + x3*(2*coefficients[7] + x5*(2*coefficients[18] + x5*2*coefficients[36]) + x4*(2*coefficients[12] + x5*2*coefficients[32] + x4*2*coefficients[26]) + x3*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[26] + x3*2*coefficients[35])) + x2*(2*coefficients[7] + x5*(2*coefficients[18] + x5*2*coefficients[36]) + x4*(2*coefficients[20] + x5*2*coefficients[30] + x4*2*coefficients[25]) + x3*(2*coefficients[17] + x5*2*coefficients[33] + x4*2*coefficients[22] + x3*2*coefficients[29]) + x2*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[25] + x3*2*coefficients[29] + x2*2*coefficients[35])) + x1*(2*coefficients[7] + x5*(2*coefficients[18] + x5*2*coefficients[36]) + x4*(2*coefficients[17] + x5*2*coefficients[33] + x4*2*coefficients[29]) + x3*(2*coefficients[20] + x5*2*coefficients[30] + x4*2*coefficients[22] + x3*2*coefficients[25]) + x2*(2*coefficients[12] + x5*2*coefficients[32] + x4*2*coefficients[22] + x3*2*coefficients[22] + x2*2*coefficients[26]) + x1*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[29] + x3*2*coefficients[25] + x2*2*coefficients[26] + x1*2*coefficients[35])) + x0*(3*coefficients[5] + x5*(3*coefficients[14] + x5*3*coefficients[23]) + x4*(3*coefficients[15] + x5*3*coefficients[31] + x4*3*coefficients[35]) + x3*(3*coefficients[15] + x5*3*coefficients[31] + x4*3*coefficients[38] + x3*3*coefficients[35]) + x2*(3*coefficients[15] + x5*3*coefficients[31] + x4*3*coefficients[21] + x3*3*coefficients[28] + x2*3*coefficients[35]) + x1*(3*coefficients[15] + x5*3*coefficients[31] + x4*3*coefficients[28] + x3*3*coefficients[21] + x2*3*coefficients[38] + x1*3*coefficients[35]) + x0*(4*coefficients[19] + x5*4*coefficients[34] + x4*4*coefficients[24] + x3*4*coefficients[24] + x2*4*coefficients[24] + x1*4*coefficients[24] + x0*5*coefficients[37])));
+                g1[j] = coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[14] + x5*coefficients[31] + x4*coefficients[34]))) + x3*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[31])) + x3*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[15] + x5*coefficients[38] + x4*coefficients[28] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[31])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[10] + x5*coefficients[27] + x4*coefficients[33]) + x3*(coefficients[18] + x5*coefficients[32] + x4*coefficients[33] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[29]) + x3*(coefficients[18] + x5*coefficients[30] + x4*coefficients[33] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[21] + x4*coefficients[28] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(2*coefficients[3] + x5*(2*coefficients[7] + x5*(2*coefficients[16] + x5*2*coefficients[35])) + x4*(2*coefficients[4] + x5*(2*coefficients[18] + x5*2*coefficients[29]) + x4*(2*coefficients[11] + x5*2*coefficients[36] + x4*2*coefficients[23])) + x3*(2*coefficients[7] + x5*(2*coefficients[12] + x5*2*coefficients[26]) + x4*(2*coefficients[18] + x5*2*coefficients[32] + x4*2*coefficients[36]) + x3*(2*coefficients[16] + x5*2*coefficients[26] + x4*2*coefficients[29] + x3*2*coefficients[35])) + x2*(2*coefficients[7] + x5*(2*coefficients[20] + x5*2*coefficients[25]) + x4*(2*coefficients[18] + x5*2*coefficients[30] + x4*2*coefficients[36]) + x3*(2*coefficients[17] + x5*2*coefficients[22] + x4*2*coefficients[33] + x3*2*coefficients[29]) + x2*(2*coefficients[16] + x5*2*coefficients[25] + x4*2*coefficients[29] + x3*2*coefficients[29] + x2*2*coefficients[35])) + x1*(3*coefficients[5] + x5*(3*coefficients[15] + x5*3*coefficients[35]) + x4*(3*coefficients[14] + x5*3*coefficients[31] + x4*3*coefficients[23]) + x3*(3*coefficients[15] + x5*3*coefficients[38] + x4*3*coefficients[31] + x3*3*coefficients[35]) + x2*(3*coefficients[15] + x5*3*coefficients[21] + x4*3*coefficients[31] + x3*3*coefficients[28] + x2*3*coefficients[35]) + x1*(4*coefficients[19] + x5*4*coefficients[24] + x4*4*coefficients[34] + x3*4*coefficients[24] + x2*4*coefficients[24] + x1*5*coefficients[37]))) + x0*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[18] + x5*coefficients[33] + x4*coefficients[31])) + x3*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[32]) + x3*(coefficients[20] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[21])) + x2*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[30]) + x3*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*coefficients[30]) + x2*(coefficients[12] + x5*coefficients[22] + x4*coefficients[22] + x3*coefficients[32] + x2*coefficients[38])) + x1*(2*coefficients[7] + x5*(2*coefficients[17] + x5*2*coefficients[29]) + x4*(2*coefficients[18] + x5*2*coefficients[33] + x4*2*coefficients[36]) + x3*(2*coefficients[20] + x5*2*coefficients[22] + x4*2*coefficients[30] + x3*2*coefficients[25]) + x2*(2*coefficients[12] + x5*2*coefficients[22] + x4*2*coefficients[32] + x3*2*coefficients[22] + x2*2*coefficients[26]) + x1*(3*coefficients[15] + x5*3*coefficients[28] + x4*3*coefficients[31] + x3*3*coefficients[21] + x2*3*coefficients[38] + x1*4*coefficients[24])) + x0*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[17] + x5*coefficients[33] + x4*coefficients[29]) + x3*(coefficients[20] + x5*coefficients[30] + x4*coefficients[22] + x3*coefficients[25]) + x2*(coefficients[12] + x5*coefficients[32] + x4*coefficients[22] + x3*coefficients[22] + x2*coefficients[26]) + x1*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[29] + x3*2*coefficients[25] + x2*2*coefficients[26] + x1*3*coefficients[35]) + x0*(coefficients[15] + x5*coefficients[31] + x4*coefficients[28] + x3*coefficients[21] + x2*coefficients[38] + x1*2*coefficients[35] + x0*coefficients[24])));
+                g2[j] = coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[15] + x5*coefficients[38] + x4*coefficients[24]))) + x3*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[28])) + x3*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[29]) + x3*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*coefficients[34]))) + x2*(2*coefficients[3] + x5*(2*coefficients[7] + x5*(2*coefficients[16] + x5*2*coefficients[35])) + x4*(2*coefficients[7] + x5*(2*coefficients[12] + x5*2*coefficients[26]) + x4*(2*coefficients[16] + x5*2*coefficients[26] + x4*2*coefficients[35])) + x3*(2*coefficients[4] + x5*(2*coefficients[18] + x5*2*coefficients[29]) + x4*(2*coefficients[18] + x5*2*coefficients[32] + x4*2*coefficients[29]) + x3*(2*coefficients[11] + x5*2*coefficients[36] + x4*2*coefficients[36] + x3*2*coefficients[23])) + x2*(3*coefficients[5] + x5*(3*coefficients[15] + x5*3*coefficients[35]) + x4*(3*coefficients[15] + x5*3*coefficients[38] + x4*3*coefficients[35]) + x3*(3*coefficients[14] + x5*3*coefficients[31] + x4*3*coefficients[31] + x3*3*coefficients[23]) + x2*(4*coefficients[19] + x5*4*coefficients[24] + x4*4*coefficients[24] + x3*4*coefficients[34] + x2*5*coefficients[37]))) + x1*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[31])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[10] + x5*coefficients[27] + x4*coefficients[33]) + x3*(coefficients[18] + x5*coefficients[32] + x4*coefficients[33] + x3*coefficients[31])) + x2*(2*coefficients[7] + x5*(2*coefficients[20] + x5*2*coefficients[25]) + x4*(2*coefficients[17] + x5*2*coefficients[22] + x4*2*coefficients[29]) + x3*(2*coefficients[18] + x5*2*coefficients[30] + x4*2*coefficients[33] + x3*2*coefficients[36]) + x2*(3*coefficients[15] + x5*3*coefficients[21] + x4*3*coefficients[28] + x3*3*coefficients[31] + x2*4*coefficients[24])) + x1*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[36]) + x3*(coefficients[17] + x5*coefficients[22] + x4*coefficients[33] + x3*coefficients[29]) + x2*(2*coefficients[16] + x5*2*coefficients[25] + x4*2*coefficients[29] + x3*2*coefficients[29] + x2*3*coefficients[35]) + x1*(coefficients[15] + x5*coefficients[21] + x4*coefficients[31] + x3*coefficients[28] + x2*2*coefficients[35] + x1*coefficients[24]))) + x0*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[20] + x5*coefficients[22] + x4*coefficients[21])) + x3*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[22]) + x3*(coefficients[18] + x5*coefficients[33] + x4*coefficients[32] + x3*coefficients[31])) + x2*(2*coefficients[7] + x5*(2*coefficients[17] + x5*2*coefficients[29]) + x4*(2*coefficients[20] + x5*2*coefficients[22] + x4*2*coefficients[25]) + x3*(2*coefficients[18] + x5*2*coefficients[33] + x4*2*coefficients[30] + x3*2*coefficients[36]) + x2*(3*coefficients[15] + x5*3*coefficients[28] + x4*3*coefficients[21] + x3*3*coefficients[31] + x2*4*coefficients[24])) + x1*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[30]) + x3*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*coefficients[30]) + x2*(2*coefficients[12] + x5*2*coefficients[22] + x4*2*coefficients[22] + x3*2*coefficients[32] + x2*3*coefficients[38]) + x1*(coefficients[12] + x5*coefficients[22] + x4*coefficients[32] + x3*coefficients[22] + x2*2*coefficients[26] + x1*coefficients[38])) + x0*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[20] + x5*coefficients[30] + x4*coefficients[25]) + x3*(coefficients[17] + x5*coefficients[33] + x4*coefficients[22] + x3*coefficients[29]) + x2*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[25] + x3*2*coefficients[29] + x2*3*coefficients[35]) + x1*(coefficients[12] + x5*coefficients[32] + x4*coefficients[22] + x3*coefficients[22] + x2*2*coefficients[26] + x1*coefficients[26]) + x0*(coefficients[15] + x5*coefficients[31] + x4*coefficients[21] + x3*coefficients[28] + x2*2*coefficients[35] + x1*coefficients[38] + x0*coefficients[24])));
+                g3[j] = coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(coefficients[15] + x5*coefficients[21] + x4*coefficients[24]))) + x3*(2*coefficients[3] + x5*(2*coefficients[7] + x5*(2*coefficients[16] + x5*2*coefficients[35])) + x4*(2*coefficients[7] + x5*(2*coefficients[20] + x5*2*coefficients[25]) + x4*(2*coefficients[16] + x5*2*coefficients[25] + x4*2*coefficients[35])) + x3*(3*coefficients[5] + x5*(3*coefficients[15] + x5*3*coefficients[35]) + x4*(3*coefficients[15] + x5*3*coefficients[21] + x4*3*coefficients[35]) + x3*(4*coefficients[19] + x5*4*coefficients[24] + x4*4*coefficients[24] + x3*5*coefficients[37]))) + x2*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[17] + x5*coefficients[22] + x4*coefficients[28])) + x3*(2*coefficients[4] + x5*(2*coefficients[18] + x5*2*coefficients[29]) + x4*(2*coefficients[18] + x5*2*coefficients[30] + x4*2*coefficients[29]) + x3*(3*coefficients[14] + x5*3*coefficients[31] + x4*3*coefficients[31] + x3*4*coefficients[34])) + x2*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[29]) + x3*(2*coefficients[11] + x5*2*coefficients[36] + x4*2*coefficients[36] + x3*3*coefficients[23]) + x2*(coefficients[14] + x5*coefficients[31] + x4*coefficients[31] + x3*2*coefficients[23] + x2*coefficients[34]))) + x1*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[18] + x5*coefficients[30] + x4*coefficients[31])) + x3*(2*coefficients[7] + x5*(2*coefficients[12] + x5*2*coefficients[26]) + x4*(2*coefficients[17] + x5*2*coefficients[22] + x4*2*coefficients[29]) + x3*(3*coefficients[15] + x5*3*coefficients[38] + x4*3*coefficients[28] + x3*4*coefficients[24])) + x2*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(coefficients[10] + x5*coefficients[27] + x4*coefficients[33]) + x3*(2*coefficients[18] + x5*2*coefficients[32] + x4*2*coefficients[33] + x3*3*coefficients[31]) + x2*(coefficients[18] + x5*coefficients[30] + x4*coefficients[33] + x3*2*coefficients[36] + x2*coefficients[31])) + x1*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(coefficients[18] + x5*coefficients[32] + x4*coefficients[36]) + x3*(2*coefficients[16] + x5*2*coefficients[26] + x4*2*coefficients[29] + x3*3*coefficients[35]) + x2*(coefficients[17] + x5*coefficients[22] + x4*coefficients[33] + x3*2*coefficients[29] + x2*coefficients[29]) + x1*(coefficients[15] + x5*coefficients[38] + x4*coefficients[31] + x3*2*coefficients[35] + x2*coefficients[28] + x1*coefficients[24]))) + x0*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(coefficients[12] + x5*coefficients[22] + x4*coefficients[38])) + x3*(2*coefficients[7] + x5*(2*coefficients[17] + x5*2*coefficients[29]) + x4*(2*coefficients[12] + x5*2*coefficients[22] + x4*2*coefficients[26]) + x3*(3*coefficients[15] + x5*3*coefficients[28] + x4*3*coefficients[38] + x3*4*coefficients[24])) + x2*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[22]) + x3*(2*coefficients[18] + x5*2*coefficients[33] + x4*2*coefficients[32] + x3*3*coefficients[31]) + x2*(coefficients[18] + x5*coefficients[33] + x4*coefficients[30] + x3*2*coefficients[36] + x2*coefficients[31])) + x1*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(coefficients[13] + x5*coefficients[27] + x4*coefficients[32]) + x3*(2*coefficients[20] + x5*2*coefficients[22] + x4*2*coefficients[22] + x3*3*coefficients[21]) + x2*(coefficients[13] + x5*coefficients[27] + x4*coefficients[27] + x3*2*coefficients[30] + x2*coefficients[32]) + x1*(coefficients[20] + x5*coefficients[22] + x4*coefficients[30] + x3*2*coefficients[25] + x2*coefficients[22] + x1*coefficients[21])) + x0*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(coefficients[12] + x5*coefficients[32] + x4*coefficients[26]) + x3*(2*coefficients[16] + x5*2*coefficients[29] + x4*2*coefficients[26] + x3*3*coefficients[35]) + x2*(coefficients[17] + x5*coefficients[33] + x4*coefficients[22] + x3*2*coefficients[29] + x2*coefficients[29]) + x1*(coefficients[20] + x5*coefficients[30] + x4*coefficients[22] + x3*2*coefficients[25] + x2*coefficients[22] + x1*coefficients[25]) + x0*(coefficients[15] + x5*coefficients[31] + x4*coefficients[38] + x3*2*coefficients[35] + x2*coefficients[28] + x1*coefficients[21] + x0*coefficients[24])));
+                g4[j] = coefficients[0] + x5*(coefficients[2] + x5*(coefficients[7] + x5*(coefficients[15] + x5*coefficients[24]))) + x4*(2*coefficients[3] + x5*(2*coefficients[7] + x5*(2*coefficients[16] + x5*2*coefficients[35])) + x4*(3*coefficients[5] + x5*(3*coefficients[15] + x5*3*coefficients[35]) + x4*(4*coefficients[19] + x5*4*coefficients[24] + x4*5*coefficients[37]))) + x3*(coefficients[2] + x5*(coefficients[8] + x5*(coefficients[20] + x5*coefficients[21])) + x4*(2*coefficients[7] + x5*(2*coefficients[20] + x5*2*coefficients[25]) + x4*(3*coefficients[15] + x5*3*coefficients[21] + x4*4*coefficients[24])) + x3*(coefficients[7] + x5*(coefficients[20] + x5*coefficients[25]) + x4*(2*coefficients[16] + x5*2*coefficients[25] + x4*3*coefficients[35]) + x3*(coefficients[15] + x5*coefficients[21] + x4*2*coefficients[35] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(coefficients[6] + x5*(coefficients[12] + x5*coefficients[38])) + x4*(2*coefficients[7] + x5*(2*coefficients[12] + x5*2*coefficients[26]) + x4*(3*coefficients[15] + x5*3*coefficients[38] + x4*4*coefficients[24])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(2*coefficients[17] + x5*2*coefficients[22] + x4*3*coefficients[28]) + x3*(coefficients[18] + x5*coefficients[30] + x4*2*coefficients[29] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(coefficients[12] + x5*coefficients[26]) + x4*(2*coefficients[16] + x5*2*coefficients[26] + x4*3*coefficients[35]) + x3*(coefficients[18] + x5*coefficients[32] + x4*2*coefficients[29] + x3*coefficients[36]) + x2*(coefficients[15] + x5*coefficients[38] + x4*2*coefficients[35] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[1] + x5*(coefficients[9] + x5*(coefficients[17] + x5*coefficients[28])) + x4*(2*coefficients[4] + x5*(2*coefficients[18] + x5*2*coefficients[29]) + x4*(3*coefficients[14] + x5*3*coefficients[31] + x4*4*coefficients[34])) + x3*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(2*coefficients[18] + x5*2*coefficients[30] + x4*3*coefficients[31]) + x3*(coefficients[17] + x5*coefficients[22] + x4*2*coefficients[29] + x3*coefficients[28])) + x2*(coefficients[9] + x5*(coefficients[13] + x5*coefficients[22]) + x4*(2*coefficients[18] + x5*2*coefficients[32] + x4*3*coefficients[31]) + x3*(coefficients[10] + x5*coefficients[27] + x4*2*coefficients[33] + x3*coefficients[33]) + x2*(coefficients[17] + x5*coefficients[22] + x4*2*coefficients[29] + x3*coefficients[33] + x2*coefficients[28])) + x1*(coefficients[4] + x5*(coefficients[18] + x5*coefficients[29]) + x4*(2*coefficients[11] + x5*2*coefficients[36] + x4*3*coefficients[23]) + x3*(coefficients[18] + x5*coefficients[32] + x4*2*coefficients[36] + x3*coefficients[29]) + x2*(coefficients[18] + x5*coefficients[30] + x4*2*coefficients[36] + x3*coefficients[33] + x2*coefficients[29]) + x1*(coefficients[14] + x5*coefficients[31] + x4*2*coefficients[23] + x3*coefficients[31] + x2*coefficients[31] + x1*coefficients[34]))) + x0*(coefficients[2] + x5*(coefficients[9] + x5*(coefficients[18] + x5*coefficients[31])) + x4*(2*coefficients[7] + x5*(2*coefficients[17] + x5*2*coefficients[29]) + x4*(3*coefficients[15] + x5*3*coefficients[28] + x4*4*coefficients[24])) + x3*(coefficients[6] + x5*(coefficients[13] + x5*coefficients[30]) + x4*(2*coefficients[12] + x5*2*coefficients[22] + x4*3*coefficients[38]) + x3*(coefficients[12] + x5*coefficients[22] + x4*2*coefficients[26] + x3*coefficients[38])) + x2*(coefficients[8] + x5*(coefficients[13] + x5*coefficients[32]) + x4*(2*coefficients[20] + x5*2*coefficients[22] + x4*3*coefficients[21]) + x3*(coefficients[13] + x5*coefficients[27] + x4*2*coefficients[22] + x3*coefficients[32]) + x2*(coefficients[20] + x5*coefficients[22] + x4*2*coefficients[25] + x3*coefficients[30] + x2*coefficients[21])) + x1*(coefficients[9] + x5*(coefficients[10] + x5*coefficients[33]) + x4*(2*coefficients[18] + x5*2*coefficients[33] + x4*3*coefficients[31]) + x3*(coefficients[13] + x5*coefficients[27] + x4*2*coefficients[32] + x3*coefficients[22]) + x2*(coefficients[13] + x5*coefficients[27] + x4*2*coefficients[30] + x3*coefficients[27] + x2*coefficients[22]) + x1*(coefficients[18] + x5*coefficients[33] + x4*2*coefficients[36] + x3*coefficients[30] + x2*coefficients[32] + x1*coefficients[31])) + x0*(coefficients[7] + x5*(coefficients[18] + x5*coefficients[36]) + x4*(2*coefficients[16] + x5*2*coefficients[29] + x4*3*coefficients[35]) + x3*(coefficients[12] + x5*coefficients[32] + x4*2*coefficients[26] + x3*coefficients[26]) + x2*(coefficients[20] + x5*coefficients[30] + x4*2*coefficients[25] + x3*coefficients[22] + x2*coefficients[25]) + x1*(coefficients[17] + x5*coefficients[33] + x4*2*coefficients[29] + x3*coefficients[22] + x2*coefficients[22] + x1*coefficients[29]) + x0*(coefficients[15] + x5*coefficients[31] + x4*2*coefficients[35] + x3*coefficients[38] + x2*coefficients[21] + x1*coefficients[28] + x0*coefficients[24])));
+                g5[j] = coefficients[0] + x5*(2*coefficients[3] + x5*(3*coefficients[5] + x5*(4*coefficients[19] + x5*5*coefficients[37]))) + x4*(coefficients[2] + x5*(2*coefficients[7] + x5*(3*coefficients[15] + x5*4*coefficients[24])) + x4*(coefficients[7] + x5*(2*coefficients[16] + x5*3*coefficients[35]) + x4*(coefficients[15] + x5*2*coefficients[35] + x4*coefficients[24]))) + x3*(coefficients[2] + x5*(2*coefficients[7] + x5*(3*coefficients[15] + x5*4*coefficients[24])) + x4*(coefficients[8] + x5*(2*coefficients[20] + x5*3*coefficients[21]) + x4*(coefficients[20] + x5*2*coefficients[25] + x4*coefficients[21])) + x3*(coefficients[7] + x5*(2*coefficients[16] + x5*3*coefficients[35]) + x4*(coefficients[20] + x5*2*coefficients[25] + x4*coefficients[25]) + x3*(coefficients[15] + x5*2*coefficients[35] + x4*coefficients[21] + x3*coefficients[24]))) + x2*(coefficients[2] + x5*(2*coefficients[7] + x5*(3*coefficients[15] + x5*4*coefficients[24])) + x4*(coefficients[6] + x5*(2*coefficients[12] + x5*3*coefficients[38]) + x4*(coefficients[12] + x5*2*coefficients[26] + x4*coefficients[38])) + x3*(coefficients[9] + x5*(2*coefficients[17] + x5*3*coefficients[28]) + x4*(coefficients[13] + x5*2*coefficients[22] + x4*coefficients[22]) + x3*(coefficients[18] + x5*2*coefficients[29] + x4*coefficients[30] + x3*coefficients[31])) + x2*(coefficients[7] + x5*(2*coefficients[16] + x5*3*coefficients[35]) + x4*(coefficients[12] + x5*2*coefficients[26] + x4*coefficients[26]) + x3*(coefficients[18] + x5*2*coefficients[29] + x4*coefficients[32] + x3*coefficients[36]) + x2*(coefficients[15] + x5*2*coefficients[35] + x4*coefficients[38] + x3*coefficients[31] + x2*coefficients[24]))) + x1*(coefficients[2] + x5*(2*coefficients[7] + x5*(3*coefficients[15] + x5*4*coefficients[24])) + x4*(coefficients[9] + x5*(2*coefficients[17] + x5*3*coefficients[28]) + x4*(coefficients[18] + x5*2*coefficients[29] + x4*coefficients[31])) + x3*(coefficients[6] + x5*(2*coefficients[12] + x5*3*coefficients[38]) + x4*(coefficients[13] + x5*2*coefficients[22] + x4*coefficients[30]) + x3*(coefficients[12] + x5*2*coefficients[26] + x4*coefficients[22] + x3*coefficients[38])) + x2*(coefficients[8] + x5*(2*coefficients[20] + x5*3*coefficients[21]) + x4*(coefficients[13] + x5*2*coefficients[22] + x4*coefficients[32]) + x3*(coefficients[13] + x5*2*coefficients[22] + x4*coefficients[27] + x3*coefficients[32]) + x2*(coefficients[20] + x5*2*coefficients[25] + x4*coefficients[22] + x3*coefficients[30] + x2*coefficients[21])) + x1*(coefficients[7] + x5*(2*coefficients[16] + x5*3*coefficients[35]) + x4*(coefficients[18] + x5*2*coefficients[29] + x4*coefficients[36]) + x3*(coefficients[12] + x5*2*coefficients[26] + x4*coefficients[32] + x3*coefficients[26]) + x2*(coefficients[20] + x5*2*coefficients[25] + x4*coefficients[30] + x3*coefficients[22] + x2*coefficients[25]) + x1*(coefficients[15] + x5*2*coefficients[35] + x4*coefficients[31] + x3*coefficients[38] + x2*coefficients[21] + x1*coefficients[24]))) + x0*(coefficients[1] + x5*(2*coefficients[4] + x5*(3*coefficients[14] + x5*4*coefficients[34])) + x4*(coefficients[9] + x5*(2*coefficients[18] + x5*3*coefficients[31]) + x4*(coefficients[17] + x5*2*coefficients[29] + x4*coefficients[28])) + x3*(coefficients[9] + x5*(2*coefficients[18] + x5*3*coefficients[31]) + x4*(coefficients[13] + x5*2*coefficients[30] + x4*coefficients[22]) + x3*(coefficients[17] + x5*2*coefficients[29] + x4*coefficients[22] + x3*coefficients[28])) + x2*(coefficients[9] + x5*(2*coefficients[18] + x5*3*coefficients[31]) + x4*(coefficients[13] + x5*2*coefficients[32] + x4*coefficients[22]) + x3*(coefficients[10] + x5*2*coefficients[33] + x4*coefficients[27] + x3*coefficients[33]) + x2*(coefficients[17] + x5*2*coefficients[29] + x4*coefficients[22] + x3*coefficients[33] + x2*coefficients[28])) + x1*(coefficients[9] + x5*(2*coefficients[18] + x5*3*coefficients[31]) + x4*(coefficients[10] + x5*2*coefficients[33] + x4*coefficients[33]) + x3*(coefficients[13] + x5*2*coefficients[32] + x4*coefficients[27] + x3*coefficients[22]) + x2*(coefficients[13] + x5*2*coefficients[30] + x4*coefficients[27] + x3*coefficients[27] + x2*coefficients[22]) + x1*(coefficients[17] + x5*2*coefficients[29] + x4*coefficients[33] + x3*coefficients[22] + x2*coefficients[22] + x1*coefficients[28])) + x0*(coefficients[4] + x5*(2*coefficients[11] + x5*3*coefficients[23]) + x4*(coefficients[18] + x5*2*coefficients[36] + x4*coefficients[29]) + x3*(coefficients[18] + x5*2*coefficients[36] + x4*coefficients[32] + x3*coefficients[29]) + x2*(coefficients[18] + x5*2*coefficients[36] + x4*coefficients[30] + x3*coefficients[33] + x2*coefficients[29]) + x1*(coefficients[18] + x5*2*coefficients[36] + x4*coefficients[33] + x3*coefficients[30] + x2*coefficients[32] + x1*coefficients[29]) + x0*(coefficients[14] + x5*2*coefficients[23] + x4*coefficients[31] + x3*coefficients[31] + x2*coefficients[31] + x1*coefficients[31] + x0*coefficients[34])));
+            }
         }
 
         std::vector<double> polynomial_terms_gradient(const std::vector<double>& variables) const {
             std::vector<double> grad(variables.size()*this->get_coefficients().size());
-            grad[0] = 0 + (1);
-            grad[1] = 0 + (1*variables[5]);
-            grad[2] = 0 + (1*variables[2] + 1*variables[4] + 1*variables[1] + 1*variables[3]);
-            grad[3] = 0 + (2*variables[0]);
-            grad[4] = 0 + (2*variables[0]*variables[5] + 1*variables[5]*variables[5]);
-            grad[5] = 0 + (3*variables[0]*variables[0]);
-            grad[6] = 0 + (1*variables[3]*variables[4] + 1*variables[1]*variables[2]);
-            grad[7] = 0 + (2*variables[0]*variables[3] + 2*variables[0]*variables[2] + 1*variables[1]*variables[1] + 2*variables[0]*variables[1] + 1*variables[3]*variables[3] + 1*variables[2]*variables[2] + 2*variables[0]*variables[4] + 1*variables[4]*variables[4]);
-            grad[8] = 0 + (1*variables[1]*variables[3] + 1*variables[2]*variables[4]);
-            grad[9] = 0 + (1*variables[2]*variables[3] + 1*variables[2]*variables[5] + 1*variables[4]*variables[5] + 1*variables[3]*variables[5] + 1*variables[1]*variables[4] + 1*variables[1]*variables[5]);
-            grad[10] = 0 + (1*variables[1]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[5]);
-            grad[11] = 0 + (2*variables[0]*variables[5]*variables[5]);
-            grad[12] = 0 + (1*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[3]*variables[4] + 1*variables[3]*variables[3]*variables[4] + 2*variables[0]*variables[1]*variables[2] + 1*variables[3]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[2]);
-            grad[13] = 0 + (1*variables[1]*variables[3]*variables[5] + 1*variables[1]*variables[2]*variables[3] + 1*variables[2]*variables[3]*variables[4] + 1*variables[2]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[5] + 1*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[3]*variables[4] + 1*variables[1]*variables[2]*variables[4]);
-            grad[14] = 0 + (1*variables[5]*variables[5]*variables[5] + 3*variables[0]*variables[0]*variables[5]);
-            grad[15] = 0 + (1*variables[1]*variables[1]*variables[1] + 3*variables[0]*variables[0]*variables[3] + 1*variables[3]*variables[3]*variables[3] + 3*variables[0]*variables[0]*variables[2] + 1*variables[4]*variables[4]*variables[4] + 3*variables[0]*variables[0]*variables[4] + 1*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[1]);
-            grad[16] = 0 + (2*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[1] + 2*variables[0]*variables[3]*variables[3]);
-            grad[17] = 0 + (1*variables[1]*variables[1]*variables[5] + 1*variables[2]*variables[2]*variables[5] + 1*variables[4]*variables[4]*variables[5] + 2*variables[0]*variables[1]*variables[4] + 1*variables[3]*variables[3]*variables[5] + 2*variables[0]*variables[2]*variables[3]);
-            grad[18] = 0 + (1*variables[2]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[5] + 2*variables[0]*variables[2]*variables[5] + 2*variables[0]*variables[3]*variables[5] + 1*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[4]*variables[5] + 1*variables[3]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[4] + 1*variables[2]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[3] + 1*variables[1]*variables[4]*variables[4] + 1*variables[1]*variables[5]*variables[5]);
-            grad[19] = 0 + (4*variables[0]*variables[0]*variables[0]);
-            grad[20] = 0 + (2*variables[0]*variables[2]*variables[4] + 1*variables[2]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[3] + 1*variables[2]*variables[2]*variables[4] + 1*variables[1]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[3]);
-            grad[21] = 0 + (1*variables[2]*variables[4]*variables[4]*variables[4] + 3*variables[0]*variables[0]*variables[1]*variables[3] + 3*variables[0]*variables[0]*variables[2]*variables[4] + 1*variables[2]*variables[2]*variables[2]*variables[4] + 1*variables[1]*variables[3]*variables[3]*variables[3] + 1*variables[1]*variables[1]*variables[1]*variables[3]);
-            grad[22] = 0 + (1*variables[3]*variables[4]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[2]*variables[5] + 2*variables[0]*variables[1]*variables[2]*variables[3] + 1*variables[1]*variables[1]*variables[2]*variables[3] + 1*variables[1]*variables[1]*variables[2]*variables[5] + 1*variables[1]*variables[3]*variables[3]*variables[5] + 2*variables[0]*variables[1]*variables[3]*variables[4] + 2*variables[0]*variables[1]*variables[2]*variables[4] + 1*variables[2]*variables[4]*variables[4]*variables[5] + 1*variables[2]*variables[2]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[2]*variables[4] + 1*variables[2]*variables[3]*variables[4]*variables[4] + 1*variables[1]*variables[3]*variables[3]*variables[4] + 2*variables[0]*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[3]*variables[5] + 1*variables[3]*variables[3]*variables[4]*variables[5]);
-            grad[23] = 0 + (3*variables[0]*variables[0]*variables[5]*variables[5] + 2*variables[0]*variables[5]*variables[5]*variables[5]);
-            grad[24] = 0 + (1*variables[3]*variables[3]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[0]*variables[0]*variables[0]*variables[2] + 1*variables[1]*variables[1]*variables[1]*variables[1] + 4*variables[0]*variables[0]*variables[0]*variables[4] + 4*variables[0]*variables[0]*variables[0]*variables[1] + 4*variables[0]*variables[0]*variables[0]*variables[3] + 1*variables[4]*variables[4]*variables[4]*variables[4]);
-            grad[25] = 0 + (2*variables[0]*variables[2]*variables[2]*variables[4] + 2*variables[0]*variables[1]*variables[1]*variables[3] + 1*variables[1]*variables[1]*variables[3]*variables[3] + 2*variables[0]*variables[2]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[4]*variables[4]);
-            grad[26] = 0 + (2*variables[0]*variables[3]*variables[4]*variables[4] + 1*variables[3]*variables[3]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[1]*variables[2] + 1*variables[1]*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[3]*variables[3]*variables[4] + 2*variables[0]*variables[1]*variables[2]*variables[2]);
-            grad[27] = 0 + (1*variables[1]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[2]*variables[3]*variables[5] + 1*variables[2]*variables[3]*variables[4]*variables[5]);
-            grad[28] = 0 + (1*variables[2]*variables[2]*variables[2]*variables[5] + 1*variables[3]*variables[3]*variables[3]*variables[5] + 1*variables[4]*variables[4]*variables[4]*variables[5] + 3*variables[0]*variables[0]*variables[1]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[5] + 3*variables[0]*variables[0]*variables[2]*variables[3]);
-            grad[29] = 0 + (1*variables[4]*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[2]*variables[3] + 2*variables[0]*variables[1]*variables[1]*variables[5] + 1*variables[2]*variables[2]*variables[5]*variables[5] + 2*variables[0]*variables[1]*variables[1]*variables[4] + 2*variables[0]*variables[2]*variables[2]*variables[5] + 1*variables[3]*variables[3]*variables[5]*variables[5] + 2*variables[0]*variables[4]*variables[4]*variables[5] + 2*variables[0]*variables[1]*variables[4]*variables[4] + 2*variables[0]*variables[3]*variables[3]*variables[5] + 1*variables[1]*variables[1]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[3]*variables[3]);
-            grad[30] = 0 + (1*variables[2]*variables[2]*variables[3]*variables[4] + 2*variables[0]*variables[1]*variables[3]*variables[5] + 1*variables[1]*variables[2]*variables[4]*variables[4] + 1*variables[3]*variables[4]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[3]*variables[4] + 1*variables[1]*variables[2]*variables[3]*variables[3] + 1*variables[1]*variables[2]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[4]*variables[5]);
-            grad[31] = 0 + (3*variables[0]*variables[0]*variables[2]*variables[5] + 1*variables[1]*variables[4]*variables[4]*variables[4] + 1*variables[1]*variables[5]*variables[5]*variables[5] + 1*variables[3]*variables[5]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[1]*variables[4] + 3*variables[0]*variables[0]*variables[3]*variables[5] + 1*variables[4]*variables[5]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[2]*variables[3] + 3*variables[0]*variables[0]*variables[1]*variables[5] + 3*variables[0]*variables[0]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[3]*variables[3] + 1*variables[2]*variables[5]*variables[5]*variables[5]);
-            grad[32] = 0 + (2*variables[0]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[2]*variables[3] + 2*variables[0]*variables[1]*variables[2]*variables[5] + 1*variables[1]*variables[3]*variables[4]*variables[4] + 1*variables[2]*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[2]*variables[4] + 1*variables[1]*variables[3]*variables[5]*variables[5] + 1*variables[2]*variables[4]*variables[5]*variables[5]);
-            grad[33] = 0 + (1*variables[2]*variables[2]*variables[3]*variables[5] + 2*variables[0]*variables[2]*variables[3]*variables[5] + 1*variables[1]*variables[4]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[3]*variables[5] + 1*variables[1]*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[1]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[4]*variables[5]);
-            grad[34] = 0 + (4*variables[0]*variables[0]*variables[0]*variables[5] + 1*variables[5]*variables[5]*variables[5]*variables[5]);
-            grad[35] = 0 + (3*variables[0]*variables[0]*variables[3]*variables[3] + 3*variables[0]*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[1]*variables[1]*variables[1] + 3*variables[0]*variables[0]*variables[1]*variables[1] + 2*variables[0]*variables[4]*variables[4]*variables[4] + 2*variables[0]*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[4]*variables[4] + 2*variables[0]*variables[3]*variables[3]*variables[3]);
-            grad[36] = 0 + (1*variables[1]*variables[1]*variables[4]*variables[4] + 2*variables[0]*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[5]*variables[5] + 2*variables[0]*variables[3]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[5]*variables[5]);
-            grad[37] = 0 + (5*variables[0]*variables[0]*variables[0]*variables[0]);
-            grad[38] = 0 + (1*variables[3]*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[2] + 1*variables[1]*variables[2]*variables[2]*variables[2] + 3*variables[0]*variables[0]*variables[3]*variables[4] + 3*variables[0]*variables[0]*variables[1]*variables[2] + 1*variables[3]*variables[4]*variables[4]*variables[4]);
-            grad[39] = 0 + (1);
-            grad[40] = 0 + (1*variables[4]);
-            grad[41] = 0 + (1*variables[3] + 1*variables[5] + 1*variables[2] + 1*variables[0]);
-            grad[42] = 0 + (2*variables[1]);
-            grad[43] = 0 + (1*variables[4]*variables[4] + 2*variables[1]*variables[4]);
-            grad[44] = 0 + (3*variables[1]*variables[1]);
-            grad[45] = 0 + (1*variables[3]*variables[5] + 1*variables[0]*variables[2]);
-            grad[46] = 0 + (1*variables[3]*variables[3] + 2*variables[0]*variables[1] + 1*variables[0]*variables[0] + 1*variables[2]*variables[2] + 1*variables[5]*variables[5] + 2*variables[1]*variables[5] + 2*variables[1]*variables[2] + 2*variables[1]*variables[3]);
-            grad[47] = 0 + (1*variables[0]*variables[3] + 1*variables[2]*variables[5]);
-            grad[48] = 0 + (1*variables[2]*variables[4] + 1*variables[4]*variables[5] + 1*variables[2]*variables[3] + 1*variables[3]*variables[4] + 1*variables[0]*variables[4] + 1*variables[0]*variables[5]);
-            grad[49] = 0 + (1*variables[0]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[4]);
-            grad[50] = 0 + (2*variables[1]*variables[4]*variables[4]);
-            grad[51] = 0 + (1*variables[3]*variables[5]*variables[5] + 1*variables[0]*variables[2]*variables[2] + 1*variables[0]*variables[0]*variables[2] + 2*variables[1]*variables[3]*variables[5] + 1*variables[3]*variables[3]*variables[5] + 2*variables[0]*variables[1]*variables[2]);
-            grad[52] = 0 + (1*variables[2]*variables[3]*variables[5] + 1*variables[2]*variables[4]*variables[5] + 1*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[3]*variables[5] + 1*variables[0]*variables[2]*variables[3] + 1*variables[0]*variables[2]*variables[5] + 1*variables[0]*variables[3]*variables[4] + 1*variables[0]*variables[2]*variables[4]);
-            grad[53] = 0 + (3*variables[1]*variables[1]*variables[4] + 1*variables[4]*variables[4]*variables[4]);
-            grad[54] = 0 + (3*variables[0]*variables[1]*variables[1] + 3*variables[1]*variables[1]*variables[3] + 1*variables[3]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[2] + 3*variables[1]*variables[1]*variables[5] + 1*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[1]*variables[2] + 1*variables[0]*variables[0]*variables[0]);
-            grad[55] = 0 + (2*variables[1]*variables[3]*variables[3] + 2*variables[1]*variables[5]*variables[5] + 2*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[0]*variables[1]);
-            grad[56] = 0 + (2*variables[0]*variables[1]*variables[5] + 1*variables[3]*variables[3]*variables[4] + 2*variables[1]*variables[2]*variables[3] + 1*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[4] + 1*variables[2]*variables[2]*variables[4]);
-            grad[57] = 0 + (1*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[5] + 1*variables[2]*variables[3]*variables[3] + 1*variables[3]*variables[4]*variables[4] + 2*variables[1]*variables[4]*variables[5] + 2*variables[0]*variables[1]*variables[4] + 1*variables[2]*variables[4]*variables[4] + 2*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[4] + 1*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[5]*variables[5]);
-            grad[58] = 0 + (4*variables[1]*variables[1]*variables[1]);
-            grad[59] = 0 + (1*variables[2]*variables[2]*variables[5] + 2*variables[0]*variables[1]*variables[3] + 1*variables[2]*variables[5]*variables[5] + 2*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[3]);
-            grad[60] = 0 + (1*variables[0]*variables[0]*variables[0]*variables[3] + 1*variables[2]*variables[2]*variables[2]*variables[5] + 1*variables[2]*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[3]*variables[3]*variables[3] + 3*variables[0]*variables[1]*variables[1]*variables[3]);
-            grad[61] = 0 + (2*variables[1]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[5] + 1*variables[3]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[2]*variables[3] + 1*variables[3]*variables[3]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[5]*variables[5] + 2*variables[0]*variables[1]*variables[2]*variables[3] + 2*variables[0]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[2]*variables[4] + 1*variables[2]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[4] + 1*variables[2]*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[3]*variables[3]*variables[4] + 2*variables[0]*variables[1]*variables[3]*variables[5]);
-            grad[62] = 0 + (2*variables[1]*variables[4]*variables[4]*variables[4] + 3*variables[1]*variables[1]*variables[4]*variables[4]);
-            grad[63] = 0 + (1*variables[5]*variables[5]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[1]*variables[1]*variables[1]*variables[5] + 1*variables[3]*variables[3]*variables[3]*variables[3] + 4*variables[0]*variables[1]*variables[1]*variables[1] + 1*variables[0]*variables[0]*variables[0]*variables[0] + 4*variables[1]*variables[1]*variables[1]*variables[2] + 4*variables[1]*variables[1]*variables[1]*variables[3]);
-            grad[64] = 0 + (2*variables[1]*variables[2]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[1]*variables[3] + 1*variables[2]*variables[2]*variables[5]*variables[5] + 2*variables[1]*variables[2]*variables[2]*variables[5] + 2*variables[0]*variables[1]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[3]*variables[3]);
-            grad[65] = 0 + (2*variables[1]*variables[3]*variables[3]*variables[5] + 2*variables[0]*variables[0]*variables[1]*variables[2] + 2*variables[0]*variables[1]*variables[2]*variables[2] + 2*variables[1]*variables[3]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[2]*variables[2] + 1*variables[3]*variables[3]*variables[5]*variables[5]);
-            grad[66] = 0 + (1*variables[0]*variables[3]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[3]*variables[4] + 1*variables[0]*variables[2]*variables[3]*variables[5]);
-            grad[67] = 0 + (1*variables[3]*variables[3]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[0]*variables[4] + 1*variables[4]*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[1]*variables[2]*variables[3] + 3*variables[0]*variables[1]*variables[1]*variables[5] + 1*variables[2]*variables[2]*variables[2]*variables[4]);
-            grad[68] = 0 + (2*variables[1]*variables[3]*variables[3]*variables[4] + 1*variables[3]*variables[3]*variables[4]*variables[4] + 2*variables[0]*variables[0]*variables[1]*variables[5] + 2*variables[0]*variables[0]*variables[1]*variables[4] + 1*variables[4]*variables[4]*variables[5]*variables[5] + 2*variables[1]*variables[2]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[2]*variables[3] + 2*variables[1]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[5]*variables[5] + 2*variables[1]*variables[2]*variables[2]*variables[4]);
-            grad[69] = 0 + (2*variables[1]*variables[2]*variables[4]*variables[5] + 1*variables[3]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[3]*variables[5] + 1*variables[0]*variables[2]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[2]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[2]*variables[5]*variables[5]);
-            grad[70] = 0 + (1*variables[2]*variables[4]*variables[4]*variables[4] + 1*variables[0]*variables[4]*variables[4]*variables[4] + 1*variables[0]*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[1]*variables[2]*variables[4] + 3*variables[0]*variables[1]*variables[1]*variables[4] + 1*variables[2]*variables[3]*variables[3]*variables[3] + 3*variables[1]*variables[1]*variables[4]*variables[5] + 1*variables[4]*variables[4]*variables[4]*variables[5] + 1*variables[3]*variables[4]*variables[4]*variables[4] + 3*variables[1]*variables[1]*variables[3]*variables[4] + 1*variables[2]*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[0]*variables[5]);
-            grad[71] = 0 + (1*variables[0]*variables[2]*variables[2]*variables[3] + 2*variables[1]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[2]*variables[5] + 1*variables[0]*variables[3]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[2]*variables[4] + 1*variables[2]*variables[4]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[3]*variables[5]*variables[5]);
-            grad[72] = 0 + (1*variables[2]*variables[2]*variables[3]*variables[4] + 1*variables[2]*variables[3]*variables[3]*variables[4] + 1*variables[0]*variables[4]*variables[4]*variables[5] + 2*variables[1]*variables[2]*variables[3]*variables[4] + 1*variables[0]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[4]*variables[5] + 1*variables[2]*variables[3]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[4]*variables[5]);
-            grad[73] = 0 + (4*variables[1]*variables[1]*variables[1]*variables[4] + 1*variables[4]*variables[4]*variables[4]*variables[4]);
-            grad[74] = 0 + (3*variables[1]*variables[1]*variables[3]*variables[3] + 2*variables[1]*variables[2]*variables[2]*variables[2] + 3*variables[1]*variables[1]*variables[5]*variables[5] + 3*variables[0]*variables[0]*variables[1]*variables[1] + 2*variables[1]*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[0]*variables[0]*variables[1] + 2*variables[1]*variables[3]*variables[3]*variables[3]);
-            grad[75] = 0 + (2*variables[0]*variables[1]*variables[4]*variables[4] + 2*variables[1]*variables[3]*variables[4]*variables[4] + 1*variables[2]*variables[2]*variables[3]*variables[3] + 2*variables[1]*variables[2]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[5]*variables[5] + 2*variables[1]*variables[4]*variables[4]*variables[5]);
-            grad[76] = 0 + (5*variables[1]*variables[1]*variables[1]*variables[1]);
-            grad[77] = 0 + (1*variables[3]*variables[3]*variables[3]*variables[5] + 3*variables[0]*variables[1]*variables[1]*variables[2] + 1*variables[3]*variables[5]*variables[5]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[2] + 3*variables[1]*variables[1]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[2]);
-            grad[78] = 0 + (1);
-            grad[79] = 0 + (1*variables[3]);
-            grad[80] = 0 + (1*variables[4] + 1*variables[0] + 1*variables[5] + 1*variables[1]);
-            grad[81] = 0 + (2*variables[2]);
-            grad[82] = 0 + (2*variables[2]*variables[3] + 1*variables[3]*variables[3]);
-            grad[83] = 0 + (3*variables[2]*variables[2]);
-            grad[84] = 0 + (1*variables[4]*variables[5] + 1*variables[0]*variables[1]);
-            grad[85] = 0 + (1*variables[0]*variables[0] + 2*variables[2]*variables[5] + 2*variables[1]*variables[2] + 1*variables[4]*variables[4] + 2*variables[0]*variables[2] + 2*variables[2]*variables[4] + 1*variables[5]*variables[5] + 1*variables[1]*variables[1]);
-            grad[86] = 0 + (1*variables[0]*variables[4] + 1*variables[1]*variables[5]);
-            grad[87] = 0 + (1*variables[1]*variables[4] + 1*variables[3]*variables[4] + 1*variables[3]*variables[5] + 1*variables[0]*variables[3] + 1*variables[0]*variables[5] + 1*variables[1]*variables[3]);
-            grad[88] = 0 + (1*variables[0]*variables[3]*variables[5] + 1*variables[1]*variables[3]*variables[4]);
-            grad[89] = 0 + (2*variables[2]*variables[3]*variables[3]);
-            grad[90] = 0 + (2*variables[0]*variables[1]*variables[2] + 1*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[1] + 1*variables[4]*variables[5]*variables[5] + 2*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[1]);
-            grad[91] = 0 + (1*variables[1]*variables[3]*variables[5] + 1*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[3] + 1*variables[0]*variables[3]*variables[4] + 1*variables[0]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[5] + 1*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[4]);
-            grad[92] = 0 + (1*variables[3]*variables[3]*variables[3] + 3*variables[2]*variables[2]*variables[3]);
-            grad[93] = 0 + (1*variables[4]*variables[4]*variables[4] + 3*variables[1]*variables[2]*variables[2] + 3*variables[2]*variables[2]*variables[4] + 1*variables[1]*variables[1]*variables[1] + 1*variables[0]*variables[0]*variables[0] + 1*variables[5]*variables[5]*variables[5] + 3*variables[0]*variables[2]*variables[2] + 3*variables[2]*variables[2]*variables[5]);
-            grad[94] = 0 + (2*variables[2]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[2] + 2*variables[1]*variables[1]*variables[2] + 2*variables[2]*variables[4]*variables[4]);
-            grad[95] = 0 + (2*variables[0]*variables[2]*variables[5] + 1*variables[3]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[3] + 1*variables[3]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[4] + 1*variables[0]*variables[0]*variables[3]);
-            grad[96] = 0 + (2*variables[1]*variables[2]*variables[3] + 2*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[5] + 1*variables[3]*variables[3]*variables[5] + 1*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[3]*variables[3] + 2*variables[2]*variables[3]*variables[4] + 1*variables[0]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[3] + 1*variables[1]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[4]);
-            grad[97] = 0 + (4*variables[2]*variables[2]*variables[2]);
-            grad[98] = 0 + (1*variables[0]*variables[0]*variables[4] + 1*variables[0]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[5] + 1*variables[1]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[4] + 1*variables[1]*variables[1]*variables[5]);
-            grad[99] = 0 + (1*variables[0]*variables[4]*variables[4]*variables[4] + 3*variables[1]*variables[2]*variables[2]*variables[5] + 1*variables[1]*variables[5]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[4] + 3*variables[0]*variables[2]*variables[2]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[5]);
-            grad[100] = 0 + (1*variables[3]*variables[4]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[3]*variables[5] + 2*variables[0]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[3] + 1*variables[3]*variables[4]*variables[5]*variables[5] + 1*variables[1]*variables[3]*variables[5]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[3] + 1*variables[0]*variables[1]*variables[1]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[4] + 1*variables[0]*variables[4]*variables[4]*variables[5] + 1*variables[1]*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[4]*variables[5] + 2*variables[0]*variables[1]*variables[2]*variables[4] + 1*variables[0]*variables[3]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[3]*variables[4]);
-            grad[101] = 0 + (2*variables[2]*variables[3]*variables[3]*variables[3] + 3*variables[2]*variables[2]*variables[3]*variables[3]);
-            grad[102] = 0 + (4*variables[2]*variables[2]*variables[2]*variables[5] + 4*variables[1]*variables[2]*variables[2]*variables[2] + 4*variables[2]*variables[2]*variables[2]*variables[4] + 4*variables[0]*variables[2]*variables[2]*variables[2] + 1*variables[0]*variables[0]*variables[0]*variables[0] + 1*variables[1]*variables[1]*variables[1]*variables[1] + 1*variables[4]*variables[4]*variables[4]*variables[4] + 1*variables[5]*variables[5]*variables[5]*variables[5]);
-            grad[103] = 0 + (1*variables[1]*variables[1]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[2]*variables[4] + 2*variables[1]*variables[2]*variables[5]*variables[5] + 2*variables[1]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[0]*variables[4]*variables[4] + 2*variables[0]*variables[2]*variables[4]*variables[4]);
-            grad[104] = 0 + (2*variables[2]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[1] + 2*variables[0]*variables[1]*variables[1]*variables[2] + 1*variables[4]*variables[4]*variables[5]*variables[5] + 2*variables[2]*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[1]*variables[2]);
-            grad[105] = 0 + (1*variables[1]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[1]*variables[3]*variables[5] + 1*variables[0]*variables[3]*variables[4]*variables[5]);
-            grad[106] = 0 + (3*variables[0]*variables[2]*variables[2]*variables[5] + 1*variables[1]*variables[1]*variables[1]*variables[3] + 1*variables[3]*variables[4]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[0]*variables[3] + 1*variables[3]*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[2]*variables[2]*variables[4]);
-            grad[107] = 0 + (2*variables[0]*variables[0]*variables[2]*variables[3] + 2*variables[0]*variables[2]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[2]*variables[5] + 1*variables[1]*variables[1]*variables[3]*variables[3] + 2*variables[1]*variables[2]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[2]*variables[3] + 2*variables[2]*variables[3]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[3]*variables[3] + 1*variables[3]*variables[3]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[2]*variables[4] + 2*variables[2]*variables[3]*variables[5]*variables[5] + 1*variables[3]*variables[3]*variables[5]*variables[5]);
-            grad[108] = 0 + (1*variables[1]*variables[1]*variables[4]*variables[5] + 2*variables[0]*variables[2]*variables[3]*variables[4] + 1*variables[3]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[4]*variables[4] + 1*variables[0]*variables[1]*variables[3]*variables[3] + 2*variables[1]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[4]*variables[5]);
-            grad[109] = 0 + (1*variables[3]*variables[3]*variables[3]*variables[5] + 1*variables[1]*variables[4]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[0]*variables[5] + 3*variables[2]*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[4] + 1*variables[1]*variables[3]*variables[3]*variables[3] + 3*variables[0]*variables[2]*variables[2]*variables[3] + 3*variables[2]*variables[2]*variables[3]*variables[5] + 3*variables[1]*variables[2]*variables[2]*variables[3] + 1*variables[3]*variables[3]*variables[3]*variables[4] + 1*variables[0]*variables[3]*variables[3]*variables[3] + 1*variables[0]*variables[5]*variables[5]*variables[5]);
-            grad[110] = 0 + (2*variables[0]*variables[1]*variables[2]*variables[3] + 2*variables[2]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[5] + 1*variables[0]*variables[3]*variables[3]*variables[4] + 1*variables[0]*variables[1]*variables[1]*variables[4] + 1*variables[1]*variables[4]*variables[4]*variables[5] + 1*variables[1]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[4]*variables[5]*variables[5]);
-            grad[111] = 0 + (2*variables[1]*variables[2]*variables[3]*variables[4] + 2*variables[0]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[3]*variables[5] + 1*variables[1]*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[3]*variables[5]*variables[5] + 1*variables[1]*variables[3]*variables[4]*variables[4]);
-            grad[112] = 0 + (4*variables[2]*variables[2]*variables[2]*variables[3] + 1*variables[3]*variables[3]*variables[3]*variables[3]);
-            grad[113] = 0 + (2*variables[0]*variables[0]*variables[0]*variables[2] + 3*variables[1]*variables[1]*variables[2]*variables[2] + 3*variables[2]*variables[2]*variables[5]*variables[5] + 2*variables[2]*variables[4]*variables[4]*variables[4] + 2*variables[2]*variables[5]*variables[5]*variables[5] + 3*variables[2]*variables[2]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[1]*variables[2] + 3*variables[0]*variables[0]*variables[2]*variables[2]);
-            grad[114] = 0 + (2*variables[1]*variables[2]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[4]*variables[4] + 2*variables[0]*variables[2]*variables[3]*variables[3] + 2*variables[2]*variables[3]*variables[3]*variables[4] + 2*variables[2]*variables[3]*variables[3]*variables[5]);
-            grad[115] = 0 + (5*variables[2]*variables[2]*variables[2]*variables[2]);
-            grad[116] = 0 + (1*variables[0]*variables[1]*variables[1]*variables[1] + 3*variables[2]*variables[2]*variables[4]*variables[5] + 1*variables[4]*variables[4]*variables[4]*variables[5] + 3*variables[0]*variables[1]*variables[2]*variables[2] + 1*variables[4]*variables[5]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[1]);
-            grad[117] = 0 + (1);
-            grad[118] = 0 + (1*variables[2]);
-            grad[119] = 0 + (1*variables[1] + 1*variables[5] + 1*variables[4] + 1*variables[0]);
-            grad[120] = 0 + (2*variables[3]);
-            grad[121] = 0 + (1*variables[2]*variables[2] + 2*variables[2]*variables[3]);
-            grad[122] = 0 + (3*variables[3]*variables[3]);
-            grad[123] = 0 + (1*variables[0]*variables[4] + 1*variables[1]*variables[5]);
-            grad[124] = 0 + (1*variables[0]*variables[0] + 2*variables[1]*variables[3] + 2*variables[0]*variables[3] + 2*variables[3]*variables[4] + 1*variables[4]*variables[4] + 2*variables[3]*variables[5] + 1*variables[5]*variables[5] + 1*variables[1]*variables[1]);
-            grad[125] = 0 + (1*variables[0]*variables[1] + 1*variables[4]*variables[5]);
-            grad[126] = 0 + (1*variables[2]*variables[4] + 1*variables[2]*variables[5] + 1*variables[0]*variables[2] + 1*variables[1]*variables[2] + 1*variables[1]*variables[4] + 1*variables[0]*variables[5]);
-            grad[127] = 0 + (1*variables[0]*variables[2]*variables[5] + 1*variables[1]*variables[2]*variables[4]);
-            grad[128] = 0 + (2*variables[2]*variables[2]*variables[3]);
-            grad[129] = 0 + (1*variables[1]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[4] + 2*variables[0]*variables[3]*variables[4] + 1*variables[0]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[5] + 2*variables[1]*variables[3]*variables[5]);
-            grad[130] = 0 + (1*variables[1]*variables[2]*variables[5] + 1*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[5] + 1*variables[0]*variables[1]*variables[2] + 1*variables[0]*variables[2]*variables[4] + 1*variables[0]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[4] + 1*variables[2]*variables[4]*variables[5]);
-            grad[131] = 0 + (3*variables[2]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[2]);
-            grad[132] = 0 + (1*variables[0]*variables[0]*variables[0] + 3*variables[3]*variables[3]*variables[4] + 3*variables[3]*variables[3]*variables[5] + 1*variables[1]*variables[1]*variables[1] + 3*variables[1]*variables[3]*variables[3] + 1*variables[5]*variables[5]*variables[5] + 3*variables[0]*variables[3]*variables[3] + 1*variables[4]*variables[4]*variables[4]);
-            grad[133] = 0 + (2*variables[1]*variables[1]*variables[3] + 2*variables[3]*variables[4]*variables[4] + 2*variables[0]*variables[0]*variables[3] + 2*variables[3]*variables[5]*variables[5]);
-            grad[134] = 0 + (1*variables[2]*variables[5]*variables[5] + 2*variables[1]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[2] + 1*variables[2]*variables[4]*variables[4] + 2*variables[0]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[2]);
-            grad[135] = 0 + (1*variables[1]*variables[2]*variables[2] + 1*variables[2]*variables[2]*variables[5] + 2*variables[0]*variables[2]*variables[3] + 2*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[5] + 2*variables[2]*variables[3]*variables[4] + 2*variables[1]*variables[2]*variables[3] + 1*variables[2]*variables[2]*variables[4] + 1*variables[1]*variables[4]*variables[4] + 1*variables[0]*variables[5]*variables[5] + 1*variables[0]*variables[2]*variables[2] + 1*variables[1]*variables[1]*variables[4]);
-            grad[136] = 0 + (4*variables[3]*variables[3]*variables[3]);
-            grad[137] = 0 + (1*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[1] + 2*variables[3]*variables[4]*variables[5] + 1*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[1]*variables[3] + 1*variables[0]*variables[0]*variables[1]);
-            grad[138] = 0 + (1*variables[0]*variables[0]*variables[0]*variables[1] + 3*variables[3]*variables[3]*variables[4]*variables[5] + 1*variables[4]*variables[5]*variables[5]*variables[5] + 1*variables[4]*variables[4]*variables[4]*variables[5] + 3*variables[0]*variables[1]*variables[3]*variables[3] + 1*variables[0]*variables[1]*variables[1]*variables[1]);
-            grad[139] = 0 + (1*variables[0]*variables[4]*variables[4]*variables[5] + 1*variables[2]*variables[4]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[2]*variables[5] + 1*variables[1]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[2] + 1*variables[2]*variables[4]*variables[5]*variables[5] + 2*variables[1]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[5]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[2] + 2*variables[0]*variables[1]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[4] + 1*variables[0]*variables[2]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[2]*variables[4] + 1*variables[0]*variables[1]*variables[1]*variables[5] + 2*variables[0]*variables[3]*variables[4]*variables[5]);
-            grad[140] = 0 + (3*variables[2]*variables[2]*variables[3]*variables[3] + 2*variables[2]*variables[2]*variables[2]*variables[3]);
-            grad[141] = 0 + (1*variables[5]*variables[5]*variables[5]*variables[5] + 4*variables[0]*variables[3]*variables[3]*variables[3] + 4*variables[1]*variables[3]*variables[3]*variables[3] + 4*variables[3]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[0] + 1*variables[4]*variables[4]*variables[4]*variables[4] + 4*variables[3]*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[1]);
-            grad[142] = 0 + (2*variables[3]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[1] + 1*variables[4]*variables[4]*variables[5]*variables[5] + 2*variables[3]*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[1]*variables[1]*variables[3] + 2*variables[0]*variables[0]*variables[1]*variables[3]);
-            grad[143] = 0 + (2*variables[1]*variables[1]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[4]*variables[4] + 2*variables[0]*variables[3]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[3]*variables[4] + 2*variables[1]*variables[3]*variables[5]*variables[5]);
-            grad[144] = 0 + (1*variables[0]*variables[1]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[2]*variables[4] + 1*variables[0]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[2]*variables[4]*variables[5]);
-            grad[145] = 0 + (3*variables[0]*variables[3]*variables[3]*variables[5] + 3*variables[1]*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[2] + 1*variables[2]*variables[4]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[0]*variables[2] + 1*variables[2]*variables[5]*variables[5]*variables[5]);
-            grad[146] = 0 + (2*variables[1]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[2]*variables[2] + 2*variables[1]*variables[3]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[2]*variables[3] + 1*variables[1]*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[3]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[4]*variables[4] + 2*variables[0]*variables[0]*variables[3]*variables[5] + 2*variables[0]*variables[0]*variables[2]*variables[3] + 2*variables[2]*variables[3]*variables[4]*variables[4] + 1*variables[2]*variables[2]*variables[5]*variables[5] + 2*variables[2]*variables[3]*variables[5]*variables[5]);
-            grad[147] = 0 + (1*variables[1]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[4] + 1*variables[0]*variables[0]*variables[1]*variables[5] + 2*variables[2]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[4] + 2*variables[0]*variables[1]*variables[2]*variables[3] + 1*variables[1]*variables[2]*variables[2]*variables[5]);
-            grad[148] = 0 + (3*variables[2]*variables[3]*variables[3]*variables[5] + 1*variables[2]*variables[2]*variables[2]*variables[4] + 1*variables[0]*variables[5]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[5] + 3*variables[1]*variables[2]*variables[3]*variables[3] + 1*variables[1]*variables[4]*variables[4]*variables[4] + 1*variables[0]*variables[2]*variables[2]*variables[2] + 1*variables[1]*variables[1]*variables[1]*variables[4] + 1*variables[2]*variables[2]*variables[2]*variables[5] + 1*variables[1]*variables[2]*variables[2]*variables[2] + 3*variables[2]*variables[3]*variables[3]*variables[4] + 3*variables[0]*variables[2]*variables[3]*variables[3]);
-            grad[149] = 0 + (1*variables[0]*variables[0]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[2]*variables[2] + 1*variables[2]*variables[2]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[1]*variables[4]*variables[4] + 2*variables[0]*variables[2]*variables[3]*variables[4] + 2*variables[1]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[5]*variables[5]);
-            grad[150] = 0 + (1*variables[1]*variables[2]*variables[2]*variables[4] + 1*variables[0]*variables[2]*variables[2]*variables[5] + 1*variables[0]*variables[0]*variables[2]*variables[5] + 2*variables[1]*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[2]*variables[4] + 2*variables[0]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[2]*variables[5]*variables[5] + 1*variables[1]*variables[2]*variables[4]*variables[4]);
-            grad[151] = 0 + (1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[2]*variables[3]*variables[3]*variables[3]);
-            grad[152] = 0 + (2*variables[0]*variables[0]*variables[0]*variables[3] + 3*variables[3]*variables[3]*variables[5]*variables[5] + 3*variables[3]*variables[3]*variables[4]*variables[4] + 2*variables[3]*variables[4]*variables[4]*variables[4] + 2*variables[3]*variables[5]*variables[5]*variables[5] + 2*variables[1]*variables[1]*variables[1]*variables[3] + 3*variables[0]*variables[0]*variables[3]*variables[3] + 3*variables[1]*variables[1]*variables[3]*variables[3]);
-            grad[153] = 0 + (1*variables[1]*variables[1]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[5]*variables[5] + 2*variables[0]*variables[2]*variables[2]*variables[3] + 2*variables[2]*variables[2]*variables[3]*variables[4] + 2*variables[2]*variables[2]*variables[3]*variables[5]);
-            grad[154] = 0 + (5*variables[3]*variables[3]*variables[3]*variables[3]);
-            grad[155] = 0 + (3*variables[0]*variables[3]*variables[3]*variables[4] + 3*variables[1]*variables[3]*variables[3]*variables[5] + 1*variables[1]*variables[5]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[1]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[4] + 1*variables[0]*variables[4]*variables[4]*variables[4]);
-            grad[156] = 0 + (1);
-            grad[157] = 0 + (1*variables[1]);
-            grad[158] = 0 + (1*variables[5] + 1*variables[2] + 1*variables[0] + 1*variables[3]);
-            grad[159] = 0 + (2*variables[4]);
-            grad[160] = 0 + (2*variables[1]*variables[4] + 1*variables[1]*variables[1]);
-            grad[161] = 0 + (3*variables[4]*variables[4]);
-            grad[162] = 0 + (1*variables[0]*variables[3] + 1*variables[2]*variables[5]);
-            grad[163] = 0 + (2*variables[2]*variables[4] + 1*variables[3]*variables[3] + 2*variables[4]*variables[5] + 2*variables[3]*variables[4] + 1*variables[0]*variables[0] + 1*variables[5]*variables[5] + 1*variables[2]*variables[2] + 2*variables[0]*variables[4]);
-            grad[164] = 0 + (1*variables[0]*variables[2] + 1*variables[3]*variables[5]);
-            grad[165] = 0 + (1*variables[1]*variables[2] + 1*variables[1]*variables[5] + 1*variables[2]*variables[3] + 1*variables[0]*variables[5] + 1*variables[1]*variables[3] + 1*variables[0]*variables[1]);
-            grad[166] = 0 + (1*variables[0]*variables[1]*variables[5] + 1*variables[1]*variables[2]*variables[3]);
-            grad[167] = 0 + (2*variables[1]*variables[1]*variables[4]);
-            grad[168] = 0 + (1*variables[0]*variables[0]*variables[3] + 1*variables[0]*variables[3]*variables[3] + 2*variables[2]*variables[4]*variables[5] + 2*variables[0]*variables[3]*variables[4] + 1*variables[2]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[5]);
-            grad[169] = 0 + (1*variables[1]*variables[2]*variables[5] + 1*variables[1]*variables[3]*variables[5] + 1*variables[0]*variables[2]*variables[3] + 1*variables[0]*variables[2]*variables[5] + 1*variables[0]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[3] + 1*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[2]);
-            grad[170] = 0 + (1*variables[1]*variables[1]*variables[1] + 3*variables[1]*variables[4]*variables[4]);
-            grad[171] = 0 + (1*variables[5]*variables[5]*variables[5] + 1*variables[3]*variables[3]*variables[3] + 3*variables[2]*variables[4]*variables[4] + 1*variables[2]*variables[2]*variables[2] + 3*variables[4]*variables[4]*variables[5] + 3*variables[0]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[0] + 3*variables[3]*variables[4]*variables[4]);
-            grad[172] = 0 + (2*variables[4]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[4] + 2*variables[3]*variables[3]*variables[4] + 2*variables[2]*variables[2]*variables[4]);
-            grad[173] = 0 + (2*variables[0]*variables[4]*variables[5] + 1*variables[1]*variables[3]*variables[3] + 2*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[1] + 1*variables[1]*variables[2]*variables[2]);
-            grad[174] = 0 + (1*variables[0]*variables[5]*variables[5] + 1*variables[2]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[5] + 2*variables[1]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[5] + 1*variables[0]*variables[1]*variables[1] + 2*variables[1]*variables[2]*variables[4] + 1*variables[1]*variables[1]*variables[3] + 2*variables[0]*variables[1]*variables[4] + 1*variables[1]*variables[1]*variables[2] + 2*variables[1]*variables[4]*variables[5]);
-            grad[175] = 0 + (4*variables[4]*variables[4]*variables[4]);
-            grad[176] = 0 + (1*variables[0]*variables[0]*variables[2] + 2*variables[0]*variables[2]*variables[4] + 2*variables[3]*variables[4]*variables[5] + 1*variables[3]*variables[3]*variables[5] + 1*variables[3]*variables[5]*variables[5] + 1*variables[0]*variables[2]*variables[2]);
-            grad[177] = 0 + (3*variables[0]*variables[2]*variables[4]*variables[4] + 1*variables[3]*variables[3]*variables[3]*variables[5] + 1*variables[3]*variables[5]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[2] + 3*variables[3]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[2]);
-            grad[178] = 0 + (2*variables[0]*variables[3]*variables[4]*variables[5] + 2*variables[2]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[3]*variables[5]*variables[5] + 1*variables[2]*variables[3]*variables[5]*variables[5] + 1*variables[1]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[3] + 1*variables[0]*variables[0]*variables[1]*variables[2] + 2*variables[0]*variables[2]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[5]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[5] + 1*variables[0]*variables[1]*variables[2]*variables[2] + 2*variables[0]*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[2]*variables[2]*variables[5] + 1*variables[0]*variables[1]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[2]*variables[3] + 1*variables[0]*variables[3]*variables[3]*variables[5]);
-            grad[179] = 0 + (3*variables[1]*variables[1]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[1]*variables[4]);
-            grad[180] = 0 + (1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[4]*variables[4]*variables[4]*variables[5] + 1*variables[5]*variables[5]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[0] + 4*variables[3]*variables[4]*variables[4]*variables[4] + 1*variables[3]*variables[3]*variables[3]*variables[3] + 4*variables[2]*variables[4]*variables[4]*variables[4] + 4*variables[0]*variables[4]*variables[4]*variables[4]);
-            grad[181] = 0 + (1*variables[0]*variables[0]*variables[2]*variables[2] + 2*variables[3]*variables[3]*variables[4]*variables[5] + 2*variables[3]*variables[4]*variables[5]*variables[5] + 1*variables[3]*variables[3]*variables[5]*variables[5] + 2*variables[0]*variables[0]*variables[2]*variables[4] + 2*variables[0]*variables[2]*variables[2]*variables[4]);
-            grad[182] = 0 + (2*variables[0]*variables[0]*variables[3]*variables[4] + 2*variables[2]*variables[2]*variables[4]*variables[5] + 2*variables[0]*variables[3]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[3]*variables[3] + 2*variables[2]*variables[4]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[5]*variables[5]);
-            grad[183] = 0 + (1*variables[0]*variables[1]*variables[3]*variables[5] + 1*variables[1]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[1]*variables[2]*variables[3] + 1*variables[0]*variables[2]*variables[3]*variables[5]);
-            grad[184] = 0 + (1*variables[1]*variables[3]*variables[3]*variables[3] + 3*variables[0]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[1] + 1*variables[1]*variables[5]*variables[5]*variables[5] + 3*variables[2]*variables[3]*variables[4]*variables[4] + 1*variables[1]*variables[2]*variables[2]*variables[2]);
-            grad[185] = 0 + (1*variables[1]*variables[1]*variables[3]*variables[3] + 2*variables[0]*variables[4]*variables[5]*variables[5] + 2*variables[1]*variables[3]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[1]*variables[1] + 2*variables[1]*variables[4]*variables[5]*variables[5] + 2*variables[1]*variables[2]*variables[2]*variables[4] + 2*variables[0]*variables[0]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[5]*variables[5] + 2*variables[2]*variables[2]*variables[3]*variables[4] + 2*variables[0]*variables[0]*variables[1]*variables[4] + 2*variables[2]*variables[3]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[2]*variables[2]);
-            grad[186] = 0 + (1*variables[1]*variables[1]*variables[2]*variables[5] + 2*variables[1]*variables[3]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[3] + 1*variables[2]*variables[3]*variables[3]*variables[5] + 2*variables[0]*variables[1]*variables[2]*variables[4] + 1*variables[0]*variables[3]*variables[5]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[3] + 1*variables[0]*variables[0]*variables[2]*variables[5]);
-            grad[187] = 0 + (3*variables[1]*variables[2]*variables[4]*variables[4] + 3*variables[0]*variables[1]*variables[4]*variables[4] + 1*variables[2]*variables[2]*variables[2]*variables[3] + 1*variables[1]*variables[1]*variables[1]*variables[2] + 1*variables[0]*variables[1]*variables[1]*variables[1] + 1*variables[1]*variables[1]*variables[1]*variables[5] + 3*variables[1]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[5]*variables[5]*variables[5] + 3*variables[1]*variables[3]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[3] + 1*variables[2]*variables[3]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[0]*variables[5]);
-            grad[188] = 0 + (1*variables[0]*variables[0]*variables[3]*variables[5] + 1*variables[2]*variables[2]*variables[3]*variables[5] + 1*variables[1]*variables[1]*variables[3]*variables[5] + 2*variables[0]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[2]*variables[3]*variables[3] + 1*variables[0]*variables[1]*variables[1]*variables[2] + 2*variables[1]*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[5]*variables[5]);
-            grad[189] = 0 + (1*variables[1]*variables[2]*variables[2]*variables[3] + 1*variables[1]*variables[2]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[2]*variables[3] + 1*variables[0]*variables[1]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[5] + 2*variables[1]*variables[2]*variables[3]*variables[4] + 1*variables[0]*variables[1]*variables[1]*variables[5]);
-            grad[190] = 0 + (1*variables[1]*variables[1]*variables[1]*variables[1] + 4*variables[1]*variables[4]*variables[4]*variables[4]);
-            grad[191] = 0 + (3*variables[4]*variables[4]*variables[5]*variables[5] + 2*variables[3]*variables[3]*variables[3]*variables[4] + 3*variables[3]*variables[3]*variables[4]*variables[4] + 3*variables[2]*variables[2]*variables[4]*variables[4] + 2*variables[2]*variables[2]*variables[2]*variables[4] + 3*variables[0]*variables[0]*variables[4]*variables[4] + 2*variables[0]*variables[0]*variables[0]*variables[4] + 2*variables[4]*variables[5]*variables[5]*variables[5]);
-            grad[192] = 0 + (2*variables[0]*variables[1]*variables[1]*variables[4] + 1*variables[0]*variables[0]*variables[5]*variables[5] + 2*variables[1]*variables[1]*variables[3]*variables[4] + 2*variables[1]*variables[1]*variables[2]*variables[4] + 1*variables[2]*variables[2]*variables[3]*variables[3] + 2*variables[1]*variables[1]*variables[4]*variables[5]);
-            grad[193] = 0 + (5*variables[4]*variables[4]*variables[4]*variables[4]);
-            grad[194] = 0 + (1*variables[0]*variables[3]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[2]*variables[5] + 3*variables[2]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[3] + 1*variables[2]*variables[5]*variables[5]*variables[5] + 3*variables[0]*variables[3]*variables[4]*variables[4]);
-            grad[195] = 0 + (1);
-            grad[196] = 0 + (1*variables[0]);
-            grad[197] = 0 + (1*variables[4] + 1*variables[2] + 1*variables[1] + 1*variables[3]);
-            grad[198] = 0 + (2*variables[5]);
-            grad[199] = 0 + (1*variables[0]*variables[0] + 2*variables[0]*variables[5]);
-            grad[200] = 0 + (3*variables[5]*variables[5]);
-            grad[201] = 0 + (1*variables[1]*variables[3] + 1*variables[2]*variables[4]);
-            grad[202] = 0 + (1*variables[2]*variables[2] + 1*variables[4]*variables[4] + 2*variables[1]*variables[5] + 1*variables[3]*variables[3] + 2*variables[3]*variables[5] + 2*variables[4]*variables[5] + 1*variables[1]*variables[1] + 2*variables[2]*variables[5]);
-            grad[203] = 0 + (1*variables[1]*variables[2] + 1*variables[3]*variables[4]);
-            grad[204] = 0 + (1*variables[1]*variables[4] + 1*variables[2]*variables[3] + 1*variables[0]*variables[2] + 1*variables[0]*variables[4] + 1*variables[0]*variables[3] + 1*variables[0]*variables[1]);
-            grad[205] = 0 + (1*variables[0]*variables[1]*variables[4] + 1*variables[0]*variables[2]*variables[3]);
-            grad[206] = 0 + (2*variables[0]*variables[0]*variables[5]);
-            grad[207] = 0 + (2*variables[1]*variables[3]*variables[5] + 1*variables[2]*variables[4]*variables[4] + 2*variables[2]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[3] + 1*variables[1]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[4]);
-            grad[208] = 0 + (1*variables[1]*variables[2]*variables[3] + 1*variables[1]*variables[2]*variables[4] + 1*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[1]*variables[3] + 1*variables[0]*variables[2]*variables[4] + 1*variables[0]*variables[1]*variables[2] + 1*variables[0]*variables[3]*variables[4] + 1*variables[2]*variables[3]*variables[4]);
-            grad[209] = 0 + (3*variables[0]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]);
-            grad[210] = 0 + (3*variables[4]*variables[5]*variables[5] + 1*variables[3]*variables[3]*variables[3] + 3*variables[3]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[1] + 3*variables[1]*variables[5]*variables[5] + 1*variables[4]*variables[4]*variables[4] + 3*variables[2]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[2]);
-            grad[211] = 0 + (2*variables[1]*variables[1]*variables[5] + 2*variables[2]*variables[2]*variables[5] + 2*variables[4]*variables[4]*variables[5] + 2*variables[3]*variables[3]*variables[5]);
-            grad[212] = 0 + (1*variables[0]*variables[1]*variables[1] + 1*variables[0]*variables[2]*variables[2] + 2*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[4]*variables[4] + 2*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[3]*variables[3]);
-            grad[213] = 0 + (1*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[1] + 1*variables[0]*variables[0]*variables[2] + 1*variables[2]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[3] + 2*variables[0]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[4] + 1*variables[1]*variables[1]*variables[4] + 2*variables[0]*variables[3]*variables[5] + 2*variables[0]*variables[2]*variables[5] + 1*variables[1]*variables[4]*variables[4] + 2*variables[0]*variables[1]*variables[5]);
-            grad[214] = 0 + (4*variables[5]*variables[5]*variables[5]);
-            grad[215] = 0 + (1*variables[1]*variables[2]*variables[2] + 1*variables[3]*variables[4]*variables[4] + 1*variables[3]*variables[3]*variables[4] + 2*variables[1]*variables[2]*variables[5] + 2*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[2]);
-            grad[216] = 0 + (1*variables[1]*variables[2]*variables[2]*variables[2] + 1*variables[3]*variables[3]*variables[3]*variables[4] + 3*variables[1]*variables[2]*variables[5]*variables[5] + 3*variables[3]*variables[4]*variables[5]*variables[5] + 1*variables[3]*variables[4]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[2]);
-            grad[217] = 0 + (1*variables[0]*variables[3]*variables[4]*variables[4] + 1*variables[2]*variables[3]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[2]*variables[3] + 1*variables[0]*variables[1]*variables[2]*variables[2] + 2*variables[1]*variables[3]*variables[4]*variables[5] + 2*variables[2]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[3]*variables[3]*variables[4] + 2*variables[1]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[2] + 1*variables[0]*variables[1]*variables[3]*variables[3] + 1*variables[0]*variables[2]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[4]*variables[5] + 1*variables[0]*variables[2]*variables[2]*variables[4] + 1*variables[1]*variables[2]*variables[2]*variables[4] + 1*variables[0]*variables[1]*variables[1]*variables[3] + 1*variables[0]*variables[3]*variables[3]*variables[4]);
-            grad[218] = 0 + (2*variables[0]*variables[0]*variables[0]*variables[5] + 3*variables[0]*variables[0]*variables[5]*variables[5]);
-            grad[219] = 0 + (4*variables[3]*variables[5]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[2]*variables[2] + 4*variables[1]*variables[5]*variables[5]*variables[5] + 1*variables[1]*variables[1]*variables[1]*variables[1] + 1*variables[4]*variables[4]*variables[4]*variables[4] + 4*variables[4]*variables[5]*variables[5]*variables[5] + 1*variables[3]*variables[3]*variables[3]*variables[3] + 4*variables[2]*variables[5]*variables[5]*variables[5]);
-            grad[220] = 0 + (2*variables[1]*variables[1]*variables[2]*variables[5] + 1*variables[3]*variables[3]*variables[4]*variables[4] + 2*variables[1]*variables[2]*variables[2]*variables[5] + 2*variables[3]*variables[4]*variables[4]*variables[5] + 2*variables[3]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[1]*variables[2]*variables[2]);
-            grad[221] = 0 + (1*variables[1]*variables[1]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[3]*variables[5] + 2*variables[2]*variables[4]*variables[4]*variables[5] + 2*variables[2]*variables[2]*variables[4]*variables[5] + 2*variables[1]*variables[3]*variables[3]*variables[5]);
-            grad[222] = 0 + (1*variables[0]*variables[1]*variables[3]*variables[4] + 1*variables[1]*variables[2]*variables[3]*variables[4] + 1*variables[0]*variables[1]*variables[2]*variables[4] + 1*variables[0]*variables[1]*variables[2]*variables[3] + 1*variables[0]*variables[2]*variables[3]*variables[4]);
-            grad[223] = 0 + (1*variables[0]*variables[2]*variables[2]*variables[2] + 1*variables[0]*variables[3]*variables[3]*variables[3] + 1*variables[0]*variables[4]*variables[4]*variables[4] + 3*variables[1]*variables[4]*variables[5]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[1] + 3*variables[2]*variables[3]*variables[5]*variables[5]);
-            grad[224] = 0 + (2*variables[0]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[1] + 2*variables[0]*variables[2]*variables[2]*variables[5] + 2*variables[1]*variables[4]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[2]*variables[2] + 2*variables[0]*variables[3]*variables[3]*variables[5] + 1*variables[0]*variables[0]*variables[4]*variables[4] + 2*variables[1]*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[1]*variables[5] + 2*variables[2]*variables[2]*variables[3]*variables[5] + 2*variables[2]*variables[3]*variables[3]*variables[5]);
-            grad[225] = 0 + (1*variables[1]*variables[1]*variables[2]*variables[4] + 1*variables[1]*variables[3]*variables[4]*variables[4] + 1*variables[0]*variables[0]*variables[1]*variables[3] + 1*variables[2]*variables[3]*variables[3]*variables[4] + 2*variables[0]*variables[3]*variables[4]*variables[5] + 1*variables[1]*variables[2]*variables[2]*variables[3] + 2*variables[0]*variables[1]*variables[2]*variables[5] + 1*variables[0]*variables[0]*variables[2]*variables[4]);
-            grad[226] = 0 + (1*variables[2]*variables[3]*variables[3]*variables[3] + 1*variables[0]*variables[0]*variables[0]*variables[2] + 3*variables[0]*variables[1]*variables[5]*variables[5] + 3*variables[0]*variables[3]*variables[5]*variables[5] + 1*variables[0]*variables[0]*variables[0]*variables[3] + 1*variables[1]*variables[1]*variables[1]*variables[4] + 1*variables[1]*variables[4]*variables[4]*variables[4] + 3*variables[0]*variables[4]*variables[5]*variables[5] + 1*variables[2]*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[0]*variables[1] + 1*variables[0]*variables[0]*variables[0]*variables[4] + 3*variables[0]*variables[2]*variables[5]*variables[5]);
-            grad[227] = 0 + (1*variables[0]*variables[0]*variables[3]*variables[4] + 1*variables[2]*variables[2]*variables[3]*variables[4] + 1*variables[1]*variables[1]*variables[3]*variables[4] + 1*variables[0]*variables[0]*variables[1]*variables[2] + 1*variables[1]*variables[2]*variables[4]*variables[4] + 1*variables[1]*variables[2]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[3]*variables[5] + 2*variables[0]*variables[2]*variables[4]*variables[5]);
-            grad[228] = 0 + (1*variables[0]*variables[2]*variables[2]*variables[3] + 1*variables[0]*variables[0]*variables[2]*variables[3] + 1*variables[0]*variables[1]*variables[4]*variables[4] + 1*variables[0]*variables[2]*variables[3]*variables[3] + 2*variables[0]*variables[1]*variables[4]*variables[5] + 1*variables[0]*variables[0]*variables[1]*variables[4] + 2*variables[0]*variables[2]*variables[3]*variables[5] + 1*variables[0]*variables[1]*variables[1]*variables[4]);
-            grad[229] = 0 + (1*variables[0]*variables[0]*variables[0]*variables[0] + 4*variables[0]*variables[5]*variables[5]*variables[5]);
-            grad[230] = 0 + (2*variables[4]*variables[4]*variables[4]*variables[5] + 2*variables[3]*variables[3]*variables[3]*variables[5] + 3*variables[3]*variables[3]*variables[5]*variables[5] + 2*variables[2]*variables[2]*variables[2]*variables[5] + 2*variables[1]*variables[1]*variables[1]*variables[5] + 3*variables[2]*variables[2]*variables[5]*variables[5] + 3*variables[1]*variables[1]*variables[5]*variables[5] + 3*variables[4]*variables[4]*variables[5]*variables[5]);
-            grad[231] = 0 + (2*variables[0]*variables[0]*variables[4]*variables[5] + 2*variables[0]*variables[0]*variables[2]*variables[5] + 2*variables[0]*variables[0]*variables[3]*variables[5] + 2*variables[0]*variables[0]*variables[1]*variables[5] + 1*variables[1]*variables[1]*variables[4]*variables[4] + 1*variables[2]*variables[2]*variables[3]*variables[3]);
-            grad[232] = 0 + (5*variables[5]*variables[5]*variables[5]*variables[5]);
-            grad[233] = 0 + (1*variables[1]*variables[3]*variables[3]*variables[3] + 1*variables[2]*variables[2]*variables[2]*variables[4] + 3*variables[1]*variables[3]*variables[5]*variables[5] + 1*variables[2]*variables[4]*variables[4]*variables[4] + 1*variables[1]*variables[1]*variables[1]*variables[3] + 3*variables[2]*variables[4]*variables[5]*variables[5]);
+            const double x0 = variables[0];
+            const double x1 = variables[1];
+            const double x2 = variables[2];
+            const double x3 = variables[3];
+            const double x4 = variables[4];
+            const double x5 = variables[5];
+            const double p_0_0_0_0_0_2 = x5*x5;
+            const double p_0_0_0_0_1_1 = x4*x5;
+            const double p_0_0_0_0_2_0 = x4*x4;
+            const double p_0_0_0_1_0_1 = x3*x5;
+            const double p_0_0_0_1_1_0 = x3*x4;
+            const double p_0_0_0_2_0_0 = x3*x3;
+            const double p_0_0_1_0_0_1 = x2*x5;
+            const double p_0_0_1_0_1_0 = x2*x4;
+            const double p_0_0_1_1_0_0 = x2*x3;
+            const double p_0_0_2_0_0_0 = x2*x2;
+            const double p_0_1_0_0_0_1 = x1*x5;
+            const double p_0_1_0_0_1_0 = x1*x4;
+            const double p_0_1_0_1_0_0 = x1*x3;
+            const double p_0_1_1_0_0_0 = x1*x2;
+            const double p_0_2_0_0_0_0 = x1*x1;
+            const double p_1_0_0_0_0_1 = x0*x5;
+            const double p_1_0_0_0_1_0 = x0*x4;
+            const double p_1_0_0_1_0_0 = x0*x3;
+            const double p_1_0_1_0_0_0 = x0*x2;
+            const double p_1_1_0_0_0_0 = x0*x1;
+            const double p_2_0_0_0_0_0 = x0*x0;
+            const double p_0_0_0_0_0_3 = p_0_0_0_0_0_2*x5;
+            const double p_0_0_0_0_1_2 = p_0_0_0_0_1_1*x5;
+            const double p_0_0_0_0_2_1 = p_0_0_0_0_2_0*x5;
+            const double p_0_0_0_0_3_0 = p_0_0_0_0_2_0*x4;
+            const double p_0_0_0_1_0_2 = p_0_0_0_1_0_1*x5;
+            const double p_0_0_0_1_1_1 = p_0_0_0_1_1_0*x5;
+            const double p_0_0_0_1_2_0 = p_0_0_0_1_1_0*x4;
+            const double p_0_0_0_2_0_1 = p_0_0_0_2_0_0*x5;
+            const double p_0_0_0_2_1_0 = p_0_0_0_2_0_0*x4;
+            const double p_0_0_0_3_0_0 = p_0_0_0_2_0_0*x3;
+            const double p_0_0_1_0_0_2 = p_0_0_1_0_0_1*x5;
+            const double p_0_0_1_0_1_1 = p_0_0_1_0_1_0*x5;
+            const double p_0_0_1_0_2_0 = p_0_0_1_0_1_0*x4;
+            const double p_0_0_1_1_0_1 = p_0_0_1_1_0_0*x5;
+            const double p_0_0_1_1_1_0 = p_0_0_1_1_0_0*x4;
+            const double p_0_0_1_2_0_0 = p_0_0_1_1_0_0*x3;
+            const double p_0_0_2_0_0_1 = p_0_0_2_0_0_0*x5;
+            const double p_0_0_2_0_1_0 = p_0_0_2_0_0_0*x4;
+            const double p_0_0_2_1_0_0 = p_0_0_2_0_0_0*x3;
+            const double p_0_0_3_0_0_0 = p_0_0_2_0_0_0*x2;
+            const double p_0_1_0_0_0_2 = p_0_1_0_0_0_1*x5;
+            const double p_0_1_0_0_1_1 = p_0_1_0_0_1_0*x5;
+            const double p_0_1_0_0_2_0 = p_0_1_0_0_1_0*x4;
+            const double p_0_1_0_1_0_1 = p_0_1_0_1_0_0*x5;
+            const double p_0_1_0_1_1_0 = p_0_1_0_1_0_0*x4;
+            const double p_0_1_0_2_0_0 = p_0_1_0_1_0_0*x3;
+            const double p_0_1_1_0_0_1 = p_0_1_1_0_0_0*x5;
+            const double p_0_1_1_0_1_0 = p_0_1_1_0_0_0*x4;
+            const double p_0_1_1_1_0_0 = p_0_1_1_0_0_0*x3;
+            const double p_0_1_2_0_0_0 = p_0_1_1_0_0_0*x2;
+            const double p_0_2_0_0_0_1 = p_0_2_0_0_0_0*x5;
+            const double p_0_2_0_0_1_0 = p_0_2_0_0_0_0*x4;
+            const double p_0_2_0_1_0_0 = p_0_2_0_0_0_0*x3;
+            const double p_0_2_1_0_0_0 = p_0_2_0_0_0_0*x2;
+            const double p_0_3_0_0_0_0 = p_0_2_0_0_0_0*x1;
+            const double p_1_0_0_0_0_2 = p_1_0_0_0_0_1*x5;
+            const double p_1_0_0_0_1_1 = p_1_0_0_0_1_0*x5;
+            const double p_1_0_0_0_2_0 = p_1_0_0_0_1_0*x4;
+            const double p_1_0_0_1_0_1 = p_1_0_0_1_0_0*x5;
+            const double p_1_0_0_1_1_0 = p_1_0_0_1_0_0*x4;
+            const double p_1_0_0_2_0_0 = p_1_0_0_1_0_0*x3;
+            const double p_1_0_1_0_0_1 = p_1_0_1_0_0_0*x5;
+            const double p_1_0_1_0_1_0 = p_1_0_1_0_0_0*x4;
+            const double p_1_0_1_1_0_0 = p_1_0_1_0_0_0*x3;
+            const double p_1_0_2_0_0_0 = p_1_0_1_0_0_0*x2;
+            const double p_1_1_0_0_0_1 = p_1_1_0_0_0_0*x5;
+            const double p_1_1_0_0_1_0 = p_1_1_0_0_0_0*x4;
+            const double p_1_1_0_1_0_0 = p_1_1_0_0_0_0*x3;
+            const double p_1_1_1_0_0_0 = p_1_1_0_0_0_0*x2;
+            const double p_1_2_0_0_0_0 = p_1_1_0_0_0_0*x1;
+            const double p_2_0_0_0_0_1 = p_2_0_0_0_0_0*x5;
+            const double p_2_0_0_0_1_0 = p_2_0_0_0_0_0*x4;
+            const double p_2_0_0_1_0_0 = p_2_0_0_0_0_0*x3;
+            const double p_2_0_1_0_0_0 = p_2_0_0_0_0_0*x2;
+            const double p_2_1_0_0_0_0 = p_2_0_0_0_0_0*x1;
+            const double p_3_0_0_0_0_0 = p_2_0_0_0_0_0*x0;
+            const double p_0_0_0_0_0_4 = p_0_0_0_0_0_3*x5;
+            const double p_0_0_0_0_1_3 = p_0_0_0_0_1_2*x5;
+            const double p_0_0_0_0_2_2 = p_0_0_0_0_2_1*x5;
+            const double p_0_0_0_0_3_1 = p_0_0_0_0_3_0*x5;
+            const double p_0_0_0_0_4_0 = p_0_0_0_0_3_0*x4;
+            const double p_0_0_0_1_0_3 = p_0_0_0_1_0_2*x5;
+            const double p_0_0_0_1_1_2 = p_0_0_0_1_1_1*x5;
+            const double p_0_0_0_1_2_1 = p_0_0_0_1_2_0*x5;
+            const double p_0_0_0_1_3_0 = p_0_0_0_1_2_0*x4;
+            const double p_0_0_0_2_0_2 = p_0_0_0_2_0_1*x5;
+            const double p_0_0_0_2_1_1 = p_0_0_0_2_1_0*x5;
+            const double p_0_0_0_2_2_0 = p_0_0_0_2_1_0*x4;
+            const double p_0_0_0_3_0_1 = p_0_0_0_3_0_0*x5;
+            const double p_0_0_0_3_1_0 = p_0_0_0_3_0_0*x4;
+            const double p_0_0_0_4_0_0 = p_0_0_0_3_0_0*x3;
+            const double p_0_0_1_0_0_3 = p_0_0_1_0_0_2*x5;
+            const double p_0_0_1_0_1_2 = p_0_0_1_0_1_1*x5;
+            const double p_0_0_1_0_2_1 = p_0_0_1_0_2_0*x5;
+            const double p_0_0_1_0_3_0 = p_0_0_1_0_2_0*x4;
+            const double p_0_0_1_1_0_2 = p_0_0_1_1_0_1*x5;
+            const double p_0_0_1_1_1_1 = p_0_0_1_1_1_0*x5;
+            const double p_0_0_1_1_2_0 = p_0_0_1_1_1_0*x4;
+            const double p_0_0_1_2_0_1 = p_0_0_1_2_0_0*x5;
+            const double p_0_0_1_2_1_0 = p_0_0_1_2_0_0*x4;
+            const double p_0_0_1_3_0_0 = p_0_0_1_2_0_0*x3;
+            const double p_0_0_2_0_0_2 = p_0_0_2_0_0_1*x5;
+            const double p_0_0_2_0_1_1 = p_0_0_2_0_1_0*x5;
+            const double p_0_0_2_0_2_0 = p_0_0_2_0_1_0*x4;
+            const double p_0_0_2_1_0_1 = p_0_0_2_1_0_0*x5;
+            const double p_0_0_2_1_1_0 = p_0_0_2_1_0_0*x4;
+            const double p_0_0_2_2_0_0 = p_0_0_2_1_0_0*x3;
+            const double p_0_0_3_0_0_1 = p_0_0_3_0_0_0*x5;
+            const double p_0_0_3_0_1_0 = p_0_0_3_0_0_0*x4;
+            const double p_0_0_3_1_0_0 = p_0_0_3_0_0_0*x3;
+            const double p_0_0_4_0_0_0 = p_0_0_3_0_0_0*x2;
+            const double p_0_1_0_0_0_3 = p_0_1_0_0_0_2*x5;
+            const double p_0_1_0_0_1_2 = p_0_1_0_0_1_1*x5;
+            const double p_0_1_0_0_2_1 = p_0_1_0_0_2_0*x5;
+            const double p_0_1_0_0_3_0 = p_0_1_0_0_2_0*x4;
+            const double p_0_1_0_1_0_2 = p_0_1_0_1_0_1*x5;
+            const double p_0_1_0_1_1_1 = p_0_1_0_1_1_0*x5;
+            const double p_0_1_0_1_2_0 = p_0_1_0_1_1_0*x4;
+            const double p_0_1_0_2_0_1 = p_0_1_0_2_0_0*x5;
+            const double p_0_1_0_2_1_0 = p_0_1_0_2_0_0*x4;
+            const double p_0_1_0_3_0_0 = p_0_1_0_2_0_0*x3;
+            const double p_0_1_1_0_0_2 = p_0_1_1_0_0_1*x5;
+            const double p_0_1_1_0_1_1 = p_0_1_1_0_1_0*x5;
+            const double p_0_1_1_0_2_0 = p_0_1_1_0_1_0*x4;
+            const double p_0_1_1_1_0_1 = p_0_1_1_1_0_0*x5;
+            const double p_0_1_1_1_1_0 = p_0_1_1_1_0_0*x4;
+            const double p_0_1_1_2_0_0 = p_0_1_1_1_0_0*x3;
+            const double p_0_1_2_0_0_1 = p_0_1_2_0_0_0*x5;
+            const double p_0_1_2_0_1_0 = p_0_1_2_0_0_0*x4;
+            const double p_0_1_2_1_0_0 = p_0_1_2_0_0_0*x3;
+            const double p_0_1_3_0_0_0 = p_0_1_2_0_0_0*x2;
+            const double p_0_2_0_0_0_2 = p_0_2_0_0_0_1*x5;
+            const double p_0_2_0_0_1_1 = p_0_2_0_0_1_0*x5;
+            const double p_0_2_0_0_2_0 = p_0_2_0_0_1_0*x4;
+            const double p_0_2_0_1_0_1 = p_0_2_0_1_0_0*x5;
+            const double p_0_2_0_1_1_0 = p_0_2_0_1_0_0*x4;
+            const double p_0_2_0_2_0_0 = p_0_2_0_1_0_0*x3;
+            const double p_0_2_1_0_0_1 = p_0_2_1_0_0_0*x5;
+            const double p_0_2_1_0_1_0 = p_0_2_1_0_0_0*x4;
+            const double p_0_2_1_1_0_0 = p_0_2_1_0_0_0*x3;
+            const double p_0_2_2_0_0_0 = p_0_2_1_0_0_0*x2;
+            const double p_0_3_0_0_0_1 = p_0_3_0_0_0_0*x5;
+            const double p_0_3_0_0_1_0 = p_0_3_0_0_0_0*x4;
+            const double p_0_3_0_1_0_0 = p_0_3_0_0_0_0*x3;
+            const double p_0_3_1_0_0_0 = p_0_3_0_0_0_0*x2;
+            const double p_0_4_0_0_0_0 = p_0_3_0_0_0_0*x1;
+            const double p_1_0_0_0_0_3 = p_1_0_0_0_0_2*x5;
+            const double p_1_0_0_0_1_2 = p_1_0_0_0_1_1*x5;
+            const double p_1_0_0_0_2_1 = p_1_0_0_0_2_0*x5;
+            const double p_1_0_0_0_3_0 = p_1_0_0_0_2_0*x4;
+            const double p_1_0_0_1_0_2 = p_1_0_0_1_0_1*x5;
+            const double p_1_0_0_1_1_1 = p_1_0_0_1_1_0*x5;
+            const double p_1_0_0_1_2_0 = p_1_0_0_1_1_0*x4;
+            const double p_1_0_0_2_0_1 = p_1_0_0_2_0_0*x5;
+            const double p_1_0_0_2_1_0 = p_1_0_0_2_0_0*x4;
+            const double p_1_0_0_3_0_0 = p_1_0_0_2_0_0*x3;
+            const double p_1_0_1_0_0_2 = p_1_0_1_0_0_1*x5;
+            const double p_1_0_1_0_1_1 = p_1_0_1_0_1_0*x5;
+            const double p_1_0_1_0_2_0 = p_1_0_1_0_1_0*x4;
+            const double p_1_0_1_1_0_1 = p_1_0_1_1_0_0*x5;
+            const double p_1_0_1_1_1_0 = p_1_0_1_1_0_0*x4;
+            const double p_1_0_1_2_0_0 = p_1_0_1_1_0_0*x3;
+            const double p_1_0_2_0_0_1 = p_1_0_2_0_0_0*x5;
+            const double p_1_0_2_0_1_0 = p_1_0_2_0_0_0*x4;
+            const double p_1_0_2_1_0_0 = p_1_0_2_0_0_0*x3;
+            const double p_1_0_3_0_0_0 = p_1_0_2_0_0_0*x2;
+            const double p_1_1_0_0_0_2 = p_1_1_0_0_0_1*x5;
+            const double p_1_1_0_0_1_1 = p_1_1_0_0_1_0*x5;
+            const double p_1_1_0_0_2_0 = p_1_1_0_0_1_0*x4;
+            const double p_1_1_0_1_0_1 = p_1_1_0_1_0_0*x5;
+            const double p_1_1_0_1_1_0 = p_1_1_0_1_0_0*x4;
+            const double p_1_1_0_2_0_0 = p_1_1_0_1_0_0*x3;
+            const double p_1_1_1_0_0_1 = p_1_1_1_0_0_0*x5;
+            const double p_1_1_1_0_1_0 = p_1_1_1_0_0_0*x4;
+            const double p_1_1_1_1_0_0 = p_1_1_1_0_0_0*x3;
+            const double p_1_1_2_0_0_0 = p_1_1_1_0_0_0*x2;
+            const double p_1_2_0_0_0_1 = p_1_2_0_0_0_0*x5;
+            const double p_1_2_0_0_1_0 = p_1_2_0_0_0_0*x4;
+            const double p_1_2_0_1_0_0 = p_1_2_0_0_0_0*x3;
+            const double p_1_2_1_0_0_0 = p_1_2_0_0_0_0*x2;
+            const double p_1_3_0_0_0_0 = p_1_2_0_0_0_0*x1;
+            const double p_2_0_0_0_0_2 = p_2_0_0_0_0_1*x5;
+            const double p_2_0_0_0_1_1 = p_2_0_0_0_1_0*x5;
+            const double p_2_0_0_0_2_0 = p_2_0_0_0_1_0*x4;
+            const double p_2_0_0_1_0_1 = p_2_0_0_1_0_0*x5;
+            const double p_2_0_0_1_1_0 = p_2_0_0_1_0_0*x4;
+            const double p_2_0_0_2_0_0 = p_2_0_0_1_0_0*x3;
+            const double p_2_0_1_0_0_1 = p_2_0_1_0_0_0*x5;
+            const double p_2_0_1_0_1_0 = p_2_0_1_0_0_0*x4;
+            const double p_2_0_1_1_0_0 = p_2_0_1_0_0_0*x3;
+            const double p_2_0_2_0_0_0 = p_2_0_1_0_0_0*x2;
+            const double p_2_1_0_0_0_1 = p_2_1_0_0_0_0*x5;
+            const double p_2_1_0_0_1_0 = p_2_1_0_0_0_0*x4;
+            const double p_2_1_0_1_0_0 = p_2_1_0_0_0_0*x3;
+            const double p_2_1_1_0_0_0 = p_2_1_0_0_0_0*x2;
+            const double p_2_2_0_0_0_0 = p_2_1_0_0_0_0*x1;
+            const double p_3_0_0_0_0_1 = p_3_0_0_0_0_0*x5;
+            const double p_3_0_0_0_1_0 = p_3_0_0_0_0_0*x4;
+            const double p_3_0_0_1_0_0 = p_3_0_0_0_0_0*x3;
+            const double p_3_0_1_0_0_0 = p_3_0_0_0_0_0*x2;
+            const double p_3_1_0_0_0_0 = p_3_0_0_0_0_0*x1;
+            const double p_4_0_0_0_0_0 = p_3_0_0_0_0_0*x0;
+            grad[0] = 1;
+            grad[1] = x5;
+            grad[2] = x2 + x4 + x1 + x3;
+            grad[3] = 2*x0;
+            grad[4] = 2*p_1_0_0_0_0_1 + p_0_0_0_0_0_2;
+            grad[5] = 3*p_2_0_0_0_0_0;
+            grad[6] = p_0_0_0_1_1_0 + p_0_1_1_0_0_0;
+            grad[7] = 2*p_1_0_0_1_0_0 + 2*p_1_0_1_0_0_0 + p_0_2_0_0_0_0 + 2*p_1_1_0_0_0_0 + p_0_0_0_2_0_0 + p_0_0_2_0_0_0 + 2*p_1_0_0_0_1_0 + p_0_0_0_0_2_0;
+            grad[8] = p_0_1_0_1_0_0 + p_0_0_1_0_1_0;
+            grad[9] = p_0_0_1_1_0_0 + p_0_0_1_0_0_1 + p_0_0_0_0_1_1 + p_0_0_0_1_0_1 + p_0_1_0_0_1_0 + p_0_1_0_0_0_1;
+            grad[10] = p_0_1_0_0_1_1 + p_0_0_1_1_0_1;
+            grad[11] = 2*p_1_0_0_0_0_2;
+            grad[12] = p_0_1_2_0_0_0 + 2*p_1_0_0_1_1_0 + p_0_0_0_2_1_0 + 2*p_1_1_1_0_0_0 + p_0_0_0_1_2_0 + p_0_2_1_0_0_0;
+            grad[13] = p_0_1_0_1_0_1 + p_0_1_1_1_0_0 + p_0_0_1_1_1_0 + p_0_0_1_0_1_1 + p_0_1_1_0_0_1 + p_0_0_0_1_1_1 + p_0_1_0_1_1_0 + p_0_1_1_0_1_0;
+            grad[14] = p_0_0_0_0_0_3 + 3*p_2_0_0_0_0_1;
+            grad[15] = p_0_3_0_0_0_0 + 3*p_2_0_0_1_0_0 + p_0_0_0_3_0_0 + 3*p_2_0_1_0_0_0 + p_0_0_0_0_3_0 + 3*p_2_0_0_0_1_0 + p_0_0_3_0_0_0 + 3*p_2_1_0_0_0_0;
+            grad[16] = 2*p_1_0_2_0_0_0 + 2*p_1_0_0_0_2_0 + 2*p_1_2_0_0_0_0 + 2*p_1_0_0_2_0_0;
+            grad[17] = p_0_2_0_0_0_1 + p_0_0_2_0_0_1 + p_0_0_0_0_2_1 + 2*p_1_1_0_0_1_0 + p_0_0_0_2_0_1 + 2*p_1_0_1_1_0_0;
+            grad[18] = p_0_0_1_2_0_0 + 2*p_1_1_0_0_0_1 + 2*p_1_0_1_0_0_1 + 2*p_1_0_0_1_0_1 + p_0_0_0_0_1_2 + 2*p_1_0_0_0_1_1 + p_0_0_0_1_0_2 + p_0_2_0_0_1_0 + p_0_0_1_0_0_2 + p_0_0_2_1_0_0 + p_0_1_0_0_2_0 + p_0_1_0_0_0_2;
+            grad[19] = 4*p_3_0_0_0_0_0;
+            grad[20] = 2*p_1_0_1_0_1_0 + p_0_0_1_0_2_0 + p_0_2_0_1_0_0 + p_0_0_2_0_1_0 + p_0_1_0_2_0_0 + 2*p_1_1_0_1_0_0;
+            grad[21] = p_0_0_1_0_3_0 + 3*p_2_1_0_1_0_0 + 3*p_2_0_1_0_1_0 + p_0_0_3_0_1_0 + p_0_1_0_3_0_0 + p_0_3_0_1_0_0;
+            grad[22] = p_0_0_0_1_2_1 + p_0_1_2_0_0_1 + 2*p_1_1_1_1_0_0 + p_0_2_1_1_0_0 + p_0_2_1_0_0_1 + p_0_1_0_2_0_1 + 2*p_1_1_0_1_1_0 + 2*p_1_1_1_0_1_0 + p_0_0_1_0_2_1 + p_0_0_2_0_1_1 + p_0_1_2_0_1_0 + p_0_0_1_1_2_0 + p_0_1_0_2_1_0 + 2*p_1_0_1_1_1_0 + p_0_2_0_1_0_1 + p_0_0_0_2_1_1;
+            grad[23] = 3*p_2_0_0_0_0_2 + 2*p_1_0_0_0_0_3;
+            grad[24] = p_0_0_0_4_0_0 + p_0_0_4_0_0_0 + 4*p_3_0_1_0_0_0 + p_0_4_0_0_0_0 + 4*p_3_0_0_0_1_0 + 4*p_3_1_0_0_0_0 + 4*p_3_0_0_1_0_0 + p_0_0_0_0_4_0;
+            grad[25] = 2*p_1_0_2_0_1_0 + 2*p_1_2_0_1_0_0 + p_0_2_0_2_0_0 + 2*p_1_0_1_0_2_0 + 2*p_1_1_0_2_0_0 + p_0_0_2_0_2_0;
+            grad[26] = 2*p_1_0_0_1_2_0 + p_0_0_0_2_2_0 + 2*p_1_2_1_0_0_0 + p_0_2_2_0_0_0 + 2*p_1_0_0_2_1_0 + 2*p_1_1_2_0_0_0;
+            grad[27] = p_0_1_0_1_1_1 + p_0_1_1_0_1_1 + p_0_1_1_1_1_0 + p_0_1_1_1_0_1 + p_0_0_1_1_1_1;
+            grad[28] = p_0_0_3_0_0_1 + p_0_0_0_3_0_1 + p_0_0_0_0_3_1 + 3*p_2_1_0_0_1_0 + p_0_3_0_0_0_1 + 3*p_2_0_1_1_0_0;
+            grad[29] = p_0_0_0_0_2_2 + 2*p_1_0_2_1_0_0 + 2*p_1_2_0_0_0_1 + p_0_0_2_0_0_2 + 2*p_1_2_0_0_1_0 + 2*p_1_0_2_0_0_1 + p_0_0_0_2_0_2 + 2*p_1_0_0_0_2_1 + 2*p_1_1_0_0_2_0 + 2*p_1_0_0_2_0_1 + p_0_2_0_0_0_2 + 2*p_1_0_1_2_0_0;
+            grad[30] = p_0_0_2_1_1_0 + 2*p_1_1_0_1_0_1 + p_0_1_1_0_2_0 + p_0_0_0_1_1_2 + p_0_2_0_1_1_0 + p_0_1_1_2_0_0 + p_0_1_1_0_0_2 + 2*p_1_0_1_0_1_1;
+            grad[31] = 3*p_2_0_1_0_0_1 + p_0_1_0_0_3_0 + p_0_1_0_0_0_3 + p_0_0_0_1_0_3 + p_0_3_0_0_1_0 + 3*p_2_0_0_1_0_1 + p_0_0_0_0_1_3 + p_0_0_3_1_0_0 + 3*p_2_1_0_0_0_1 + 3*p_2_0_0_0_1_1 + p_0_0_1_3_0_0 + p_0_0_1_0_0_3;
+            grad[32] = 2*p_1_0_0_1_1_1 + p_0_1_2_1_0_0 + 2*p_1_1_1_0_0_1 + p_0_1_0_1_2_0 + p_0_0_1_2_1_0 + p_0_2_1_0_1_0 + p_0_1_0_1_0_2 + p_0_0_1_0_1_2;
+            grad[33] = p_0_0_2_1_0_1 + 2*p_1_0_1_1_0_1 + p_0_1_0_0_2_1 + p_0_0_1_2_0_1 + p_0_1_0_0_1_2 + 2*p_1_1_0_0_1_1 + p_0_0_1_1_0_2 + p_0_2_0_0_1_1;
+            grad[34] = 4*p_3_0_0_0_0_1 + p_0_0_0_0_0_4;
+            grad[35] = 3*p_2_0_0_2_0_0 + 3*p_2_0_2_0_0_0 + 2*p_1_3_0_0_0_0 + 3*p_2_2_0_0_0_0 + 2*p_1_0_0_0_3_0 + 2*p_1_0_3_0_0_0 + 3*p_2_0_0_0_2_0 + 2*p_1_0_0_3_0_0;
+            grad[36] = p_0_2_0_0_2_0 + 2*p_1_0_0_0_1_2 + 2*p_1_0_1_0_0_2 + 2*p_1_0_0_1_0_2 + p_0_0_2_2_0_0 + 2*p_1_1_0_0_0_2;
+            grad[37] = 5*p_4_0_0_0_0_0;
+            grad[38] = p_0_0_0_3_1_0 + p_0_3_1_0_0_0 + p_0_1_3_0_0_0 + 3*p_2_0_0_1_1_0 + 3*p_2_1_1_0_0_0 + p_0_0_0_1_3_0;
+            grad[39] = 1;
+            grad[40] = x4;
+            grad[41] = x3 + x5 + x2 + x0;
+            grad[42] = 2*x1;
+            grad[43] = p_0_0_0_0_2_0 + 2*p_0_1_0_0_1_0;
+            grad[44] = 3*p_0_2_0_0_0_0;
+            grad[45] = p_0_0_0_1_0_1 + p_1_0_1_0_0_0;
+            grad[46] = p_0_0_0_2_0_0 + 2*p_1_1_0_0_0_0 + p_2_0_0_0_0_0 + p_0_0_2_0_0_0 + p_0_0_0_0_0_2 + 2*p_0_1_0_0_0_1 + 2*p_0_1_1_0_0_0 + 2*p_0_1_0_1_0_0;
+            grad[47] = p_1_0_0_1_0_0 + p_0_0_1_0_0_1;
+            grad[48] = p_0_0_1_0_1_0 + p_0_0_0_0_1_1 + p_0_0_1_1_0_0 + p_0_0_0_1_1_0 + p_1_0_0_0_1_0 + p_1_0_0_0_0_1;
+            grad[49] = p_1_0_0_0_1_1 + p_0_0_1_1_1_0;
+            grad[50] = 2*p_0_1_0_0_2_0;
+            grad[51] = p_0_0_0_1_0_2 + p_1_0_2_0_0_0 + p_2_0_1_0_0_0 + 2*p_0_1_0_1_0_1 + p_0_0_0_2_0_1 + 2*p_1_1_1_0_0_0;
+            grad[52] = p_0_0_1_1_0_1 + p_0_0_1_0_1_1 + p_0_0_0_1_1_1 + p_1_0_0_1_0_1 + p_1_0_1_1_0_0 + p_1_0_1_0_0_1 + p_1_0_0_1_1_0 + p_1_0_1_0_1_0;
+            grad[53] = 3*p_0_2_0_0_1_0 + p_0_0_0_0_3_0;
+            grad[54] = 3*p_1_2_0_0_0_0 + 3*p_0_2_0_1_0_0 + p_0_0_0_3_0_0 + p_0_0_3_0_0_0 + 3*p_0_2_0_0_0_1 + p_0_0_0_0_0_3 + 3*p_0_2_1_0_0_0 + p_3_0_0_0_0_0;
+            grad[55] = 2*p_0_1_0_2_0_0 + 2*p_0_1_0_0_0_2 + 2*p_0_1_2_0_0_0 + 2*p_2_1_0_0_0_0;
+            grad[56] = 2*p_1_1_0_0_0_1 + p_0_0_0_2_1_0 + 2*p_0_1_1_1_0_0 + p_0_0_0_0_1_2 + p_2_0_0_0_1_0 + p_0_0_2_0_1_0;
+            grad[57] = p_0_0_2_1_0_0 + p_2_0_0_0_0_1 + p_0_0_1_2_0_0 + p_0_0_0_1_2_0 + 2*p_0_1_0_0_1_1 + 2*p_1_1_0_0_1_0 + p_0_0_1_0_2_0 + 2*p_0_1_0_1_1_0 + p_1_0_0_0_2_0 + 2*p_0_1_1_0_1_0 + p_0_0_0_0_2_1 + p_1_0_0_0_0_2;
+            grad[58] = 4*p_0_3_0_0_0_0;
+            grad[59] = p_0_0_2_0_0_1 + 2*p_1_1_0_1_0_0 + p_0_0_1_0_0_2 + 2*p_0_1_1_0_0_1 + p_1_0_0_2_0_0 + p_2_0_0_1_0_0;
+            grad[60] = p_3_0_0_1_0_0 + p_0_0_3_0_0_1 + p_0_0_1_0_0_3 + 3*p_0_2_1_0_0_1 + p_1_0_0_3_0_0 + 3*p_1_2_0_1_0_0;
+            grad[61] = 2*p_0_1_1_1_0_1 + p_1_0_2_0_0_1 + p_0_0_0_1_1_2 + p_2_0_1_1_0_0 + p_0_0_0_2_1_1 + p_0_0_1_1_0_2 + 2*p_1_1_1_1_0_0 + 2*p_1_1_1_0_0_1 + p_1_0_0_2_0_1 + p_2_0_0_1_1_0 + p_2_0_1_0_1_0 + p_0_0_1_0_1_2 + p_1_0_2_0_1_0 + p_0_0_2_0_1_1 + p_1_0_0_2_1_0 + 2*p_1_1_0_1_0_1;
+            grad[62] = 2*p_0_1_0_0_3_0 + 3*p_0_2_0_0_2_0;
+            grad[63] = p_0_0_0_0_0_4 + p_0_0_4_0_0_0 + 4*p_0_3_0_0_0_1 + p_0_0_0_4_0_0 + 4*p_1_3_0_0_0_0 + p_4_0_0_0_0_0 + 4*p_0_3_1_0_0_0 + 4*p_0_3_0_1_0_0;
+            grad[64] = 2*p_0_1_1_0_0_2 + 2*p_2_1_0_1_0_0 + p_0_0_2_0_0_2 + 2*p_0_1_2_0_0_1 + 2*p_1_1_0_2_0_0 + p_2_0_0_2_0_0;
+            grad[65] = 2*p_0_1_0_2_0_1 + 2*p_2_1_1_0_0_0 + 2*p_1_1_2_0_0_0 + 2*p_0_1_0_1_0_2 + p_2_0_2_0_0_0 + p_0_0_0_2_0_2;
+            grad[66] = p_1_0_0_1_1_1 + p_0_0_1_1_1_1 + p_1_0_1_0_1_1 + p_1_0_1_1_1_0 + p_1_0_1_1_0_1;
+            grad[67] = p_0_0_0_3_1_0 + p_3_0_0_0_1_0 + p_0_0_0_0_1_3 + 3*p_0_2_1_1_0_0 + 3*p_1_2_0_0_0_1 + p_0_0_3_0_1_0;
+            grad[68] = 2*p_0_1_0_2_1_0 + p_0_0_0_2_2_0 + 2*p_2_1_0_0_0_1 + 2*p_2_1_0_0_1_0 + p_0_0_0_0_2_2 + 2*p_0_1_1_2_0_0 + p_0_0_2_0_2_0 + 2*p_0_1_2_1_0_0 + 2*p_0_1_0_0_1_2 + p_2_0_0_0_2_0 + 2*p_1_1_0_0_0_2 + 2*p_0_1_2_0_1_0;
+            grad[69] = 2*p_0_1_1_0_1_1 + p_0_0_0_1_2_1 + p_2_0_0_1_0_1 + p_1_0_1_0_2_0 + 2*p_1_1_0_1_1_0 + p_1_0_1_2_0_0 + p_0_0_2_1_0_1 + p_1_0_1_0_0_2;
+            grad[70] = p_0_0_1_0_3_0 + p_1_0_0_0_3_0 + p_1_0_0_0_0_3 + 3*p_0_2_1_0_1_0 + 3*p_1_2_0_0_1_0 + p_0_0_1_3_0_0 + 3*p_0_2_0_0_1_1 + p_0_0_0_0_3_1 + p_0_0_0_1_3_0 + 3*p_0_2_0_1_1_0 + p_0_0_3_1_0_0 + p_3_0_0_0_0_1;
+            grad[71] = p_1_0_2_1_0_0 + 2*p_0_1_0_1_1_1 + p_2_0_1_0_0_1 + p_1_0_0_1_2_0 + 2*p_1_1_1_0_1_0 + p_0_0_1_0_2_1 + p_0_0_1_2_0_1 + p_1_0_0_1_0_2;
+            grad[72] = p_0_0_2_1_1_0 + p_0_0_1_2_1_0 + p_1_0_0_0_2_1 + 2*p_0_1_1_1_1_0 + p_1_0_0_0_1_2 + p_2_0_0_0_1_1 + p_0_0_1_1_2_0 + 2*p_1_1_0_0_1_1;
+            grad[73] = 4*p_0_3_0_0_1_0 + p_0_0_0_0_4_0;
+            grad[74] = 3*p_0_2_0_2_0_0 + 2*p_0_1_3_0_0_0 + 3*p_0_2_0_0_0_2 + 3*p_2_2_0_0_0_0 + 2*p_0_1_0_0_0_3 + 3*p_0_2_2_0_0_0 + 2*p_3_1_0_0_0_0 + 2*p_0_1_0_3_0_0;
+            grad[75] = 2*p_1_1_0_0_2_0 + 2*p_0_1_0_1_2_0 + p_0_0_2_2_0_0 + 2*p_0_1_1_0_2_0 + p_2_0_0_0_0_2 + 2*p_0_1_0_0_2_1;
+            grad[76] = 5*p_0_4_0_0_0_0;
+            grad[77] = p_0_0_0_3_0_1 + 3*p_1_2_1_0_0_0 + p_0_0_0_1_0_3 + p_1_0_3_0_0_0 + 3*p_0_2_0_1_0_1 + p_3_0_1_0_0_0;
+            grad[78] = 1;
+            grad[79] = x3;
+            grad[80] = x4 + x0 + x5 + x1;
+            grad[81] = 2*x2;
+            grad[82] = 2*p_0_0_1_1_0_0 + p_0_0_0_2_0_0;
+            grad[83] = 3*p_0_0_2_0_0_0;
+            grad[84] = p_0_0_0_0_1_1 + p_1_1_0_0_0_0;
+            grad[85] = p_2_0_0_0_0_0 + 2*p_0_0_1_0_0_1 + 2*p_0_1_1_0_0_0 + p_0_0_0_0_2_0 + 2*p_1_0_1_0_0_0 + 2*p_0_0_1_0_1_0 + p_0_0_0_0_0_2 + p_0_2_0_0_0_0;
+            grad[86] = p_1_0_0_0_1_0 + p_0_1_0_0_0_1;
+            grad[87] = p_0_1_0_0_1_0 + p_0_0_0_1_1_0 + p_0_0_0_1_0_1 + p_1_0_0_1_0_0 + p_1_0_0_0_0_1 + p_0_1_0_1_0_0;
+            grad[88] = p_1_0_0_1_0_1 + p_0_1_0_1_1_0;
+            grad[89] = 2*p_0_0_1_2_0_0;
+            grad[90] = 2*p_1_1_1_0_0_0 + p_0_0_0_0_2_1 + p_2_1_0_0_0_0 + p_0_0_0_0_1_2 + 2*p_0_0_1_0_1_1 + p_1_2_0_0_0_0;
+            grad[91] = p_0_1_0_1_0_1 + p_0_1_0_0_1_1 + p_1_1_0_1_0_0 + p_1_0_0_1_1_0 + p_1_0_0_0_1_1 + p_1_1_0_0_0_1 + p_0_0_0_1_1_1 + p_1_1_0_0_1_0;
+            grad[92] = p_0_0_0_3_0_0 + 3*p_0_0_2_1_0_0;
+            grad[93] = p_0_0_0_0_3_0 + 3*p_0_1_2_0_0_0 + 3*p_0_0_2_0_1_0 + p_0_3_0_0_0_0 + p_3_0_0_0_0_0 + p_0_0_0_0_0_3 + 3*p_1_0_2_0_0_0 + 3*p_0_0_2_0_0_1;
+            grad[94] = 2*p_0_0_1_0_0_2 + 2*p_2_0_1_0_0_0 + 2*p_0_2_1_0_0_0 + 2*p_0_0_1_0_2_0;
+            grad[95] = 2*p_1_0_1_0_0_1 + p_0_0_0_1_0_2 + p_0_2_0_1_0_0 + p_0_0_0_1_2_0 + 2*p_0_1_1_0_1_0 + p_2_0_0_1_0_0;
+            grad[96] = 2*p_0_1_1_1_0_0 + 2*p_0_0_1_1_0_1 + p_1_0_0_2_0_0 + p_2_0_0_0_0_1 + p_0_0_0_2_0_1 + p_0_0_0_2_1_0 + p_0_1_0_2_0_0 + 2*p_0_0_1_1_1_0 + p_1_0_0_0_0_2 + 2*p_1_0_1_1_0_0 + p_0_1_0_0_2_0 + p_0_2_0_0_1_0;
+            grad[97] = 4*p_0_0_3_0_0_0;
+            grad[98] = p_2_0_0_0_1_0 + p_1_0_0_0_2_0 + 2*p_0_1_1_0_0_1 + p_0_1_0_0_0_2 + 2*p_1_0_1_0_1_0 + p_0_2_0_0_0_1;
+            grad[99] = p_1_0_0_0_3_0 + 3*p_0_1_2_0_0_1 + p_0_1_0_0_0_3 + p_3_0_0_0_1_0 + 3*p_1_0_2_0_1_0 + p_0_3_0_0_0_1;
+            grad[100] = p_0_0_0_1_2_1 + p_0_2_0_1_0_1 + 2*p_1_1_1_0_0_1 + p_2_1_0_1_0_0 + p_0_0_0_1_1_2 + p_0_1_0_1_0_2 + p_1_2_0_1_0_0 + p_1_2_0_0_0_1 + p_2_1_0_0_1_0 + p_1_0_0_0_2_1 + p_0_1_0_0_1_2 + 2*p_1_0_1_0_1_1 + 2*p_1_1_1_0_1_0 + p_1_0_0_1_2_0 + 2*p_0_1_1_0_1_1 + p_2_0_0_1_1_0;
+            grad[101] = 2*p_0_0_1_3_0_0 + 3*p_0_0_2_2_0_0;
+            grad[102] = 4*p_0_0_3_0_0_1 + 4*p_0_1_3_0_0_0 + 4*p_0_0_3_0_1_0 + 4*p_1_0_3_0_0_0 + p_4_0_0_0_0_0 + p_0_4_0_0_0_0 + p_0_0_0_0_4_0 + p_0_0_0_0_0_4;
+            grad[103] = p_0_2_0_0_0_2 + 2*p_2_0_1_0_1_0 + 2*p_0_1_1_0_0_2 + 2*p_0_2_1_0_0_1 + p_2_0_0_0_2_0 + 2*p_1_0_1_0_2_0;
+            grad[104] = 2*p_0_0_1_0_2_1 + p_2_2_0_0_0_0 + 2*p_1_2_1_0_0_0 + p_0_0_0_0_2_2 + 2*p_0_0_1_0_1_2 + 2*p_2_1_1_0_0_0;
+            grad[105] = p_0_1_0_1_1_1 + p_1_1_0_0_1_1 + p_1_1_0_1_1_0 + p_1_1_0_1_0_1 + p_1_0_0_1_1_1;
+            grad[106] = 3*p_1_0_2_0_0_1 + p_0_3_0_1_0_0 + p_0_0_0_1_3_0 + p_3_0_0_1_0_0 + p_0_0_0_1_0_3 + 3*p_0_1_2_0_1_0;
+            grad[107] = 2*p_2_0_1_1_0_0 + 2*p_1_0_1_0_0_2 + 2*p_2_0_1_0_0_1 + p_0_2_0_2_0_0 + 2*p_0_1_1_0_2_0 + 2*p_0_2_1_1_0_0 + 2*p_0_0_1_1_2_0 + p_2_0_0_2_0_0 + p_0_0_0_2_2_0 + 2*p_0_2_1_0_1_0 + 2*p_0_0_1_1_0_2 + p_0_0_0_2_0_2;
+            grad[108] = p_0_2_0_0_1_1 + 2*p_1_0_1_1_1_0 + p_0_0_0_2_1_1 + p_1_1_0_0_2_0 + p_1_1_0_2_0_0 + 2*p_0_1_1_1_0_1 + p_1_1_0_0_0_2 + p_2_0_0_0_1_1;
+            grad[109] = p_0_0_0_3_0_1 + p_0_1_0_0_3_0 + p_3_0_0_0_0_1 + 3*p_0_0_2_1_1_0 + p_0_3_0_0_1_0 + p_0_1_0_3_0_0 + 3*p_1_0_2_1_0_0 + 3*p_0_0_2_1_0_1 + 3*p_0_1_2_1_0_0 + p_0_0_0_3_1_0 + p_1_0_0_3_0_0 + p_1_0_0_0_0_3;
+            grad[110] = 2*p_1_1_1_1_0_0 + 2*p_0_0_1_1_1_1 + p_2_1_0_0_0_1 + p_1_0_0_2_1_0 + p_1_2_0_0_1_0 + p_0_1_0_0_2_1 + p_0_1_0_2_0_1 + p_1_0_0_0_1_2;
+            grad[111] = 2*p_0_1_1_1_1_0 + 2*p_1_0_1_1_0_1 + p_2_0_0_1_0_1 + p_0_1_0_2_1_0 + p_0_2_0_1_1_0 + p_1_0_0_2_0_1 + p_1_0_0_1_0_2 + p_0_1_0_1_2_0;
+            grad[112] = 4*p_0_0_3_1_0_0 + p_0_0_0_4_0_0;
+            grad[113] = 2*p_3_0_1_0_0_0 + 3*p_0_2_2_0_0_0 + 3*p_0_0_2_0_0_2 + 2*p_0_0_1_0_3_0 + 2*p_0_0_1_0_0_3 + 3*p_0_0_2_0_2_0 + 2*p_0_3_1_0_0_0 + 3*p_2_0_2_0_0_0;
+            grad[114] = 2*p_0_1_1_2_0_0 + p_2_0_0_0_0_2 + p_0_2_0_0_2_0 + 2*p_1_0_1_2_0_0 + 2*p_0_0_1_2_1_0 + 2*p_0_0_1_2_0_1;
+            grad[115] = 5*p_0_0_4_0_0_0;
+            grad[116] = p_1_3_0_0_0_0 + 3*p_0_0_2_0_1_1 + p_0_0_0_0_3_1 + 3*p_1_1_2_0_0_0 + p_0_0_0_0_1_3 + p_3_1_0_0_0_0;
+            grad[117] = 1;
+            grad[118] = x2;
+            grad[119] = x1 + x5 + x4 + x0;
+            grad[120] = 2*x3;
+            grad[121] = p_0_0_2_0_0_0 + 2*p_0_0_1_1_0_0;
+            grad[122] = 3*p_0_0_0_2_0_0;
+            grad[123] = p_1_0_0_0_1_0 + p_0_1_0_0_0_1;
+            grad[124] = p_2_0_0_0_0_0 + 2*p_0_1_0_1_0_0 + 2*p_1_0_0_1_0_0 + 2*p_0_0_0_1_1_0 + p_0_0_0_0_2_0 + 2*p_0_0_0_1_0_1 + p_0_0_0_0_0_2 + p_0_2_0_0_0_0;
+            grad[125] = p_1_1_0_0_0_0 + p_0_0_0_0_1_1;
+            grad[126] = p_0_0_1_0_1_0 + p_0_0_1_0_0_1 + p_1_0_1_0_0_0 + p_0_1_1_0_0_0 + p_0_1_0_0_1_0 + p_1_0_0_0_0_1;
+            grad[127] = p_1_0_1_0_0_1 + p_0_1_1_0_1_0;
+            grad[128] = 2*p_0_0_2_1_0_0;
+            grad[129] = p_0_1_0_0_0_2 + p_2_0_0_0_1_0 + 2*p_1_0_0_1_1_0 + p_1_0_0_0_2_0 + p_0_2_0_0_0_1 + 2*p_0_1_0_1_0_1;
+            grad[130] = p_0_1_1_0_0_1 + p_0_1_0_0_1_1 + p_1_1_0_0_0_1 + p_1_1_1_0_0_0 + p_1_0_1_0_1_0 + p_1_0_0_0_1_1 + p_1_1_0_0_1_0 + p_0_0_1_0_1_1;
+            grad[131] = 3*p_0_0_1_2_0_0 + p_0_0_3_0_0_0;
+            grad[132] = p_3_0_0_0_0_0 + 3*p_0_0_0_2_1_0 + 3*p_0_0_0_2_0_1 + p_0_3_0_0_0_0 + 3*p_0_1_0_2_0_0 + p_0_0_0_0_0_3 + 3*p_1_0_0_2_0_0 + p_0_0_0_0_3_0;
+            grad[133] = 2*p_0_2_0_1_0_0 + 2*p_0_0_0_1_2_0 + 2*p_2_0_0_1_0_0 + 2*p_0_0_0_1_0_2;
+            grad[134] = p_0_0_1_0_0_2 + 2*p_0_1_0_1_1_0 + p_0_2_1_0_0_0 + p_0_0_1_0_2_0 + 2*p_1_0_0_1_0_1 + p_2_0_1_0_0_0;
+            grad[135] = p_0_1_2_0_0_0 + p_0_0_2_0_0_1 + 2*p_1_0_1_1_0_0 + 2*p_0_0_1_1_0_1 + p_2_0_0_0_0_1 + 2*p_0_0_1_1_1_0 + 2*p_0_1_1_1_0_0 + p_0_0_2_0_1_0 + p_0_1_0_0_2_0 + p_1_0_0_0_0_2 + p_1_0_2_0_0_0 + p_0_2_0_0_1_0;
+            grad[136] = 4*p_0_0_0_3_0_0;
+            grad[137] = p_0_0_0_0_2_1 + p_1_2_0_0_0_0 + 2*p_0_0_0_1_1_1 + p_0_0_0_0_1_2 + 2*p_1_1_0_1_0_0 + p_2_1_0_0_0_0;
+            grad[138] = p_3_1_0_0_0_0 + 3*p_0_0_0_2_1_1 + p_0_0_0_0_1_3 + p_0_0_0_0_3_1 + 3*p_1_1_0_2_0_0 + p_1_3_0_0_0_0;
+            grad[139] = p_1_0_0_0_2_1 + p_0_0_1_0_2_1 + p_0_2_1_0_0_1 + p_0_1_0_0_1_2 + p_2_1_1_0_0_0 + p_0_0_1_0_1_2 + 2*p_0_1_0_1_1_1 + p_0_1_1_0_0_2 + p_1_2_1_0_0_0 + 2*p_1_1_0_1_0_1 + p_2_1_0_0_1_0 + p_1_0_1_0_2_0 + 2*p_1_1_0_1_1_0 + p_2_0_1_0_1_0 + p_1_2_0_0_0_1 + 2*p_1_0_0_1_1_1;
+            grad[140] = 3*p_0_0_2_2_0_0 + 2*p_0_0_3_1_0_0;
+            grad[141] = p_0_0_0_0_0_4 + 4*p_1_0_0_3_0_0 + 4*p_0_1_0_3_0_0 + 4*p_0_0_0_3_0_1 + p_4_0_0_0_0_0 + p_0_0_0_0_4_0 + 4*p_0_0_0_3_1_0 + p_0_4_0_0_0_0;
+            grad[142] = 2*p_0_0_0_1_2_1 + p_2_2_0_0_0_0 + p_0_0_0_0_2_2 + 2*p_0_0_0_1_1_2 + 2*p_1_2_0_1_0_0 + 2*p_2_1_0_1_0_0;
+            grad[143] = 2*p_0_2_0_1_0_1 + p_2_0_0_0_2_0 + 2*p_1_0_0_1_2_0 + p_0_2_0_0_0_2 + 2*p_2_0_0_1_1_0 + 2*p_0_1_0_1_0_2;
+            grad[144] = p_1_1_0_0_1_1 + p_0_1_1_0_1_1 + p_1_1_1_0_1_0 + p_1_1_1_0_0_1 + p_1_0_1_0_1_1;
+            grad[145] = 3*p_1_0_0_2_0_1 + 3*p_0_1_0_2_1_0 + p_0_3_1_0_0_0 + p_0_0_1_0_3_0 + p_3_0_1_0_0_0 + p_0_0_1_0_0_3;
+            grad[146] = 2*p_0_2_0_1_1_0 + p_2_0_2_0_0_0 + 2*p_0_1_0_1_2_0 + 2*p_0_2_1_1_0_0 + p_0_2_2_0_0_0 + 2*p_1_0_0_1_0_2 + p_0_0_2_0_2_0 + 2*p_2_0_0_1_0_1 + 2*p_2_0_1_1_0_0 + 2*p_0_0_1_1_2_0 + p_0_0_2_0_0_2 + 2*p_0_0_1_1_0_2;
+            grad[147] = p_0_1_0_0_2_1 + p_1_0_2_0_1_0 + p_2_1_0_0_0_1 + 2*p_0_0_1_1_1_1 + p_1_0_0_0_1_2 + p_1_2_0_0_1_0 + 2*p_1_1_1_1_0_0 + p_0_1_2_0_0_1;
+            grad[148] = 3*p_0_0_1_2_0_1 + p_0_0_3_0_1_0 + p_1_0_0_0_0_3 + p_3_0_0_0_0_1 + 3*p_0_1_1_2_0_0 + p_0_1_0_0_3_0 + p_1_0_3_0_0_0 + p_0_3_0_0_1_0 + p_0_0_3_0_0_1 + p_0_1_3_0_0_0 + 3*p_0_0_1_2_1_0 + 3*p_1_0_1_2_0_0;
+            grad[149] = p_2_0_0_0_1_1 + p_1_1_2_0_0_0 + p_0_0_2_0_1_1 + p_0_2_0_0_1_1 + p_1_1_0_0_2_0 + 2*p_1_0_1_1_1_0 + 2*p_0_1_1_1_0_1 + p_1_1_0_0_0_2;
+            grad[150] = p_0_1_2_0_1_0 + p_1_0_2_0_0_1 + p_2_0_1_0_0_1 + 2*p_0_1_1_1_1_0 + p_0_2_1_0_1_0 + 2*p_1_0_1_1_0_1 + p_1_0_1_0_0_2 + p_0_1_1_0_2_0;
+            grad[151] = p_0_0_4_0_0_0 + 4*p_0_0_1_3_0_0;
+            grad[152] = 2*p_3_0_0_1_0_0 + 3*p_0_0_0_2_0_2 + 3*p_0_0_0_2_2_0 + 2*p_0_0_0_1_3_0 + 2*p_0_0_0_1_0_3 + 2*p_0_3_0_1_0_0 + 3*p_2_0_0_2_0_0 + 3*p_0_2_0_2_0_0;
+            grad[153] = p_0_2_0_0_2_0 + 2*p_0_1_2_1_0_0 + p_2_0_0_0_0_2 + 2*p_1_0_2_1_0_0 + 2*p_0_0_2_1_1_0 + 2*p_0_0_2_1_0_1;
+            grad[154] = 5*p_0_0_0_4_0_0;
+            grad[155] = 3*p_1_0_0_2_1_0 + 3*p_0_1_0_2_0_1 + p_0_1_0_0_0_3 + p_0_3_0_0_0_1 + p_3_0_0_0_1_0 + p_1_0_0_0_3_0;
+            grad[156] = 1;
+            grad[157] = x1;
+            grad[158] = x5 + x2 + x0 + x3;
+            grad[159] = 2*x4;
+            grad[160] = 2*p_0_1_0_0_1_0 + p_0_2_0_0_0_0;
+            grad[161] = 3*p_0_0_0_0_2_0;
+            grad[162] = p_1_0_0_1_0_0 + p_0_0_1_0_0_1;
+            grad[163] = 2*p_0_0_1_0_1_0 + p_0_0_0_2_0_0 + 2*p_0_0_0_0_1_1 + 2*p_0_0_0_1_1_0 + p_2_0_0_0_0_0 + p_0_0_0_0_0_2 + p_0_0_2_0_0_0 + 2*p_1_0_0_0_1_0;
+            grad[164] = p_1_0_1_0_0_0 + p_0_0_0_1_0_1;
+            grad[165] = p_0_1_1_0_0_0 + p_0_1_0_0_0_1 + p_0_0_1_1_0_0 + p_1_0_0_0_0_1 + p_0_1_0_1_0_0 + p_1_1_0_0_0_0;
+            grad[166] = p_1_1_0_0_0_1 + p_0_1_1_1_0_0;
+            grad[167] = 2*p_0_2_0_0_1_0;
+            grad[168] = p_2_0_0_1_0_0 + p_1_0_0_2_0_0 + 2*p_0_0_1_0_1_1 + 2*p_1_0_0_1_1_0 + p_0_0_1_0_0_2 + p_0_0_2_0_0_1;
+            grad[169] = p_0_1_1_0_0_1 + p_0_1_0_1_0_1 + p_1_0_1_1_0_0 + p_1_0_1_0_0_1 + p_1_0_0_1_0_1 + p_1_1_0_1_0_0 + p_0_0_1_1_0_1 + p_1_1_1_0_0_0;
+            grad[170] = p_0_3_0_0_0_0 + 3*p_0_1_0_0_2_0;
+            grad[171] = p_0_0_0_0_0_3 + p_0_0_0_3_0_0 + 3*p_0_0_1_0_2_0 + p_0_0_3_0_0_0 + 3*p_0_0_0_0_2_1 + 3*p_1_0_0_0_2_0 + p_3_0_0_0_0_0 + 3*p_0_0_0_1_2_0;
+            grad[172] = 2*p_0_0_0_0_1_2 + 2*p_2_0_0_0_1_0 + 2*p_0_0_0_2_1_0 + 2*p_0_0_2_0_1_0;
+            grad[173] = 2*p_1_0_0_0_1_1 + p_0_1_0_2_0_0 + 2*p_0_0_1_1_1_0 + p_0_1_0_0_0_2 + p_2_1_0_0_0_0 + p_0_1_2_0_0_0;
+            grad[174] = p_1_0_0_0_0_2 + p_0_0_1_2_0_0 + p_0_0_2_1_0_0 + p_2_0_0_0_0_1 + 2*p_0_1_0_1_1_0 + p_0_2_0_0_0_1 + p_1_2_0_0_0_0 + 2*p_0_1_1_0_1_0 + p_0_2_0_1_0_0 + 2*p_1_1_0_0_1_0 + p_0_2_1_0_0_0 + 2*p_0_1_0_0_1_1;
+            grad[175] = 4*p_0_0_0_0_3_0;
+            grad[176] = p_2_0_1_0_0_0 + 2*p_1_0_1_0_1_0 + 2*p_0_0_0_1_1_1 + p_0_0_0_2_0_1 + p_0_0_0_1_0_2 + p_1_0_2_0_0_0;
+            grad[177] = 3*p_1_0_1_0_2_0 + p_0_0_0_3_0_1 + p_0_0_0_1_0_3 + p_3_0_1_0_0_0 + 3*p_0_0_0_1_2_1 + p_1_0_3_0_0_0;
+            grad[178] = 2*p_1_0_0_1_1_1 + 2*p_0_0_1_1_1_1 + p_0_1_0_1_0_2 + p_0_0_1_1_0_2 + p_0_1_0_2_0_1 + p_2_1_0_1_0_0 + p_2_1_1_0_0_0 + 2*p_1_0_1_0_1_1 + p_0_1_1_0_0_2 + p_1_0_2_0_0_1 + p_1_1_2_0_0_0 + 2*p_1_0_1_1_1_0 + p_0_1_2_0_0_1 + p_1_1_0_2_0_0 + p_2_0_1_1_0_0 + p_1_0_0_2_0_1;
+            grad[179] = 3*p_0_2_0_0_2_0 + 2*p_0_3_0_0_1_0;
+            grad[180] = p_0_0_4_0_0_0 + 4*p_0_0_0_0_3_1 + p_0_0_0_0_0_4 + p_4_0_0_0_0_0 + 4*p_0_0_0_1_3_0 + p_0_0_0_4_0_0 + 4*p_0_0_1_0_3_0 + 4*p_1_0_0_0_3_0;
+            grad[181] = p_2_0_2_0_0_0 + 2*p_0_0_0_2_1_1 + 2*p_0_0_0_1_1_2 + p_0_0_0_2_0_2 + 2*p_2_0_1_0_1_0 + 2*p_1_0_2_0_1_0;
+            grad[182] = 2*p_2_0_0_1_1_0 + 2*p_0_0_2_0_1_1 + 2*p_1_0_0_2_1_0 + p_2_0_0_2_0_0 + 2*p_0_0_1_0_1_2 + p_0_0_2_0_0_2;
+            grad[183] = p_1_1_0_1_0_1 + p_0_1_1_1_0_1 + p_1_1_1_0_0_1 + p_1_1_1_1_0_0 + p_1_0_1_1_0_1;
+            grad[184] = p_0_1_0_3_0_0 + 3*p_1_0_0_0_2_1 + p_3_1_0_0_0_0 + p_0_1_0_0_0_3 + 3*p_0_0_1_1_2_0 + p_0_1_3_0_0_0;
+            grad[185] = p_0_2_0_2_0_0 + 2*p_1_0_0_0_1_2 + 2*p_0_1_0_2_1_0 + p_2_2_0_0_0_0 + 2*p_0_1_0_0_1_2 + 2*p_0_1_2_0_1_0 + 2*p_2_0_0_0_1_1 + p_0_2_0_0_0_2 + 2*p_0_0_2_1_1_0 + 2*p_2_1_0_0_1_0 + 2*p_0_0_1_2_1_0 + p_0_2_2_0_0_0;
+            grad[186] = p_0_2_1_0_0_1 + 2*p_0_1_0_1_1_1 + p_1_0_2_1_0_0 + p_0_0_1_2_0_1 + 2*p_1_1_1_0_1_0 + p_1_0_0_1_0_2 + p_1_2_0_1_0_0 + p_2_0_1_0_0_1;
+            grad[187] = 3*p_0_1_1_0_2_0 + 3*p_1_1_0_0_2_0 + p_0_0_3_1_0_0 + p_0_3_1_0_0_0 + p_1_3_0_0_0_0 + p_0_3_0_0_0_1 + 3*p_0_1_0_0_2_1 + p_1_0_0_0_0_3 + 3*p_0_1_0_1_2_0 + p_0_3_0_1_0_0 + p_0_0_1_3_0_0 + p_3_0_0_0_0_1;
+            grad[188] = p_2_0_0_1_0_1 + p_0_0_2_1_0_1 + p_0_2_0_1_0_1 + 2*p_1_1_0_1_1_0 + p_1_0_1_2_0_0 + p_1_2_1_0_0_0 + 2*p_0_1_1_0_1_1 + p_1_0_1_0_0_2;
+            grad[189] = p_0_1_2_1_0_0 + p_0_1_1_2_0_0 + 2*p_1_1_0_0_1_1 + p_0_2_1_1_0_0 + p_1_1_0_0_0_2 + p_2_1_0_0_0_1 + 2*p_0_1_1_1_1_0 + p_1_2_0_0_0_1;
+            grad[190] = p_0_4_0_0_0_0 + 4*p_0_1_0_0_3_0;
+            grad[191] = 3*p_0_0_0_0_2_2 + 2*p_0_0_0_3_1_0 + 3*p_0_0_0_2_2_0 + 3*p_0_0_2_0_2_0 + 2*p_0_0_3_0_1_0 + 3*p_2_0_0_0_2_0 + 2*p_3_0_0_0_1_0 + 2*p_0_0_0_0_1_3;
+            grad[192] = 2*p_1_2_0_0_1_0 + p_2_0_0_0_0_2 + 2*p_0_2_0_1_1_0 + 2*p_0_2_1_0_1_0 + p_0_0_2_2_0_0 + 2*p_0_2_0_0_1_1;
+            grad[193] = 5*p_0_0_0_0_4_0;
+            grad[194] = p_1_0_0_3_0_0 + p_0_0_3_0_0_1 + 3*p_0_0_1_0_2_1 + p_3_0_0_1_0_0 + p_0_0_1_0_0_3 + 3*p_1_0_0_1_2_0;
+            grad[195] = 1;
+            grad[196] = x0;
+            grad[197] = x4 + x2 + x1 + x3;
+            grad[198] = 2*x5;
+            grad[199] = p_2_0_0_0_0_0 + 2*p_1_0_0_0_0_1;
+            grad[200] = 3*p_0_0_0_0_0_2;
+            grad[201] = p_0_1_0_1_0_0 + p_0_0_1_0_1_0;
+            grad[202] = p_0_0_2_0_0_0 + p_0_0_0_0_2_0 + 2*p_0_1_0_0_0_1 + p_0_0_0_2_0_0 + 2*p_0_0_0_1_0_1 + 2*p_0_0_0_0_1_1 + p_0_2_0_0_0_0 + 2*p_0_0_1_0_0_1;
+            grad[203] = p_0_1_1_0_0_0 + p_0_0_0_1_1_0;
+            grad[204] = p_0_1_0_0_1_0 + p_0_0_1_1_0_0 + p_1_0_1_0_0_0 + p_1_0_0_0_1_0 + p_1_0_0_1_0_0 + p_1_1_0_0_0_0;
+            grad[205] = p_1_1_0_0_1_0 + p_1_0_1_1_0_0;
+            grad[206] = 2*p_2_0_0_0_0_1;
+            grad[207] = 2*p_0_1_0_1_0_1 + p_0_0_1_0_2_0 + 2*p_0_0_1_0_1_1 + p_0_2_0_1_0_0 + p_0_1_0_2_0_0 + p_0_0_2_0_1_0;
+            grad[208] = p_0_1_1_1_0_0 + p_0_1_1_0_1_0 + p_0_1_0_1_1_0 + p_1_1_0_1_0_0 + p_1_0_1_0_1_0 + p_1_1_1_0_0_0 + p_1_0_0_1_1_0 + p_0_0_1_1_1_0;
+            grad[209] = 3*p_1_0_0_0_0_2 + p_3_0_0_0_0_0;
+            grad[210] = 3*p_0_0_0_0_1_2 + p_0_0_0_3_0_0 + 3*p_0_0_0_1_0_2 + p_0_3_0_0_0_0 + 3*p_0_1_0_0_0_2 + p_0_0_0_0_3_0 + 3*p_0_0_1_0_0_2 + p_0_0_3_0_0_0;
+            grad[211] = 2*p_0_2_0_0_0_1 + 2*p_0_0_2_0_0_1 + 2*p_0_0_0_0_2_1 + 2*p_0_0_0_2_0_1;
+            grad[212] = p_1_2_0_0_0_0 + p_1_0_2_0_0_0 + 2*p_0_0_1_1_0_1 + p_1_0_0_0_2_0 + 2*p_0_1_0_0_1_1 + p_1_0_0_2_0_0;
+            grad[213] = p_0_0_2_1_0_0 + p_2_1_0_0_0_0 + p_2_0_1_0_0_0 + p_0_0_1_2_0_0 + p_2_0_0_1_0_0 + 2*p_1_0_0_0_1_1 + p_2_0_0_0_1_0 + p_0_2_0_0_1_0 + 2*p_1_0_0_1_0_1 + 2*p_1_0_1_0_0_1 + p_0_1_0_0_2_0 + 2*p_1_1_0_0_0_1;
+            grad[214] = 4*p_0_0_0_0_0_3;
+            grad[215] = p_0_1_2_0_0_0 + p_0_0_0_1_2_0 + p_0_0_0_2_1_0 + 2*p_0_1_1_0_0_1 + 2*p_0_0_0_1_1_1 + p_0_2_1_0_0_0;
+            grad[216] = p_0_1_3_0_0_0 + p_0_0_0_3_1_0 + 3*p_0_1_1_0_0_2 + 3*p_0_0_0_1_1_2 + p_0_0_0_1_3_0 + p_0_3_1_0_0_0;
+            grad[217] = p_1_0_0_1_2_0 + p_0_0_1_1_2_0 + p_0_2_1_1_0_0 + p_1_1_2_0_0_0 + 2*p_0_1_0_1_1_1 + 2*p_0_0_1_1_1_1 + p_0_1_0_2_1_0 + 2*p_0_1_1_1_0_1 + p_1_2_1_0_0_0 + p_1_1_0_2_0_0 + p_1_0_1_0_2_0 + 2*p_0_1_1_0_1_1 + p_1_0_2_0_1_0 + p_0_1_2_0_1_0 + p_1_2_0_1_0_0 + p_1_0_0_2_1_0;
+            grad[218] = 2*p_3_0_0_0_0_1 + 3*p_2_0_0_0_0_2;
+            grad[219] = 4*p_0_0_0_1_0_3 + p_0_0_4_0_0_0 + 4*p_0_1_0_0_0_3 + p_0_4_0_0_0_0 + p_0_0_0_0_4_0 + 4*p_0_0_0_0_1_3 + p_0_0_0_4_0_0 + 4*p_0_0_1_0_0_3;
+            grad[220] = 2*p_0_2_1_0_0_1 + p_0_0_0_2_2_0 + 2*p_0_1_2_0_0_1 + 2*p_0_0_0_1_2_1 + 2*p_0_0_0_2_1_1 + p_0_2_2_0_0_0;
+            grad[221] = p_0_2_0_2_0_0 + p_0_0_2_0_2_0 + 2*p_0_2_0_1_0_1 + 2*p_0_0_1_0_2_1 + 2*p_0_0_2_0_1_1 + 2*p_0_1_0_2_0_1;
+            grad[222] = p_1_1_0_1_1_0 + p_0_1_1_1_1_0 + p_1_1_1_0_1_0 + p_1_1_1_1_0_0 + p_1_0_1_1_1_0;
+            grad[223] = p_1_0_3_0_0_0 + p_1_0_0_3_0_0 + p_1_0_0_0_3_0 + 3*p_0_1_0_0_1_2 + p_1_3_0_0_0_0 + 3*p_0_0_1_1_0_2;
+            grad[224] = 2*p_1_0_0_0_2_1 + p_2_2_0_0_0_0 + 2*p_1_0_2_0_0_1 + 2*p_0_1_0_0_2_1 + p_2_0_2_0_0_0 + 2*p_1_0_0_2_0_1 + p_2_0_0_0_2_0 + 2*p_0_2_0_0_1_1 + p_2_0_0_2_0_0 + 2*p_1_2_0_0_0_1 + 2*p_0_0_2_1_0_1 + 2*p_0_0_1_2_0_1;
+            grad[225] = p_0_2_1_0_1_0 + p_0_1_0_1_2_0 + p_2_1_0_1_0_0 + p_0_0_1_2_1_0 + 2*p_1_0_0_1_1_1 + p_0_1_2_1_0_0 + 2*p_1_1_1_0_0_1 + p_2_0_1_0_1_0;
+            grad[226] = p_0_0_1_3_0_0 + p_3_0_1_0_0_0 + 3*p_1_1_0_0_0_2 + 3*p_1_0_0_1_0_2 + p_3_0_0_1_0_0 + p_0_3_0_0_1_0 + p_0_1_0_0_3_0 + 3*p_1_0_0_0_1_2 + p_0_0_3_1_0_0 + p_3_1_0_0_0_0 + p_3_0_0_0_1_0 + 3*p_1_0_1_0_0_2;
+            grad[227] = p_2_0_0_1_1_0 + p_0_0_2_1_1_0 + p_0_2_0_1_1_0 + p_2_1_1_0_0_0 + p_0_1_1_0_2_0 + p_0_1_1_2_0_0 + 2*p_1_1_0_1_0_1 + 2*p_1_0_1_0_1_1;
+            grad[228] = p_1_0_2_1_0_0 + p_2_0_1_1_0_0 + p_1_1_0_0_2_0 + p_1_0_1_2_0_0 + 2*p_1_1_0_0_1_1 + p_2_1_0_0_1_0 + 2*p_1_0_1_1_0_1 + p_1_2_0_0_1_0;
+            grad[229] = p_4_0_0_0_0_0 + 4*p_1_0_0_0_0_3;
+            grad[230] = 2*p_0_0_0_0_3_1 + 2*p_0_0_0_3_0_1 + 3*p_0_0_0_2_0_2 + 2*p_0_0_3_0_0_1 + 2*p_0_3_0_0_0_1 + 3*p_0_0_2_0_0_2 + 3*p_0_2_0_0_0_2 + 3*p_0_0_0_0_2_2;
+            grad[231] = 2*p_2_0_0_0_1_1 + 2*p_2_0_1_0_0_1 + 2*p_2_0_0_1_0_1 + 2*p_2_1_0_0_0_1 + p_0_2_0_0_2_0 + p_0_0_2_2_0_0;
+            grad[232] = 5*p_0_0_0_0_0_4;
+            grad[233] = p_0_1_0_3_0_0 + p_0_0_3_0_1_0 + 3*p_0_1_0_1_0_2 + p_0_0_1_0_3_0 + p_0_3_0_1_0_0 + 3*p_0_0_1_0_1_2;
             return grad;
         }
 
@@ -513,3 +1484,10 @@ void FitFuncs::add_polynomials(std::vector<Polynomial*>& polynomials) {
     polynomials.push_back(new OW_OW_OW());
     polynomials.push_back(new OW_OW_OW_OW());
 }
+
+Polynomial* FitFuncs::create_polynomial(const std::string& name) {
+    if(name == "OW_OW") return new OW_OW();
+    if(name == "OW_OW_OW") return new OW_OW_OW();
+    if(name == "OW_OW_OW_OW") return new OW_OW_OW_OW();
+    return 0;
+}
@@ -0,0 +1,7 @@
+#include "NBodyKernel.h"
+
+// One atom per monomer, as in the coarse-grained models
+template class NBodyKernel<2, 1>;
+template class NBodyKernel<3, 1>;
+template class NBodyKernel<4, 1>;
+template class NBodyKernel<5, 1>;
@@ -0,0 +1,338 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Polynomial.h"
+#include "ParamRegistry.h"
+#include "tools/custom_exceptions.h"
+
+/*
+* Evaluator of a polynomial of the FitFuncs for N-mers of N monomers with
+* NatomsPerMon atoms each. The atoms of the polynomial are the atoms of the
+* first monomer, then the ones of the second monomer, and so on.
+*
+* The number of atoms and of distances are known at compile time, so the
+* loops over them in the batched energy and gradients have fixed trip
+* counts and are unrolled by the compiler. The variables and the polynomial
+* are computed in the precision selected for the polynomial by the
+* ParamRegistry::PrecisionScope of the calling thread (see
+* Polynomial::Precision). A new N-body term is a new instantiation:
+*
+*     typedef NBodyKernel<3, 1> OW_OW_OW;
+*     const OW_OW_OW pot("OW_OW_OW");
+*/
+template <std::size_t N, std::size_t NatomsPerMon>
+class NBodyKernel
+{
+
+    static_assert(N >= 2 && N <= 5, "NBodyKernel evaluates N-mers of 2 to 5 monomers");
+    static_assert(NatomsPerMon >= 1, "NBodyKernel needs at least one atom per monomer");
+
+    public:
+
+        static constexpr std::size_t num_monomers = N;
+        static constexpr std::size_t atoms_per_monomer = NatomsPerMon;
+        static constexpr std::size_t num_atoms = N*NatomsPerMon;
+        static constexpr std::size_t num_distances = num_atoms*(num_atoms - 1)/2;
+
+        static_assert(num_distances <= SwitchFunction::max_distances,
+                      "NBodyKernel has more distances than the switch functions support");
+
+        // Coordinates, or gradients, of all the N-mers, one pointer per
+        // monomer. Each has 3*NatomsPerMon doubles per N-mer.
+        typedef std::array<const double*, N> Coordinates;
+        typedef std::array<double*, N> Gradients;
+
+        /*
+        * Kernel of a polynomial of the FitFuncs, with its parameters from
+        * the ParamRegistry.
+        *
+        * @param name Name of the polynomial. Throws CUException if it does
+        * not have N*NatomsPerMon atoms.
+        */
+        explicit NBodyKernel(const std::string& name);
+
+        /*
+        * Evaluate the switched polynomial for nm N-mers.
+        *
+        * @return Sum of the energies of the N-mers.
+        */
+        double eval(const Coordinates& xyz, std::size_t nm) const;
+
+        /*
+        * Evaluate the switched polynomial and its gradients for nm N-mers.
+        *
+        * @param grad The gradients of the polynomial are added to them.
+        * @param virial Virial to which the one of the polynomial is added,
+        * or 0.
+        *
+        * @return Sum of the energies of the N-mers.
+        */
+        double eval(const Coordinates& xyz, const Gradients& grad, std::size_t nm,
+                    std::vector<double>* virial = 0) const;
+
+        /*
+        * @return Number of monomers of the switch of the polynomial
+        */
+        int get_nb() const { return poly->get_nb(); }
+
+        /*
+        * @return Outer cutoff of the switch of the polynomial
+        */
+        double get_ro() const { return poly->get_ro(); }
+
+        const Polynomial& get_polynomial() const { return *poly; }
+
+    private:
+
+        // Number of N-mers evaluated together
+        static constexpr std::size_t batch_size = Polynomial::batch_size;
+
+        // Coordinates, 3 components of the pair vectors, distances, switch
+        // gradients and switches of a block, in double
+        static constexpr std::size_t scratch_size = batch_size*(3*num_atoms + 5*num_distances + 1);
+
+        // Variables, polynomial gradients and energies of a block, in the
+        // precision selected for the polynomial
+        static constexpr std::size_t real_scratch_size = batch_size*(2*num_distances + 1);
+
+        // Energy, and gradients if Gradient, of the N-mers in blocks of
+        // batch_size, vectorized across the N-mers of the block. The
+        // variables and the polynomial are computed in Real, and everything
+        // else in double.
+        template <typename Real, bool Gradient>
+        double eval_blocks(const Coordinates& xyz, const Gradients& grad, std::size_t nm, double* virial) const;
+
+        // Scratch buffer Id of the calling thread, with at least size
+        // elements. Kept between calls, so evaluations do not allocate.
+        template <typename T, int Id>
+        static T* thread_scratch(std::size_t size) {
+            static thread_local std::vector<T> buffer;
+            if(buffer.size() < size) buffer.resize(size);
+            return buffer.data();
+        }
+
+        // The polynomial, its name and its switch
+        const Polynomial* poly;
+        std::string name;
+        const SwitchFunction* switch_function;
+
+        // Nonlinear parameter of the variable of each distance
+        std::array<double, num_distances> nl_params;
+
+};
+
+template <std::size_t N, std::size_t NatomsPerMon>
+constexpr std::size_t NBodyKernel<N, NatomsPerMon>::num_monomers;
+template <std::size_t N, std::size_t NatomsPerMon>
+constexpr std::size_t NBodyKernel<N, NatomsPerMon>::atoms_per_monomer;
+template <std::size_t N, std::size_t NatomsPerMon>
+constexpr std::size_t NBodyKernel<N, NatomsPerMon>::num_atoms;
+template <std::size_t N, std::size_t NatomsPerMon>
+constexpr std::size_t NBodyKernel<N, NatomsPerMon>::num_distances;
+template <std::size_t N, std::size_t NatomsPerMon>
+constexpr std::size_t NBodyKernel<N, NatomsPerMon>::batch_size;
+template <std::size_t N, std::size_t NatomsPerMon>
+constexpr std::size_t NBodyKernel<N, NatomsPerMon>::scratch_size;
+template <std::size_t N, std::size_t NatomsPerMon>
+constexpr std::size_t NBodyKernel<N, NatomsPerMon>::real_scratch_size;
+
+template <std::size_t N, std::size_t NatomsPerMon>
+NBodyKernel<N, NatomsPerMon>::NBodyKernel(const std::string& name) : name(name) {
+    // Shared by all the instances. Its parameters are read on the first request.
+    poly = &ParamRegistry::get_polynomial(name);
+
+    if(poly->get_system().get_num_atoms() != static_cast<int>(num_atoms) ||
+       poly->get_num_variables() != static_cast<int>(num_distances)) {
+        std::ostringstream text;
+        text << "Polynomial " << name << " has " << poly->get_system().get_num_atoms()
+             << " atoms, but its kernel evaluates " << N << " monomers of " << NatomsPerMon << " atoms";
+        throw CUException(__func__, __FILE__, __LINE__, text.str());
+    }
+
+    switch_function = &poly->get_switch_function();
+    for(std::size_t k = 0; k < num_distances; k++)
+        nl_params[k] = poly->get_variable_nl_param(k);
+}
+
+template <std::size_t N, std::size_t NatomsPerMon>
+double NBodyKernel<N, NatomsPerMon>::eval(const Coordinates& xyz, std::size_t nm) const {
+    Gradients no_grad;
+    no_grad.fill(0);
+    if(ParamRegistry::get_precision(name) == Polynomial::single_precision)
+        return eval_blocks<float, false>(xyz, no_grad, nm, 0);
+    return eval_blocks<double, false>(xyz, no_grad, nm, 0);
+}
+
+template <std::size_t N, std::size_t NatomsPerMon>
+double NBodyKernel<N, NatomsPerMon>::eval(const Coordinates& xyz, const Gradients& grad, std::size_t nm,
+                                          std::vector<double>* virial) const {
+    double* virial_ptr = virial == 0 ? 0 : virial->data();
+    if(ParamRegistry::get_precision(name) == Polynomial::single_precision)
+        return eval_blocks<float, true>(xyz, grad, nm, virial_ptr);
+    return eval_blocks<double, true>(xyz, grad, nm, virial_ptr);
+}
+
+template <std::size_t N, std::size_t NatomsPerMon>
+template <typename Real, bool Gradient>
+double NBodyKernel<N, NatomsPerMon>::eval_blocks(const Coordinates& xyz, const Gradients& grad, std::size_t nm,
+                                                 double* virial) const {
+    const std::size_t B = batch_size;
+    const std::size_t stride = 3*NatomsPerMon;
+
+    // Layout of the scratch buffers. Element j of each array is N-mer j of
+    // the block. The coordinates are overwritten by the gradients.
+    double* pos = thread_scratch<double, 0>(scratch_size);
+    double* delta = pos + 3*num_atoms*B;
+    double* distances = delta + 3*num_distances*B;
+    double* switch_gradients = distances + num_distances*B;
+    double* switches = switch_gradients + num_distances*B;
+
+    Real* variables = thread_scratch<Real, 1>(real_scratch_size);
+    Real* V_gradients = variables + num_distances*B;
+    Real* energies = V_gradients + num_distances*B;
+
+    double energy = 0;
+    double v0 = 0, v1 = 0, v2 = 0, v4 = 0, v5 = 0, v8 = 0;
+
+    for(std::size_t start = 0; start < nm; start += B) {
+        const std::size_t nl = std::min(B, nm - start);
+
+        // Gather the coordinates of the block. Atom a is atom
+        // a % NatomsPerMon of monomer a / NatomsPerMon.
+        for(std::size_t a = 0; a < num_atoms; a++) {
+            const double* x = xyz[a / NatomsPerMon] + stride*start + 3*(a % NatomsPerMon);
+            for(std::size_t c = 0; c < 3; c++) {
+                double* p = pos + (3*a + c)*B;
+                for(std::size_t j = 0; j < nl; j++)
+                    p[j] = x[stride*j + c];
+            }
+        }
+
+        // Distances and variables
+        std::size_t k = 0;
+        for(std::size_t a1 = 0; a1 < num_atoms; a1++) {
+            for(std::size_t a2 = a1 + 1; a2 < num_atoms; a2++, k++) {
+                const double* x1 = pos + 3*a1*B;
+                const double* x2 = pos + 3*a2*B;
+                double* dx = delta + 3*k*B;
+                double* r = distances + k*B;
+                Real* v = variables + k*B;
+                const Real nl_param = nl_params[k];
+#pragma omp simd
+                for(std::size_t j = 0; j < nl; j++) {
+                    dx[j] = x1[j] - x2[j];
+                    dx[B + j] = x1[B + j] - x2[B + j];
+                    dx[2*B + j] = x1[2*B + j] - x2[2*B + j];
+                    r[j] = std::sqrt(dx[j]*dx[j] + dx[B + j]*dx[B + j] + dx[2*B + j]*dx[2*B + j]);
+                    v[j] = std::exp(-nl_param*static_cast<Real>(r[j]));
+                }
+            }
+        }
+
+        // Polynomials and switches of the whole block
+        poly->polynomial_batch(nl, B, variables, energies, Gradient ? V_gradients : 0);
+        switch_function->eval_batch(nl, B, num_distances, distances, switches, Gradient ? switch_gradients : 0);
+
+#pragma omp simd reduction(+ : energy)
+        for(std::size_t j = 0; j < nl; j++)
+            energy += static_cast<double>(energies[j])*switches[j];
+
+        if(!Gradient) continue;
+
+        // Chain rule for each pair, accumulating the gradients of the
+        // atoms where the coordinates were
+        std::fill(pos, pos + 3*num_atoms*B, 0.0);
+
+        k = 0;
+        for(std::size_t a1 = 0; a1 < num_atoms; a1++) {
+            for(std::size_t a2 = a1 + 1; a2 < num_atoms; a2++, k++) {
+                double* g1 = pos + 3*a1*B;
+                double* g2 = pos + 3*a2*B;
+                const double* dx = delta + 3*k*B;
+                const double* r = distances + k*B;
+                const Real* v = variables + k*B;
+                const double* dsw = switch_gradients + k*B;
+                const Real* dV = V_gradients + k*B;
+                const double nl_param = nl_params[k];
+#pragma omp simd reduction(+ : v0, v1, v2, v4, v5, v8)
+                for(std::size_t j = 0; j < nl; j++) {
+                    // dsw*V/dr = dsw/dr * V + sw * dV/dv * dv/dr, with dv/dr = -k*v
+                    const double dEdr = dsw[j]*static_cast<double>(energies[j])
+                                        - switches[j]*static_cast<double>(dV[j])*nl_param*static_cast<double>(v[j]);
+                    const double f = dEdr/r[j];
+                    const double fx = f*dx[j];
+                    const double fy = f*dx[B + j];
+                    const double fz = f*dx[2*B + j];
+
+                    g1[j] += fx;
+                    g1[B + j] += fy;
+                    g1[2*B + j] += fz;
+                    g2[j] -= fx;
+                    g2[B + j] -= fy;
+                    g2[2*B + j] -= fz;
+
+                    v0 -= fx*dx[j];
+                    v1 -= fx*dx[B + j];
+                    v2 -= fx*dx[2*B + j];
+                    v4 -= fy*dx[B + j];
+                    v5 -= fy*dx[2*B + j];
+                    v8 -= fz*dx[2*B + j];
+                }
+            }
+        }
+
+        // Scatter the gradients of the block
+        for(std::size_t a = 0; a < num_atoms; a++) {
+            double* g = grad[a / NatomsPerMon] + stride*start + 3*(a % NatomsPerMon);
+            for(std::size_t c = 0; c < 3; c++) {
+                const double* p = pos + (3*a + c)*B;
+                for(std::size_t j = 0; j < nl; j++)
+                    g[stride*j + c] += p[j];
+            }
+        }
+    }
+
+    if(Gradient && virial != 0) {
+        virial[0] += v0;
+        virial[1] += v1;
+        virial[2] += v2;
+        virial[3] += v1;
+        virial[4] += v4;
+        virial[5] += v5;
+        virial[6] += v2;
+        virial[7] += v5;
+        virial[8] += v8;
+    }
+
+    return energy;
+}
+
+/*
+* Evaluate nm N-mers with a kernel, given the coordinates and gradients of
+* the monomers as arrays of N pointers, as the nbody kernels receive them.
+* If grad is 0, only the energy is computed.
+*/
+template <class Kernel>
+double eval_nbody_kernel(const Kernel& kernel, std::size_t nm, const double* const* xyz, double* const* grad,
+                         std::vector<double>* virial) {
+    typename Kernel::Coordinates x;
+    std::copy(xyz, xyz + Kernel::num_monomers, x.begin());
+    if(grad == 0) return kernel.eval(x, nm);
+
+    typename Kernel::Gradients g;
+    std::copy(grad, grad + Kernel::num_monomers, g.begin());
+    return kernel.eval(x, g, nm, virial);
+}
+
+// The coarse-grained kernels, instantiated once in NBodyKernel.cpp
+extern template class NBodyKernel<2, 1>;
+extern template class NBodyKernel<3, 1>;
+extern template class NBodyKernel<4, 1>;
+extern template class NBodyKernel<5, 1>;
@@ -2,18 +2,24 @@
 #include <vector>
 #include <iostream>
 #include <cmath>
+#include <limits>
 
 class NoSwitchFunction: public SwitchFunction
 {
 
     public:
 
-        double eval(const std::vector<double>& distances) const {
+        double eval(const double* distances, std::size_t n) const {
             return 1;
         }
 
-        std::vector<double> gradient(const std::vector<double>& distances) const {
-            return std::vector<double>(distances.size(), 0);
+        void gradient(const double* distances, std::size_t n, double* gradients) const {
+            for(std::size_t i = 0; i < n; i++)
+                gradients[i] = 0;
         }
 
+        // No distance is switched off: any number of monomers, no cutoff
+        double GetRo() const { return std::numeric_limits<double>::infinity(); }
+        int GetNb() const { return 1; }
+
 };
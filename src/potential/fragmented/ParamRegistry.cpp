@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#include "ParamRegistry.h"
+#include "FitFuncs.h"
+#include "tools/custom_exceptions.h"
+
+namespace {
+
+    const char cache_magic[8] = {'M', 'B', 'X', 'P', 'A', 'R', 'A', 'M'};
+    const std::uint64_t cache_version = 2;
+
+    std::mutex registry_lock;
+    std::vector<std::string> user_path;
+    std::map<std::string, Polynomial*> polynomials;
+    // File the parameters of each polynomial were read from
+    std::map<std::string, std::string> files;
+    // Table of the innermost PrecisionScope of each thread
+    thread_local const ParamRegistry::PrecisionTable* thread_precisions = 0;
+
+    // Contents of a file. False if it cannot be read.
+    bool read_file(const std::string& file, std::string& contents) {
+        std::ifstream in(file.c_str(), std::ios::binary);
+        if(!in) return false;
+        std::ostringstream stream;
+        stream << in.rdbuf();
+        contents = stream.str();
+        return true;
+    }
+
+    // Size and 64-bit FNV-1a hash of the contents of a text file. The hash,
+    // unlike the modification time, also tells apart edits made within the
+    // resolution of the file system clock.
+    void get_stamp(const std::string& contents, std::uint64_t* stamp) {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for(std::size_t i = 0; i < contents.size(); i++) {
+            hash ^= static_cast<unsigned char>(contents[i]);
+            hash *= 1099511628211ULL;
+        }
+        stamp[0] = contents.size();
+        stamp[1] = hash;
+    }
+
+    // Parameters from the text of the file. False if they are not all there.
+    bool read_text(const std::string& contents, std::vector<double>& nl_params, std::vector<double>& coefficients) {
+        std::istringstream in(contents);
+        std::string nl, params, coef;
+        in >> nl >> params;
+        if(nl != "NL" || params != "PARAMS:") return false;
+        for(std::size_t i = 0; i < nl_params.size(); i++)
+            if(!(in >> nl_params[i])) return false;
+        in >> coef;
+        if(coef != "COEFFICIENTS:") return false;
+        for(std::size_t i = 0; i < coefficients.size(); i++)
+            if(!(in >> coefficients[i])) return false;
+        return true;
+    }
+
+    // File the parameters of a polynomial are read from with a search path,
+    // or an empty string if there is none
+    std::string resolve_file(const std::string& name, const std::vector<std::string>& path) {
+        for(std::size_t i = 0; i < path.size(); i++) {
+            const std::string text_file = path[i] + "/" + name + ".params";
+            const std::string cache_file = text_file + ".bin";
+            if(std::ifstream(text_file.c_str())) return text_file;
+            if(std::ifstream(cache_file.c_str())) return cache_file;
+        }
+        return "";
+    }
+
+    // Parameters from the binary cache. If stamp is not 0, the cache is
+    // only valid for a text file with that stamp.
+    bool read_cache(const std::string& file, const std::uint64_t* stamp,
+                    std::vector<double>& nl_params, std::vector<double>& coefficients) {
+        std::ifstream in(file.c_str(), std::ios::binary);
+        char magic[8];
+        std::uint64_t header[5];
+        if(!in.read(magic, 8) || !in.read(reinterpret_cast<char*>(header), sizeof(header))) return false;
+        if(!std::equal(magic, magic + 8, cache_magic) || header[0] != cache_version) return false;
+        if(stamp != 0 && (header[1] != stamp[0] || header[2] != stamp[1])) return false;
+        if(header[3] != nl_params.size() || header[4] != coefficients.size()) return false;
+        return in.read(reinterpret_cast<char*>(nl_params.data()), nl_params.size()*sizeof(double))
+            && in.read(reinterpret_cast<char*>(coefficients.data()), coefficients.size()*sizeof(double));
+    }
+
+    // Best effort: the directory may not be writable
+    void write_cache(const std::string& file, const std::uint64_t* stamp,
+                     const std::vector<double>& nl_params, const std::vector<double>& coefficients) {
+        std::string tmp_file = file + ".tmp";
+        {
+            std::ofstream out(tmp_file.c_str(), std::ios::binary);
+            std::uint64_t header[5] = {cache_version, stamp[0], stamp[1], nl_params.size(), coefficients.size()};
+            out.write(cache_magic, 8);
+            out.write(reinterpret_cast<const char*>(header), sizeof(header));
+            out.write(reinterpret_cast<const char*>(nl_params.data()), nl_params.size()*sizeof(double));
+            out.write(reinterpret_cast<const char*>(coefficients.data()), coefficients.size()*sizeof(double));
+            if(!out) {
+                out.close();
+                std::remove(tmp_file.c_str());
+                return;
+            }
+        }
+        // Renamed into place, so other processes never read half a file
+        if(std::rename(tmp_file.c_str(), file.c_str()) != 0) std::remove(tmp_file.c_str());
+    }
+
+}
+
+void ParamRegistry::set_search_path(const std::vector<std::string>& directories) {
+    std::lock_guard<std::mutex> guard(registry_lock);
+    user_path = directories;
+}
+
+std::vector<std::string> ParamRegistry::get_search_path() {
+    std::vector<std::string> path;
+    {
+        std::lock_guard<std::mutex> guard(registry_lock);
+        path = user_path;
+    }
+
+    const char* env = std::getenv("MBX_PARAMS_PATH");
+    if(env != 0) {
+        std::stringstream stream(env);
+        std::string directory;
+        while(std::getline(stream, directory, ':'))
+            if(!directory.empty()) path.push_back(directory);
+    }
+
+    path.push_back(".");
+    return path;
+}
+
+const Polynomial& ParamRegistry::get_polynomial(const std::string& name) {
+    std::vector<std::string> path = get_search_path();
+
+    std::lock_guard<std::mutex> guard(registry_lock);
+
+    std::map<std::string, Polynomial*>::iterator it = polynomials.find(name);
+    if(it != polynomials.end()) return *it->second;
+
+    Polynomial* polynomial = FitFuncs::create_polynomial(name);
+    if(polynomial == 0) {
+        std::string text = "There is no polynomial " + name + " in the FitFuncs.";
+        throw CUException(__func__, __FILE__, __LINE__, text);
+    }
+
+    std::vector<double> nl_params(polynomial->get_num_nl_params());
+    std::vector<double> coefficients(polynomial->get_num_coefficients());
+
+    bool found = false;
+    std::string searched, file;
+    for(std::size_t i = 0; i < path.size() && !found; i++) {
+        const std::string text_file = path[i] + "/" + name + ".params";
+        const std::string cache_file = text_file + ".bin";
+        searched += " " + path[i];
+        file = text_file;
+
+        std::string contents;
+        if(read_file(text_file, contents)) {
+            std::uint64_t stamp[2];
+            get_stamp(contents, stamp);
+            found = read_cache(cache_file, stamp, nl_params, coefficients);
+            if(!found) {
+                if(!read_text(contents, nl_params, coefficients)) {
+                    delete polynomial;
+                    std::string text = text_file + " does not have the " + std::to_string(nl_params.size())
+                                       + " nonlinear parameters and " + std::to_string(coefficients.size())
+                                       + " coefficients of " + name + ".";
+                    throw CUException(__func__, __FILE__, __LINE__, text);
+                }
+                write_cache(cache_file, stamp, nl_params, coefficients);
+                found = true;
+            }
+        } else {
+            found = read_cache(cache_file, 0, nl_params, coefficients);
+            file = cache_file;
+        }
+    }
+
+    if(!found) {
+        delete polynomial;
+        std::string text = "No parameters for " + name + " (" + name + ".params) were found in:" + searched
+                           + ". Set \"params_path\" in the MBX json or MBX_PARAMS_PATH.";
+        throw CUException(__func__, __FILE__, __LINE__, text);
+    }
+
+    polynomial->set_nl_params(nl_params);
+    polynomial->set_coefficients(coefficients);
+    polynomials[name] = polynomial;
+    files[name] = file;
+    return *polynomial;
+}
+
+std::map<std::string, std::string> ParamRegistry::get_stale_polynomials() {
+    std::vector<std::string> path = get_search_path();
+
+    std::lock_guard<std::mutex> guard(registry_lock);
+
+    std::map<std::string, std::string> stale;
+    for(std::map<std::string, std::string>::const_iterator it = files.begin(); it != files.end(); it++) {
+        const std::string file = resolve_file(it->first, path);
+        if(file != it->second) stale[it->first] = it->second;
+    }
+    return stale;
+}
+
+ParamRegistry::PrecisionScope::PrecisionScope(const PrecisionTable& table) : previous(thread_precisions) {
+    thread_precisions = &table;
+}
+
+ParamRegistry::PrecisionScope::~PrecisionScope() {
+    thread_precisions = previous;
+}
+
+Polynomial::Precision ParamRegistry::get_precision(const std::string& name) {
+    if(thread_precisions == 0) return Polynomial::double_precision;
+    PrecisionTable::const_iterator it = thread_precisions->find(name);
+    return it == thread_precisions->end() ? Polynomial::double_precision : it->second;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Polynomial.h"
+
+/*
+* Registry of the parametrized polynomials of the FitFuncs.
+*
+* Each polynomial is created, and its parameters read, the first time it is
+* requested, and is shared by the whole process after that: the first load
+* wins. Changing the search path later, for example with the "params_path"
+* of another System, does not read the parameters again (see
+* get_stale_polynomials). The parameters of a
+* polynomial NAME are read from NAME.params in the first directory of the
+* search path that has it. A binary copy of them, NAME.params.bin, is written
+* next to it and read instead in later runs while the text file has the same
+* size and contents (checked with a hash of the text).
+* A directory with only NAME.params.bin is valid too.
+*/
+namespace ParamRegistry {
+
+    /*
+    * Set the directories searched for the parameters. They are searched
+    * before the ones in the MBX_PARAMS_PATH environment variable (separated
+    * by ':') and the current directory. Polynomials that were already
+    * requested keep their parameters.
+    *
+    * @param directories The directories, in the order they are searched.
+    */
+    void set_search_path(const std::vector<std::string>& directories);
+
+    /*
+    * @return All the directories searched for the parameters, in order.
+    */
+    std::vector<std::string> get_search_path();
+
+    /*
+    * Get a polynomial with its parameters. Thread safe.
+    *
+    * @param name Name of the polynomial in the FitFuncs.
+    *
+    * @return The polynomial. Throws CUException if there is no polynomial
+    * with that name, or if no complete parameters are found for it.
+    */
+    const Polynomial& get_polynomial(const std::string& name);
+
+    /*
+    * Find the polynomials that were already requested, whose parameters
+    * the current search path would take from another file (or from none).
+    * They keep the parameters they have.
+    *
+    * @return The file the parameters of each of them were read from, by
+    * polynomial name.
+    */
+    std::map<std::string, std::string> get_stale_polynomials();
+
+    /*
+    * Precisions of the batched evaluation of the polynomials (see
+    * Polynomial::Precision), by polynomial name. Polynomials without one
+    * use double precision.
+    */
+    typedef std::map<std::string, Polynomial::Precision> PrecisionTable;
+
+    /*
+    * Selects the precisions of the polynomials evaluated by the calling
+    * thread while it exists. The polynomials are shared by the whole
+    * process, so each System opens a scope with its own table around its
+    * N-body kernels, and Systems with different precisions do not affect
+    * each other, even when they are evaluated from different threads.
+    * Scopes can be nested; the innermost one applies.
+    */
+    class PrecisionScope {
+        public:
+            explicit PrecisionScope(const PrecisionTable& table);
+            ~PrecisionScope();
+        private:
+            PrecisionScope(const PrecisionScope&);
+            PrecisionScope& operator=(const PrecisionScope&);
+            const PrecisionTable* previous;
+    };
+
+    /*
+    * @return The precision of a polynomial in the innermost PrecisionScope
+    * of the calling thread, or double precision if there is none.
+    */
+    Polynomial::Precision get_precision(const std::string& name);
+
+}
@@ -6,8 +6,17 @@
 #include "Polynomial.h"
 #include "LocalSystem.h"
 #include "SwitchFunction.h"
-
-Polynomial::Polynomial(LocalSystem system, std::string name, int num_terms, int num_nl_params, std::vector<int> nl_param_indices, SwitchFunction* switch_function) : system(system), name(name), coefficients(num_terms, 0), nl_params(num_nl_params, 0), nl_param_indices(nl_param_indices), switch_function(switch_function) {
+#include "tools/custom_exceptions.h"
+
+Polynomial::Polynomial(LocalSystem system, std::string name, int num_terms, int num_nl_params, std::vector<int> nl_param_indices, SwitchFunction* switch_function) : system(system), nl_params(num_nl_params, 0), nl_param_indices(nl_param_indices), coefficients(num_terms, 0), coefficients_float(num_terms, 0), name(name), switch_function(switch_function) {
+    // The switch functions work in stack buffers of max_distances
+    if (nl_param_indices.size() > SwitchFunction::max_distances) {
+        delete switch_function;
+        std::string text = "Polynomial " + name + " has " + std::to_string(nl_param_indices.size()) +
+                           " distances. The switch functions support up to " +
+                           std::to_string(SwitchFunction::max_distances) + ".";
+        throw CUException(__func__, __FILE__, __LINE__, text);
+    }
 }
 
 Polynomial::~Polynomial() {
@@ -19,163 +28,161 @@ std::vector<double> Polynomial::eval_terms(const std::vector<double>& distances)
 
 }
 
-std::vector<double> Polynomial::eval_variables(const std::vector<double>& distances) const {
-	std::vector<double> variables;
+std::vector<double> Polynomial::eval_terms_from_variables(const std::vector<double>& variables) const {
+	std::vector<double> terms(this->coefficients.size());
+	this->eval_terms_from_variables(variables.data(), terms.data());
+	return terms;
+}
 
+std::vector<double> Polynomial::eval_variables(const std::vector<double>& distances) const {
+	std::vector<double> variables(this->nl_param_indices.size());
+	this->eval_variables(distances.data(), variables.data());
+	return variables;
+}
 
+void Polynomial::eval_variables(const double* distances, double* variables) const {
 	// TODO: add support for other nl_param models. For now this is the exp model.
 	for(int nl_param_index = 0; nl_param_index < this->nl_param_indices.size(); nl_param_index++) {
-		variables.push_back(exp(-this->nl_params[this->nl_param_indices[nl_param_index]] * distances[nl_param_index]));
+		variables[nl_param_index] = exp(-this->nl_params[this->nl_param_indices[nl_param_index]] * distances[nl_param_index]);
 	}
-
-	return variables;
 }
 
 double Polynomial::eval_switch(const std::vector<double>& distances) const {
-    //double r = distances[0];
-    //double m_ri = 2;
-    //double m_ro = 5;
-    //if (r > m_ro) {
-    //    return 0.0;
-    //} else if (r > m_ri) {
-    //    const double t1 = M_PI/(m_ro - m_ri);
-    //    const double x = (r - m_ri)*t1;
-    //    return (1.0 + std::cos(x))/2.0;
-    //} else {
-    //    return 1.0;
-    //}
     return this->switch_function->eval(distances);
 }
 
-double Polynomial::eval(const std::vector<double>& distances) const {
-	double sum = 0;
-
-	std::vector<double> terms = this->eval_terms(distances);
-	std::vector<double> coefficients = this->get_coefficients();
-
-	for(int index = 0; index < terms.size(); index++)
-		sum += terms[index] * coefficients[index];
+double Polynomial::eval_switch(const double* distances) const {
+    return this->switch_function->eval(distances, this->nl_param_indices.size());
+}
 
-	return sum;
+double Polynomial::eval(const std::vector<double>& distances) const {
+	std::vector<double> scratch(this->get_scratch_size());
+	return this->eval(distances.data(), scratch.data());
 }
 
-std::vector<double> Polynomial::gradient(const std::vector<double>& coords, std::vector<double>& virial) const {
+double Polynomial::eval(const double* distances, double* scratch) const {
+	const std::size_t num_variables = this->nl_param_indices.size();
+	double* variables = scratch;
+	double* terms = scratch + num_variables;
 
-    std::vector<double> distances;
-    
-    for(int atom_index1 = 0; atom_index1 < coords.size() / 3; atom_index1++) {
-        for(int atom_index2 = atom_index1 + 1; atom_index2 < coords.size() / 3; atom_index2++) {
-            double x1 = coords[3*atom_index1];
-            double y1 = coords[3*atom_index1 + 1];
-            double z1 = coords[3*atom_index1 + 2];
-            double x2 = coords[3*atom_index2];
-            double y2 = coords[3*atom_index2 + 1];
-            double z2 = coords[3*atom_index2 + 2];
-            distances.push_back(std::sqrt(((x1 - x2) * (x1 - x2)) + ((y1 - y2) * (y1 - y2)) + ((z1 - z2) * (z1 - z2))));
-        }
-    }
+	this->eval_variables(distances, variables);
+	this->eval_terms_from_variables(variables, terms);
 
-    double** distance_gradients = new double* [distances.size()];
-    for(int i = 0; i < distances.size(); i++) {
-        distance_gradients[i] = new double[coords.size()];
-        for(int k = 0; k < coords.size(); k++) {
-            distance_gradients[i][k] = 0;
-        }
-    }
-    int distance_index = 0;
-    for(int atom_index1 = 0; atom_index1 < coords.size() / 3; atom_index1++) {
-        for(int atom_index2 = atom_index1 + 1; atom_index2 < coords.size() / 3; atom_index2++) {
-            double x1 = coords[3*atom_index1];
-            double y1 = coords[3*atom_index1 + 1];
-            double z1 = coords[3*atom_index1 + 2];
-            double x2 = coords[3*atom_index2];
-            double y2 = coords[3*atom_index2 + 1];
-            double z2 = coords[3*atom_index2 + 2];
-            distance_gradients[distance_index][atom_index1*3] = (x1-x2)/distances[distance_index];
-            distance_gradients[distance_index][atom_index1*3 + 1] = (y1-y2)/distances[distance_index];
-            distance_gradients[distance_index][atom_index1*3 + 2] = (z1-z2)/distances[distance_index];
-            distance_gradients[distance_index][atom_index2*3] = (x2-x1)/distances[distance_index];
-            distance_gradients[distance_index][atom_index2*3 + 1] = (y2-y1)/distances[distance_index];
-            distance_gradients[distance_index][atom_index2*3 + 2] = (z2-z1)/distances[distance_index];
-            distance_index++;
-        }
-    }
-    
+	double sum = 0;
+	for(int index = 0; index < this->coefficients.size(); index++)
+		sum += terms[index] * this->coefficients[index];
 
-    // Form of the gradient:
-    // dsw*V/dx = dsw/da * da/dr * dr/dx * V + sw * dV/dv * dv/dr * dr/dx
-    
-    // dsw/da * da/dr
-    std::vector<double> switch_gradients = this->switch_gradient(distances);
+	return sum;
+}
 
-    //dr/dx
-    // 1 / distances
+std::vector<double> Polynomial::polynomial_gradient(const std::vector<double>& variables) const {
+	std::vector<double> grad(variables.size());
+	this->polynomial_gradient(variables.data(), grad.data());
+	return grad;
+}
 
-    // V
-    double energy = this->eval(distances);
+std::vector<double> Polynomial::gradient(const std::vector<double>& coords, std::vector<double>& virial) const {
+    std::vector<double> gradients(coords.size(), 0);
+    std::vector<double> scratch(this->get_scratch_size());
 
-    // sw
-    double sw = this->eval_switch(distances);
+    for(int i = 0; i < 9; i++)
+        virial[i] = 0;
 
-    // dV/dv
-    std::vector<double> V_gradients = this->polynomial_gradient(this->eval_variables(distances));
+    this->eval_gradient(coords.data(), gradients.data(), virial.data(), scratch.data());
 
-    // dv/dr
-    std::vector<double> variable_gradients = this->variable_gradient(distances);
+    return gradients;
+}
 
-    // dsw*v/dx
-    std::vector<double> gradients(coords.size());
+std::size_t Polynomial::get_scratch_size() const {
+    // distances, variables, switch gradients, polynomial gradients and terms
+    return 4 * this->nl_param_indices.size() + this->coefficients.size();
+}
 
-    for(int i = 0; i < coords.size(); i++) {
-        double grad1 = 0;
-        for(int k = 0; k < distances.size(); k++) {
-            grad1 += switch_gradients[k] * distance_gradients[k][i];
+void Polynomial::eval_distances(const double* coords, double* distances) const {
+    const int num_atoms = this->system.get_num_atoms();
+    int distance_index = 0;
+    for(int atom_index1 = 0; atom_index1 < num_atoms; atom_index1++) {
+        for(int atom_index2 = atom_index1 + 1; atom_index2 < num_atoms; atom_index2++) {
+            const double dx = coords[3*atom_index1] - coords[3*atom_index2];
+            const double dy = coords[3*atom_index1 + 1] - coords[3*atom_index2 + 1];
+            const double dz = coords[3*atom_index1 + 2] - coords[3*atom_index2 + 2];
+            distances[distance_index++] = std::sqrt(dx*dx + dy*dy + dz*dz);
         }
+    }
+}
 
-        double grad2 = 0;
-        for(int k = 0; k < distances.size(); k++) {
-            grad2 += V_gradients[k] * variable_gradients[k] * distance_gradients[k][i];
-        }
-        
+double Polynomial::eval_energy(const double* coords, double* scratch) const {
+    const std::size_t num_variables = this->nl_param_indices.size();
+    double* distances = scratch;
 
-        double grad = grad1*energy + sw*grad2;
+    this->eval_distances(coords, distances);
 
-        gradients[i] = grad;
-    }
+    return this->eval(distances, scratch + num_variables) * this->eval_switch(distances);
+}
 
-    // calculate the virial
+double Polynomial::eval_gradient(const double* coords, double* gradients, double* virial, double* scratch) const {
+    const std::size_t num_variables = this->nl_param_indices.size();
+    double* distances = scratch;
+    double* variables = scratch + num_variables;
+    double* switch_gradients = scratch + 2*num_variables;
+    double* V_gradients = scratch + 3*num_variables;
 
-    virial[0] = 0;
-    virial[1] = 0;
-    virial[2] = 0;
-    virial[4] = 0;
-    virial[5] = 0;
-    virial[8] = 0;
-    for(int i = 0; i < coords.size() / 3; i++) {
+    this->eval_distances(coords, distances);
 
-        virial[0] -= coords[i*3 + 0] * gradients[i*3 + 0]; // x*2 component
-        virial[4] -= coords[i*3 + 1] * gradients[i*3 + 1]; // y*2 component
-        virial[8] -= coords[i*3 + 2] * gradients[i*3 + 2]; // z*2 component
+    // Form of the gradient:
+    // dsw*V/dx = dsw/da * da/dr * dr/dx * V + sw * dV/dv * dv/dr * dr/dx
 
-        virial[1] -= coords[i*3 + 0] * gradients[i*3 + 1]; // x*y component
-        virial[2] -= coords[i*3 + 0] * gradients[i*3 + 2]; // x*z component
-        virial[5] -= coords[i*3 + 1] * gradients[i*3 + 2]; // y*z component
-    }
+    // V and dV/dv in a single evaluation of the polynomial
+    this->eval_variables(distances, variables);
+    double energy;
+    this->polynomial_batch(1, 1, variables, &energy, V_gradients);
 
-    virial[3] = virial[1];
-    virial[6] = virial[2];
-    virial[7] = virial[5];
-    
+    // sw and dsw/da * da/dr in a single evaluation of the switch
+    double sw;
+    this->switch_function->eval_batch(1, 1, num_variables, distances, &sw, switch_gradients);
 
+    // dsw*V/dr. dv/dr is -k*v for the exp model.
+    const int num_atoms = this->system.get_num_atoms();
+    int distance_index = 0;
+    for(int atom_index1 = 0; atom_index1 < num_atoms; atom_index1++) {
+        for(int atom_index2 = atom_index1 + 1; atom_index2 < num_atoms; atom_index2++) {
+            const double k = this->nl_params[this->nl_param_indices[distance_index]];
+            const double dEdr = switch_gradients[distance_index]*energy
+                                - sw*V_gradients[distance_index]*k*variables[distance_index];
+
+            // dr/dx
+            const double dx = coords[3*atom_index1] - coords[3*atom_index2];
+            const double dy = coords[3*atom_index1 + 1] - coords[3*atom_index2 + 1];
+            const double dz = coords[3*atom_index1 + 2] - coords[3*atom_index2 + 2];
+            const double f = dEdr/distances[distance_index];
+
+            gradients[3*atom_index1] += f*dx;
+            gradients[3*atom_index1 + 1] += f*dy;
+            gradients[3*atom_index1 + 2] += f*dz;
+            gradients[3*atom_index2] -= f*dx;
+            gradients[3*atom_index2 + 1] -= f*dy;
+            gradients[3*atom_index2 + 2] -= f*dz;
+
+            // -sum(x*g) over the atoms is the same as -f*dx*dx over the pairs
+            if(virial != 0) {
+                virial[0] -= f*dx*dx;
+                virial[1] -= f*dx*dy;
+                virial[2] -= f*dx*dz;
+                virial[3] -= f*dx*dy;
+                virial[4] -= f*dy*dy;
+                virial[5] -= f*dy*dz;
+                virial[6] -= f*dx*dz;
+                virial[7] -= f*dy*dz;
+                virial[8] -= f*dz*dz;
+            }
 
-    for(int i = 0; i < distances.size(); i++) {
-        delete[] distance_gradients[i];
+            distance_index++;
+        }
     }
-    delete[] distance_gradients;
-
-    return gradients;
 
+    return energy*sw;
 }
+
 int Polynomial::get_nb() const{
   return this->switch_function->GetNb();
 }  
@@ -183,6 +190,18 @@ double Polynomial::get_ro() const{
   return this->switch_function->GetRo();
 }  
 
+int Polynomial::get_num_variables() const {
+    return this->nl_param_indices.size();
+}
+
+double Polynomial::get_variable_nl_param(int k) const {
+    return this->nl_params[this->nl_param_indices[k]];
+}
+
+const SwitchFunction& Polynomial::get_switch_function() const {
+    return *this->switch_function;
+}
+
 
 std::vector<double> Polynomial::variable_gradient(const std::vector<double>& distances) const {
 	std::vector<double> gradients;
@@ -197,27 +216,6 @@ std::vector<double> Polynomial::variable_gradient(const std::vector<double>& dis
 }
 
 std::vector<double> Polynomial::switch_gradient(const std::vector<double>& distances) const {
-    //std::vector<double> gradients(distances.size());
-
-    //double m_ri = 2;
-    //double m_ro = 5;
-
-    //double r = distances[0];
-    //if (r > m_ro) {
-    //    gradients[0] = 0;
-    //} else if (r > m_ri) {
-    //    const double t1 = M_PI/(m_ro - m_ri);
-    //    const double x = (r - m_ri)*t1;
-    //    gradients[0] = -M_PI*std::sin(x)/(2.0*(m_ro - m_ri));
-    //} else {
-    //    gradients[0] = 0;
-    //}
-
-
-    //for(int i = 1; i < distances.size(); i++) {
-    //    gradients[i] = 0;
-    //}
-
     return this->switch_function->gradient(distances);
 }
 
@@ -227,6 +225,7 @@ void Polynomial::set_nl_params(std::vector<double>& nl_params) {
 
 void Polynomial::set_coefficients(std::vector<double>& coefficients) {
 	this->coefficients = coefficients;
+	this->coefficients_float.assign(coefficients.begin(), coefficients.end());
 }
 
 const std::vector<double>& Polynomial::get_nl_params() const {
@@ -237,6 +236,10 @@ const std::vector<double>& Polynomial::get_coefficients() const {
 	return this->coefficients;
 }
 
+const std::vector<float>& Polynomial::get_coefficients_float() const {
+	return this->coefficients_float;
+}
+
 int Polynomial::get_num_coefficients() const {
     return this->coefficients.size();
 }
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <iostream>
+#include <cstddef>
 
 #include "LocalSystem.h"
 #include "SwitchFunction.h"
@@ -13,7 +14,7 @@ class Polynomial
 
         Polynomial(LocalSystem system, std::string name, int num_terms, int num_nl_params, std::vector<int> nl_param_indices, SwitchFunction* switch_function);
 
-        ~Polynomial();
+        virtual ~Polynomial();
         /*
         *
         * Evaluate each term of the polynomial with the given atomic distances.
@@ -24,7 +25,16 @@ class Polynomial
         */
         std::vector<double> eval_terms(const std::vector<double>& distances) const;
 
-        virtual std::vector<double> eval_terms_from_variables(const std::vector<double>& variables) const = 0;
+        std::vector<double> eval_terms_from_variables(const std::vector<double>& variables) const;
+
+        /*
+        * Evaluate each term of the polynomial with the given variables.
+        *
+        * @param variables The variables of the polynomial.
+        * @param terms Caller-owned array of get_num_coefficients() doubles
+        * where the terms are written.
+        */
+        virtual void eval_terms_from_variables(const double* variables, double* terms) const = 0;
 
         std::vector<double> eval_variables(const std::vector<double>& distances) const;
 
@@ -47,8 +57,104 @@ class Polynomial
 
         std::vector<double> gradient(const std::vector<double>& coords, std::vector<double>& virial) const;
 
-        virtual std::vector<double> polynomial_gradient(const std::vector<double>& variables) const = 0;
-        
+        std::vector<double> polynomial_gradient(const std::vector<double>& variables) const;
+
+        /*
+        * Evaluate the derivatives of the polynomial with respect to each
+        * variable.
+        *
+        * @param variables The variables of the polynomial.
+        * @param grad Caller-owned array of one double per variable where
+        * the derivatives are written.
+        */
+        virtual void polynomial_gradient(const double* variables, double* grad) const = 0;
+
+        /*
+        * Allocation-free evaluation. All the buffers are owned by the
+        * caller, and scratch must hold at least get_scratch_size() doubles.
+        * One scratch buffer can be reused for any number of calls, but not
+        * by two threads at the same time.
+        */
+
+        /*
+        * @return Number of doubles of the scratch buffer of the functions below.
+        */
+        std::size_t get_scratch_size() const;
+
+        /*
+        * Computes the distances between all pairs of atoms, in the order
+        * used by the polynomial.
+        *
+        * @param coords The coordinates of the atoms (3 per atom).
+        * @param distances Array of one double per variable.
+        */
+        void eval_distances(const double* coords, double* distances) const;
+
+        void eval_variables(const double* distances, double* variables) const;
+
+        double eval_switch(const double* distances) const;
+
+        /*
+        * Evaluate the polynomial (without switch) with the given atomic distances.
+        */
+        double eval(const double* distances, double* scratch) const;
+
+        /*
+        * Evaluate the switched polynomial for the given coordinates.
+        *
+        * @param coords The coordinates of the atoms (3 per atom).
+        *
+        * @return The value of the polynomial times the switch.
+        */
+        double eval_energy(const double* coords, double* scratch) const;
+
+        /*
+        * Evaluate the switched polynomial and its gradient for the given
+        * coordinates, in one pass.
+        *
+        * @param coords The coordinates of the atoms (3 per atom).
+        * @param gradients The gradients of the atoms (3 per atom). The
+        * gradients of the polynomial are added to them.
+        * @param virial Array of 9 doubles to which the virial of the
+        * polynomial is added, or 0.
+        *
+        * @return The value of the polynomial times the switch.
+        */
+        double eval_gradient(const double* coords, double* gradients, double* virial, double* scratch) const;
+
+        /*
+        * Evaluate the polynomial (without switch) and, optionally, its
+        * derivatives with respect to each variable, for n N-mers at once.
+        * Variable k of N-mer j is variables[k*stride + j], and its
+        * derivative is written in the same position of grad.
+        *
+        * @param values Array of n doubles with the values of the polynomial.
+        * @param grad Caller-owned array, or 0 to skip the derivatives.
+        */
+        virtual void polynomial_batch(std::size_t n, std::size_t stride, const double* variables, double* values, double* grad) const = 0;
+
+        /*
+        * Same as above, in single precision, with the coefficients rounded
+        * to float.
+        */
+        virtual void polynomial_batch(std::size_t n, std::size_t stride, const float* variables, float* values, float* grad) const = 0;
+
+        /*
+        * Arithmetic of the variables and the polynomial in the batched
+        * kernels (see NBodyKernel). With single_precision they are computed
+        * in float, and the distances, switch and sums of energies and
+        * gradients stay in double. The default is double_precision. It is
+        * selected by each System, not by the polynomial, which is shared
+        * (see ParamRegistry::PrecisionScope).
+        */
+        enum Precision { double_precision, single_precision };
+
+        /*
+        * Number of N-mers evaluated together by the batched kernels
+        * (see NBodyKernel).
+        */
+        static const std::size_t batch_size = 64;
+
         std::vector<double> variable_gradient(const std::vector<double>& distances) const;
         std::vector<double> switch_gradient(const std::vector<double>& distances) const;
 
@@ -80,6 +186,12 @@ class Polynomial
         */
         const std::vector<double>& get_coefficients() const;
 
+        /*
+        * Gets the coefficients rounded to float, for the single precision
+        * evaluation.
+        */
+        const std::vector<float>& get_coefficients_float() const;
+
         // TODO: add a get_num_coefficients() and get_num_nl_params() for efficiency's sake.
         int get_num_coefficients() const;
         int get_num_nl_params() const;
@@ -91,6 +203,19 @@ class Polynomial
         friend std::ostream& operator<<(std::ostream& os, const Polynomial& polynomial);
  	int get_nb() const;
 	double get_ro() const;
+
+        /*
+        * @return Number of variables, one per pair of atoms.
+        */
+        int get_num_variables() const;
+
+        /*
+        * @return Nonlinear parameter of the variable of pair k, the
+        * variable being exp(-nl_param*distance).
+        */
+        double get_variable_nl_param(int k) const;
+
+        const SwitchFunction& get_switch_function() const;
 	
    private:
 
@@ -98,6 +223,7 @@ class Polynomial
         std::vector<double> nl_params;
         std::vector<int> nl_param_indices;
         std::vector<double> coefficients;
+        std::vector<float> coefficients_float;
         std::string name;
         SwitchFunction* switch_function;
 
@@ -1,14 +1,74 @@
 #pragma once
 #include <vector>
+#include <cstddef>
+#include <cassert>
 
 class SwitchFunction
 {
 
     public:
 
-        virtual double eval(const std::vector<double>& distances) const = 0;
-        virtual std::vector<double> gradient(const std::vector<double>& distanes) const = 0;
+        virtual ~SwitchFunction() {}
+
+        /*
+        * Evaluate the switch function without allocating memory.
+        *
+        * @param distances The n atomic distances.
+        * @param n Number of distances.
+        *
+        * @return The value of the switch function.
+        */
+        virtual double eval(const double* distances, std::size_t n) const = 0;
+
+        /*
+        * Evaluate the derivatives of the switch function with respect to
+        * each distance, without allocating memory.
+        *
+        * @param distances The n atomic distances.
+        * @param n Number of distances.
+        * @param gradients Caller-owned array of n doubles where the
+        * derivatives are written.
+        */
+        virtual void gradient(const double* distances, std::size_t n, double* gradients) const = 0;
+
+        double eval(const std::vector<double>& distances) const {
+            return this->eval(distances.data(), distances.size());
+        }
+
+        std::vector<double> gradient(const std::vector<double>& distances) const {
+            std::vector<double> gradients(distances.size());
+            this->gradient(distances.data(), distances.size(), gradients.data());
+            return gradients;
+        }
+
+        /*
+        * Evaluate the switch function and its derivatives for n N-mers at
+        * once. Distance k of N-mer j is distances[k*stride + j], and its
+        * derivative is written in the same position of gradients.
+        *
+        * @param gradients Caller-owned array, or 0 to skip the derivatives.
+        */
+        virtual void eval_batch(std::size_t n, std::size_t stride, std::size_t num_distances, const double* distances,
+                                double* values, double* gradients) const {
+            assert(num_distances <= max_distances);
+            double lane_distances[max_distances];
+            double lane_gradients[max_distances];
+            for(std::size_t j = 0; j < n; j++) {
+                for(std::size_t k = 0; k < num_distances; k++)
+                    lane_distances[k] = distances[k*stride + j];
+                values[j] = this->eval(lane_distances, num_distances);
+                if(gradients == 0) continue;
+                this->gradient(lane_distances, num_distances, lane_gradients);
+                for(std::size_t k = 0; k < num_distances; k++)
+                    gradients[k*stride + j] = lane_gradients[k];
+            }
+        }
+
 	virtual double GetRo()const =0;
 	virtual int GetNb()const =0;
+
+        // Largest number of distances (6 monomers). The switches work in
+        // stack buffers of this size; Polynomial checks it on construction.
+        static const std::size_t max_distances = 15;
  
 };
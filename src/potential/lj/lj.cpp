@@ -150,6 +150,7 @@ void LennardJones::Initialize(const std::vector<double> sys_ljchg, const std::ve
 
     user_fft_grid_ = std::vector<int>{};
 
+    CompileMonomerTypes();
     ReorderData();
 
 #ifdef DEBUG
@@ -177,7 +178,10 @@ void LennardJones::Initialize(const std::vector<double> sys_ljchg, const std::ve
 }
 
 void LennardJones::SetJsonLennardJones(nlohmann::json repdisp_j) { repdisp_j_ = repdisp_j; }
-void LennardJones::SetJsonMonomers(nlohmann::json mon_j) { mon_j_ = mon_j; }
+void LennardJones::SetJsonMonomers(nlohmann::json mon_j) {
+    mon_j_ = mon_j;
+    CompileMonomerTypes();
+}
 
 nlohmann::json LennardJones::GetJsonLennardJones() { return repdisp_j_; }
 nlohmann::json LennardJones::GetJsonMonomers() { return mon_j_; }
@@ -246,6 +250,30 @@ void LennardJones::SetBoxPMElocal(std::vector<double> box) {
     box_ABCabc_PMElocal_ = box.size() ? BoxVecToBoxABCabc(box) : std::vector<double>{};
 }
 
+void LennardJones::SetMonomerTypes(std::shared_ptr<const bblock::MonomerTypeTable> mon_types) {
+    sys_mon_types_ = mon_types;
+}
+
+void LennardJones::CompileMonomerTypes() {
+    // Inside a System, the types compiled by the System are used
+    if (sys_mon_types_) {
+        mon_types_ = sys_mon_types_;
+        return;
+    }
+
+    std::vector<std::string> ids;
+    std::vector<size_t> nsites;
+    size_t fi_mon = 0;
+    for (size_t mt = 0; mt < mon_type_count_.size(); mt++) {
+        ids.push_back(mon_type_count_[mt].first);
+        nsites.push_back(num_atoms_[fi_mon]);
+        fi_mon += mon_type_count_[mt].second;
+    }
+    std::shared_ptr<bblock::MonomerTypeTable> mon_types(new bblock::MonomerTypeTable());
+    mon_types->Compile(ids, nsites, mon_j_);
+    mon_types_ = mon_types;
+}
+
 void LennardJones::ReorderData() {
     // Organize xyz so we have
     // x1_1 x1_2 ... y1_1 y1_2... z1_1 z1_2 ... x2_1 x2_2 ...
@@ -482,6 +510,12 @@ double LennardJones::GetLennardJonesPMElocal(std::vector<double> &grad, std::vec
     return lj_energy_;
 }
 
+helpme::PMEInstance<double> &LennardJones::GetPMESolver(double A, double B, double C, double alpha, double beta,
+                                                        double gamma, bool parallel) {
+    return pme_solver_.Get(6, -1.0, ewald_alpha_, pme_spline_order_, pme_grid_density_, user_fft_grid_, parallel,
+                           world_, proc_grid_x_, proc_grid_y_, proc_grid_z_, A, B, C, alpha, beta, gamma);
+}
+
 void LennardJones::CalculateLennardJones(bool use_ghost) {
     lj_energy_ = 0.0;
     std::fill(phi_.begin(), phi_.end(), 0.0);
@@ -503,11 +537,6 @@ void LennardJones::CalculateLennardJones(bool use_ghost) {
     size_t fi_crd = 0;
     size_t fi_sites = 0;
 
-    // Excluded sets
-    excluded_set_type exc12;
-    excluded_set_type exc13;
-    excluded_set_type exc14;
-
     // Loop over each monomer type
     for (size_t mt = 0; mt < mon_type_count_.size(); mt++) {
         size_t ns = num_atoms_[fi_mon];
@@ -518,9 +547,6 @@ void LennardJones::CalculateLennardJones(bool use_ghost) {
 
         std::vector<double> xyz_mt(xyz_.begin() + fi_crd, xyz_.begin() + fi_crd + nmon * ns * 3);
 
-        // Obtain excluded pairs for monomer type mt
-        systools::GetExcluded(mon_id_[fi_mon], mon_j_, exc12, exc13, exc14);
-
         // For parallel region
         std::vector<std::vector<double> > phi_pool;
         std::vector<std::vector<double> > grad_pool;
@@ -538,9 +564,10 @@ void LennardJones::CalculateLennardJones(bool use_ghost) {
             size_t inmon3 = inmon * 3;
             for (size_t j = i + 1; j < ns; j++) {
                 // Continue only if i and j are not bonded
-                bool is12 = systools::IsExcluded(exc12, i, j);
-                bool is13 = systools::IsExcluded(exc13, i, j);
-                bool is14 = systools::IsExcluded(exc14, i, j);
+                unsigned char exc = mon_types_->GetExclusion(mt, i, j);
+                bool is12 = exc & bblock::EXCLUDED_12;
+                bool is13 = exc & bblock::EXCLUDED_13;
+                bool is14 = exc & bblock::EXCLUDED_14;
                 double lj_scale_factor = (is12 || is13 || is14 || !do_lj) ? 0 : 1;
                 double sigma, eps;
                 double ljchgi = lj_long_range_[fi_sites + i * nmon];
@@ -722,8 +749,6 @@ void LennardJones::CalculateLennardJones(bool use_ghost) {
     }
 
     if (ewald_alpha_ > 0 && use_pbc_) {
-        helpme::PMEInstance<double> pme_solver_;
-        if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
         // Compute the reciprocal space terms, using PME
         double A = box_ABCabc_[0];
         double B = box_ABCabc_[1];
@@ -732,11 +757,7 @@ void LennardJones::CalculateLennardJones(bool use_ghost) {
         double beta = box_ABCabc_[4];
         double gamma = box_ABCabc_[5];
 
-        int grid_A = pme_grid_density_ * A;
-        int grid_B = pme_grid_density_ * B;
-        int grid_C = pme_grid_density_ * C;
-        pme_solver_.setup(6, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, -1, 0);
-        pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+        helpme::PMEInstance<double> &pme_solver = GetPMESolver(A, B, C, alpha, beta, gamma, false);
         // N.B. these do not make copies; they just wrap the memory with some metadata
         auto coords = helpme::Matrix<double>(sys_xyz_.data(), natoms_, 3);
         auto params = helpme::Matrix<double>(sys_lj_long_range_.data(), natoms_, 1);
@@ -744,7 +765,7 @@ void LennardJones::CalculateLennardJones(bool use_ghost) {
         std::vector<double> dummy_6vec(6, 0.0);
         auto rec_virial = helpme::Matrix<double>(dummy_6vec.data(), 6, 1);
         std::fill(sys_grad_.begin(), sys_grad_.end(), 0);
-        double rec_energy = pme_solver_.computeEFVRec(0, params, coords, forces, rec_virial);
+        double rec_energy = pme_solver.computeEFVRec(0, params, coords, forces, rec_virial);
 
         // get virial
         if (calc_virial_) {
@@ -817,8 +838,6 @@ void LennardJones::CalculateLennardJonesPME(bool use_ghost) {
     if (!compute_pme && use_ghost && ewald_alpha_ > 0) compute_pme = true;
 
     if (compute_pme) {
-        helpme::PMEInstance<double> pme_solver_;
-        if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
         // Compute the reciprocal space terms, using PME
         double A = box_ABCabc_[0];
         double B = box_ABCabc_[1];
@@ -827,18 +846,7 @@ void LennardJones::CalculateLennardJonesPME(bool use_ghost) {
         double beta = box_ABCabc_[4];
         double gamma = box_ABCabc_[5];
 
-        int grid_A = pme_grid_density_ * A;
-        int grid_B = pme_grid_density_ * B;
-        int grid_C = pme_grid_density_ * C;
-
-        if (mpi_initialized_) {
-            pme_solver_.setupParallel(6, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, -1, 0, world_,
-                                      PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
-        } else {
-            pme_solver_.setup(6, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, -1, 0);
-        }
-
-        pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+        helpme::PMEInstance<double> &pme_solver = GetPMESolver(A, B, C, alpha, beta, gamma, mpi_initialized_);
 
         // N.B. these do not make copies; they just wrap the memory with some metadata
         auto coords = helpme::Matrix<double>(sys_xyz_.data(), natoms_, 3);
@@ -849,7 +857,7 @@ void LennardJones::CalculateLennardJonesPME(bool use_ghost) {
         std::vector<double> dummy_6vec(6, 0.0);
         auto rec_virial = helpme::Matrix<double>(dummy_6vec.data(), 6, 1);
         std::fill(sys_grad_.begin(), sys_grad_.end(), 0);
-        double rec_energy = pme_solver_.computeEFVRec(0, params, coords, forces, rec_virial);
+        double rec_energy = pme_solver.computeEFVRec(0, params, coords, forces, rec_virial);
 
         const int num_procs = proc_grid_x_ * proc_grid_y_ * proc_grid_z_;
 
@@ -933,8 +941,6 @@ void LennardJones::CalculateLennardJonesPMElocal(bool use_ghost) {
     //    if(!compute_pme && use_ghost && ewald_alpha_ > 0) compute_pme = true;
 
     //    if (compute_pme) {
-    helpme::PMEInstance<double> pme_solver_;
-    if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
     // Compute the reciprocal space terms, using PME
     double A = box_ABCabc_PMElocal_[0];
     double B = box_ABCabc_PMElocal_[1];
@@ -943,18 +949,7 @@ void LennardJones::CalculateLennardJonesPMElocal(bool use_ghost) {
     double beta = box_ABCabc_PMElocal_[4];
     double gamma = box_ABCabc_PMElocal_[5];
 
-    int grid_A = pme_grid_density_ * A;
-    int grid_B = pme_grid_density_ * B;
-    int grid_C = pme_grid_density_ * C;
-
-    if (mpi_initialized_) {
-        pme_solver_.setupParallel(6, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, -1, 0, world_,
-                                  PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
-    } else {
-        pme_solver_.setup(6, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, -1, 0);
-    }
-
-    pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+    helpme::PMEInstance<double> &pme_solver = GetPMESolver(A, B, C, alpha, beta, gamma, mpi_initialized_);
 
     // N.B. these do not make copies; they just wrap the memory with some metadata
     auto coords = helpme::Matrix<double>(sys_xyz_.data(), natoms_, 3);
@@ -1013,7 +1008,7 @@ void LennardJones::CalculateLennardJonesPMElocal(bool use_ghost) {
     std::vector<double> dummy_6vec(6, 0.0);
     auto rec_virial = helpme::Matrix<double>(dummy_6vec.data(), 6, 1);
     std::fill(sys_grad_.begin(), sys_grad_.end(), 0);
-    double rec_energy = pme_solver_.computeEFVRec(0, params, coords, forces, rec_virial);
+    double rec_energy = pme_solver.computeEFVRec(0, params, coords, forces, rec_virial);
 
     // get virial
     if (calc_virial_) {
@@ -1095,18 +1090,18 @@ std::vector<int> LennardJones::GetFFTDimension(int box_id) {
         int grid_B = pme_grid_density_ * B;
         int grid_C = pme_grid_density_ * C;
 
-        helpme::PMEInstance<double> pme_solver_;
-        if (user_fft_grid_.size()) pme_solver_.SetFFTDimension(user_fft_grid_);
+        helpme::PMEInstance<double> pme_solver;
+        if (user_fft_grid_.size()) pme_solver.SetFFTDimension(user_fft_grid_);
 
         if (mpi_initialized_) {
-            pme_solver_.setupParallel(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0, world_,
-                                      PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
+            pme_solver.setupParallel(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0, world_,
+                                     PMEInstanceD::NodeOrder::ZYX, proc_grid_x_, proc_grid_y_, proc_grid_z_);
         } else {
-            pme_solver_.setup(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0);
+            pme_solver.setup(1, ewald_alpha_, pme_spline_order_, grid_A, grid_B, grid_C, 1, 0);
         }
-        pme_solver_.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
+        pme_solver.setLatticeVectors(A, B, C, alpha, beta, gamma, PMEInstanceD::LatticeType::XAligned);
 
-        fft_grid = pme_solver_.GetFFTDimension();
+        fft_grid = pme_solver.GetFFTDimension();
     }
 
     return fft_grid;
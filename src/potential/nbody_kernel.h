@@ -0,0 +1,240 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#ifndef NBODY_KERNEL_H
+#define NBODY_KERNEL_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/**
+ * @file nbody_kernel.h
+ * @brief Common interface of the 2b, 3b and 4b energy kernels
+ */
+
+/**
+ * @namespace nbody
+ * @brief Sets the namespace for the tools shared by the N-body energy calls
+ */
+namespace nbody {
+
+/**
+ * @brief Largest number of monomers of an N-mer that a kernel can evaluate
+ */
+const size_t max_nb = 5;
+
+/**
+ * @brief Kernel of an N-body potential.
+ *
+ * A kernel evaluates nm N-mers of the same monomer types, given in
+ * canonical order (monomer ids sorted alphabetically).
+ * @param[in] mon Monomer ids of the N-mer, in canonical order
+ * @param[in] nm Number of N-mers
+ * @param[in] xyz Coordinates of each monomer of the N-mer (N pointers)
+ * @param[in,out] grad Gradients of each monomer of the N-mer (N pointers).
+ * If it is 0, the gradients are not computed.
+ * @param[in,out] virial Virial tensor. Only used if grad is not 0.
+ * @return Sum of the N-body energies of all the N-mers
+ */
+typedef double (*Kernel)(const std::string *mon, size_t nm, const double *const *xyz, double *const *grad,
+                         std::vector<double> *virial);
+
+/**
+ * @brief Region of the N-mers where a kernel can be nonzero.
+ *
+ * The energy of an N-mer is exactly zero if fewer than min_pairs of the
+ * distances between the first sites of its monomers are shorter than ro.
+ * A min_pairs of 0 means that the kernel is not bounded.
+ */
+struct Support {
+    /**
+     * Distance beyond which a pair of monomers does not contribute
+     */
+    double ro;
+
+    /**
+     * Number of pairs closer than ro needed for a nonzero energy
+     */
+    size_t min_pairs;
+};
+
+/**
+ * @brief Function that returns the support of a kernel
+ */
+typedef Support (*SupportQuery)();
+
+/**
+ * @brief Support of a potential multiplied by a coarse grain switch.
+ *
+ * The switch is zero when fewer than nb-1 of the distances of the N-mer
+ * are shorter than ro, so the support is {ro, nb-1}.
+ * @tparam Pot Type of the potential. It must have get_ro() and get_nb().
+ * @tparam get_pot Function that returns the potential
+ * @return Support of the potential
+ */
+template <class Pot, const Pot &(*get_pot)()>
+Support SwitchedSupport() {
+    const Pot &pot = get_pot();
+    Support support = {pot.get_ro(), static_cast<size_t>(pot.get_nb() - 1)};
+    return support;
+}
+
+/**
+ * @brief Entry of the table of kernels of an N-body term
+ */
+struct Registration {
+    /**
+     * Monomer ids, in canonical order. Unused positions are 0.
+     */
+    const char *mon[max_nb];
+
+    /**
+     * Kernel for these monomers
+     */
+    Kernel kernel;
+
+    /**
+     * Support of the kernel, or 0 if it is not bounded
+     */
+    SupportQuery support;
+};
+
+/**
+ * @brief Finds the entry registered for an N-mer
+ * @param[in] table Table of kernels
+ * @param[in] ntable Number of entries in the table
+ * @param[in] nb Number of monomers of the N-mer
+ * @param[in] mon Monomer ids, in canonical order
+ * @return The entry, or 0 if there is none registered for these monomers
+ */
+inline const Registration *FindRegistration(const Registration *table, size_t ntable, size_t nb,
+                                            const std::string *mon) {
+    for (size_t i = 0; i < ntable; i++) {
+        bool match = true;
+        for (size_t k = 0; k < nb && match; k++) match = mon[k] == table[i].mon[k];
+        if (match) return table + i;
+    }
+    return 0;
+}
+
+/**
+ * @brief Finds the kernel registered for an N-mer
+ * @param[in] table Table of kernels
+ * @param[in] ntable Number of entries in the table
+ * @param[in] nb Number of monomers of the N-mer
+ * @param[in] mon Monomer ids, in canonical order
+ * @return The kernel, or 0 if there is none registered for these monomers
+ */
+inline Kernel FindKernel(const Registration *table, size_t ntable, size_t nb, const std::string *mon) {
+    const Registration *entry = FindRegistration(table, ntable, nb, mon);
+    return entry == 0 ? 0 : entry->kernel;
+}
+
+/**
+ * @brief Finds the support of the kernel registered for an N-mer
+ * @param[in] table Table of kernels
+ * @param[in] ntable Number of entries in the table
+ * @param[in] nb Number of monomers of the N-mer
+ * @param[in] mon Monomer ids, in canonical order
+ * @return The support of the kernel. min_pairs is 0 if there is no kernel
+ * or if it is not bounded.
+ */
+inline Support FindSupport(const Registration *table, size_t ntable, size_t nb, const std::string *mon) {
+    const Registration *entry = FindRegistration(table, ntable, nb, mon);
+    if (entry == 0 || entry->support == 0) {
+        Support unbounded = {0.0, 0};
+        return unbounded;
+    }
+    return entry->support();
+}
+
+/**
+ * @brief Gets the canonical order of the monomers of an N-mer
+ *
+ * Sorts the monomer ids alphabetically. Monomers with the same id keep
+ * their relative order.
+ * @param[in] nb Number of monomers of the N-mer
+ * @param[in] mon Monomer ids
+ * @param[out] perm perm[k] is the position in mon of the k-th monomer
+ * in canonical order
+ */
+inline void GetCanonicalOrder(size_t nb, const std::string *mon, size_t *perm) {
+    for (size_t k = 0; k < nb; k++) perm[k] = k;
+    // Insertion sort, N is at most max_nb
+    for (size_t k = 1; k < nb; k++) {
+        size_t p = perm[k];
+        size_t j = k;
+        for (; j > 0 && mon[p] < mon[perm[j - 1]]; j--) perm[j] = perm[j - 1];
+        perm[j] = p;
+    }
+}
+
+/**
+ * @brief Evaluates nm N-mers given in any order of their monomers.
+ *
+ * Puts the monomers in canonical order, looks up the kernel and
+ * calls it. The gradients are returned in the original order.
+ * @param[in] nb Number of monomers of the N-mer (at most max_nb)
+ * @param[in] lookup Function that returns the kernel of canonical monomer ids
+ * @param[in] mon Monomer ids of the N-mer
+ * @param[in] nm Number of N-mers
+ * @param[in] xyz Coordinates of each monomer of the N-mer
+ * @param[in,out] grad Gradients of each monomer of the N-mer, or 0
+ * @param[in,out] virial Virial tensor
+ * @return Sum of the N-body energies, or 0 if there is no kernel for these monomers
+ */
+inline double Evaluate(size_t nb, Kernel (*lookup)(const std::string *), const std::string *mon, size_t nm,
+                       const double *const *xyz, double *const *grad, std::vector<double> *virial) {
+    size_t perm[max_nb];
+    GetCanonicalOrder(nb, mon, perm);
+
+    std::string cmon[max_nb];
+    const double *cxyz[max_nb];
+    double *cgrad[max_nb];
+    for (size_t k = 0; k < nb; k++) {
+        cmon[k] = mon[perm[k]];
+        cxyz[k] = xyz[perm[k]];
+        cgrad[k] = grad == 0 ? 0 : grad[perm[k]];
+    }
+
+    Kernel kernel = lookup(cmon);
+    if (kernel == 0) return 0.0;
+
+    return kernel(cmon, nm, cxyz, grad == 0 ? 0 : cgrad, virial);
+}
+
+}  // namespace nbody
+
+#endif  // NBODY_KERNEL_H
@@ -0,0 +1,211 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#include "Catch2/single_include/catch.hpp"
+#include "testutils.h"
+
+#include "bblock/neighbor_list.h"
+#include "bblock/system.h"
+#include "tools/math_tools.h"
+#include "setup_h2o_256_pbc.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+constexpr double TOL = 1E-10;
+
+// Cutoff and skin of the clusters
+constexpr double CUTOFF = 4.5;
+constexpr double SKIN = 1.0;
+
+namespace {
+
+// Moves every water rigidly by a random displacement of length disp
+void MoveMonomers(std::vector<double> &coords, size_t n_monomers, size_t n_at, double disp, std::mt19937 &gen) {
+    std::normal_distribution<double> normal(0.0, 1.0);
+    for (size_t i = 0; i < n_monomers; i++) {
+        double d[3] = {normal(gen), normal(gen), normal(gen)};
+        double norm = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+        for (size_t a = 0; a < n_at; a++) {
+            for (size_t k = 0; k < 3; k++) coords[3 * (n_at * i + a) + k] += disp * d[k] / norm;
+        }
+    }
+}
+
+// Clusters of size n of all the roots, with the tuples sorted
+std::vector<std::vector<size_t>> SortClusters(const std::vector<size_t> &clusters, size_t n) {
+    std::vector<std::vector<size_t>> sorted;
+    for (size_t c = 0; c < clusters.size(); c += n) sorted.emplace_back(clusters.begin() + c, clusters.begin() + c + n);
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
+}
+
+// Checks that the clusters cached with a skin are the ones of a list built
+// without skin for the current coordinates
+void CheckClusters(bblock::NeighborList &skin_list, std::vector<bblock::ClusterList> &cluster_lists,
+                   const std::vector<double> &coords, const std::vector<size_t> &first_index, size_t n_monomers,
+                   bool use_pbc, const std::vector<double> &box) {
+    std::vector<double> box_inverse = use_pbc ? InvertUnitCell(box) : std::vector<double>{};
+    bblock::NeighborList ref_list;
+    ref_list.Build(coords, first_index, n_monomers, CUTOFF, 0.0, use_pbc, box, box_inverse);
+
+    std::vector<size_t> is_local(n_monomers, 1);
+    for (size_t n = 2; n <= 4; n++) {
+        std::vector<size_t> ref_clusters;
+        std::vector<size_t> skin_clusters;
+        bblock::SubgraphEnumerator enumerator;
+        for (size_t i = 0; i < n_monomers; i++) {
+            ref_list.GetClusters(n, CUTOFF, i, is_local, false, ref_clusters);
+            cluster_lists[n - 2].GetClusters(skin_list, i, is_local, enumerator, skin_clusters);
+        }
+        REQUIRE(ref_clusters.size() > 0);
+        REQUIRE(SortClusters(skin_clusters, n) == SortClusters(ref_clusters, n));
+    }
+
+    // Refreshed distances of the pairs within the cutoff
+    for (size_t i = 0; i < n_monomers; i++) {
+        for (size_t p = 0; p < ref_list.GetNumNeighbors(i); p++) {
+            size_t j = ref_list.GetNeighbors(i)[p];
+            if (ref_list.GetDistances2(i)[p] >= CUTOFF * CUTOFF) continue;
+            REQUIRE(skin_list.GetDistance2(i, j) == Approx(ref_list.GetDistances2(i)[p]).margin(TOL));
+        }
+    }
+}
+
+void RunNeighborListTest(bool use_pbc) {
+    SETUP_H2O_256_PBC
+    if (!use_pbc) box.clear();
+    std::vector<double> box_inverse = use_pbc ? InvertUnitCell(box) : std::vector<double>{};
+    std::vector<size_t> first_index(n_monomers);
+    for (size_t i = 0; i < n_monomers; i++) first_index[i] = n_at * i;
+    std::mt19937 gen(12345);
+
+    bblock::NeighborList skin_list;
+    skin_list.Build(coords, first_index, n_monomers, CUTOFF, SKIN, use_pbc, box, box_inverse);
+    size_t build = skin_list.GetBuildCount();
+    std::vector<bblock::ClusterList> cluster_lists(3);
+    for (size_t n = 2; n <= 4; n++) cluster_lists[n - 2].Reset(n_monomers, n, CUTOFF, false, build);
+
+    CheckClusters(skin_list, cluster_lists, coords, first_index, n_monomers, use_pbc, box);
+
+    // Two moves of 0.2, less than skin/2 in total from the build
+    for (size_t step = 0; step < 2; step++) {
+        MoveMonomers(coords, n_monomers, n_at, 0.2, gen);
+        REQUIRE(skin_list.IsValid(coords, first_index, n_monomers, CUTOFF, SKIN, use_pbc, box));
+        skin_list.Refresh(coords, first_index);
+        REQUIRE(skin_list.GetBuildCount() == build);
+        for (size_t n = 2; n <= 4; n++) REQUIRE(cluster_lists[n - 2].IsValid(n, CUTOFF, false, build));
+        CheckClusters(skin_list, cluster_lists, coords, first_index, n_monomers, use_pbc, box);
+    }
+
+    // One more move of 0.6 is more than skin/2 from the build
+    MoveMonomers(coords, n_monomers, n_at, 0.6, gen);
+    REQUIRE_FALSE(skin_list.IsValid(coords, first_index, n_monomers, CUTOFF, SKIN, use_pbc, box));
+    skin_list.Build(coords, first_index, n_monomers, CUTOFF, SKIN, use_pbc, box, box_inverse);
+    REQUIRE(skin_list.GetBuildCount() == build + 1);
+    for (size_t n = 2; n <= 4; n++) {
+        REQUIRE_FALSE(cluster_lists[n - 2].IsValid(n, CUTOFF, false, skin_list.GetBuildCount()));
+        cluster_lists[n - 2].Reset(n_monomers, n, CUTOFF, false, skin_list.GetBuildCount());
+    }
+    CheckClusters(skin_list, cluster_lists, coords, first_index, n_monomers, use_pbc, box);
+}
+
+// Creates a water system with the given cluster skin
+void SetUpSystem(bblock::System &system, const std::vector<double> &coords, const std::vector<std::string> &atoms,
+                 size_t n_monomers, size_t n_at, const std::vector<double> &box, double skin) {
+    for (size_t i = 0; i < n_monomers; i++) {
+        std::vector<double> xyz(coords.begin() + 3 * n_at * i, coords.begin() + 3 * n_at * (i + 1));
+        std::vector<std::string> ats(atoms.begin() + n_at * i, atoms.begin() + n_at * (i + 1));
+        system.AddMonomer(xyz, ats, "h2o");
+    }
+
+    std::string json = "{\"MBX\" : {\"box\" : [";
+    for (size_t k = 0; k < box.size(); k++) json += (k ? ", " : "") + std::to_string(box[k]);
+    json += "], \"twobody_cutoff\" : 6.0, \"threebody_cutoff\" : " + std::to_string(CUTOFF) +
+            ", \"cluster_skin\" : " + std::to_string(skin) + "}}";
+    system.SetUpFromJson(json);
+}
+
+// Checks the 2b and 3b energies and gradients of a system against a system without skin
+void CheckEnergies(bblock::System &system, bblock::System &reference) {
+    double e2b = system.TwoBodyEnergy(true);
+    std::vector<double> grad2b = system.GetRealGrads();
+    double e2b_ref = reference.TwoBodyEnergy(true);
+    std::vector<double> grad2b_ref = reference.GetRealGrads();
+    REQUIRE(e2b == Approx(e2b_ref).margin(TOL));
+    REQUIRE(VectorsAreEqual(grad2b, grad2b_ref, TOL));
+
+    double e3b = system.ThreeBodyEnergy(true);
+    std::vector<double> grad3b = system.GetRealGrads();
+    double e3b_ref = reference.ThreeBodyEnergy(true);
+    std::vector<double> grad3b_ref = reference.GetRealGrads();
+    REQUIRE(e3b == Approx(e3b_ref).margin(TOL));
+    REQUIRE(VectorsAreEqual(grad3b, grad3b_ref, TOL));
+}
+
+void RunSystemTest(bool use_pbc) {
+    SETUP_H2O_256_PBC
+    if (!use_pbc) box.clear();
+    std::mt19937 gen(12345);
+
+    bblock::System system;
+    SetUpSystem(system, coords, atom_names, n_monomers, n_at, box, SKIN);
+    bblock::System reference;
+    SetUpSystem(reference, coords, atom_names, n_monomers, n_at, box, 0.0);
+    CheckEnergies(system, reference);
+
+    // Moves of 0.2 (the cluster lists are kept) and of 0.6 (they are rebuilt)
+    const double disp[3] = {0.2, 0.2, 0.6};
+    for (size_t step = 0; step < 3; step++) {
+        MoveMonomers(coords, n_monomers, n_at, disp[step], gen);
+        system.SetRealXyz(coords);
+        reference.SetRealXyz(coords);
+        CheckEnergies(system, reference);
+    }
+}
+
+}  // namespace
+
+TEST_CASE("Test the neighbor list and the cluster lists with a skin") {
+    SECTION("Gas phase") { RunNeighborListTest(false); }
+    SECTION("PBC") { RunNeighborListTest(true); }
+}
+
+TEST_CASE("Test the N-body energies with a cluster skin") {
+    SECTION("Gas phase") { RunSystemTest(false); }
+    SECTION("PBC") { RunSystemTest(true); }
+}
@@ -0,0 +1,135 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#include "Catch2/single_include/catch.hpp"
+
+#include "potential/electrostatics/electrostatics.h"
+#include "setup_h2o_216.h"
+
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+
+constexpr double TOL = 1E-10;
+
+void run_test(const char *method, const std::vector<double> &box_vectors) {
+    // TIP3P test
+    double qO = -0.834;
+    double qH = 0.417;
+    double qM = 0;
+    double polfacO = 1.310;
+    double polfacH = 0.294;
+    double polfacM = 0;
+    SETUP_H2O_216
+    std::vector<int> atom_tag(n_atoms);
+    std::iota(atom_tag.begin(), atom_tag.end(), 1);
+
+    bool use_pbc = box_vectors.size();
+    double cutoff = use_pbc ? 9 : 100;
+    double alpha = use_pbc ? 0.3 : 0;
+
+    // Energy and forces of the configuration, with the tensors kept in at most cache_mb MB
+    auto compute = [&](elec::Electrostatics &elec, double cache_mb, std::vector<double> &forces) {
+        elec.Initialize(charges, chg_grad, polfac, pol, coords, monomer_names, sites, first_ind, mon_type_count,
+                        islocal, atom_tag, true, 1E-16, 100, method, box_vectors);
+        elec.SetCutoff(cutoff);
+        elec.SetEwaldAlpha(alpha);
+        elec.SetEwaldGridDensity(2.5);
+        elec.SetEwaldSplineOrder(6);
+        elec.SetDipoleTensorCache(cache_mb);
+        return elec.GetElectrostatics(forces);
+    };
+
+    elec::Electrostatics elec_ref;
+    std::vector<double> forces_ref(3 * n_atoms);
+    double energy_ref = compute(elec_ref, 0, forces_ref);
+
+    std::cout << method << (use_pbc ? " (PBC):" : " (GAS):") << std::endl;
+    std::cout << "No cache:    " << std::setw(20) << std::setprecision(12) << energy_ref << std::endl;
+
+    elec::Electrostatics elec_cached;
+    std::vector<double> forces_cached(3 * n_atoms);
+    double energy_cached = compute(elec_cached, 1000, forces_cached);
+    std::cout << "Cache:       " << std::setw(20) << std::setprecision(12) << energy_cached << std::endl;
+    REQUIRE(energy_cached == Approx(energy_ref).epsilon(TOL));
+    for (int n = 0; n < 3 * n_atoms; ++n) REQUIRE(forces_cached[n] == Approx(forces_ref[n]).margin(TOL));
+
+    // The tensors do not fit in 10 kB, so they are recomputed in every iteration
+    elec::Electrostatics elec_small;
+    std::vector<double> forces_small(3 * n_atoms);
+    double energy_small = compute(elec_small, 0.01, forces_small);
+    std::cout << "Small cache: " << std::setw(20) << std::setprecision(12) << energy_small << std::endl;
+    REQUIRE(energy_small == Approx(energy_ref).epsilon(TOL));
+    for (int n = 0; n < 3 * n_atoms; ++n) REQUIRE(forces_small[n] == Approx(forces_ref[n]).margin(TOL));
+
+    // New coordinates, and in PBC a new box and alpha, on the object that already
+    // holds the tensors: they have to be recomputed
+    for (size_t i = 0; i < coords.size(); i++) coords[i] *= 1.01;
+    std::vector<double> new_box(box_vectors);
+    for (size_t i = 0; i < new_box.size(); i++) new_box[i] *= 1.01;
+    if (use_pbc) alpha = 0.35;
+
+    elec_cached.SetNewParameters(coords, charges, chg_grad, pol, polfac, method, true, new_box, cutoff);
+    elec_cached.SetEwaldAlpha(alpha);
+    std::fill(forces_cached.begin(), forces_cached.end(), 0.0);
+    energy_cached = elec_cached.GetElectrostatics(forces_cached);
+
+    elec::Electrostatics elec_new;
+    std::vector<double> forces_new(3 * n_atoms);
+    elec_new.Initialize(charges, chg_grad, polfac, pol, coords, monomer_names, sites, first_ind, mon_type_count,
+                        islocal, atom_tag, true, 1E-16, 100, method, new_box);
+    elec_new.SetCutoff(cutoff);
+    elec_new.SetEwaldAlpha(alpha);
+    elec_new.SetEwaldGridDensity(2.5);
+    elec_new.SetEwaldSplineOrder(6);
+    double energy_new = elec_new.GetElectrostatics(forces_new);
+    std::cout << "Updated:     " << std::setw(20) << std::setprecision(12) << energy_cached << "  "
+              << std::setw(20) << std::setprecision(12) << energy_new << std::endl;
+    REQUIRE(energy_new != Approx(energy_ref).epsilon(1E-6));
+    REQUIRE(energy_cached == Approx(energy_new).epsilon(TOL));
+    for (int n = 0; n < 3 * n_atoms; ++n) REQUIRE(forces_cached[n] == Approx(forces_new[n]).margin(TOL));
+}
+
+TEST_CASE("test the dipole tensor cache of the electrostatics class (GAS).") {
+    std::vector<double> box_vectors{};
+    SECTION("CG algorithm") { run_test("cg", box_vectors); }
+    SECTION("iter algorithm") { run_test("iter", box_vectors); }
+}
+
+TEST_CASE("test the dipole tensor cache of the electrostatics class (PME).") {
+    std::vector<double> box_vectors{34, 0, 0, 0, 34, 0, 0, 0, 34};
+    SECTION("CG algorithm") { run_test("cg", box_vectors); }
+    SECTION("iter algorithm") { run_test("iter", box_vectors); }
+}
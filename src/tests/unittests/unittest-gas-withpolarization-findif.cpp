@@ -40,6 +40,7 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #include <vector>
 #include <iostream>
 #include <iomanip>
+#include <numeric>
 
 constexpr double TOL = 5E-6;
 
@@ -51,13 +52,15 @@ void run_test(const char *method) {
     double polfacH = 0.294;
     double polfacM = 0;
     SETUP_H2O_2
+    std::vector<int> atom_tag(n_atoms);
+    std::iota(atom_tag.begin(), atom_tag.end(), 1);
     double ref_energy = -0.1632261513;
 
     elec::Electrostatics elec;
     std::vector<double> box_vectors{};
 
     elec.Initialize(charges, chg_grad, polfac, pol, coords, monomer_names, sites, first_ind, mon_type_count, islocal,
-                    true, 1E-16, 100, method, box_vectors);
+                    atom_tag, true, 1E-16, 100, method, box_vectors);
     elec.SetCutoff(12);
     std::vector<double> forces(3 * n_atoms);
     double energy = elec.GetElectrostatics(forces);
@@ -72,11 +75,11 @@ void run_test(const char *method) {
     for (int degreeOfFreedom = 0; degreeOfFreedom < 3 * n_atoms; ++degreeOfFreedom) {
         coords[degreeOfFreedom] += stepSize;
         elec.Initialize(charges, chg_grad, polfac, pol, coords, monomer_names, sites, first_ind, mon_type_count,
-                        islocal, false, 1E-16, 100, method, box_vectors);
+                        islocal, atom_tag, false, 1E-16, 100, method, box_vectors);
         double plusEnergy = elec.GetElectrostatics(ignoredForces);
         coords[degreeOfFreedom] -= 2 * stepSize;
         elec.Initialize(charges, chg_grad, polfac, pol, coords, monomer_names, sites, first_ind, mon_type_count,
-                        islocal, false, 1E-16, 100, method, box_vectors);
+                        islocal, atom_tag, false, 1E-16, 100, method, box_vectors);
         double minusEnergy = elec.GetElectrostatics(ignoredForces);
         coords[degreeOfFreedom] += stepSize;
         double finiteDifferenceForce = (plusEnergy - minusEnergy) / (2 * stepSize);
@@ -95,5 +98,6 @@ void run_test(const char *method) {
 
 TEST_CASE("test the electrostatics class for coulomb and polarization terms (GAS) - finite differences.") {
     SECTION("CG algorithm") { run_test("cg"); }
+    SECTION("PCG algorithm") { run_test("pcg"); }
     SECTION("iter algorithm") { run_test("iter"); }
 }
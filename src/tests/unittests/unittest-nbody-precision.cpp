@@ -0,0 +1,155 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#include "testutils.h"
+
+#include "bblock/system.h"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Relative tolerance of the single precision polynomials
+constexpr double TOL = 1E-4;
+
+namespace {
+
+// Writes a polynomial parameter file with made up, but complete, parameters
+void WriteParams(const std::string &file, double nl_param, size_t ncoef) {
+    std::ofstream out(file.c_str());
+    out << "NL PARAMS: " << nl_param << "\nCOEFFICIENTS:";
+    for (size_t k = 0; k < ncoef; k++) out << " " << (k % 2 ? -1.0 : 1.0) * (1.0 + 0.1 * k);
+    out << "\n";
+}
+
+// Directory with the OW monomers and the parameters of their 2b, 3b and 4b
+// polynomials. It is always the same one, since the parameters are read once
+// per process.
+std::string WriteOWFiles() {
+    const std::string path = "unittest-nbody-precision-files";
+    mkdir(path.c_str(), 0755);
+
+    std::ofstream monomers((path + "/OW.json").c_str());
+    monomers << "{\"ow\" : {\"sites\" : 1, \"nat\" : 1, \"exc12\" : [], \"exc13\" : [], \"exc14\" : [], "
+             << "\"charges\" : [0.0], \"pol\" : [0.0], \"polfac\" : [1E-30], \"c6lr\" : [0.0]}}\n";
+
+    WriteParams(path + "/OW_OW.params", 0.6, 10);
+    WriteParams(path + "/OW_OW_OW.params", 0.5, 15);
+    WriteParams(path + "/OW_OW_OW_OW.params", 0.5, 39);
+    return path;
+}
+
+// Oxygens of a distorted cube, with trimers inside the 3b switch and
+// tetramers inside the 4b switch
+void SetUpSystem(bblock::System &system, const std::string &dir, const std::string &precision) {
+    const double xyz[] = {0.00, 0.00, 0.00, 2.75, 0.10, -0.05, 0.05, 2.80, 0.10, 2.70, 2.85, -0.10,
+                          -0.10, 0.05, 2.90, 2.80, -0.05, 2.70, 0.10, 2.70, 2.80, 2.95, 2.75, 2.85};
+    for (size_t i = 0; i < 8; i++) {
+        system.AddMonomer(std::vector<double>(xyz + 3 * i, xyz + 3 * i + 3), {"O"}, "ow");
+    }
+
+    std::string json = "{\"MBX\" : {\"box\" : [], \"twobody_cutoff\" : 9.0, \"threebody_cutoff\" : 4.5, "
+                       "\"fourbody_cutoff\" : 4.5, \"params_path\" : \"" + dir + "\", \"monomers_file\" : \"" +
+                       dir + "/OW.json\"";
+    if (!precision.empty()) {
+        json += ", \"fragmented_precision\" : {\"OW_OW_OW\" : \"" + precision + "\", \"OW_OW_OW_OW\" : \"" +
+                precision + "\"}";
+    }
+    json += "}}";
+    system.SetUpFromJson(json);
+}
+
+double MaxAbs(const std::vector<double> &v) {
+    double m = 0.0;
+    for (size_t i = 0; i < v.size(); i++) m = std::max(m, std::fabs(v[i]));
+    return m;
+}
+
+}  // namespace
+
+TEST_CASE("N-body polynomials in single precision") {
+    const std::string dir = WriteOWFiles();
+
+    bblock::System system_double;
+    SetUpSystem(system_double, dir, "");
+    bblock::System system_float;
+    SetUpSystem(system_float, dir, "float");
+
+    for (int n = 3; n <= 4; n++) {
+        const double energy_double = system_double.NBodyEnergy(true, n);
+        const std::vector<double> grad_double = system_double.GetGrads();
+        const double energy_float = system_float.NBodyEnergy(true, n);
+        const std::vector<double> grad_float = system_float.GetGrads();
+
+        // The configuration must exercise the polynomial
+        REQUIRE(std::fabs(energy_double) > 1E-3);
+        const double grad_scale = MaxAbs(grad_double);
+        REQUIRE(grad_scale > 1E-3);
+
+        SECTION("Energies and gradients agree with double precision, N = " + std::to_string(n)) {
+            // The system in float does take the single precision path
+            REQUIRE(energy_float != energy_double);
+            REQUIRE(energy_float == Approx(energy_double).epsilon(TOL));
+            REQUIRE(VectorsAreEqual(grad_float, grad_double, TOL * grad_scale));
+        }
+
+        SECTION("The precision is selected per system, N = " + std::to_string(n)) {
+            // The system in double is not affected by the one in float
+            REQUIRE(system_double.NBodyEnergy(true, n) == energy_double);
+            REQUIRE(system_double.GetGrads() == grad_double);
+        }
+
+        SECTION("CheckNBodyPrecision, N = " + std::to_string(n)) {
+            std::vector<double> diff = system_float.CheckNBodyPrecision(n);
+            REQUIRE(diff.size() == 3);
+            REQUIRE(diff[0] == Approx(std::fabs(energy_float - energy_double)).margin(1E-12));
+            REQUIRE(diff[0] > 0.0);
+            REQUIRE(diff[0] <= TOL * std::fabs(energy_double));
+            REQUIRE(diff[1] <= TOL * diff[2]);
+            REQUIRE(diff[2] == Approx(grad_scale).epsilon(1E-12));
+
+            // The results of the selected precision are kept
+            REQUIRE(system_float.GetGrads() == grad_float);
+
+            // A system in double precision has no error
+            std::vector<double> no_diff = system_double.CheckNBodyPrecision(n);
+            REQUIRE(no_diff[0] == 0.0);
+            REQUIRE(no_diff[1] == 0.0);
+        }
+    }
+}
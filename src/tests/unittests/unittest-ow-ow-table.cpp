@@ -0,0 +1,129 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#include "testutils.h"
+
+#include "potential/2b/OW_OW.h"
+#include "potential/fragmented/ParamRegistry.h"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Largest error of the table, relative to the largest energy or gradient
+constexpr double TOL = 1E-6;
+
+TEST_CASE("Table of the OW_OW polynomial") {
+    // Parameters of test/OW_OW.params
+    const std::string dir = "unittest-ow-ow-table-files";
+    mkdir(dir.c_str(), 0755);
+    {
+        std::ofstream params((dir + "/OW_OW.params").c_str());
+        params << "NL PARAMS: 6.42434053e-01\n"
+               << "COEFFICIENTS: -1.07718768e+01 -7.41234427e+02 2.50160216e+04 -2.18259380e+05 5.30285666e+05 "
+               << "1.80258622e+05 -1.08040086e+01 -2.06988416e+04 -1.08509642e+04 -3.93263958e+03\n";
+    }
+    ParamRegistry::set_search_path(std::vector<std::string>(1, dir));
+
+    const OW_OW_namespace::OW_OW pot("ow", "ow");
+    const Polynomial &poly = ParamRegistry::get_polynomial("OW_OW");
+    const double ro = pot.get_ro();
+    REQUIRE(ro == poly.get_ro());
+
+    SECTION("The table reproduces the polynomial in its range") {
+        tools::RadialTableError error = pot.check_table(7);
+        REQUIRE(error.max_value > 0.0);
+        REQUIRE(error.value <= TOL * error.max_value);
+        REQUIRE(error.derivative <= TOL * error.max_derivative);
+    }
+
+    SECTION("Energies and gradients of dimers agree with the polynomial") {
+        // Dimers from overlapping monomers to beyond the cutoff, along a
+        // direction that is not a coordinate axis
+        const size_t ndim = 2000;
+        const double u[3] = {0.48, -0.6, 0.64};
+        std::vector<double> xyz0(3 * ndim), xyz1(3 * ndim);
+        for (size_t i = 0; i < ndim; i++) {
+            const double r = (ro + 1.0) * i / (ndim - 1);
+            for (size_t k = 0; k < 3; k++) {
+                xyz0[3 * i + k] = 0.1 * k;
+                xyz1[3 * i + k] = 0.1 * k + r * u[k];
+            }
+        }
+
+        std::vector<double> grad0(3 * ndim, 0.0), grad1(3 * ndim, 0.0);
+        std::vector<double> virial(9, 0.0);
+        const double energy = pot.eval(xyz0.data(), xyz1.data(), grad0.data(), grad1.data(), ndim, &virial);
+        REQUIRE(energy == Approx(pot.eval(xyz0.data(), xyz1.data(), ndim)).epsilon(1E-14));
+
+        std::vector<double> scratch(poly.get_scratch_size());
+        std::vector<double> energies(ndim), ref_grad0(3 * ndim, 0.0), ref_grad1(3 * ndim, 0.0);
+        double ref_energy = 0.0;
+        double max_energy = 0.0;
+        double max_grad = 0.0;
+        for (size_t i = 0; i < ndim; i++) {
+            double xyz[6], grad[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+            std::copy(xyz0.begin() + 3 * i, xyz0.begin() + 3 * i + 3, xyz);
+            std::copy(xyz1.begin() + 3 * i, xyz1.begin() + 3 * i + 3, xyz + 3);
+            energies[i] = poly.eval_gradient(xyz, grad, 0, scratch.data());
+            ref_energy += energies[i];
+            max_energy = std::max(max_energy, std::fabs(energies[i]));
+            // The direction, and so the gradient of the polynomial, is not
+            // defined for monomers on top of each other
+            if (i == 0) continue;
+            for (size_t k = 0; k < 3; k++) {
+                ref_grad0[3 * i + k] = grad[k];
+                ref_grad1[3 * i + k] = grad[3 + k];
+                max_grad = std::max(max_grad, std::fabs(grad[k]));
+            }
+        }
+
+        // The errors of the dimers add up
+        REQUIRE(energy == Approx(ref_energy).margin(ndim * TOL * max_energy));
+        REQUIRE(VectorsAreEqual(grad0, ref_grad0, TOL * max_grad));
+        REQUIRE(VectorsAreEqual(grad1, ref_grad1, TOL * max_grad));
+
+        // Monomers on top of each other have a finite energy and no gradient
+        REQUIRE(std::isfinite(energy));
+        for (size_t k = 0; k < 3; k++) {
+            REQUIRE(grad0[k] == 0.0);
+            REQUIRE(grad1[k] == 0.0);
+        }
+        for (size_t k = 0; k < 9; k++) REQUIRE(std::isfinite(virial[k]));
+    }
+}
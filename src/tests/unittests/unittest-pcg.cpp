@@ -0,0 +1,97 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#include "Catch2/single_include/catch.hpp"
+
+#include "potential/electrostatics/electrostatics.h"
+#include "setup_h2o_2.h"
+
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+
+// Compares the electrostatics of a water dimer with PCG and CG, in gas phase
+// if the box is empty and with PME otherwise
+void compare_pcg(double pol_scale, const std::vector<double> &box_vectors, double tol) {
+    // TIP3P test
+    double qO = -0.834;
+    double qH = 0.417;
+    double qM = 0;
+    double polfacO = 1.310;
+    double polfacH = 0.294;
+    double polfacM = 0;
+    SETUP_H2O_2
+    std::vector<int> atom_tag(n_atoms);
+    std::iota(atom_tag.begin(), atom_tag.end(), 1);
+
+    // Scale the polarizabilities of the first monomer, leaving the damping unchanged
+    for (size_t i = 0; i < sites[0]; i++) pol[i] *= pol_scale;
+
+    double alpha = box_vectors.size() ? 0.3 : 0.0;
+    double grid_density = 2;
+    int spline_order = 6;
+    double cutoff = 10;
+
+    std::vector<double> energies;
+    std::vector<std::vector<double>> forces;
+    for (const char *method : {"cg", "pcg"}) {
+        elec::Electrostatics elec;
+        elec.Initialize(charges, chg_grad, polfac, pol, coords, monomer_names, sites, first_ind, mon_type_count,
+                        islocal, atom_tag, true, 1E-16, 100, method, box_vectors);
+        elec.SetCutoff(cutoff);
+        elec.SetEwaldAlpha(alpha);
+        elec.SetEwaldGridDensity(grid_density);
+        elec.SetEwaldSplineOrder(spline_order);
+        forces.push_back(std::vector<double>(3 * n_atoms));
+        energies.push_back(elec.GetElectrostatics(forces.back()));
+    }
+
+    std::cout << "pol scale " << pol_scale << ": cg " << std::setw(16) << std::setprecision(10) << energies[0]
+              << "  pcg " << std::setw(16) << std::setprecision(10) << energies[1] << std::endl;
+    REQUIRE(energies[1] == Approx(energies[0]).margin(tol));
+    for (int n = 0; n < 3 * n_atoms; ++n) REQUIRE(forces[1][n] == Approx(forces[0][n]).margin(tol));
+}
+
+TEST_CASE("test the electrostatics class for coulomb and polarization terms - PCG against CG.") {
+    const std::vector<double> gas{};
+    const std::vector<double> pme{30, 0, 0, 0, 30, 0, 0, 0, 30};
+
+    SECTION("water dimer (GAS)") { compare_pcg(1.0, gas, 5E-6); }
+    SECTION("water dimer (PME)") { compare_pcg(1.0, pme, 1E-8); }
+    // Close to the polarization catastrophe of the first monomer: the smallest
+    // eigenvalue of its intramolecular block is about 3e-3
+    SECTION("near-singular block (GAS)") { compare_pcg(1.667, gas, 5E-6); }
+    SECTION("near-singular block (PME)") { compare_pcg(1.667, pme, 1E-8); }
+}
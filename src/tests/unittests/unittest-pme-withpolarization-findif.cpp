@@ -40,6 +40,7 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #include <vector>
 #include <iostream>
 #include <iomanip>
+#include <numeric>
 
 constexpr double TOL = 1E-8;
 
@@ -52,6 +53,8 @@ void run_test(const char *method) {
     double polfacH = 0.294;
     double polfacM = 0;
     SETUP_H2O_2
+    std::vector<int> atom_tag(n_atoms);
+    std::iota(atom_tag.begin(), atom_tag.end(), 1);
     double ref_energy = -0.1752818171;
 
     elec::Electrostatics elec;
@@ -65,7 +68,7 @@ void run_test(const char *method) {
     int spline_order = 6;
     double cutoff = 10;
     elec.Initialize(charges, chg_grad, polfac, pol, coords, monomer_names, sites, first_ind, mon_type_count, islocal,
-                    true, 1E-16, 100, method, box_vectors);
+                    atom_tag, true, 1E-16, 100, method, box_vectors);
     elec.SetCutoff(cutoff);
     elec.SetEwaldAlpha(alpha);
     elec.SetEwaldGridDensity(grid_density);
@@ -83,7 +86,7 @@ void run_test(const char *method) {
     for (int degreeOfFreedom = 0; degreeOfFreedom < 3 * n_atoms; ++degreeOfFreedom) {
         coords[degreeOfFreedom] += stepSize;
         elec.Initialize(charges, chg_grad, polfac, pol, coords, monomer_names, sites, first_ind, mon_type_count,
-                        islocal, false, 1E-16, 100, method, box_vectors);
+                        islocal, atom_tag, false, 1E-16, 100, method, box_vectors);
         elec.SetCutoff(cutoff);
         elec.SetEwaldAlpha(alpha);
         elec.SetEwaldGridDensity(grid_density);
@@ -91,7 +94,7 @@ void run_test(const char *method) {
         double plusEnergy = elec.GetElectrostatics(ignoredForces);
         coords[degreeOfFreedom] -= 2 * stepSize;
         elec.Initialize(charges, chg_grad, polfac, pol, coords, monomer_names, sites, first_ind, mon_type_count,
-                        islocal, false, 1E-16, 100, method, box_vectors);
+                        islocal, atom_tag, false, 1E-16, 100, method, box_vectors);
         elec.SetCutoff(cutoff);
         elec.SetEwaldAlpha(alpha);
         elec.SetEwaldGridDensity(grid_density);
@@ -114,5 +117,6 @@ void run_test(const char *method) {
 
 TEST_CASE("test the electrostatics class for coulomb and polarization terms (PME) - finite differences.") {
     SECTION("CG algorithm") { run_test("cg"); }
+    SECTION("PCG algorithm") { run_test("pcg"); }
     SECTION("iter algorithm") { run_test("iter"); }
 }
@@ -40,6 +40,7 @@ SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
 #include <vector>
 #include <iostream>
 #include <iomanip>
+#include <numeric>
 
 constexpr double TOL = 5e-5;
 
@@ -52,6 +53,8 @@ void run_test(const char *method) {
     double polfacH = 0.294;
     double polfacM = 0;
     SETUP_H2O_216
+    std::vector<int> atom_tag(n_atoms);
+    std::iota(atom_tag.begin(), atom_tag.end(), 1);
     double ref_energy = -2531.4416733178;
 
     elec::Electrostatics elec;
@@ -63,7 +66,7 @@ void run_test(const char *method) {
     // alpha = 0.3
 
     elec.Initialize(charges, chg_grad, polfac, pol, coords, monomer_names, sites, first_ind, mon_type_count, islocal,
-                    true, 1E-16, 100, method, box_vectors);
+                    atom_tag, true, 1E-16, 100, method, box_vectors);
     elec.SetCutoff(16.5);
     elec.SetEwaldAlpha(0.25);
     elec.SetEwaldGridDensity(2.5);
@@ -74,7 +77,7 @@ void run_test(const char *method) {
 
     // alpha = 0.4
     elec.Initialize(charges, chg_grad, polfac, pol, coords, monomer_names, sites, first_ind, mon_type_count, islocal,
-                    true, 1E-16, 100, method, box_vectors);
+                    atom_tag, true, 1E-16, 100, method, box_vectors);
     elec.SetCutoff(13);
     elec.SetEwaldAlpha(0.35);
     elec.SetEwaldGridDensity(3);
@@ -86,7 +89,7 @@ void run_test(const char *method) {
 
     // alpha = 0.5
     elec.Initialize(charges, chg_grad, polfac, pol, coords, monomer_names, sites, first_ind, mon_type_count, islocal,
-                    true, 1E-16, 100, method, box_vectors);
+                    atom_tag, true, 1E-16, 100, method, box_vectors);
     elec.SetCutoff(10);
     elec.SetEwaldAlpha(0.45);
     elec.SetEwaldGridDensity(3.5);
@@ -117,5 +120,6 @@ void run_test(const char *method) {
 }
 TEST_CASE("test the electrostatics class for only coulomb terms (PME) - ewald alpha sweep.") {
     SECTION("CG algorithm") { run_test("cg"); }
+    SECTION("PCG algorithm") { run_test("pcg"); }
     SECTION("iter algorithm") { run_test("iter"); }
 }
@@ -0,0 +1,121 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#include "testutils.h"
+
+#include "tools/radial_table.h"
+#include "tools/custom_exceptions.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+// Damped oscillation, with its derivative. Its fourth derivative is at most
+// (0.5^2 + 2^2)^2 exp(-0.5 r).
+double Function(double r, double &dfdr) {
+    const double e = std::exp(-0.5 * r);
+    dfdr = e * (std::cos(2.0 * r) * 2.0 - 0.5 * std::sin(2.0 * r));
+    return e * std::sin(2.0 * r);
+}
+
+}  // namespace
+
+TEST_CASE("Radial table of a known function") {
+    const double rmin = 1.0;
+    const double rmax = 6.0;
+    const size_t nintervals = 500;
+    const double h = (rmax - rmin) / nintervals;
+
+    tools::RadialTable table;
+    REQUIRE(table.IsEmpty());
+    table.Build(Function, rmin, rmax, nintervals);
+    REQUIRE(!table.IsEmpty());
+    REQUIRE(table.GetRmin() == rmin);
+    REQUIRE(table.GetRmax() == rmax);
+
+    SECTION("Exact at the samples") {
+        for (size_t i = 0; i <= nintervals; i++) {
+            const double r = rmin + i * h;
+            double df, dt;
+            const double vf = Function(r, df);
+            const double vt = table.Eval(r, dt);
+            REQUIRE(vt == Approx(vf).margin(1E-14));
+            REQUIRE(dt == Approx(df).margin(1E-12));
+        }
+    }
+
+    SECTION("Errors within the bounds of cubic Hermite interpolation") {
+        // |f - p| <= h^4 max|f''''| / 384 and |f' - p'| <= sqrt(3) h^3 max|f''''| / 216
+        const double max_d4 = std::pow(0.25 + 4.0, 2) * std::exp(-0.5 * rmin);
+        const double value_bound = std::pow(h, 4) * max_d4 / 384.0;
+        const double derivative_bound = std::sqrt(3.0) * std::pow(h, 3) * max_d4 / 216.0;
+
+        tools::RadialTableError error = table.CheckError(Function, 7);
+        REQUIRE(error.value <= value_bound);
+        REQUIRE(error.derivative <= derivative_bound);
+        REQUIRE(error.value > 0.0);
+        REQUIRE(error.r_value >= rmin);
+        REQUIRE(error.r_value <= rmax);
+        REQUIRE(error.max_value > 0.5);
+        REQUIRE(error.max_derivative > 1.0);
+
+        // Also at points that are not the ones of CheckError
+        for (size_t k = 0; k < 10000; k++) {
+            const double r = rmin + (rmax - rmin) * (k + 0.37) / 10000;
+            double df, dt;
+            const double vf = Function(r, df);
+            const double vt = table.Eval(r, dt);
+            REQUIRE(std::fabs(vt - vf) <= value_bound);
+            REQUIRE(std::fabs(dt - df) <= derivative_bound);
+        }
+    }
+
+    SECTION("Fourth order convergence") {
+        tools::RadialTable fine;
+        fine.Build(Function, rmin, rmax, 2 * nintervals);
+        const double coarse_error = table.CheckError(Function, 7).value;
+        const double fine_error = fine.CheckError(Function, 7).value;
+        REQUIRE(coarse_error / fine_error == Approx(16.0).epsilon(0.1));
+    }
+
+    SECTION("Invalid samples") {
+        std::vector<double> one(1, 0.0);
+        std::vector<double> two(2, 0.0);
+        std::vector<double> three(3, 0.0);
+        REQUIRE_THROWS_AS(table.SetSamples(rmin, rmax, one, one), CUException);
+        REQUIRE_THROWS_AS(table.SetSamples(rmin, rmax, two, three), CUException);
+        REQUIRE_THROWS_AS(table.SetSamples(rmax, rmin, two, two), CUException);
+    }
+}
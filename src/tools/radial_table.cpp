@@ -0,0 +1,76 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#include "tools/radial_table.h"
+#include "tools/custom_exceptions.h"
+
+/**
+ * @file radial_table.cpp
+ * @brief Implementation of the tables of radial pair potentials
+ */
+
+namespace tools {
+
+RadialTable::RadialTable() : rmin_(0.0), rmax_(0.0), h_(0.0), inv_h_(0.0) {}
+
+void RadialTable::SetSamples(double rmin, double rmax, const std::vector<double> &values,
+                             const std::vector<double> &derivatives) {
+    if (values.size() < 2 || values.size() != derivatives.size() || !(rmax > rmin)) {
+        std::string text = "A radial table needs at least two samples, with their derivatives, in a nonempty range.";
+        throw CUException(__func__, __FILE__, __LINE__, text);
+    }
+
+    const size_t nintervals = values.size() - 1;
+    rmin_ = rmin;
+    rmax_ = rmax;
+    h_ = (rmax - rmin) / nintervals;
+    inv_h_ = 1.0 / h_;
+
+    // Cubic Hermite interpolation between the samples i and i + 1, with
+    // the derivatives scaled to the unit interval
+    coefficients_.resize(4 * nintervals);
+    for (size_t i = 0; i < nintervals; i++) {
+        const double f0 = values[i];
+        const double f1 = values[i + 1];
+        const double m0 = derivatives[i] * h_;
+        const double m1 = derivatives[i + 1] * h_;
+        double *c = coefficients_.data() + 4 * i;
+        c[0] = f0;
+        c[1] = m0;
+        c[2] = 3.0 * (f1 - f0) - 2.0 * m0 - m1;
+        c[3] = 2.0 * (f0 - f1) + m0 + m1;
+    }
+}
+
+}  // namespace tools
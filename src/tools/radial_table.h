@@ -0,0 +1,212 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#ifndef RADIAL_TABLE_H
+#define RADIAL_TABLE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @file radial_table.h
+ * @brief Tabulation of radial pair potentials with cubic Hermite splines
+ */
+
+namespace tools {
+
+/**
+ * @brief Largest difference between a table and the function it tabulates
+ */
+struct RadialTableError {
+    /**
+     * Largest absolute error of the value
+     */
+    double value;
+
+    /**
+     * Distance where the largest error of the value is
+     */
+    double r_value;
+
+    /**
+     * Largest absolute error of the derivative
+     */
+    double derivative;
+
+    /**
+     * Distance where the largest error of the derivative is
+     */
+    double r_derivative;
+
+    /**
+     * Largest absolute value of the function in the range of the table
+     */
+    double max_value;
+
+    /**
+     * Largest absolute value of the derivative in the range of the table
+     */
+    double max_derivative;
+};
+
+/**
+ * @brief Table of a function of the distance f(r) in [rmin, rmax].
+ *
+ * The function and its derivative are sampled once on a uniform grid and
+ * interpolated with a cubic Hermite spline, so both the value and the
+ * derivative are continuous. Evaluating the table costs the same for any
+ * function, which makes it useful for pair potentials whose analytic form
+ * is expensive, like the OW 2b polynomial or damped dispersion.
+ */
+class RadialTable {
+   public:
+    /**
+     * Default constructor. Creates an empty table.
+     */
+    RadialTable();
+
+    /**
+     * @brief Samples a function and builds the table.
+     * @param[in] f Function of the distance. f(r, dfdr) returns the value
+     * and stores the derivative in dfdr.
+     * @param[in] rmin Smallest distance of the table
+     * @param[in] rmax Largest distance of the table
+     * @param[in] nintervals Number of intervals of the grid
+     */
+    template <class F>
+    void Build(F f, double rmin, double rmax, size_t nintervals) {
+        std::vector<double> values(nintervals + 1);
+        std::vector<double> derivatives(nintervals + 1);
+        const double h = (rmax - rmin) / nintervals;
+        for (size_t i = 0; i <= nintervals; i++) values[i] = f(rmin + i * h, derivatives[i]);
+        SetSamples(rmin, rmax, values, derivatives);
+    }
+
+    /**
+     * @brief Compares the table with the function it was built from.
+     * @param[in] f Function of the distance, as in Build
+     * @param[in] nsamples Number of points checked inside each interval
+     * @return Largest errors of the value and of the derivative
+     */
+    template <class F>
+    RadialTableError CheckError(F f, size_t nsamples) const {
+        RadialTableError error = {0.0, rmin_, 0.0, rmin_, 0.0, 0.0};
+        const size_t nintervals = coefficients_.size() / 4;
+        for (size_t i = 0; i < nintervals; i++) {
+            for (size_t s = 0; s <= nsamples; s++) {
+                const double r = rmin_ + (i + double(s) / (nsamples + 1)) * h_;
+                double df, dt;
+                const double vf = f(r, df);
+                const double vt = Eval(r, dt);
+                error.max_value = std::max(error.max_value, std::fabs(vf));
+                error.max_derivative = std::max(error.max_derivative, std::fabs(df));
+                if (std::fabs(vf - vt) > error.value) {
+                    error.value = std::fabs(vf - vt);
+                    error.r_value = r;
+                }
+                if (std::fabs(df - dt) > error.derivative) {
+                    error.derivative = std::fabs(df - dt);
+                    error.r_derivative = r;
+                }
+            }
+        }
+        return error;
+    }
+
+    /**
+     * @brief Builds the table from samples on a uniform grid.
+     * @param[in] rmin Distance of the first sample
+     * @param[in] rmax Distance of the last sample
+     * @param[in] values Values of the function at the samples
+     * @param[in] derivatives Derivatives of the function at the samples
+     */
+    void SetSamples(double rmin, double rmax, const std::vector<double> &values,
+                    const std::vector<double> &derivatives);
+
+    /**
+     * @return True if the table has not been built
+     */
+    bool IsEmpty() const { return coefficients_.empty(); }
+
+    /**
+     * @return Smallest distance of the table
+     */
+    double GetRmin() const { return rmin_; }
+
+    /**
+     * @return Largest distance of the table
+     */
+    double GetRmax() const { return rmax_; }
+
+    /**
+     * @brief Interpolates the function.
+     * @param[in] r Distance. Must be in [rmin, rmax].
+     * @param[out] dfdr Derivative of the function
+     * @return Value of the function
+     */
+    double Eval(double r, double &dfdr) const {
+        const double x = (r - rmin_) * inv_h_;
+        size_t i = static_cast<size_t>(x);
+        if (i >= coefficients_.size() / 4) i = coefficients_.size() / 4 - 1;
+        const double t = x - i;
+        const double *c = coefficients_.data() + 4 * i;
+        dfdr = (c[1] + t * (2.0 * c[2] + t * 3.0 * c[3])) * inv_h_;
+        return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+    }
+
+   private:
+    /**
+     * Range of the table
+     */
+    double rmin_;
+    double rmax_;
+
+    /**
+     * Width of the intervals, and its inverse
+     */
+    double h_;
+    double inv_h_;
+
+    /**
+     * Coefficients of the cubic of each interval, in powers of the
+     * position t in [0, 1] inside the interval. 4 per interval.
+     */
+    std::vector<double> coefficients_;
+};
+
+}  // namespace tools
+
+#endif  // RADIAL_TABLE_H
@@ -0,0 +1,147 @@
+/******************************************************************************
+Copyright 2019 The Regents of the University of California.
+All Rights Reserved.
+
+Permission to copy, modify and distribute any part of this Software for
+educational, research and non-profit purposes, without fee, and without
+a written agreement is hereby granted, provided that the above copyright
+notice, this paragraph and the following three paragraphs appear in all
+copies.
+
+Those desiring to incorporate this Software into commercial products or
+use for commercial purposes should contact the:
+Office of Innovation & Commercialization
+University of California, San Diego
+9500 Gilman Drive, Mail Code 0910
+La Jolla, CA 92093-0910
+Ph: (858) 534-5815
+FAX: (858) 534-7345
+E-MAIL: invent@ucsd.edu
+
+IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY PARTY FOR
+DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES, INCLUDING
+LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE, EVEN IF THE UNIVERSITY
+OF CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND THE UNIVERSITY OF
+CALIFORNIA HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES,
+ENHANCEMENTS, OR MODIFICATIONS. THE UNIVERSITY OF CALIFORNIA MAKES NO
+REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER IMPLIED OR
+EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE, OR THAT THE USE OF THE
+SOFTWARE WILL NOT INFRINGE ANY PATENT, TRADEMARK OR OTHER RIGHTS.
+******************************************************************************/
+
+#ifndef SOLVER_CACHE_H
+#define SOLVER_CACHE_H
+
+#include <memory>
+#include <vector>
+
+/**
+ * @file solver_cache.h
+ * @brief Owner of a solver that is kept between calls of its owner
+ */
+
+namespace tools {
+
+/**
+ * @brief Owns a solver that an object keeps between calls, such as a PME
+ * solver, without making the object non-copyable.
+ *
+ * A copy of the cache is empty, so the copy of the owner sets up its own
+ * solver on first use instead of sharing, or requiring the copy of, the one
+ * of the original.
+ */
+template <typename T>
+class SolverCache {
+   public:
+    SolverCache() {}
+    SolverCache(const SolverCache &) {}
+    SolverCache &operator=(const SolverCache &) {
+        reset();
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the solver
+     * @param[in] solver New solver, owned by the cache from now on
+     */
+    void reset(T *solver = 0) {
+        solver_.reset(solver);
+        params_.clear();
+    }
+
+    /**
+     * @brief Gets the PME solver (helpme::PMEInstance), set up for the given
+     * Ewald parameters and cell.
+     *
+     * The solver is only created again when a parameter other than the cell
+     * changes. helpme only updates the terms that depend on the cell when the
+     * cell changes, and the grids are allocated once and reused.
+     * @param[in] r_power Exponent of the interaction (1 for Coulomb, 6 for dispersion)
+     * @param[in] scale Scale factor of the interaction
+     * @param[in] kappa Attenuation parameter
+     * @param[in] order Spline order
+     * @param[in] grid_density Number of grid points per unit of length of the cell
+     * @param[in] user_fft_grid FFT grid given by the user. Empty to use the default.
+     * @param[in] parallel If true, the solver is distributed over the MPI processes
+     * @param[in] comm MPI communicator. Only used if parallel is true.
+     * @param[in] proc_x,proc_y,proc_z Number of processes in each direction. Only used if parallel is true.
+     * @param[in] A,B,C Lengths of the cell vectors
+     * @param[in] alpha,beta,gamma Angles of the cell, in degrees
+     * @return Reference to the solver
+     */
+    template <typename Comm>
+    T &Get(int r_power, double scale, double kappa, int order, double grid_density,
+           const std::vector<int> &user_fft_grid, bool parallel, const Comm &comm, size_t proc_x, size_t proc_y,
+           size_t proc_z, double A, double B, double C, double alpha, double beta, double gamma) {
+        int grid_A = grid_density * A;
+        int grid_B = grid_density * B;
+        int grid_C = grid_density * C;
+
+        // Everything the setup depends on, other than the cell
+        std::vector<double> params = {double(r_power), scale,          kappa,          double(order),
+                                      double(grid_A),  double(grid_B), double(grid_C), double(parallel)};
+        if (parallel) {
+            params.push_back(proc_x);
+            params.push_back(proc_y);
+            params.push_back(proc_z);
+        }
+        params.insert(params.end(), user_fft_grid.begin(), user_fft_grid.end());
+
+        if (!solver_ || params != params_) {
+            solver_.reset(new T());
+            if (user_fft_grid.size()) solver_->SetFFTDimension(user_fft_grid);
+            if (parallel) {
+                solver_->setupParallel(r_power, kappa, order, grid_A, grid_B, grid_C, scale, 0, comm,
+                                       T::NodeOrder::ZYX, proc_x, proc_y, proc_z);
+            } else {
+                solver_->setup(r_power, kappa, order, grid_A, grid_B, grid_C, scale, 0);
+            }
+            params_ = params;
+        }
+
+        // Does nothing if the cell has not changed
+        solver_->setLatticeVectors(A, B, C, alpha, beta, gamma, T::LatticeType::XAligned);
+
+        return *solver_;
+    }
+
+    /**
+     * @return True if the cache holds a solver
+     */
+    explicit operator bool() const { return static_cast<bool>(solver_); }
+
+    T &operator*() const { return *solver_; }
+    T *operator->() const { return solver_.get(); }
+
+   private:
+    std::unique_ptr<T> solver_;
+    // Parameters used to set up solver_ in Get
+    std::vector<double> params_;
+};
+
+}  // namespace tools
+
+#endif  // SOLVER_CACHE_H